@@ -0,0 +1,144 @@
+/*
+*  MIT License
+*
+*  Copyright (c) 2025 Alexander Fedorov
+*
+*  Permission is hereby granted, free of charge, to any person obtaining a copy
+*  of this software and associated documentation files (the "Software"), to deal
+*  in the Software without restriction, including without limitation the rights
+*  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*  copies of the Software, and to permit persons to whom the Software is
+*  furnished to do so, subject to the following conditions:
+*
+*  The above copyright notice and this permission notice shall be included in all
+*  copies or substantial portions of the Software.
+*
+*  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*  SOFTWARE.
+*/
+
+/* Binary log (user32.blog) decoder. Prints messages in the same format as text log (user32.log).
+   Usage: blogdec [user32.blog] */
+
+#include "logging.hpp"
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <cstring>
+#include <map>
+
+struct Site
+{
+  std::string source;
+  std::size_t nArgs;
+  logging::ArgKind kinds[logging::LogRecord::maxArgs];
+  std::vector<std::string> literals;
+};
+
+
+template <class T>
+T read(std::istream & is)
+{
+  T v;
+  if (!is.read(reinterpret_cast<char *>(&v), sizeof(v)))
+    throw std::runtime_error("Unexpected end of file");
+  return v;
+}
+
+
+std::string read_str(std::istream & is)
+{
+  auto const len = read<uint16_t>(is);
+  std::string s (len, '\0');
+  if (len != 0 && !is.read(&s[0], len))
+    throw std::runtime_error("Unexpected end of file");
+  return s;
+}
+
+
+void decode(std::istream & is, std::ostream & os)
+{
+  char magic[sizeof(logging::BinaryLogPrinter::magic)];
+  if (!is.read(magic, sizeof(magic)) || std::memcmp(magic, logging::BinaryLogPrinter::magic, sizeof(magic)) != 0)
+    throw std::runtime_error("Not a binary log");
+  auto const version = read<uint32_t>(is);
+  if (version != logging::BinaryLogPrinter::version)
+    throw std::runtime_error(stream_to_str("Unsupported binary log version: ", version));
+
+  std::map<uint32_t, Site> sites;
+  logging::LogRecord lr;
+  StrBuffer<logging::StreamLogPrinter::maxLineSize> msg, line;
+  while (is.peek() != std::char_traits<char>::eof())
+  {
+    auto const tag = read<uint8_t>(is);
+    if (tag == logging::BinaryLogPrinter::tagSite)
+    {
+      auto const id = read<uint32_t>(is);
+      Site & site = sites[id];
+      site.source = read_str(is);
+      site.nArgs = read<uint8_t>(is);
+      if (site.nArgs > logging::LogRecord::maxArgs)
+        throw std::runtime_error(stream_to_str("Too many arguments in site ", id));
+      site.literals.assign(site.nArgs, std::string());
+      for (std::size_t i = 0; i < site.nArgs; ++i)
+      {
+        site.kinds[i] = read<logging::ArgKind>(is);
+        if (site.kinds[i] > logging::ArgKind::string)
+          throw std::runtime_error(stream_to_str("Bad argument kind in site ", id));
+        if (site.kinds[i] == logging::ArgKind::literal)
+          site.literals[i] = read_str(is);
+      }
+    }
+    else if (tag == logging::BinaryLogPrinter::tagMessage)
+    {
+      auto const id = read<uint32_t>(is);
+      auto const it = sites.find(id);
+      if (it == sites.end())
+        throw std::runtime_error(stream_to_str("Unknown site: ", id));
+      Site const & site = it->second;
+      auto const level = static_cast<logging::LogLevel>(read<uint8_t>(is));
+      auto const time = static_cast<std::time_t>(read<int64_t>(is));
+      lr.reset(site.source.c_str(), level, time);
+      lr.nArgs = site.nArgs;
+      for (std::size_t i = 0; i < site.nArgs; ++i)
+      {
+        lr.kinds[i] = site.kinds[i];
+        lr.literals[i] = site.literals[i].c_str();
+      }
+      lr.payloadSize = read<uint16_t>(is);
+      if (lr.payloadSize > logging::LogRecord::maxPayload || !is.read(reinterpret_cast<char *>(lr.payload), lr.payloadSize))
+        throw std::runtime_error(stream_to_str("Bad payload in message of site ", id));
+
+      msg.clear();
+      logging::print_args(msg, lr);
+      logging::LogMessage const lm (lr.source, lr.level, lr.time, msg.str());
+      line.clear();
+      logging::format_default(line, lm);
+      os.write(line.data(), line.size()) << '\n';
+    }
+    else
+      throw std::runtime_error(stream_to_str("Bad record tag: ", static_cast<int>(tag)));
+  }
+}
+
+
+int main(int argc, char ** argv)
+try {
+  char const * path = argc > 1 ? argv[1] : "user32.blog";
+  std::ifstream is (path, std::ios::in|std::ios::binary);
+  if (!is.is_open())
+    throw std::runtime_error(stream_to_str("Failed to open: ", path));
+  decode(is, std::cout);
+  return 0;
+} catch (std::exception const & e)
+{
+  std::cerr << e.what() << std::endl;
+  return 1;
+}
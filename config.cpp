@@ -0,0 +1,605 @@
+/*
+*  MIT License
+*
+*  Copyright (c) 2025 Alexander Fedorov
+*
+*  Permission is hereby granted, free of charge, to any person obtaining a copy
+*  of this software and associated documentation files (the "Software"), to deal
+*  in the Software without restriction, including without limitation the rights
+*  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*  copies of the Software, and to permit persons to whom the Software is
+*  furnished to do so, subject to the following conditions:
+*
+*  The above copyright notice and this permission notice shall be included in all
+*  copies or substantial portions of the Software.
+*
+*  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*  SOFTWARE.
+*/
+
+#include "logging.hpp"
+#include "config.hpp"
+#include "vkeys.hpp"
+
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <cmath>
+#include <algorithm>
+#include <initializer_list>
+#include <limits>
+
+namespace config
+{
+
+config_t load(std::string const & path)
+{
+  std::ifstream is (path, std::ios::in|std::ios::binary);
+  if (!is.is_open())
+    throw std::runtime_error(stream_to_str("Failed to load config from: ", path));
+  std::string const text ((std::istreambuf_iterator<char>(is)), std::istreambuf_iterator<char>());
+  return nlohmann::json::parse(text, nullptr, true, true);
+}
+
+}//config
+
+
+namespace config
+{
+
+/* Reads values from json object, reporting errors with path to value, and keeps track of
+   keys that were read, so that unknown ones can be reported. */
+class ObjectReader
+{
+public:
+  config_t const * find(char const * key)
+  {
+    read_.push_back(key);
+    auto const it = object_.find(key);
+    return it == object_.end() ? nullptr : &*it;
+  }
+
+  config_t const & at(char const * key)
+  {
+    auto const p = find(key);
+    if (p == nullptr)
+      throw std::runtime_error(stream_to_str(path_, ": missing key \"", key, "\""));
+    return *p;
+  }
+
+  template <class R>
+  R get(char const * key)
+  {
+    return convert<R>(at(key), key);
+  }
+
+  template <class R>
+  R get_d(char const * key, R const & dfault)
+  {
+    auto const p = find(key);
+    return p == nullptr ? dfault : convert<R>(*p, key);
+  }
+
+  /* Counts and sizes must be non-negative integers that fit in R. */
+  template <class R>
+  R get_count_d(char const * key, R const & dfault)
+  {
+    auto const p = find(key);
+    if (p == nullptr)
+      return dfault;
+    if (!p->is_number_unsigned() || p->get<uint64_t>() > std::numeric_limits<R>::max())
+      throw std::runtime_error(stream_to_str(path(key), ": non-negative integer up to ", std::numeric_limits<R>::max(), " expected"));
+    return p->get<R>();
+  }
+
+  /* Durations are given in seconds and may be fractional, but must be whole number of D. */
+  template <class D>
+  D get_duration_d(char const * key, D const & dfault)
+  {
+    auto const p = find(key);
+    if (p == nullptr)
+      return dfault;
+    if (!p->is_number())
+      throw std::runtime_error(stream_to_str(path(key), ": duration in seconds expected"));
+    auto const seconds = p->get<double>();
+    auto const ticks = seconds * D::period::den / D::period::num;
+    auto const rounded = static_cast<typename D::rep>(ticks + 0.5);
+    if (seconds < 0 || std::abs(ticks - rounded) > 1e-6)
+      throw std::runtime_error(stream_to_str(path(key), ": duration ", seconds, " s is negative or not a whole number of ",
+        D::period::num, "/", D::period::den, " s"));
+    return D(rounded);
+  }
+
+  /* json does not like single backslashes in strings, so can either use forward slashes or double backslashes. */
+  std::string get_escaped_string_d(char const * key, std::string const & dfault)
+  {
+    auto s = get_d<std::string>(key, dfault);
+    std::replace(s.begin(), s.end(), '/', '\\');
+    return s;
+  }
+
+  std::string path(char const * key) const
+  {
+    return stream_to_str(path_, ".", key);
+  }
+
+  void check_unknown() const
+  {
+    for (auto const & el : object_.items())
+      if (std::find(read_.begin(), read_.end(), el.key()) == read_.end())
+        throw std::runtime_error(stream_to_str(path_, ": unknown key \"", el.key(), "\""));
+  }
+
+  ObjectReader(config_t const & object, std::string const & path) : object_(object), path_(path), read_()
+  {
+    if (!object_.is_object())
+      throw std::runtime_error(stream_to_str(path_, ": object expected"));
+  }
+
+private:
+  template <class R>
+  R convert(config_t const & value, char const * key) const
+  try {
+    return value.get<R>();
+  } catch (nlohmann::json::type_error const & e)
+  {
+    throw std::runtime_error(stream_to_str(path(key), ": ", e.what()));
+  }
+
+  config_t const & object_;
+  std::string path_;
+  std::vector<std::string> read_;
+};
+
+
+static logging::LogLevel parse_log_level(std::string const & name, std::string const & path)
+{
+  auto const level = logging::n2ll(name);
+  if (level == logging::LogLevel::notset && name != "NOTSET")
+    throw std::runtime_error(stream_to_str(path, ": invalid log level \"", name, "\""));
+  return level;
+}
+
+
+static ActionSettings parse_action(config_t const & config, std::string const & path)
+{
+  static char const * const actions[] = { "enable", "disable", "toggle", "set_state", "push_state", "pop_state", "switch_profile" };
+  static char const * const statefulActions[] = { "set_state", "push_state" };
+  static char const * const timedActions[] = { "enable", "disable", "toggle", "set_state" };
+
+  ObjectReader r (config, path);
+  ActionSettings as;
+  as.action = r.get<std::string>("action");
+  if (std::find(std::begin(actions), std::end(actions), as.action) == std::end(actions))
+    throw std::runtime_error(stream_to_str(r.path("action"), ": invalid action \"", as.action, "\""));
+  if (as.action == "switch_profile")
+  {
+    as.profile = r.get<std::string>("profile");
+    r.check_unknown();
+    return as;
+  }
+  as.name = r.get_escaped_string_d("name", "");
+  if (as.name.empty())
+    throw std::runtime_error(stream_to_str(r.path("name"), ": device name expected"));
+  if (std::find(std::begin(statefulActions), std::end(statefulActions), as.action) != std::end(statefulActions))
+    as.state = r.get<bool>("state");
+  as.duration = r.get_duration_d("duration", as.duration);
+  if (as.duration != std::chrono::microseconds::zero()
+    && std::find(std::begin(timedActions), std::end(timedActions), as.action) == std::end(timedActions))
+    throw std::runtime_error(stream_to_str(r.path("duration"), ": duration is not supported for \"", as.action, "\" action"));
+  r.check_unknown();
+  return as;
+}
+
+
+static std::vector<std::string> parse_keys(config_t const & config, std::string const & path)
+{
+  if (!config.is_array() || config.empty())
+    throw std::runtime_error(stream_to_str(path, ": non-empty array of key names expected"));
+  std::vector<std::string> keys;
+  for (auto const & el : config)
+  {
+    if (!el.is_string() || name2key(el.get<std::string>()) == 0)
+      throw std::runtime_error(stream_to_str(path, ": invalid key ", el.dump()));
+    keys.push_back(el.get<std::string>());
+  }
+  return keys;
+}
+
+
+static BindingSettings parse_binding(config_t const & config, std::string const & path)
+{
+  ObjectReader r (config, path);
+  BindingSettings bs;
+  {
+    ObjectReader on (r.at("on"), r.path("on"));
+    auto const pKey = on.find("key");
+    auto const pSequence = on.find("sequence");
+    if ((pKey == nullptr) == (pSequence == nullptr))
+      throw std::runtime_error(stream_to_str(r.path("on"), ": either \"key\" or \"sequence\" expected"));
+    if (pKey)
+    {
+      auto const key = on.get<std::string>("key");
+      if (name2key(key) == 0)
+        throw std::runtime_error(stream_to_str(on.path("key"), ": invalid key \"", key, "\""));
+      bs.keys.push_back(key);
+    }
+    else
+      bs.keys = parse_keys(*pSequence, on.path("sequence"));
+    if (auto const p = on.find("modifiers"))
+      bs.modifiers = parse_keys(*p, on.path("modifiers"));
+    bs.event = on.get<std::string>("event");
+    if (bs.event != "press" && bs.event != "release" && bs.event != "hold")
+      throw std::runtime_error(stream_to_str(on.path("event"), ": invalid event \"", bs.event, "\""));
+    bs.hold = on.get_duration_d("duration", bs.hold);
+    if ((bs.event == "hold") != (bs.hold != std::chrono::microseconds::zero()))
+      throw std::runtime_error(stream_to_str(on.path("duration"), ": positive duration is required for \"hold\" event only"));
+    bs.interval = on.get_duration_d("interval", bs.interval);
+    on.check_unknown();
+  }
+  bs.do_ = parse_action(r.at("do"), r.path("do"));
+  r.check_unknown();
+  return bs;
+}
+
+
+static BlockSettings parse_block(config_t const & config, std::string const & path)
+{
+  ObjectReader r (config, path);
+  BlockSettings bs;
+  bs.source = r.get_escaped_string_d("source", "");
+  if (bs.source.empty())
+    throw std::runtime_error(stream_to_str(r.path("source"), ": device name expected"));
+  bs.target = r.get_escaped_string_d("target", "");
+  if (bs.target.empty())
+    throw std::runtime_error(stream_to_str(r.path("target"), ": device name expected"));
+  bs.window = r.get_duration_d("window", bs.window);
+  if (bs.window == std::chrono::microseconds::zero())
+    throw std::runtime_error(stream_to_str(r.path("window"), ": positive duration expected"));
+  r.check_unknown();
+  return bs;
+}
+
+
+static std::vector<std::string> parse_device_names(config_t const & config, std::string const & path)
+{
+  if (!config.is_array() || config.empty())
+    throw std::runtime_error(stream_to_str(path, ": non-empty array of device names expected"));
+  std::vector<std::string> names;
+  for (auto const & el : config)
+  {
+    if (!el.is_string() || el.get<std::string>().empty())
+      throw std::runtime_error(stream_to_str(path, ": invalid device name ", el.dump()));
+    auto name = el.get<std::string>();
+    std::replace(name.begin(), name.end(), '/', '\\');
+    names.push_back(name);
+  }
+  return names;
+}
+
+
+static ArbitrationSettings parse_arbitration(config_t const & config, std::string const & path)
+{
+  ObjectReader r (config, path);
+  ArbitrationSettings as;
+  as.devices = parse_device_names(r.at("devices"), r.path("devices"));
+  if (as.devices.size() < 2)
+    throw std::runtime_error(stream_to_str(r.path("devices"), ": at least 2 devices expected"));
+  as.takeover = r.get_duration_d("takeover", as.takeover);
+  as.gap = r.get_duration_d("gap", as.gap);
+  if (as.gap == std::chrono::microseconds::zero())
+    throw std::runtime_error(stream_to_str(r.path("gap"), ": positive duration expected"));
+  r.check_unknown();
+  return as;
+}
+
+
+static unsigned int parse_button(std::string const & name, std::string const & path)
+{
+  if (name.size() != 1 || name[0] < '1' || name[0] > '5')
+    throw std::runtime_error(stream_to_str(path, ": invalid button \"", name, "\", 1-5 expected"));
+  return name[0] - '0';
+}
+
+
+/* Keys without scan code can not be remapped, since raw input identifies keys by scan code. */
+static std::string parse_remapped_key(std::string const & name, std::string const & path)
+{
+  auto const scan = key2scan(name2key(name));
+  if (scan == 0 || (scan & 0xFF00) == 0xE100)
+    throw std::runtime_error(stream_to_str(path, ": invalid or unsupported key \"", name, "\""));
+  return name;
+}
+
+
+static RemapSettings parse_remap(std::string const & device, config_t const & config, std::string const & path)
+{
+  ObjectReader r (config, path);
+  RemapSettings rs;
+  rs.device = device;
+  std::replace(rs.device.begin(), rs.device.end(), '/', '\\');
+  if (auto const p = r.find("keys"))
+  {
+    ObjectReader keys (*p, r.path("keys"));
+    for (auto const & el : p->items())
+    {
+      auto const keyPath = keys.path(el.key().c_str());
+      rs.keys.push_back(std::make_pair(parse_remapped_key(el.key(), keyPath), parse_remapped_key(keys.get<std::string>(el.key().c_str()), keyPath)));
+    }
+  }
+  if (auto const p = r.find("buttons"))
+  {
+    ObjectReader buttons (*p, r.path("buttons"));
+    for (auto const & el : p->items())
+    {
+      auto const buttonPath = buttons.path(el.key().c_str());
+      auto const to = buttons.get<unsigned int>(el.key().c_str());
+      rs.buttons.push_back(std::make_pair(parse_button(el.key(), buttonPath), parse_button(stream_to_str(to), buttonPath)));
+    }
+    /* Unlisted buttons stay in place, so resulting table must be a permutation, otherwise some button is lost. */
+    unsigned int table[5] = {1, 2, 3, 4, 5};
+    for (auto const & b : rs.buttons)
+      table[b.first - 1] = b.second;
+    for (unsigned int target = 1; target <= 5; ++target)
+      if (std::count(std::begin(table), std::end(table), target) > 1)
+        throw std::runtime_error(stream_to_str(r.path("buttons"), ": button ", target, " is target of more than one button"));
+  }
+  r.check_unknown();
+  return rs;
+}
+
+
+static MotionSettings parse_motion(std::string const & device, config_t const & config, std::string const & path)
+{
+  ObjectReader r (config, path);
+  MotionSettings ms;
+  ms.device = device;
+  std::replace(ms.device.begin(), ms.device.end(), '/', '\\');
+  /* Gains are stored as 16.16 fixed point. */
+  static double const maxGain = 256.0;
+  ms.scale = r.get_d<double>("scale", ms.scale);
+  if (!(ms.scale > 0 && ms.scale < maxGain))
+    throw std::runtime_error(stream_to_str(r.path("scale"), ": must be in (0, ", maxGain, ")"));
+  if (auto const p = r.find("curve"))
+  {
+    if (!p->is_array() || p->empty())
+      throw std::runtime_error(stream_to_str(r.path("curve"), ": non-empty array of [speed, gain] points expected"));
+    for (auto const & el : *p)
+    {
+      if (!el.is_array() || el.size() != 2 || !el[0].is_number() || !el[1].is_number())
+        throw std::runtime_error(stream_to_str(r.path("curve"), ": invalid point ", el.dump()));
+      auto const point = std::make_pair(el[0].get<double>(), el[1].get<double>());
+      if (point.first < 0 || (!ms.curve.empty() && point.first <= ms.curve.back().first) || !(point.second >= 0 && point.second < maxGain))
+        throw std::runtime_error(stream_to_str(r.path("curve"), ": invalid point ", el.dump(), ", speed must increase and gain be in [0, ", maxGain, ")"));
+      ms.curve.push_back(point);
+    }
+  }
+  ms.swapAxes = r.get_d<bool>("swapAxes", ms.swapAxes);
+  ms.invertX = r.get_d<bool>("invertX", ms.invertX);
+  ms.invertY = r.get_d<bool>("invertY", ms.invertY);
+  r.check_unknown();
+  return ms;
+}
+
+
+Settings parse_settings(config_t const & config)
+{
+  ObjectReader r (config, "config");
+  Settings s;
+
+  s.dllPath = r.get_escaped_string_d("dllPath", s.dllPath);
+  s.enabled = r.get_d<bool>("enabled", s.enabled);
+  /* Obsolete: initialization is always done off loader lock now. Accepted for compatibility. */
+  r.find("deferInit");
+  s.printDevices = r.get_d<bool>("printDevices", s.printDevices);
+  s.updatePeriod = r.get_duration_d("updatePeriod", s.updatePeriod);
+  if (s.updatePeriod == std::chrono::microseconds::zero())
+    throw std::runtime_error(stream_to_str(r.path("updatePeriod"), ": must be positive"));
+  s.idleUpdatePeriod = r.get_duration_d("idleUpdatePeriod", s.idleUpdatePeriod);
+  s.idleTicks = r.get_count_d<unsigned int>("idleTicks", s.idleTicks);
+  s.statsPeriod = r.get_duration_d("statsPeriod", s.statsPeriod);
+  s.configReloadPeriod = r.get_duration_d("configReloadPeriod", s.configReloadPeriod);
+
+  s.log.level = parse_log_level(r.get_d<std::string>("logLevel", "DEBUG"), r.path("logLevel"));
+  if (auto const p = r.find("logLevels"))
+  {
+    ObjectReader levels (*p, r.path("logLevels"));
+    for (auto const & el : p->items())
+    {
+      auto const source = logging::n2src(el.key());
+      if (source == logging::LogSource::count)
+        throw std::runtime_error(stream_to_str(levels.path(el.key().c_str()), ": invalid log source"));
+      auto const level = parse_log_level(levels.get<std::string>(el.key().c_str()), levels.path(el.key().c_str()));
+      s.log.levels.push_back(std::make_pair(source, level));
+      /* "export" also covers export categories that are not given explicitly. */
+      if (source == logging::LogSource::exports)
+        for (auto const category : { logging::LogSource::input_exports, logging::LogSource::message_exports })
+          if (!p->contains(logging::src2n(category)))
+            s.log.levels.push_back(std::make_pair(category, level));
+    }
+  }
+  s.log.format = r.get_d<std::string>("logFormat", s.log.format);
+  if (s.log.format != "text" && s.log.format != "binary")
+    throw std::runtime_error(stream_to_str(r.path("logFormat"), ": invalid log format \"", s.log.format, "\""));
+  s.log.maxSize = r.get_count_d<std::size_t>("logMaxSize", s.log.maxSize);
+  s.log.maxFiles = r.get_count_d<unsigned int>("logMaxFiles", s.log.maxFiles);
+  s.log.repeatWindow = r.get_duration_d("logRepeatWindow", s.log.repeatWindow);
+
+  if (auto const p = r.find("devices"))
+  {
+    ObjectReader devices (*p, r.path("devices"));
+    for (auto const & el : p->items())
+    {
+      ObjectReader dr (devices.at(el.key().c_str()), devices.path(el.key().c_str()));
+      DeviceSettings ds;
+      ds.alias = el.key();
+      ds.name = dr.get_escaped_string_d("name", "");
+      if (ds.name.empty())
+        throw std::runtime_error(stream_to_str(dr.path("name"), ": device name expected"));
+      ds.state = dr.get_d<bool>("state", ds.state);
+      dr.check_unknown();
+      s.devices.push_back(ds);
+    }
+  }
+
+  if (auto const p = r.find("groups"))
+  {
+    ObjectReader groups (*p, r.path("groups"));
+    for (auto const & el : p->items())
+    {
+      GroupSettings gs;
+      gs.name = el.key();
+      auto const path = groups.path(gs.name.c_str());
+      for (auto const & ds : s.devices)
+        if (ds.alias == gs.name)
+          throw std::runtime_error(stream_to_str(path, ": group name is already used as device alias"));
+      gs.devices = parse_device_names(groups.at(gs.name.c_str()), path);
+      s.groups.push_back(gs);
+    }
+  }
+
+  if (auto const p = r.find("profiles"))
+  {
+    ObjectReader profiles (*p, r.path("profiles"));
+    for (auto const & el : p->items())
+    {
+      ObjectReader pr (profiles.at(el.key().c_str()), profiles.path(el.key().c_str()));
+      ProfileSettings ps;
+      ps.name = el.key();
+      if (auto const pEnable = pr.find("enable"))
+        ps.enable = parse_device_names(*pEnable, pr.path("enable"));
+      if (auto const pDisable = pr.find("disable"))
+        ps.disable = parse_device_names(*pDisable, pr.path("disable"));
+      pr.check_unknown();
+      /* Profile gives state of configured devices, so it can only refer to them and to groups. */
+      auto const check_names = [&s, &pr](std::vector<std::string> const & names, char const * key)
+      {
+        for (auto const & name : names)
+          if (std::find_if(s.devices.begin(), s.devices.end(), [&name](DeviceSettings const & ds) { return ds.alias == name || ds.name == name; }) == s.devices.end()
+            && std::find_if(s.groups.begin(), s.groups.end(), [&name](GroupSettings const & gs) { return gs.name == name; }) == s.groups.end())
+            throw std::runtime_error(stream_to_str(pr.path(key), ": unknown device or group \"", name, "\""));
+      };
+      check_names(ps.enable, "enable");
+      check_names(ps.disable, "disable");
+      s.profiles.push_back(ps);
+    }
+  }
+
+  if (auto const p = r.find("bindings"))
+  {
+    if (!p->is_array())
+      throw std::runtime_error(stream_to_str(r.path("bindings"), ": array expected"));
+    for (std::size_t i = 0; i < p->size(); ++i)
+    {
+      auto const path = stream_to_str(r.path("bindings"), "[", i, "]");
+      auto const bs = parse_binding((*p)[i], path);
+      if (bs.do_.action == "switch_profile"
+        && std::find_if(s.profiles.begin(), s.profiles.end(), [&bs](ProfileSettings const & ps) { return ps.name == bs.do_.profile; }) == s.profiles.end())
+        throw std::runtime_error(stream_to_str(path, ".do.profile: unknown profile \"", bs.do_.profile, "\""));
+      s.bindings.push_back(bs);
+    }
+  }
+
+  if (auto const p = r.find("blocks"))
+  {
+    if (!p->is_array())
+      throw std::runtime_error(stream_to_str(r.path("blocks"), ": array expected"));
+    for (std::size_t i = 0; i < p->size(); ++i)
+      s.blocks.push_back(parse_block((*p)[i], stream_to_str(r.path("blocks"), "[", i, "]")));
+  }
+
+  if (auto const p = r.find("arbitration"))
+  {
+    if (!p->is_array())
+      throw std::runtime_error(stream_to_str(r.path("arbitration"), ": array expected"));
+    for (std::size_t i = 0; i < p->size(); ++i)
+      s.arbitration.push_back(parse_arbitration((*p)[i], stream_to_str(r.path("arbitration"), "[", i, "]")));
+  }
+
+  if (auto const p = r.find("remap"))
+  {
+    ObjectReader remap (*p, r.path("remap"));
+    for (auto const & el : p->items())
+      s.remap.push_back(parse_remap(el.key(), remap.at(el.key().c_str()), remap.path(el.key().c_str())));
+  }
+
+  if (auto const p = r.find("motion"))
+  {
+    ObjectReader motion (*p, r.path("motion"));
+    for (auto const & el : p->items())
+      s.motion.push_back(parse_motion(el.key(), motion.at(el.key().c_str()), motion.path(el.key().c_str())));
+  }
+
+  if (auto const p = r.find("debounce"))
+  {
+    ObjectReader debounce (*p, r.path("debounce"));
+    for (auto const & el : p->items())
+    {
+      ObjectReader dr (debounce.at(el.key().c_str()), debounce.path(el.key().c_str()));
+      DebounceSettings ds;
+      ds.device = el.key();
+      std::replace(ds.device.begin(), ds.device.end(), '/', '\\');
+      ds.window = dr.get_duration_d("window", ds.window);
+      if (ds.window == std::chrono::microseconds::zero())
+        throw std::runtime_error(stream_to_str(dr.path("window"), ": positive duration expected"));
+      dr.check_unknown();
+      s.debounce.push_back(ds);
+    }
+  }
+
+  r.check_unknown();
+  return s;
+}
+
+
+static uint64_t fnv1a(std::string const & s)
+{
+  uint64_t h = 14695981039346656037ULL;
+  for (unsigned char c : s)
+  {
+    h ^= c;
+    h *= 1099511628211ULL;
+  }
+  return h;
+}
+
+
+bool FileWatcher::poll()
+{
+  auto const current = stamp_();
+  if (current != last_)
+  {
+    last_ = current;
+    return true;
+  }
+  return false;
+}
+
+
+/* File is hashed on every poll: mtime may have coarse resolution, so that edit within the same second
+   that keeps size would be missed. Config is small, and rewriting it unchanged does not cause reload. */
+FileWatcher::Stamp FileWatcher::stamp_() const
+{
+  Stamp stamp = { false, 0, 0 };
+  std::ifstream is (path_, std::ios::in|std::ios::binary);
+  if (is.is_open())
+  {
+    std::string const text ((std::istreambuf_iterator<char>(is)), std::istreambuf_iterator<char>());
+    stamp.exists = true;
+    stamp.size = text.size();
+    stamp.hash = fnv1a(text);
+  }
+  return stamp;
+}
+
+
+FileWatcher::FileWatcher(std::string const & path)
+  : path_(path), last_(stamp_())
+{}
+
+}//config
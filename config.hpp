@@ -26,7 +26,11 @@
 #define CONFIG_HPP_
 
 #include "nlohmann/json.hpp"
+#include "logging.hpp"
 #include <string>
+#include <vector>
+#include <utility>
+#include <chrono>
 
 namespace config
 {
@@ -41,7 +45,7 @@ try {
   return config.at(key).template get<R>();
 } catch (nlohmann::json::out_of_range const & e)
 {
-  logging::log("util", logging::LogLevel::error, e.what(), "; key: ", key, "; config: ", config);
+  logging::log(logging::LogSource::util, logging::LogLevel::error, e.what(), "; key: "_lit, key, "; config: "_lit, config);
   throw;
 }
 
@@ -52,21 +56,25 @@ try {
   return config.at(key);
 } catch (nlohmann::json::out_of_range const & e)
 {
-  logging::log("util", logging::LogLevel::error, e.what(), "; key: ", key, "; config: ", config);
+  logging::log(logging::LogSource::util, logging::LogLevel::error, e.what(), "; key: "_lit, key, "; config: "_lit, config);
   throw;
 }
 
 
 template <class R, class C, class K>
 R get_d(C const & config, K&& key, R&& dfault)
-try {
-  return config.at(key).template get<R>();
-} catch (nlohmann::json::out_of_range const & e)
 {
-  return dfault;
+  auto const it = config.find(key);
+  if (it == config.end())
+    return dfault;
+  return it->template get<R>();
 }
 
 
+/* Loads config from text file, which may have C and C++ style comments. */
+config_t load(std::string const & path);
+
+
 /* json does not like single backslashes in strings, so can either use forward slashes or double backslashes. */
 template <class C, class K>
 std::string get_escaped_string(C const & config, K&& key)
@@ -85,6 +93,228 @@ std::string get_escaped_string_d(C const & config, K&& key, D&& dfault)
   return s;
 }
 
+/* Typed settings. user32.cfg is converted to these once at load time (see parse_settings()),
+   so that type errors, unknown keys and bad values are reported early and json DOM can be released. */
+struct LogSettings
+{
+  logging::LogLevel level = logging::LogLevel::debug;
+  std::vector<std::pair<logging::LogSource, logging::LogLevel> > levels;
+  std::string format = "text";
+  std::size_t maxSize = 0;
+  unsigned int maxFiles = 3;
+  std::chrono::milliseconds repeatWindow = std::chrono::milliseconds::zero();
+};
+
+struct DeviceSettings
+{
+  std::string alias;
+  std::string name;
+  bool state = true;
+
+  bool operator==(DeviceSettings const & other) const
+  {
+    return alias == other.alias && name == other.name && state == other.state;
+  }
+  bool operator!=(DeviceSettings const & other) const { return !(*this == other); }
+};
+
+/* Named set of devices (names or aliases) that actions can apply to as a whole. */
+struct GroupSettings
+{
+  std::string name;
+  std::vector<std::string> devices;
+
+  bool operator==(GroupSettings const & other) const
+  {
+    return name == other.name && devices == other.devices;
+  }
+  bool operator!=(GroupSettings const & other) const { return !(*this == other); }
+};
+
+/* Complete device state that switch_profile action activates at once: devices (or groups) of enable list are
+   enabled, then those of disable list are disabled; other devices have state given in "devices". */
+struct ProfileSettings
+{
+  std::string name;
+  std::vector<std::string> enable;
+  std::vector<std::string> disable;
+
+  bool operator==(ProfileSettings const & other) const
+  {
+    return name == other.name && enable == other.enable && disable == other.disable;
+  }
+  bool operator!=(ProfileSettings const & other) const { return !(*this == other); }
+};
+
+struct ActionSettings
+{
+  std::string action;
+  /* Device name, alias or group name. */
+  std::string name;
+  bool state = true;
+  /* Profile name of switch_profile action, which has no device name. */
+  std::string profile;
+  /* If non-zero, device state is restored when duration expires; triggering again extends it. */
+  std::chrono::microseconds duration = std::chrono::microseconds::zero();
+
+  bool operator==(ActionSettings const & other) const
+  {
+    return action == other.action && name == other.name && state == other.state && profile == other.profile
+      && duration == other.duration;
+  }
+  bool operator!=(ActionSettings const & other) const { return !(*this == other); }
+};
+
+/* Binding fires when keys of sequence are pressed in order, each within interval of previous one, and
+   modifiers (and no other keys used as modifiers) are held when last key of sequence is pressed.
+   Event is press, release or hold (last key held for hold duration). */
+struct BindingSettings
+{
+  std::vector<std::string> keys;
+  std::vector<std::string> modifiers;
+  std::string event;
+  std::chrono::microseconds hold = std::chrono::microseconds::zero();
+  std::chrono::microseconds interval = std::chrono::microseconds(500000);
+  ActionSettings do_;
+
+  bool operator==(BindingSettings const & other) const
+  {
+    return keys == other.keys && modifiers == other.modifiers && event == other.event && hold == other.hold
+      && interval == other.interval && do_ == other.do_;
+  }
+  bool operator!=(BindingSettings const & other) const { return !(*this == other); }
+};
+
+/* Input from target device is blocked for window after any input from source device. */
+struct BlockSettings
+{
+  std::string source;
+  std::string target;
+  std::chrono::microseconds window = std::chrono::microseconds::zero();
+
+  bool operator==(BlockSettings const & other) const
+  {
+    return source == other.source && target == other.target && window == other.window;
+  }
+  bool operator!=(BlockSettings const & other) const { return !(*this == other); }
+};
+
+/* Only most recently active device of group passes. Other device takes over after it has been continuously
+   active (no gaps longer than gap) for takeover time while current one was silent. */
+struct ArbitrationSettings
+{
+  std::vector<std::string> devices;
+  std::chrono::microseconds takeover = std::chrono::microseconds(250000);
+  std::chrono::microseconds gap = std::chrono::microseconds(100000);
+
+  bool operator==(ArbitrationSettings const & other) const
+  {
+    return devices == other.devices && takeover == other.takeover && gap == other.gap;
+  }
+  bool operator!=(ArbitrationSettings const & other) const { return !(*this == other); }
+};
+
+/* Keys (by name) and mouse buttons (1-5) of device are replaced by other ones in raw input. */
+struct RemapSettings
+{
+  std::string device;
+  std::vector<std::pair<std::string, std::string> > keys;
+  std::vector<std::pair<unsigned int, unsigned int> > buttons;
+
+  bool operator==(RemapSettings const & other) const
+  {
+    return device == other.device && keys == other.keys && buttons == other.buttons;
+  }
+  bool operator!=(RemapSettings const & other) const { return !(*this == other); }
+};
+
+/* Relative motion of mouse is multiplied by scale and by gain of curve at message speed (|x| + |y| counts),
+   then axes are swapped and inverted as requested. */
+struct MotionSettings
+{
+  std::string device;
+  double scale = 1.0;
+  /* Points (speed, gain) with increasing speed; empty for constant gain 1. */
+  std::vector<std::pair<double, double> > curve;
+  bool swapAxes = false;
+  bool invertX = false;
+  bool invertY = false;
+
+  bool operator==(MotionSettings const & other) const
+  {
+    return device == other.device && scale == other.scale && curve == other.curve && swapAxes == other.swapAxes
+      && invertX == other.invertX && invertY == other.invertY;
+  }
+  bool operator!=(MotionSettings const & other) const { return !(*this == other); }
+};
+
+/* Mouse button transition that is reversed within window is dropped together with reversal. */
+struct DebounceSettings
+{
+  std::string device;
+  std::chrono::microseconds window = std::chrono::microseconds(10000);
+
+  bool operator==(DebounceSettings const & other) const
+  {
+    return device == other.device && window == other.window;
+  }
+  bool operator!=(DebounceSettings const & other) const { return !(*this == other); }
+};
+
+struct Settings
+{
+  std::string dllPath;
+  bool enabled = true;
+  bool printDevices = true;
+  std::chrono::microseconds updatePeriod = std::chrono::microseconds(100000);
+  /* After idleTicks updates without key activity update period grows up to idleUpdatePeriod;
+     zero disables backoff. */
+  std::chrono::microseconds idleUpdatePeriod = std::chrono::microseconds::zero();
+  unsigned int idleTicks = 100;
+  /* How often to log key map thread statistics; zero disables. */
+  std::chrono::microseconds statsPeriod = std::chrono::microseconds::zero();
+  /* How often to check user32.cfg for changes; zero disables reload. */
+  std::chrono::microseconds configReloadPeriod = std::chrono::microseconds::zero();
+  LogSettings log;
+  std::vector<DeviceSettings> devices;
+  std::vector<GroupSettings> groups;
+  std::vector<ProfileSettings> profiles;
+  std::vector<BindingSettings> bindings;
+  std::vector<BlockSettings> blocks;
+  std::vector<ArbitrationSettings> arbitration;
+  std::vector<RemapSettings> remap;
+  std::vector<MotionSettings> motion;
+  std::vector<DebounceSettings> debounce;
+};
+
+/* Throws std::runtime_error that names offending key. */
+Settings parse_settings(config_t const & config);
+
+/* Detects file changes by polling its size and hash of contents. */
+class FileWatcher
+{
+public:
+  /* Returns true if file has changed since previous call (or construction). */
+  bool poll();
+
+  FileWatcher(std::string const & path);
+
+private:
+  struct Stamp
+  {
+    bool exists;
+    uint64_t size;
+    uint64_t hash;
+
+    bool operator!=(Stamp const & other) const { return exists != other.exists || size != other.size || hash != other.hash; }
+  };
+
+  Stamp stamp_() const;
+
+  std::string path_;
+  Stamp last_;
+};
+
 }//config
 
 #endif
@@ -0,0 +1,377 @@
+/*
+*  MIT License
+*
+*  Copyright (c) 2025 Alexander Fedorov
+*
+*  Permission is hereby granted, free of charge, to any person obtaining a copy
+*  of this software and associated documentation files (the "Software"), to deal
+*  in the Software without restriction, including without limitation the rights
+*  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*  copies of the Software, and to permit persons to whom the Software is
+*  furnished to do so, subject to the following conditions:
+*
+*  The above copyright notice and this permission notice shall be included in all
+*  copies or substantial portions of the Software.
+*
+*  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*  SOFTWARE.
+*/
+
+#include "keymap.hpp"
+#include "logging.hpp"
+#include "util.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <cstring>
+
+
+KeyEventType name2ket(char const * name)
+{
+  static struct { char const * name; KeyEventType ket; } const n2k[] = { { "press", KeyEventType::press }, { "release", KeyEventType::release }, { "hold", KeyEventType::hold } };
+  for (auto const & p : n2k)
+    if (std::strcmp(p.name, name) == 0)
+      return p.ket;
+  throw std::runtime_error("Invalid key event type");
+}
+
+
+char const * ket2name(KeyEventType ket)
+{
+  switch(ket)
+  {
+    case KeyEventType::press:
+      return "pressed";
+    case KeyEventType::release:
+      return "released";
+    case KeyEventType::hold:
+      return "held";
+    default:
+      return "invalid";
+  }
+}
+
+
+unsigned int GKSKeyMap::update()
+{
+  logging::log(logging::LogSource::wrapper, logging::LogLevel::debug, "GKSKeyMap::update()"_lit);
+  auto const & snapshot = *pSnapshot_.load();
+  if (snapshot.generation != seenGeneration_)
+  {
+    /* Automaton state, timers and armed bindings refer to previous snapshot. */
+    seenGeneration_ = snapshot.generation;
+    current_ = 0;
+    timers_.clear();
+    timers_.reserve(snapshot.bindings.size());
+    armed_.clear();
+    armed_.reserve(snapshot.bindings.size());
+    isArmed_.assign(snapshot.bindings.size(), false);
+  }
+
+  mask_t current[maskSize] = {};
+  for (std::size_t i = 0; i < maskSize; ++i)
+    for (auto bits = snapshot.active[i]; bits != 0; bits &= bits - 1)
+    {
+      auto const bit = __builtin_ctzll(bits);
+      if (isKeyDown_(i * maskBits + bit))
+        current[i] |= mask_t(1) << bit;
+    }
+
+  /* State is updated for all keys first, so that modifiers pressed in the same tick are seen as held. */
+  mask_t changed[maskSize];
+  for (std::size_t i = 0; i < maskSize; ++i)
+  {
+    changed[i] = (current[i] ^ state_[i]) & snapshot.active[i];
+    state_[i] = current[i];
+  }
+
+  auto const now = clock_t::now();
+  unsigned int events = 0;
+  for (std::size_t i = 0; i < maskSize; ++i)
+  {
+    for (auto bits = changed[i]; bits != 0; bits &= bits - 1)
+    {
+      auto const bit = __builtin_ctzll(bits);
+      key_t const key = i * maskBits + bit;
+      auto const ket = (current[i] >> bit) & 1 ? KeyEventType::press : KeyEventType::release;
+      logging::log(logging::LogSource::wrapper, logging::LogLevel::debug, "key "_lit, key2name(key), " "_lit, ket2name(ket));
+      if (ket == KeyEventType::press)
+        on_press_(snapshot, key, now);
+      else
+        on_release_(snapshot, key);
+      ++events;
+    }
+  }
+  check_timers_(snapshot, now);
+
+  ++updates_;
+  if (!pExecutor_ || pExecutor_->idle())
+    quiescent_.store(updates_);
+  return events;
+}
+
+
+void GKSKeyMap::collect()
+{
+  if (!hasRetired_.load(std::memory_order_relaxed))
+    return;
+  std::unique_lock<std::mutex> lock (mutex_, std::try_to_lock);
+  if (lock.owns_lock())
+    collect_();
+}
+
+
+void GKSKeyMap::on_press_(Snapshot const & snapshot, key_t key, clock_t::time_point now)
+{
+  if (current_ != 0 && now - lastPress_ > snapshot.states[current_].interval)
+    current_ = 0;
+  /* Press also starts sequence anew, so bindings of path from initial state fire even when automaton
+     is in the middle of longer sequence. */
+  auto const restart = snapshot.states[0].next[key];
+  auto const next = snapshot.states[current_].next[key];
+  current_ = next != 0 ? next : restart;
+  lastPress_ = now;
+
+  match_(snapshot, current_, now);
+  if (restart != current_)
+    match_(snapshot, restart, now);
+}
+
+
+void GKSKeyMap::match_(Snapshot const & snapshot, state_t state, clock_t::time_point now)
+{
+  for (auto const i : snapshot.states[state].bindings)
+  {
+    auto const & binding = snapshot.bindings[i];
+    bool matches = true;
+    for (std::size_t j = 0; j < maskSize; ++j)
+      matches &= (state_[j] & snapshot.modifiers[j]) == binding.modifiers[j];
+    if (!matches)
+      continue;
+    switch (binding.event)
+    {
+      case KeyEventType::press:
+        fire_(binding);
+        break;
+      case KeyEventType::release:
+        if (!isArmed_[i])
+        {
+          isArmed_[i] = true;
+          armed_.push_back(i);
+        }
+        break;
+      case KeyEventType::hold:
+      {
+        auto const it = std::find_if(timers_.begin(), timers_.end(), [i](Timer const & t) { return t.binding == i; });
+        if (it == timers_.end())
+          timers_.push_back(Timer{now + binding.hold, i});
+        else
+          it->deadline = now + binding.hold;
+        break;
+      }
+    }
+  }
+}
+
+
+void GKSKeyMap::on_release_(Snapshot const & snapshot, key_t key)
+{
+  for (std::size_t i = 0; i < timers_.size();)
+    if (snapshot.bindings[timers_[i].binding].key == key)
+    {
+      timers_[i] = timers_.back();
+      timers_.pop_back();
+    }
+    else
+      ++i;
+
+  for (std::size_t i = 0; i < armed_.size();)
+  {
+    auto const & binding = snapshot.bindings[armed_[i]];
+    if (binding.key == key)
+    {
+      isArmed_[armed_[i]] = false;
+      armed_[i] = armed_.back();
+      armed_.pop_back();
+      fire_(binding);
+    }
+    else
+      ++i;
+  }
+}
+
+
+void GKSKeyMap::check_timers_(Snapshot const & snapshot, clock_t::time_point now)
+{
+  for (std::size_t i = 0; i < timers_.size();)
+    if (timers_[i].deadline <= now)
+    {
+      auto const & binding = snapshot.bindings[timers_[i].binding];
+      timers_[i] = timers_.back();
+      timers_.pop_back();
+      fire_(binding);
+    }
+    else
+      ++i;
+}
+
+
+void GKSKeyMap::fire_(Binding const & binding)
+{
+  logging::log(logging::LogSource::wrapper, logging::LogLevel::debug, "binding "_lit, binding.id, " on key "_lit, key2name(binding.key), " "_lit, ket2name(binding.event));
+  if (pExecutor_)
+    pExecutor_->post(&binding.cb);
+  else
+    binding.cb();
+}
+
+
+std::unique_ptr<GKSKeyMap::Snapshot> GKSKeyMap::compile_(std::vector<Spec> const & specs)
+{
+  std::unique_ptr<Snapshot> upSnapshot (new Snapshot());
+  auto & states = upSnapshot->states;
+  states.resize(1);
+  for (auto const & spec : specs)
+  {
+    auto const & trigger = spec.trigger;
+    if (trigger.keys.empty())
+      throw std::runtime_error("No keys in binding");
+    for (auto const key : trigger.keys)
+      if (key >= keyCount)
+        throw std::runtime_error(stream_to_str("Invalid key: ", key));
+    for (auto const key : trigger.modifiers)
+      if (key >= keyCount)
+        throw std::runtime_error(stream_to_str("Invalid key: ", key));
+
+    std::size_t state = 0;
+    for (std::size_t i = 0; i < trigger.keys.size(); ++i)
+    {
+      auto const key = trigger.keys[i];
+      if (i > 0)
+        states[state].interval = std::max(states[state].interval, trigger.interval);
+      if (states[state].next[key] == 0)
+      {
+        if (states.size() > std::numeric_limits<state_t>::max())
+          throw std::runtime_error("Too many bindings");
+        states[state].next[key] = states.size();
+        states.push_back(State());
+      }
+      state = states[state].next[key];
+      set_bit_(upSnapshot->active, key);
+    }
+
+    Binding binding = {};
+    binding.id = spec.id;
+    binding.key = trigger.keys.back();
+    binding.event = trigger.event;
+    binding.hold = trigger.hold;
+    binding.cb = spec.cb;
+    for (auto const key : trigger.modifiers)
+    {
+      set_bit_(binding.modifiers, key);
+      set_bit_(upSnapshot->modifiers, key);
+      set_bit_(upSnapshot->active, key);
+    }
+    states[state].bindings.push_back(upSnapshot->bindings.size());
+    upSnapshot->bindings.push_back(binding);
+  }
+  return upSnapshot;
+}
+
+
+/* Called with mutex_ locked. Specs are only stored if they compile. */
+void GKSKeyMap::publish_(std::vector<Spec> && specs)
+{
+  auto upSnapshot = compile_(specs);
+  upSnapshot->generation = ++generation_;
+  specs_ = std::move(specs);
+  auto const pOld = pSnapshot_.exchange(upSnapshot.release());
+  retired_.push_back(Retired{pOld, quiescent_.load()});
+  hasRetired_.store(true, std::memory_order_relaxed);
+  collect_();
+}
+
+
+/* Called with mutex_ locked. */
+void GKSKeyMap::collect_()
+{
+  auto const quiescent = quiescent_.load();
+  auto const it = std::partition(retired_.begin(), retired_.end(), [quiescent](Retired const & r) { return r.epoch >= quiescent; });
+  for (auto i = it; i != retired_.end(); ++i)
+    delete i->pSnapshot;
+  retired_.erase(it, retired_.end());
+  hasRetired_.store(!retired_.empty(), std::memory_order_relaxed);
+}
+
+
+unsigned int GKSKeyMap::add(Trigger const & trigger, GKSKeyMap::callback_t const & cb)
+{
+  std::unique_lock<std::mutex> lock (mutex_);
+  auto const id = ++id_;
+  auto specs = specs_;
+  specs.push_back(Spec{id, trigger, cb});
+  publish_(std::move(specs));
+  return id;
+}
+
+
+unsigned int GKSKeyMap::add(GKSKeyMap::key_t key, KeyEventType ket, GKSKeyMap::callback_t const & cb)
+{
+  Trigger trigger;
+  trigger.keys.push_back(key);
+  trigger.event = ket;
+  trigger.hold = clock_t::duration::zero();
+  trigger.interval = clock_t::duration::zero();
+  return add(trigger, cb);
+}
+
+
+void GKSKeyMap::remove(unsigned int id)
+{
+  std::unique_lock<std::mutex> lock (mutex_);
+  auto specs = specs_;
+  auto const it = std::remove_if(specs.begin(), specs.end(), [id](Spec const & spec) { return spec.id == id; });
+  if (it == specs.end())
+    return;
+  specs.erase(it, specs.end());
+  publish_(std::move(specs));
+}
+
+
+void GKSKeyMap::assign(std::vector<binding_t> const & bindings)
+{
+  std::unique_lock<std::mutex> lock (mutex_);
+  std::vector<Spec> specs;
+  for (auto const & b : bindings)
+    specs.push_back(Spec{++id_, b.first, b.second});
+  publish_(std::move(specs));
+}
+
+
+GKSKeyMap::GKSKeyMap(is_key_down_t isKeyDown)
+  : pSnapshot_(nullptr), quiescent_(0), hasRetired_(false), mutex_(), specs_(), retired_(), generation_(0), id_(0),
+    seenGeneration_(0), updates_(0), state_(), current_(0), lastPress_(), timers_(), armed_(), isArmed_(), isKeyDown_(isKeyDown),
+    pExecutor_(nullptr)
+{
+  auto upSnapshot = compile_(specs_);
+  upSnapshot->generation = generation_;
+  pSnapshot_.store(upSnapshot.release());
+}
+
+
+GKSKeyMap::~GKSKeyMap()
+{
+  for (auto const & r : retired_)
+    delete r.pSnapshot;
+  delete pSnapshot_.load();
+}
+
+
+GKSKeyMap::State::State() : next(), interval(clock_t::duration::zero()), bindings()
+{}
@@ -0,0 +1,210 @@
+/*
+*  MIT License
+*
+*  Copyright (c) 2025 Alexander Fedorov
+*
+*  Permission is hereby granted, free of charge, to any person obtaining a copy
+*  of this software and associated documentation files (the "Software"), to deal
+*  in the Software without restriction, including without limitation the rights
+*  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*  copies of the Software, and to permit persons to whom the Software is
+*  furnished to do so, subject to the following conditions:
+*
+*  The above copyright notice and this permission notice shall be included in all
+*  copies or substantial portions of the Software.
+*
+*  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*  SOFTWARE.
+*/
+
+#ifndef KEYMAP_HPP_
+#define KEYMAP_HPP_
+
+#include "vkeys.hpp"
+#include "threads.hpp"
+
+#include <vector>
+#include <array>
+#include <functional>
+#include <chrono>
+#include <atomic>
+#include <memory>
+#include <cstdint>
+
+enum class KeyEventType : int { press=0, release=1, hold=2 };
+
+/* Throws std::runtime_error on unknown name. */
+KeyEventType name2ket(char const * name);
+char const * ket2name(KeyEventType ket);
+
+
+/* Runs actions that key map posts on other thread. */
+class ActionSink
+{
+public:
+  typedef std::function<void()> action_t;
+
+  /* Called from key map thread only. Action must stay alive until idle() returns true. */
+  virtual void post(action_t const * pAction) =0;
+  /* Returns true if all posted actions have run. Called from key map thread only. */
+  virtual bool idle() const =0;
+  virtual ~ActionSink() {}
+};
+
+
+/* Bindings are compiled into automaton over key presses: each state has transition table indexed by virtual
+   key, and bindings that fire when state is reached. Sequences that share prefix share states. Each press
+   also fires bindings of state reached by that key from initial state, so single key binding on F9 fires on
+   every tap, while sequence F9, F9 fires on second, fourth and so on. On key that has no transition from
+   current state, automaton restarts from initial state; it also restarts if next key of sequence is not
+   pressed within its interval. Hold bindings put timer in single timer list that is checked on each update;
+   releasing key cancels it. Bound keys are sampled into bitmask (only keys set in active mask), and edges are
+   found by xor against previous sample.
+
+   Compiled bindings are published as immutable snapshot behind atomic pointer, so bindings may be changed from
+   any thread while update() runs; update() never locks and does not allocate unless snapshot has changed.
+   Replaced snapshots are freed once update() has completed after the swap at a time when executor had no
+   pending actions (so neither can refer to them). */
+class GKSKeyMap
+{
+public:
+  typedef UINT key_t;
+  typedef std::function<void()> callback_t;
+  typedef std::chrono::steady_clock clock_t;
+  typedef bool (*is_key_down_t)(key_t key);
+
+  static const std::size_t keyCount = 256;
+
+  struct Trigger
+  {
+    /* Keys to be pressed in order; binding events refer to the last one. */
+    std::vector<key_t> keys;
+    /* Must be held when last key is pressed; other keys used as modifiers in any binding must not be. */
+    std::vector<key_t> modifiers;
+    KeyEventType event;
+    clock_t::duration hold;
+    clock_t::duration interval;
+  };
+  typedef std::pair<Trigger, callback_t> binding_t;
+
+  /* Called from key map thread only. Returns number of key events (press or release) found. */
+  unsigned int update();
+  bool has_pending_timers() const { return !timers_.empty(); }
+  /* Frees snapshots that are no longer in use. Called from key map thread only; never blocks. */
+  void collect();
+
+  /* May be called from any thread. Each call publishes new snapshot. */
+  unsigned int add(Trigger const & trigger, callback_t const & cb);
+  unsigned int add(key_t key, KeyEventType ket, callback_t const & cb);
+  /* Unknown ids are ignored. */
+  void remove(unsigned int id);
+  /* Replaces all bindings at once. */
+  void assign(std::vector<binding_t> const & bindings);
+
+  /* If set, actions are posted to executor instead of being called from update(). Must be set before
+     key map thread starts. */
+  void set_executor(ActionSink * pExecutor) { pExecutor_ = pExecutor; }
+
+  /* isKeyDown is called from update() for keys that bindings use. */
+  explicit GKSKeyMap(is_key_down_t isKeyDown);
+  ~GKSKeyMap();
+
+private:
+  GKSKeyMap(GKSKeyMap const &) =delete;
+  GKSKeyMap & operator=(GKSKeyMap const &) =delete;
+
+  typedef uint64_t mask_t;
+  static const std::size_t maskBits = 64;
+  static const std::size_t maskSize = keyCount / maskBits;
+  typedef uint16_t state_t;
+
+  struct Binding
+  {
+    unsigned int id;
+    key_t key;
+    KeyEventType event;
+    mask_t modifiers[maskSize];
+    clock_t::duration hold;
+    callback_t cb;
+  };
+
+  struct State
+  {
+    std::array<state_t, keyCount> next;
+    clock_t::duration interval;
+    std::vector<std::size_t> bindings;
+
+    State();
+  };
+
+  struct Snapshot
+  {
+    unsigned long generation;
+    std::vector<State> states;
+    std::vector<Binding> bindings;
+    mask_t active[maskSize];
+    mask_t modifiers[maskSize];
+  };
+
+  struct Spec
+  {
+    unsigned int id;
+    Trigger trigger;
+    callback_t cb;
+  };
+
+  struct Retired
+  {
+    Snapshot const * pSnapshot;
+    unsigned long epoch;
+  };
+
+  struct Timer
+  {
+    clock_t::time_point deadline;
+    std::size_t binding;
+  };
+
+  static void set_bit_(mask_t * mask, key_t key) { mask[key / maskBits] |= mask_t(1) << (key % maskBits); }
+  static std::unique_ptr<Snapshot> compile_(std::vector<Spec> const & specs);
+
+  void publish_(std::vector<Spec> && specs);
+  void collect_();
+  void on_press_(Snapshot const & snapshot, key_t key, clock_t::time_point now);
+  /* Fires, arms or starts timers of bindings of state whose modifiers are held. */
+  void match_(Snapshot const & snapshot, state_t state, clock_t::time_point now);
+  void on_release_(Snapshot const & snapshot, key_t key);
+  void check_timers_(Snapshot const & snapshot, clock_t::time_point now);
+  void fire_(Binding const & binding);
+
+  /* Shared. */
+  std::atomic<Snapshot const *> pSnapshot_;
+  std::atomic<unsigned long> quiescent_;
+  std::atomic<bool> hasRetired_;
+
+  /* Guarded by mutex_. */
+  std::mutex mutex_;
+  std::vector<Spec> specs_;
+  std::vector<Retired> retired_;
+  unsigned long generation_;
+  unsigned int id_;
+
+  /* Key map thread only. */
+  unsigned long seenGeneration_;
+  unsigned long updates_;
+  mask_t state_[maskSize];
+  state_t current_;
+  clock_t::time_point lastPress_;
+  std::vector<Timer> timers_;
+  std::vector<std::size_t> armed_;
+  std::vector<char> isArmed_;
+  is_key_down_t isKeyDown_;
+  ActionSink * pExecutor_;
+};
+
+#endif
@@ -23,8 +23,23 @@
 */
 
 #include "logging.hpp"
+#include "threads.hpp"
 #include <cstdlib>
 #include <cstring>
+#include <stdexcept>
+#include <unordered_map>
+#include <cstdio>
+#include <atomic>
+#include <algorithm>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/types.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
 
 namespace logging
 {
@@ -58,36 +73,606 @@ LogLevel n2ll(std::string const & name)
   return n2ll(name.c_str());
 }
 
-LogMessage::LogMessage(std::string const & source, LogLevel level, std::time_t const & time, std::string const & msg)
+static char const * const g_logSourceNames[] = { "init", "wrapper", "util", "export", "api", "rawinput", "export.input", "export.message" };
+
+static_assert(sizeof(g_logSourceNames) / sizeof(g_logSourceNames[0]) == static_cast<std::size_t>(LogSource::count), "Log source names do not match LogSource");
+
+char const * src2n(LogSource source)
+{
+  auto const i = static_cast<std::size_t>(source);
+  return i < static_cast<std::size_t>(LogSource::count) ? g_logSourceNames[i] : "";
+}
+
+LogSource n2src(char const * name)
+{
+  for (std::size_t i = 0; i < static_cast<std::size_t>(LogSource::count); ++i)
+    if (std::strcmp(g_logSourceNames[i], name) == 0)
+      return static_cast<LogSource>(i);
+  return LogSource::count;
+}
+
+LogSource n2src(std::string const & name)
+{
+  return n2src(name.c_str());
+}
+
+LogMessage::LogMessage(char const * source, LogLevel level, std::time_t const & time, StrRef const & msg)
   : source(source), level(level), time(time), msg(msg)
 {}
 
+void LogRecord::reset(char const * source, LogLevel level, std::time_t time)
+{
+  this->source = source;
+  this->level = level;
+  this->time = time;
+  nArgs = 0;
+  payloadSize = 0;
+}
+
+void LogRecord::add_literal(char const * s)
+{
+  if (nArgs == maxArgs)
+    return;
+  kinds[nArgs] = ArgKind::literal;
+  literals[nArgs] = s;
+  ++nArgs;
+}
+
+void LogRecord::add_value(ArgKind kind, void const * p, std::size_t n)
+{
+  if (nArgs == maxArgs || payloadSize + n > maxPayload)
+    return;
+  kinds[nArgs] = kind;
+  literals[nArgs] = nullptr;
+  ++nArgs;
+  std::memcpy(payload + payloadSize, p, n);
+  payloadSize += n;
+}
+
+void LogRecord::add_string(char const * s, std::size_t n)
+{
+  /* Strings are truncated so that there is still space left for remaining fixed-size args. */
+  std::size_t const reserved = sizeof(uint16_t) + sizeof(uint64_t) * (maxArgs - nArgs);
+  if (nArgs == maxArgs || payloadSize + reserved > maxPayload)
+    return;
+  if (n > maxPayload - payloadSize - reserved)
+    n = maxPayload - payloadSize - reserved;
+  uint16_t const len = static_cast<uint16_t>(n);
+  kinds[nArgs] = ArgKind::string;
+  literals[nArgs] = nullptr;
+  ++nArgs;
+  std::memcpy(payload + payloadSize, &len, sizeof(len));
+  payloadSize += sizeof(len);
+  std::memcpy(payload + payloadSize, s, n);
+  payloadSize += n;
+}
+
+/* Payload may come from file (see blogdec), so reads are checked against its size. */
+template <class T>
+static bool read_payload(uint8_t const *& p, uint8_t const * end, T & v)
+{
+  if (static_cast<std::size_t>(end - p) < sizeof(v))
+    return false;
+  std::memcpy(&v, p, sizeof(v));
+  p += sizeof(v);
+  return true;
+}
+
+StrWriter & print_args(StrWriter & w, LogRecord const & lr)
+{
+  uint8_t const * p = lr.payload;
+  uint8_t const * const end = lr.payload + (lr.payloadSize < LogRecord::maxPayload ? lr.payloadSize : LogRecord::maxPayload);
+  for (std::size_t i = 0; i < lr.nArgs && i < LogRecord::maxArgs; ++i)
+  {
+    bool ok = true;
+    switch (lr.kinds[i])
+    {
+      case ArgKind::literal:
+        if (lr.literals[i])
+          w << lr.literals[i];
+        break;
+      case ArgKind::sint:
+      {
+        int64_t v;
+        if ((ok = read_payload(p, end, v)))
+          w << v;
+        break;
+      }
+      case ArgKind::uint:
+      {
+        uint64_t v;
+        if ((ok = read_payload(p, end, v)))
+          w << v;
+        break;
+      }
+      case ArgKind::real:
+      {
+        double v;
+        if ((ok = read_payload(p, end, v)))
+          w << v;
+        break;
+      }
+      case ArgKind::pointer:
+      {
+        uint64_t v;
+        if ((ok = read_payload(p, end, v)))
+          w << reinterpret_cast<void const *>(static_cast<uintptr_t>(v));
+        break;
+      }
+      case ArgKind::boolean:
+      {
+        uint8_t v;
+        if ((ok = read_payload(p, end, v)))
+          w << static_cast<bool>(v);
+        break;
+      }
+      case ArgKind::character:
+      {
+        char v;
+        if ((ok = read_payload(p, end, v)))
+          w << v;
+        break;
+      }
+      case ArgKind::string:
+      {
+        uint16_t len;
+        if ((ok = read_payload(p, end, len) && len <= end - p))
+        {
+          w.write(reinterpret_cast<char const *>(p), len);
+          p += len;
+        }
+        break;
+      }
+      default:
+        ok = false;
+        break;
+    }
+    if (!ok)
+      return w << "<bad payload>";
+  }
+  return w;
+}
+
+LogRecord & local_log_record()
+{
+  static thread_local LogRecord lr;
+  return lr;
+}
+
+void format_default(StrWriter & w, LogMessage const & lm)
+{
+  /* Time string is only reformatted when the second changes. */
+  static thread_local std::time_t cachedTime = -1;
+  static thread_local char timeCstr[16] = {0};
+  if (lm.time != cachedTime)
+  {
+    static char const fmt[] = "%H:%M:%S";
+    auto time = std::localtime(&lm.time);
+    std::strftime(timeCstr, sizeof(timeCstr), fmt, time);
+    cachedTime = lm.time;
+  }
+  strm(w, "(", lm.source, ") <", timeCstr, "> [", lm.level, "] ", lm.msg);
+}
+
 void StreamLogPrinter::print(LogMessage const & lm) const
 {
-  auto const msg = formatter_(lm);
-  streamHolder_() << msg << std::endl;
+  static thread_local StrBuffer<maxLineSize> line;
+  line.clear();
+  formatter_(line, lm);
+  streamHolder_().write(line.data(), line.size()) << std::endl;
 }
 
 StreamLogPrinter::StreamLogPrinter(formatter_t const & formatter, stream_holder_t const & streamHolder)
   : formatter_(formatter), streamHolder_(streamHolder)
 {}
 
+struct MappedFileLogPrinter::Impl
+{
+  typedef std::mutex mutex_t;
+  typedef std::unique_lock<mutex_t> lock_t;
+
+  formatter_t formatter;
+  std::string path;
+  std::size_t maxSize;
+  unsigned int maxFiles;
+  char * begin;
+  std::size_t used;
+#ifdef _WIN32
+  HANDLE hFile, hMapping;
+#else
+  int fd;
+#endif
+  mutex_t mutex;
+
+  void open()
+  {
+    used = 0;
+#ifdef _WIN32
+    hFile = CreateFileA(path.c_str(), GENERIC_READ|GENERIC_WRITE, FILE_SHARE_READ, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (hFile == INVALID_HANDLE_VALUE)
+      throw std::runtime_error(stream_to_str("Failed to open log file: ", path));
+    uint64_t const size = maxSize;
+    hMapping = CreateFileMappingA(hFile, NULL, PAGE_READWRITE, static_cast<DWORD>(size >> 32), static_cast<DWORD>(size), NULL);
+    if (hMapping == NULL)
+    {
+      CloseHandle(hFile);
+      throw std::runtime_error(stream_to_str("Failed to create mapping of log file: ", path));
+    }
+    begin = static_cast<char *>(MapViewOfFile(hMapping, FILE_MAP_WRITE, 0, 0, maxSize));
+    if (begin == NULL)
+    {
+      CloseHandle(hMapping);
+      CloseHandle(hFile);
+      throw std::runtime_error(stream_to_str("Failed to map log file: ", path));
+    }
+#else
+    fd = ::open(path.c_str(), O_RDWR|O_CREAT|O_TRUNC, 0644);
+    if (fd == -1)
+      throw std::runtime_error(stream_to_str("Failed to open log file: ", path));
+    void * p = MAP_FAILED;
+    if (ftruncate(fd, maxSize) == 0)
+      p = mmap(NULL, maxSize, PROT_READ|PROT_WRITE, MAP_SHARED, fd, 0);
+    if (p == MAP_FAILED)
+    {
+      ::close(fd);
+      throw std::runtime_error(stream_to_str("Failed to map log file: ", path));
+    }
+    begin = static_cast<char *>(p);
+#endif
+  }
+
+  /* Unmaps segment and cuts file to written size. */
+  void close()
+  {
+    if (begin == nullptr)
+      return;
+#ifdef _WIN32
+    UnmapViewOfFile(begin);
+    CloseHandle(hMapping);
+    LONG high = static_cast<LONG>(static_cast<uint64_t>(used) >> 32);
+    SetFilePointer(hFile, static_cast<LONG>(used), &high, FILE_BEGIN);
+    SetEndOfFile(hFile);
+    CloseHandle(hFile);
+#else
+    munmap(begin, maxSize);
+    /* If this fails, file just keeps zero-filled tail. */
+    int const r = ftruncate(fd, used);
+    static_cast<void>(r);
+    ::close(fd);
+#endif
+    begin = nullptr;
+  }
+
+  void rotate()
+  {
+    close();
+    for (unsigned int i = maxFiles; i > 0; --i)
+    {
+      auto const to = stream_to_str(path, ".", i);
+      std::remove(to.c_str());
+      auto const from = i > 1 ? stream_to_str(path, ".", i - 1) : path;
+      std::rename(from.c_str(), to.c_str());
+    }
+    if (maxFiles == 0)
+      std::remove(path.c_str());
+    open();
+  }
+
+  void write(char const * data, std::size_t n)
+  {
+    if (n > maxSize)
+      n = maxSize;
+    if (used + n > maxSize)
+      rotate();
+    std::memcpy(begin + used, data, n);
+    used += n;
+  }
+
+  Impl(formatter_t const & formatter, std::string const & path, std::size_t maxSize, unsigned int maxFiles)
+    : formatter(formatter), path(path), maxSize(maxSize), maxFiles(maxFiles), begin(nullptr), used(0), mutex()
+  {}
+};
+
+void MappedFileLogPrinter::print(LogMessage const & lm) const
+{
+  static thread_local StrBuffer<StreamLogPrinter::maxLineSize> line;
+  line.clear();
+  upImpl_->formatter(line, lm);
+  line.put('\n');
+  Impl::lock_t l (upImpl_->mutex);
+  try {
+    if (upImpl_->begin != nullptr)
+      upImpl_->write(line.data(), line.size());
+  } catch (std::exception const &)
+  {
+    /* Failed to rotate; further messages are dropped. */
+  }
+}
+
+MappedFileLogPrinter::MappedFileLogPrinter(formatter_t const & formatter, std::string const & path, std::size_t maxSize, unsigned int maxFiles)
+  : upImpl_(new Impl(formatter, path, maxSize, maxFiles))
+{
+  if (maxSize == 0)
+    throw std::runtime_error("Log file size must not be 0");
+  upImpl_->open();
+}
+
+MappedFileLogPrinter::~MappedFileLogPrinter()
+{
+  upImpl_->close();
+}
+
+/* Format site is identified by source, argument kinds and addresses of literals. */
+struct SiteKey
+{
+  char const * source;
+  std::size_t nArgs;
+  ArgKind kinds[LogRecord::maxArgs];
+  char const * literals[LogRecord::maxArgs];
+
+  bool operator==(SiteKey const & other) const
+  {
+    if (source != other.source || nArgs != other.nArgs)
+      return false;
+    for (std::size_t i = 0; i < nArgs; ++i)
+      if (kinds[i] != other.kinds[i] || literals[i] != other.literals[i])
+        return false;
+    return true;
+  }
+
+  SiteKey() : source(nullptr), nArgs(0) {}
+
+  explicit SiteKey(LogRecord const & lr) : source(lr.source), nArgs(lr.nArgs)
+  {
+    std::copy(lr.kinds, lr.kinds + lr.nArgs, kinds);
+    std::copy(lr.literals, lr.literals + lr.nArgs, literals);
+  }
+};
+
+struct SiteKeyHash
+{
+  std::size_t operator()(SiteKey const & key) const
+  {
+    std::size_t h = std::hash<void const *>()(key.source);
+    for (std::size_t i = 0; i < key.nArgs; ++i)
+      h = h * 31 + static_cast<std::size_t>(key.kinds[i]) + std::hash<void const *>()(key.literals[i]);
+    return h;
+  }
+};
+
+char const BinaryLogPrinter::magic[8] = { 'R', 'I', 'B', 'L', 'O', 'G', '\0', '\0' };
+uint32_t const BinaryLogPrinter::version;
+
+struct BinaryLogPrinter::Impl
+{
+  typedef std::mutex mutex_t;
+  typedef std::unique_lock<mutex_t> lock_t;
+
+  stream_holder_t streamHolder;
+  std::unordered_map<SiteKey, uint32_t, SiteKeyHash> sites;
+  mutex_t mutex;
+
+  template <class T>
+  void write(std::ostream & os, T const & v)
+  {
+    os.write(reinterpret_cast<char const *>(&v), sizeof(v));
+  }
+
+  void write_str(std::ostream & os, char const * s)
+  {
+    uint16_t const len = static_cast<uint16_t>(std::strlen(s));
+    write(os, len);
+    os.write(s, len);
+  }
+
+  Impl(stream_holder_t const & streamHolder) : streamHolder(streamHolder), sites(), mutex() {}
+};
+
+void BinaryLogPrinter::print(LogRecord const & lr)
+{
+  auto & impl = *upImpl_;
+  Impl::lock_t l (impl.mutex);
+  auto & os = impl.streamHolder();
+
+  SiteKey const key (lr);
+  auto it = impl.sites.find(key);
+  if (it == impl.sites.end())
+  {
+    uint32_t const id = static_cast<uint32_t>(impl.sites.size());
+    it = impl.sites.insert(std::make_pair(key, id)).first;
+    impl.write(os, static_cast<uint8_t>(tagSite));
+    impl.write(os, id);
+    impl.write_str(os, lr.source);
+    impl.write(os, static_cast<uint8_t>(lr.nArgs));
+    for (std::size_t i = 0; i < lr.nArgs; ++i)
+    {
+      impl.write(os, lr.kinds[i]);
+      if (lr.kinds[i] == ArgKind::literal)
+        impl.write_str(os, lr.literals[i]);
+    }
+  }
+
+  impl.write(os, static_cast<uint8_t>(tagMessage));
+  impl.write(os, it->second);
+  impl.write(os, static_cast<uint8_t>(lr.level));
+  impl.write(os, static_cast<int64_t>(lr.time));
+  impl.write(os, static_cast<uint16_t>(lr.payloadSize));
+  os.write(reinterpret_cast<char const *>(lr.payload), lr.payloadSize);
+}
+
+BinaryLogPrinter::BinaryLogPrinter(stream_holder_t const & streamHolder)
+  : upImpl_(new Impl(streamHolder))
+{
+  auto & os = upImpl_->streamHolder();
+  os.write(magic, sizeof(magic));
+  upImpl_->write(os, version);
+}
+
+BinaryLogPrinter::~BinaryLogPrinter()
+{
+  upImpl_->streamHolder().flush();
+}
+
 void Logger::log(LogMessage const & lm)
 {
-  if (static_cast<int>(lm.level) < static_cast<int>(level_))
-    return;
   for (auto const & sp : printers_)
     sp->print(lm);
 }
 
+/* Consecutive messages from the same format site and of the same level on the same thread are only printed
+   once per window; the rest are counted (not formatted) and reported in a summary message. Summary is printed
+   when other message comes on that thread, or by flush_repeats() once window has passed. State is kept per
+   thread, so logging threads do not contend for a lock; lock of thread state is only shared with
+   flush_repeats(). */
+struct Logger::RepeatState
+{
+  typedef std::mutex mutex_t;
+  typedef std::unique_lock<mutex_t> lock_t;
+  typedef std::chrono::steady_clock clock_t;
+
+  struct Thread
+  {
+    SiteKey lastKey;
+    LogLevel lastLevel;
+    clock_t::time_point windowStart;
+    unsigned long nRepeats;
+    mutex_t mutex;
+
+    /* Called with mutex locked. */
+    void print_summary(Logger & logger, std::time_t time);
+
+    Thread() : lastKey(), lastLevel(LogLevel::notset), windowStart(), nRepeats(0), mutex() {}
+  };
+
+  /* Read without lock by every logging thread. */
+  std::atomic<clock_t::rep> window;
+  /* Identifies logger in per-thread cache, since address of destroyed logger can be reused. */
+  uint64_t const id;
+  /* States of threads that have logged with suppression enabled. */
+  std::vector<std::shared_ptr<Thread> > threads;
+  mutex_t mutex;
+
+  /* Returns state of calling thread; registers it on first call. */
+  Thread & local();
+
+  RepeatState() : window(0), id(next_id()), threads(), mutex() {}
+
+private:
+  static uint64_t next_id()
+  {
+    static std::atomic<uint64_t> lastId (0);
+    return ++lastId;
+  }
+};
+
+Logger::RepeatState::Thread & Logger::RepeatState::local()
+{
+  static thread_local std::vector<std::pair<uint64_t, std::shared_ptr<Thread> > > states;
+  for (auto const & p : states)
+    if (p.first == id)
+      return *p.second;
+  auto const spThread = std::make_shared<Thread>();
+  {
+    lock_t l (mutex);
+    threads.push_back(spThread);
+  }
+  states.push_back(std::make_pair(id, spThread));
+  return *spThread;
+}
+
+void Logger::RepeatState::Thread::print_summary(Logger & logger, std::time_t time)
+{
+  if (nRepeats == 0)
+    return;
+  LogRecord summary;
+  summary.reset(lastKey.source, lastLevel, time);
+  encode_args(summary, "last message repeated ", nRepeats, " times");
+  nRepeats = 0;
+  logger.print_(summary);
+}
+
+void Logger::log(LogRecord const & lr)
+{
+  auto & rs = *upRepeatState_;
+  RepeatState::clock_t::duration const window (rs.window.load(std::memory_order_relaxed));
+  if (window != RepeatState::clock_t::duration::zero())
+  {
+    auto & ts = rs.local();
+    RepeatState::lock_t l (ts.mutex);
+    auto const now = RepeatState::clock_t::now();
+    SiteKey const key (lr);
+    if (key == ts.lastKey && lr.level == ts.lastLevel && now - ts.windowStart < window)
+    {
+      ++ts.nRepeats;
+      return;
+    }
+    ts.print_summary(*this, lr.time);
+    ts.lastKey = key;
+    ts.lastLevel = lr.level;
+    ts.windowStart = now;
+  }
+  print_(lr);
+}
+
+void Logger::flush_repeats(bool all)
+{
+  auto & rs = *upRepeatState_;
+  RepeatState::clock_t::duration const window (rs.window.load(std::memory_order_relaxed));
+  RepeatState::lock_t l (rs.mutex);
+  auto const now = RepeatState::clock_t::now();
+  for (auto const & spThread : rs.threads)
+  {
+    RepeatState::lock_t tl (spThread->mutex);
+    if (spThread->nRepeats == 0 || (!all && now - spThread->windowStart < window))
+      continue;
+    spThread->print_summary(*this, std::time(nullptr));
+    /* Next message of the same site starts new window. */
+    spThread->lastKey = SiteKey();
+  }
+  /* States of exited threads are only referenced here; they are dropped once their summary is printed. */
+  rs.threads.erase(std::remove_if(rs.threads.begin(), rs.threads.end(),
+    [](std::shared_ptr<RepeatState::Thread> const & sp) { return sp.use_count() == 1 && sp->nRepeats == 0; }), rs.threads.end());
+}
+
+void Logger::set_repeat_window(std::chrono::milliseconds window)
+{
+  upRepeatState_->window.store(std::chrono::duration_cast<RepeatState::clock_t::duration>(window).count(), std::memory_order_relaxed);
+}
+
+void Logger::print_(LogRecord const & lr)
+{
+  for (auto const & sp : recordPrinters_)
+    sp->print(lr);
+  if (!printers_.empty())
+  {
+    static thread_local StrBuffer<maxMessageSize> msg;
+    msg.clear();
+    print_args(msg, lr);
+    LogMessage const lm (lr.source, lr.level, lr.time, msg.str());
+    log(lm);
+  }
+}
+
 void Logger::set_level(LogLevel level)
 {
-  level_ = level;
+  for (auto & l : levels_)
+    l.store(level, std::memory_order_relaxed);
+}
+
+void Logger::set_level(LogSource source, LogLevel level)
+{
+  auto const i = static_cast<std::size_t>(source);
+  if (i >= static_cast<std::size_t>(LogSource::count))
+    throw std::runtime_error("Invalid log source");
+  levels_[i].store(level, std::memory_order_relaxed);
 }
 
-LogLevel Logger::get_level() const
+LogLevel Logger::get_level(LogSource source) const
 {
-  return level_;
+  auto const i = static_cast<std::size_t>(source);
+  if (i >= static_cast<std::size_t>(LogSource::count))
+    throw std::runtime_error("Invalid log source");
+  return levels_[i].load(std::memory_order_relaxed);
 }
 
 void Logger::add_printer(std::shared_ptr<LogPrinter> const & spPrinter)
@@ -97,8 +682,22 @@ void Logger::add_printer(std::shared_ptr<LogPrinter> const & spPrinter)
   printers_.push_back(spPrinter);
 }
 
+void Logger::add_printer(std::shared_ptr<LogRecordPrinter> const & spPrinter)
+{
+  if (spPrinter == nullptr)
+    throw std::runtime_error("Log record printer ptr is NULL");
+  recordPrinters_.push_back(spPrinter);
+}
+
 Logger::Logger(LogLevel level)
-  : level_(level), printers_()
+  : printers_(), recordPrinters_(), upRepeatState_(new RepeatState())
+{
+  set_level(level);
+}
+
+/* Pending summaries are not printed here: root logger is destroyed during static destruction, when streams of
+   printers may be gone. See flush_repeats(). */
+Logger::~Logger()
 {}
 
 Logger & root_logger()
@@ -32,8 +32,21 @@
 #include <functional>
 #include <memory>
 #include <ctime>
+#include <cstdint>
+#include <type_traits>
+#include <ostream>
+#include <chrono>
+#include <atomic>
 
 /* Logging */
+namespace logging
+{
+class Literal;
+}
+
+/* "text"_lit marks static format text of log message, see logging::Literal. */
+logging::Literal operator"" _lit(char const * s, std::size_t);
+
 namespace logging
 {
 
@@ -43,21 +56,225 @@ char const * ll2n(LogLevel level);
 LogLevel n2ll(char const * name);
 LogLevel n2ll(std::string const & name);
 
+/* Log sources are interned to small integers at compile time, so that per-source level check
+   in Logger::log() is a single array load. Exported functions are split into categories: raw input ones
+   ("rawinput"), keyboard, mouse, cursor and hook ones ("export.input"), message queue and window procedure
+   ones ("export.message"), and the rest ("export"). */
+enum class LogSource : uint8_t { init=0, wrapper, util, exports, api, rawinput, input_exports, message_exports, count };
+
+char const * src2n(LogSource source);
+LogSource n2src(char const * name);
+LogSource n2src(std::string const & name);
+
 inline std::ostream & operator<<(std::ostream & os, LogLevel logLevel)
 {
   return os << ll2n(logLevel);
 }
 
+inline StrWriter & operator<<(StrWriter & w, LogLevel logLevel)
+{
+  return w << ll2n(logLevel);
+}
+
+/* Message text is not owned; it is only valid during LogPrinter::print() call. */
 struct LogMessage
 {
-  std::string source;
+  char const * source;
   LogLevel level;
   std::time_t time;
-  std::string msg;
+  StrRef msg;
+
+  LogMessage(char const * source, LogLevel level, std::time_t const & time, StrRef const & msg);
+};
 
-  LogMessage(std::string const & source, LogLevel level, std::time_t const & time, std::string const & msg);
+/* Static format text of log message: stored in log record by pointer and defines format site together
+   with other literals of message. Made by "text"_lit only, so that it can not refer to a buffer. */
+class Literal
+{
+public:
+  char const * str() const { return s_; }
+
+private:
+  explicit Literal(char const * s) : s_(s) {}
+  friend Literal (::operator"" _lit)(char const * s, std::size_t);
+
+  char const * s_;
+};
+
+/* Log record: message arguments kept in binary form, so that text formatting can be deferred
+   (or done offline, see BinaryLogPrinter and blogdec). Literals are stored by pointer; everything
+   else, including char arrays, is stored by value. */
+enum class ArgKind : uint8_t { literal=0, sint=1, uint=2, real=3, pointer=4, boolean=5, character=6, string=7 };
+
+struct LogRecord
+{
+  static std::size_t const maxArgs = 16;
+  static std::size_t const maxPayload = 1024;
+
+  char const * source;
+  LogLevel level;
+  std::time_t time;
+  std::size_t nArgs;
+  ArgKind kinds[maxArgs];
+  char const * literals[maxArgs];
+  std::size_t payloadSize;
+  uint8_t payload[maxPayload];
+
+  void reset(char const * source, LogLevel level, std::time_t time);
+  void add_literal(char const * s);
+  void add_value(ArgKind kind, void const * p, std::size_t n);
+  void add_string(char const * s, std::size_t n);
+};
+
+/* Writes record arguments as text, the same way as stream_to_str() would have. Arguments that do not fit
+   in payload (e.g. of corrupt record read from file) are not read; "<bad payload>" is written instead. */
+StrWriter & print_args(StrWriter & w, LogRecord const & lr);
+
+namespace detail
+{
+
+/* Keeps arrays, so that they are not taken for pointers. */
+template <class T>
+struct arg_type
+{
+  typedef typename std::remove_reference<T>::type U;
+  typedef typename std::conditional<std::is_array<U>::value, U, typename std::remove_cv<U>::type>::type type;
 };
 
+template <class T, class Enable=void>
+struct ArgEncoder
+{
+  static void encode(LogRecord & lr, T const & t)
+  {
+    auto const s = stream_to_str(t);
+    lr.add_string(s.data(), s.size());
+  }
+};
+
+template <>
+struct ArgEncoder<Literal>
+{
+  static void encode(LogRecord & lr, Literal t) { lr.add_literal(t.str()); }
+};
+
+/* Unmarked string literals are copied too: array may as well be a local buffer. */
+template <std::size_t N>
+struct ArgEncoder<char const[N]>
+{
+  static void encode(LogRecord & lr, char const (&t)[N]) { lr.add_string(t, std::char_traits<char>::length(t)); }
+};
+
+template <std::size_t N>
+struct ArgEncoder<char[N]> : ArgEncoder<char const[N]> {};
+
+template <>
+struct ArgEncoder<char const *>
+{
+  static void encode(LogRecord & lr, char const * t) { lr.add_string(t, t ? std::char_traits<char>::length(t) : 0); }
+};
+
+template <>
+struct ArgEncoder<char *> : ArgEncoder<char const *> {};
+
+template <>
+struct ArgEncoder<std::string>
+{
+  static void encode(LogRecord & lr, std::string const & t) { lr.add_string(t.data(), t.size()); }
+};
+
+template <class T>
+struct ArgEncoder<std::shared_ptr<T> >
+{
+  static void encode(LogRecord & lr, std::shared_ptr<T> const & t) { ArgEncoder<T *>::encode(lr, t.get()); }
+};
+
+template <>
+struct ArgEncoder<LogLevel>
+{
+  static void encode(LogRecord & lr, LogLevel t) { lr.add_literal(ll2n(t)); }
+};
+
+template <>
+struct ArgEncoder<bool>
+{
+  static void encode(LogRecord & lr, bool t) { uint8_t const v = t; lr.add_value(ArgKind::boolean, &v, sizeof(v)); }
+};
+
+template <>
+struct ArgEncoder<char>
+{
+  static void encode(LogRecord & lr, char t) { lr.add_value(ArgKind::character, &t, sizeof(t)); }
+};
+
+template <>
+struct ArgEncoder<signed char> : ArgEncoder<char> {};
+
+template <>
+struct ArgEncoder<unsigned char> : ArgEncoder<char> {};
+
+template <class T>
+struct ArgEncoder<T, typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value>::type>
+{
+  static void encode(LogRecord & lr, T t) { int64_t const v = t; lr.add_value(ArgKind::sint, &v, sizeof(v)); }
+};
+
+template <class T>
+struct ArgEncoder<T, typename std::enable_if<std::is_integral<T>::value && std::is_unsigned<T>::value>::type>
+{
+  static void encode(LogRecord & lr, T t) { uint64_t const v = t; lr.add_value(ArgKind::uint, &v, sizeof(v)); }
+};
+
+/* Enums are stored as their underlying integer (as ostream prints unscoped ones), so that they are not formatted
+   through stream_to_str(). Enums that need names have their own encoder, see LogLevel. */
+template <class T>
+struct ArgEncoder<T, typename std::enable_if<std::is_enum<T>::value>::type>
+{
+  typedef typename std::underlying_type<T>::type U;
+
+  static void encode(LogRecord & lr, T t)
+  {
+    if (std::is_signed<U>::value)
+    {
+      int64_t const v = static_cast<U>(t);
+      lr.add_value(ArgKind::sint, &v, sizeof(v));
+    }
+    else
+    {
+      uint64_t const v = static_cast<U>(t);
+      lr.add_value(ArgKind::uint, &v, sizeof(v));
+    }
+  }
+};
+
+template <class T>
+struct ArgEncoder<T, typename std::enable_if<std::is_floating_point<T>::value>::type>
+{
+  static void encode(LogRecord & lr, T t) { double const v = t; lr.add_value(ArgKind::real, &v, sizeof(v)); }
+};
+
+template <class T>
+struct ArgEncoder<T, typename std::enable_if<std::is_pointer<T>::value>::type>
+{
+  static void encode(LogRecord & lr, T t) { uint64_t const v = reinterpret_cast<uintptr_t>(t); lr.add_value(ArgKind::pointer, &v, sizeof(v)); }
+};
+
+} //detail
+
+inline void encode_args(LogRecord &)
+{}
+
+template <typename T, typename... R>
+void encode_args(LogRecord & lr, T&& t, R&&... r)
+{
+  detail::ArgEncoder<typename detail::arg_type<T>::type>::encode(lr, t);
+  encode_args(lr, r...);
+}
+
+LogRecord & local_log_record();
+
+/* Formats message as "(source) <HH:MM:SS> [LEVEL] msg". */
+void format_default(StrWriter & w, LogMessage const & lm);
+
 class LogPrinter
 {
 public:
@@ -69,9 +286,11 @@ public:
 class StreamLogPrinter : public LogPrinter
 {
 public:
-  typedef std::function<std::string(LogMessage const &)> formatter_t;
+  typedef std::function<void(StrWriter &, LogMessage const &)> formatter_t;
   typedef std::function<std::ostream&()> stream_holder_t;
 
+  static std::size_t const maxLineSize = 2048;
+
   virtual void print(LogMessage const & lm) const;
 
   StreamLogPrinter(formatter_t const & formatter, stream_holder_t const & streamHolder);
@@ -81,42 +300,119 @@ private:
   stream_holder_t streamHolder_;
 };
 
+/* Writes formatted lines into a preallocated memory-mapped segment of file by plain memcpy; flushing
+   is left to OS. When segment is full, file is truncated to written size and rotated to path.1 .. path.N.
+   If process crashes, unwritten tail of segment remains zero-filled. */
+class MappedFileLogPrinter : public LogPrinter
+{
+public:
+  typedef StreamLogPrinter::formatter_t formatter_t;
+
+  virtual void print(LogMessage const & lm) const;
+
+  MappedFileLogPrinter(formatter_t const & formatter, std::string const & path, std::size_t maxSize, unsigned int maxFiles);
+  ~MappedFileLogPrinter();
+
+private:
+  struct Impl;
+  std::unique_ptr<Impl> upImpl_;
+};
+
+class LogRecordPrinter
+{
+public:
+  virtual void print(LogRecord const & lr) =0;
+
+  virtual ~LogRecordPrinter() {}
+};
+
+/* Binary log sink: instead of text, writes format site definitions (source, argument kinds and
+   literal text), once per site, followed by messages referring to site by id and carrying
+   timestamp and raw argument bytes. See blogdec.cpp for decoder. */
+class BinaryLogPrinter : public LogRecordPrinter
+{
+public:
+  typedef std::function<std::ostream&()> stream_holder_t;
+
+  static char const magic[8];
+  static uint32_t const version = 1;
+  enum : uint8_t { tagSite = 'S', tagMessage = 'M' };
+
+  virtual void print(LogRecord const & lr);
+
+  BinaryLogPrinter(stream_holder_t const & streamHolder);
+  ~BinaryLogPrinter();
+
+private:
+  struct Impl;
+  std::unique_ptr<Impl> upImpl_;
+};
+
 class Logger
 {
 public:
   template <typename... T>
-  void log(char const * source, LogLevel level, const T&... t)
+  void log(LogSource source, LogLevel level, T&&... t)
   {
-    if (static_cast<int>(level) < static_cast<int>(level_))
+    static_assert(sizeof...(T) <= LogRecord::maxArgs, "Too many log message arguments");
+    if (static_cast<int>(level) < static_cast<int>(levels_[static_cast<std::size_t>(source)].load(std::memory_order_relaxed)))
       return;
-    auto const msg = stream_to_str(t...);
-    auto const time = std::time(nullptr);
-    LogMessage const lm (source, level, time, msg);
-    log(lm);
+    LogRecord & lr = local_log_record();
+    lr.reset(src2n(source), level, std::time(nullptr));
+    encode_args(lr, t...);
+    log(lr);
   }
 
+  /* These do not check level; it is checked in log(source, level, ...) above. */
   void log(LogMessage const & lm);
+  void log(LogRecord const & lr);
 
+  /* Sets level for all sources. */
   void set_level(LogLevel level);
-  LogLevel get_level() const;
+  void set_level(LogSource source, LogLevel level);
+  LogLevel get_level(LogSource source) const;
+
+  /* Consecutive messages from the same format site and of the same level on the same thread within window are
+     suppressed and reported as "last message repeated N times". Zero window disables suppression. */
+  void set_repeat_window(std::chrono::milliseconds window);
+  /* Prints summaries of suppressed messages whose window has passed; otherwise summary of a trailing burst
+     would wait for next message. Called periodically, and with all set on shutdown (while printers are alive)
+     to print pending summaries regardless of window; destructor does not print them. */
+  void flush_repeats(bool all=false);
 
   void add_printer(std::shared_ptr<LogPrinter> const & spPrinter);
+  void add_printer(std::shared_ptr<LogRecordPrinter> const & spPrinter);
 
   Logger(LogLevel level=LogLevel::notset);
+  ~Logger();
 
 private:
-  LogLevel level_;
+  static std::size_t const maxMessageSize = 2048;
+
+  struct RepeatState;
+
+  void print_(LogRecord const & lr);
+
+  /* Levels can be changed on config reload while other threads log. */
+  std::atomic<LogLevel> levels_[static_cast<std::size_t>(LogSource::count)];
   std::vector<std::shared_ptr<LogPrinter> > printers_;
+  std::vector<std::shared_ptr<LogRecordPrinter> > recordPrinters_;
+  std::unique_ptr<RepeatState> upRepeatState_;
 };
 
 Logger & root_logger();
 
 template <typename... T>
-void log(char const * source, LogLevel level, const T&... t)
+void log(LogSource source, LogLevel level, T&&... t)
 {
   root_logger().log(source, level, t...);
 }
 
 } //logging
 
+inline logging::Literal operator"" _lit(char const * s, std::size_t)
+{
+  return logging::Literal(s);
+}
+
 #endif 
@@ -0,0 +1,731 @@
+/*
+*  MIT License
+*
+*  Copyright (c) 2025 Alexander Fedorov
+*
+*  Permission is hereby granted, free of charge, to any person obtaining a copy
+*  of this software and associated documentation files (the "Software"), to deal
+*  in the Software without restriction, including without limitation the rights
+*  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*  copies of the Software, and to permit persons to whom the Software is
+*  furnished to do so, subject to the following conditions:
+*
+*  The above copyright notice and this permission notice shall be included in all
+*  copies or substantial portions of the Software.
+*
+*  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*  SOFTWARE.
+*/
+
+#include "rawinput.hpp"
+#include "logging.hpp"
+#include "util.hpp"
+#include "vkeys.hpp"
+
+#include <stdexcept>
+#include <limits>
+#include <algorithm>
+#include <cstdlib>
+
+
+/* Returns slot of handle or empty slot where it belongs. */
+std::size_t DeviceIndex::slot_(HANDLE handle) const
+{
+  auto const mask = table_.size() - 1;
+  /* Fibonacci hashing: handles are small multiples of 4 or so, low bits alone are poor. */
+  auto i = static_cast<std::size_t>((reinterpret_cast<uintptr_t>(handle) * UINT64_C(0x9E3779B97F4A7C15)) >> 32) & mask;
+  while (table_[i] != 0 && handles_[table_[i] - 1] != handle)
+    i = (i + 1) & mask;
+  return i;
+}
+
+
+std::size_t DeviceIndex::find(HANDLE handle) const
+{
+  auto const entry = table_[slot_(handle)];
+  return entry == 0 ? npos : entry - 1;
+}
+
+
+std::size_t DeviceIndex::add(HANDLE handle)
+{
+  auto const i = slot_(handle);
+  if (table_[i] != 0)
+    return table_[i] - 1;
+  handles_.push_back(handle);
+  if (handles_.size() * 2 > table_.size())
+    rehash_(table_.size() * 2);
+  else
+    table_[i] = handles_.size();
+  return handles_.size() - 1;
+}
+
+
+void DeviceIndex::rehash_(std::size_t capacity)
+{
+  table_.assign(capacity, 0);
+  for (std::size_t index = 0; index < handles_.size(); ++index)
+    table_[slot_(handles_[index])] = index + 1;
+}
+
+
+DeviceIndex::DeviceIndex()
+  : handles_(), table_(8, 0)
+{}
+
+
+void CompositeRawInputTest::begin_batch(clock_t::time_point now)
+{
+  for (auto & spChild : children_)
+    spChild->begin_batch(now);
+}
+
+
+/* Stops at first result that differs from initial one: for and/or it decides the result, and later children
+   (e.g. arbitration) only see input that passed earlier ones. */
+bool CompositeRawInputTest::test(PRAWINPUT pRawInput)
+{
+  auto r = initial_;
+  for (auto & spChild : children_)
+  {
+    r = combine_(r, spChild->test(pRawInput));
+    if (r != initial_)
+      break;
+  }
+  return r;
+}
+
+
+void CompositeRawInputTest::add(std::shared_ptr<RawInputTest> const & spChild)
+{
+  children_.push_back(spChild);
+}
+
+
+CompositeRawInputTest::CompositeRawInputTest(combine_t const & combine, bool initial)
+  : combine_(combine), initial_(initial), children_()
+{}
+
+
+bool DeviceMaskRawInputTest::test(PRAWINPUT pRawInput)
+{
+  auto const i = index_.find(pRawInput->header.hDevice);
+  if (i == DeviceIndex::npos)
+    return true;
+  auto const & bits = *pBits_.load(std::memory_order_acquire);
+  return (bits[i / 64].load(std::memory_order_relaxed) >> (i % 64)) & 1;
+}
+
+
+std::size_t DeviceMaskRawInputTest::add(HANDLE hDevice, bool state)
+{
+  auto const size = index_.size();
+  auto const i = index_.add(hDevice);
+  if (i == size)
+  {
+    if (i >= words * 64)
+      throw std::runtime_error(stream_to_str("Too many devices, at most ", words * 64, " are supported"));
+    mask_t mask {};
+    mask[i / 64] = uint64_t(1) << (i % 64);
+    set(mask, state);
+  }
+  return i;
+}
+
+
+void DeviceMaskRawInputTest::set(mask_t const & mask, bool state)
+{
+  std::unique_lock<std::mutex> l (writeMutex_);
+  auto & bits_ = *pBits_.load();
+  for (std::size_t w = 0; w < words; ++w)
+    if (mask[w])
+    {
+      if (state)
+        bits_[w].fetch_or(mask[w]);
+      else
+        bits_[w].fetch_and(~mask[w]);
+    }
+}
+
+
+void DeviceMaskRawInputTest::toggle(mask_t const & mask)
+{
+  std::unique_lock<std::mutex> l (writeMutex_);
+  auto & bits_ = *pBits_.load();
+  for (std::size_t w = 0; w < words; ++w)
+    if (mask[w])
+      bits_[w].fetch_xor(mask[w]);
+}
+
+
+DeviceMaskRawInputTest::mask_t DeviceMaskRawInputTest::get(mask_t const & mask) const
+{
+  auto const & bits_ = *pBits_.load();
+  mask_t r;
+  for (std::size_t w = 0; w < words; ++w)
+    r[w] = bits_[w].load() & mask[w];
+  return r;
+}
+
+
+void DeviceMaskRawInputTest::assign(mask_t const & mask, mask_t const & value)
+{
+  std::unique_lock<std::mutex> l (writeMutex_);
+  auto & bits_ = *pBits_.load();
+  for (std::size_t w = 0; w < words; ++w)
+    if (mask[w])
+    {
+      auto expected = bits_[w].load();
+      while (!bits_[w].compare_exchange_weak(expected, (expected & ~mask[w]) | (value[w] & mask[w])))
+        ;
+    }
+}
+
+
+void DeviceMaskRawInputTest::switch_to(mask_t const & table)
+{
+  std::unique_lock<std::mutex> l (writeMutex_);
+  auto const pActive = pBits_.load();
+  auto const pSpare = pActive == &blocks_[0] ? &blocks_[1] : &blocks_[0];
+  for (std::size_t w = 0; w < words; ++w)
+    (*pSpare)[w].store(table[w], std::memory_order_relaxed);
+  pBits_.store(pSpare, std::memory_order_release);
+}
+
+
+DeviceMaskRawInputTest::DeviceMaskRawInputTest()
+  : index_(), blocks_(), pBits_(&blocks_[0]), writeMutex_()
+{
+  for (auto & block : blocks_)
+    for (auto & word : block)
+      word.store(0);
+}
+
+
+void DeviceSet::set_state(bool state)
+{
+  spTest_->set(mask_, state);
+  logging::log(logging::LogSource::wrapper, logging::LogLevel::debug, "state: "_lit, state);
+}
+
+
+void DeviceSet::toggle()
+{
+  spTest_->toggle(mask_);
+  logging::log(logging::LogSource::wrapper, logging::LogLevel::debug, "state toggled"_lit);
+}
+
+
+void DeviceSet::push_state(bool state)
+{
+  std::unique_lock<std::mutex> l (mutex_);
+  states_.push_back(save());
+  set_state(state);
+}
+
+
+void DeviceSet::pop_state()
+{
+  std::unique_lock<std::mutex> l (mutex_);
+  if (states_.empty())
+  {
+    logging::log(logging::LogSource::wrapper, logging::LogLevel::error, "pop_state without push_state"_lit);
+    return;
+  }
+  restore(states_.back());
+  states_.pop_back();
+}
+
+
+DeviceSet::mask_t DeviceSet::save() const
+{
+  return spTest_->get(mask_);
+}
+
+
+void DeviceSet::restore(mask_t const & saved)
+{
+  spTest_->assign(mask_, saved);
+  logging::log(logging::LogSource::wrapper, logging::LogLevel::debug, "state restored"_lit);
+}
+
+
+DeviceSet::DeviceSet(std::shared_ptr<DeviceMaskRawInputTest> const & spTest, mask_t const & mask)
+  : spTest_(spTest), mask_(mask), states_(), mutex_()
+{}
+
+
+void ActivityWindowRawInputTest::begin_batch(clock_t::time_point now)
+{
+  now_.store(std::chrono::duration_cast<us>(now.time_since_epoch()).count(), std::memory_order_relaxed);
+}
+
+
+/* Activity of source is recorded even if target rule rejects its message. */
+bool ActivityWindowRawInputTest::test(PRAWINPUT pRawInput)
+{
+  auto const i = index_.find(pRawInput->header.hDevice);
+  if (i == DeviceIndex::npos)
+    return true;
+  auto const & device = devices_[i];
+  auto const now = now_.load(std::memory_order_relaxed);
+  bool r = true;
+  for (auto const & block : device.blockedBy)
+    if (now - lastActivity_[block.source].load(std::memory_order_relaxed) < block.window)
+      r = false;
+  if (device.isSource)
+    lastActivity_[i].store(now, std::memory_order_relaxed);
+  return r;
+}
+
+
+void ActivityWindowRawInputTest::add_rule(HANDLE hSource, HANDLE hTarget, clock_t::duration window)
+{
+  auto const source = index_.add(hSource);
+  auto const target = index_.add(hTarget);
+  devices_.resize(index_.size());
+  devices_[source].isSource = true;
+  devices_[target].blockedBy.push_back(Block{source, std::chrono::duration_cast<us>(window).count()});
+  lastActivity_.reset(new std::atomic<int64_t>[devices_.size()]);
+  for (std::size_t i = 0; i < devices_.size(); ++i)
+    lastActivity_[i].store(std::numeric_limits<int64_t>::min() / 2, std::memory_order_relaxed);
+}
+
+
+ActivityWindowRawInputTest::ActivityWindowRawInputTest()
+  : index_(), devices_(), lastActivity_(), now_(0)
+{}
+
+
+void ArbitrationRawInputTest::begin_batch(clock_t::time_point now)
+{
+  now_.store(std::chrono::duration_cast<us>(now.time_since_epoch()).count(), std::memory_order_relaxed);
+}
+
+
+bool ArbitrationRawInputTest::test(PRAWINPUT pRawInput)
+{
+  auto const i = index_.find(pRawInput->header.hDevice);
+  if (i == DeviceIndex::npos)
+    return true;
+  auto & device = devices_[i];
+  auto const & group = groups_[device.group];
+  auto const now = now_.load(std::memory_order_relaxed);
+  if (now - device.lastActivity.load(std::memory_order_relaxed) > group.gap)
+    device.activeSince.store(now, std::memory_order_relaxed);
+  device.lastActivity.store(now, std::memory_order_relaxed);
+
+  auto & owner = owners_[device.group];
+  auto const o = owner.load(std::memory_order_relaxed);
+  if (o == i)
+    return true;
+  if (o != DeviceIndex::npos)
+  {
+    auto const since = std::max(device.activeSince.load(std::memory_order_relaxed), devices_[o].lastActivity.load(std::memory_order_relaxed));
+    if (now - since < group.takeover)
+      return false;
+  }
+  owner.store(i, std::memory_order_relaxed);
+  logging::log(logging::LogSource::wrapper, logging::LogLevel::info, "Arbitration: device "_lit, pRawInput->header.hDevice, " took over group "_lit, device.group);
+  return true;
+}
+
+
+void ArbitrationRawInputTest::add_group(std::vector<HANDLE> const & handles, clock_t::duration takeover, clock_t::duration gap)
+{
+  auto const group = groups_.size();
+  groups_.push_back(Group{std::chrono::duration_cast<us>(takeover).count(), std::chrono::duration_cast<us>(gap).count()});
+  for (auto const handle : handles)
+  {
+    auto const i = index_.add(handle);
+    if (i < groupOf_.size())
+    {
+      logging::log(logging::LogSource::init, logging::LogLevel::error, "Device "_lit, handle, " is already arbitrated in group "_lit, groupOf_[i]);
+      continue;
+    }
+    groupOf_.push_back(group);
+  }
+  devices_.reset(new Device[index_.size()]);
+  for (std::size_t i = 0; i < index_.size(); ++i)
+  {
+    devices_[i].group = groupOf_[i];
+    devices_[i].lastActivity.store(std::numeric_limits<int64_t>::min() / 2, std::memory_order_relaxed);
+    devices_[i].activeSince.store(0, std::memory_order_relaxed);
+  }
+  owners_.reset(new std::atomic<std::size_t>[groups_.size()]);
+  for (std::size_t g = 0; g < groups_.size(); ++g)
+    owners_[g].store(DeviceIndex::npos, std::memory_order_relaxed);
+}
+
+
+ArbitrationRawInputTest::ArbitrationRawInputTest()
+  : index_(), groups_(), groupOf_(), devices_(), owners_(), now_(0)
+{}
+
+
+void CompositeRawInputTransform::transform(PRAWINPUT const * ppRawInput, std::size_t count, clock_t::time_point now)
+{
+  for (auto & spChild : children_)
+    spChild->transform(ppRawInput, count, now);
+}
+
+
+void CompositeRawInputTransform::add(std::shared_ptr<RawInputTransform> const & spChild)
+{
+  children_.push_back(spChild);
+}
+
+
+CompositeRawInputTransform::CompositeRawInputTransform()
+  : children_()
+{}
+
+
+void RemapRawInputTransform::transform(PRAWINPUT const * ppRawInput, std::size_t count, clock_t::time_point)
+{
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    auto const pRawInput = ppRawInput[i];
+    auto const d = index_.find(pRawInput->header.hDevice);
+    if (d == DeviceIndex::npos)
+      continue;
+    auto const & device = devices_[d];
+    if (pRawInput->header.dwType == RIM_TYPEKEYBOARD && device.upKeys)
+    {
+      auto & kb = pRawInput->data.keyboard;
+      if (kb.Flags & RI_KEY_E1)
+        continue;
+      auto const & key = (*device.upKeys)[(kb.MakeCode & 0xFF) | ((kb.Flags & RI_KEY_E0) ? 0x100 : 0)];
+      if (key.vKey == 0)
+        continue;
+      kb.MakeCode = key.makeCode;
+      kb.Flags = (kb.Flags & ~(RI_KEY_E0 | RI_KEY_E1)) | key.flags;
+      kb.VKey = key.vKey;
+    }
+    else if (pRawInput->header.dwType == RIM_TYPEMOUSE && device.upButtons)
+    {
+      auto & flags = pRawInput->data.mouse.usButtonFlags;
+      auto const & table = *device.upButtons;
+      flags = table[0][flags & 0xFF] | table[1][flags >> 8];
+    }
+  }
+}
+
+
+void RemapRawInputTransform::set_keys(HANDLE hDevice, key_table_t const & keys)
+{
+  device_(hDevice).upKeys.reset(new key_table_t(keys));
+}
+
+
+/* Button n has down flag at bit 2 * (n - 1) and up flag at next bit; wheel flags stay in place. */
+void RemapRawInputTransform::set_buttons(HANDLE hDevice, button_table_t const & buttons)
+{
+  std::array<USHORT, 16> bits;
+  for (std::size_t bit = 0; bit < bits.size(); ++bit)
+    bits[bit] = static_cast<USHORT>(1u << bit);
+  for (std::size_t b = 0; b < buttons.size(); ++b)
+  {
+    bits[2 * b] = static_cast<USHORT>(1u << (2 * (buttons[b] - 1)));
+    bits[2 * b + 1] = static_cast<USHORT>(1u << (2 * (buttons[b] - 1) + 1));
+  }
+  std::unique_ptr<button_flags_table_t> upTable (new button_flags_table_t());
+  for (std::size_t half = 0; half < 2; ++half)
+    for (std::size_t value = 0; value < 256; ++value)
+    {
+      USHORT flags = 0;
+      for (std::size_t bit = 0; bit < 8; ++bit)
+        if (value & (1u << bit))
+          flags |= bits[half * 8 + bit];
+      (*upTable)[half][value] = flags;
+    }
+  device_(hDevice).upButtons = std::move(upTable);
+}
+
+
+RemapRawInputTransform::key_table_t RemapRawInputTransform::make_key_table()
+{
+  key_table_t keys;
+  keys.fill(Key{0, 0, 0});
+  return keys;
+}
+
+
+void RemapRawInputTransform::map_key(key_table_t & keys, std::string const & from, std::string const & to)
+{
+  auto const fromScan = key2scan(name2key(from));
+  auto const toKey = name2key(to);
+  auto const toScan = key2scan(toKey);
+  /* Raw input reports generic virtual key for left and right modifiers. */
+  auto const vKey = toKey == VK_LSHIFT || toKey == VK_RSHIFT ? VK_SHIFT
+    : toKey == VK_LCONTROL || toKey == VK_RCONTROL ? VK_CONTROL
+    : toKey == VK_LMENU || toKey == VK_RMENU ? VK_MENU : toKey;
+  keys[(fromScan & 0xFF) | ((fromScan & 0xFF00) ? 0x100 : 0)] = Key{
+    static_cast<USHORT>(toScan & 0xFF), static_cast<USHORT>((toScan & 0xFF00) ? RI_KEY_E0 : 0), static_cast<USHORT>(vKey)};
+}
+
+
+RemapRawInputTransform::button_table_t RemapRawInputTransform::make_button_table()
+{
+  return button_table_t{{1, 2, 3, 4, 5}};
+}
+
+
+RemapRawInputTransform::Device & RemapRawInputTransform::device_(HANDLE hDevice)
+{
+  auto const i = index_.add(hDevice);
+  devices_.resize(index_.size());
+  return devices_[i];
+}
+
+
+RemapRawInputTransform::RemapRawInputTransform()
+  : index_(), devices_()
+{}
+
+
+void MotionRawInputTransform::transform(PRAWINPUT const * ppRawInput, std::size_t count, clock_t::time_point)
+{
+  Chunk chunk;
+  chunk.size = 0;
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    auto const pRawInput = ppRawInput[i];
+    if (pRawInput->header.dwType != RIM_TYPEMOUSE || (pRawInput->data.mouse.usFlags & MOUSE_MOVE_ABSOLUTE))
+      continue;
+    auto const d = index_.find(pRawInput->header.hDevice);
+    if (d == DeviceIndex::npos)
+      continue;
+    auto const & params = devices_[d].params;
+    auto const n = chunk.size++;
+    chunk.pRawInput[n] = pRawInput;
+    chunk.device[n] = d;
+    /* Clamped, so that products below do not overflow. */
+    chunk.x[n] = std::max<LONG>(std::min<LONG>(pRawInput->data.mouse.lLastX, maxCounts), -maxCounts);
+    chunk.y[n] = std::max<LONG>(std::min<LONG>(pRawInput->data.mouse.lLastY, maxCounts), -maxCounts);
+    chunk.swap[n] = params.swapAxes;
+    chunk.signX[n] = params.invertX ? -1 : 1;
+    chunk.signY[n] = params.invertY ? -1 : 1;
+    if (chunk.size == chunkSize)
+    {
+      process_(chunk);
+      chunk.size = 0;
+    }
+  }
+  if (chunk.size != 0)
+    process_(chunk);
+}
+
+
+void MotionRawInputTransform::process_(Chunk & chunk)
+{
+  auto const n = chunk.size;
+  for (std::size_t i = 0; i < n; ++i)
+  {
+    auto const speed = std::abs(chunk.x[i]) + std::abs(chunk.y[i]);
+    chunk.speed[i] = speed < static_cast<int32_t>(curveSize) ? speed : curveSize - 1;
+  }
+  for (std::size_t i = 0; i < n; ++i)
+  {
+    auto const & params = devices_[chunk.device[i]].params;
+    chunk.gain[i] = (static_cast<int64_t>(params.scale) * params.curve[chunk.speed[i]]) >> fractionBits;
+  }
+  for (std::size_t i = 0; i < n; ++i)
+  {
+    int64_t const x = chunk.x[i] + int64_t(chunk.y[i] - chunk.x[i]) * chunk.swap[i];
+    int64_t const y = chunk.y[i] + int64_t(chunk.x[i] - chunk.y[i]) * chunk.swap[i];
+    chunk.outX[i] = x * chunk.signX[i] * chunk.gain[i];
+    chunk.outY[i] = y * chunk.signY[i] * chunk.gain[i];
+  }
+  /* Remainder carry depends on previous message of the same device, so it is done in order. Arithmetic shift
+     rounds down and keeps remainder non-negative for both directions. */
+  for (std::size_t i = 0; i < n; ++i)
+  {
+    auto & device = devices_[chunk.device[i]];
+    auto const x = chunk.outX[i] + device.remainderX;
+    auto const y = chunk.outY[i] + device.remainderY;
+    auto const countsX = x >> fractionBits;
+    auto const countsY = y >> fractionBits;
+    device.remainderX = x - (countsX << fractionBits);
+    device.remainderY = y - (countsY << fractionBits);
+    auto & mouse = chunk.pRawInput[i]->data.mouse;
+    mouse.lLastX = static_cast<LONG>(std::max<int64_t>(std::min<int64_t>(countsX, std::numeric_limits<LONG>::max()), std::numeric_limits<LONG>::min()));
+    mouse.lLastY = static_cast<LONG>(std::max<int64_t>(std::min<int64_t>(countsY, std::numeric_limits<LONG>::max()), std::numeric_limits<LONG>::min()));
+  }
+}
+
+
+void MotionRawInputTransform::set_params(HANDLE hDevice, Params const & params)
+{
+  auto const i = index_.add(hDevice);
+  devices_.resize(index_.size());
+  devices_[i].params = params;
+  devices_[i].remainderX = devices_[i].remainderY = 0;
+}
+
+
+MotionRawInputTransform::Params MotionRawInputTransform::make_params(double scale, std::vector<std::pair<double, double> > const & curve)
+{
+  auto const one = double(1 << fractionBits);
+  Params params;
+  params.scale = static_cast<int32_t>(scale * one + 0.5);
+  for (std::size_t speed = 0; speed < params.curve.size(); ++speed)
+  {
+    double gain = 1.0;
+    if (!curve.empty())
+    {
+      auto const it = std::find_if(curve.begin(), curve.end(),
+        [speed](std::pair<double, double> const & point) { return point.first >= speed; });
+      if (it == curve.begin())
+        gain = it->second;
+      else if (it == curve.end())
+        gain = curve.back().second;
+      else
+      {
+        auto const & p0 = *(it - 1);
+        gain = p0.second + (it->second - p0.second) * (speed - p0.first) / (it->first - p0.first);
+      }
+    }
+    params.curve[speed] = static_cast<int32_t>(gain * one + 0.5);
+  }
+  params.swapAxes = params.invertX = params.invertY = false;
+  return params;
+}
+
+
+MotionRawInputTransform::MotionRawInputTransform()
+  : index_(), devices_()
+{}
+
+
+void DebounceRawInputTransform::transform(PRAWINPUT const * ppRawInput, std::size_t count, clock_t::time_point now)
+{
+  auto const t = std::chrono::duration_cast<us>(now.time_since_epoch()).count();
+  std::unique_lock<std::mutex> lock (mutex_);
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    auto const pRawInput = ppRawInput[i];
+    if (pRawInput->header.dwType != RIM_TYPEMOUSE)
+      continue;
+    auto const d = index_.find(pRawInput->header.hDevice);
+    if (d == DeviceIndex::npos)
+      continue;
+    auto & device = devices_[d];
+    auto & flags = pRawInput->data.mouse.usButtonFlags;
+    for (std::size_t b = 0; b < buttons; ++b)
+    {
+      USHORT const downFlag = static_cast<USHORT>(1u << (2 * b));
+      USHORT const upFlag = static_cast<USHORT>(downFlag << 1);
+      unsigned int const bit = 1u << b;
+      auto const isDown = (device.down & bit) != 0;
+      auto const recent = t - device.lastTransition[b] < device.window;
+      /* Both flags in one record: pair starts from physical state, which differs from state of application
+         if transition is pending, so pair ends in pending state and only pending transition is passed.
+         Otherwise pair ends where it started and passes as is. */
+      if ((flags & downFlag) && (flags & upFlag))
+      {
+        if (device.pending & bit)
+        {
+          flags &= ~(isDown ? downFlag : upFlag);
+          device.down ^= bit;
+          device.pending &= ~bit;
+        }
+        device.lastTransition[b] = t;
+        continue;
+      }
+      if ((flags & (downFlag | upFlag)) == 0)
+      {
+        if ((device.pending & bit) && !recent)
+        {
+          flags |= isDown ? upFlag : downFlag;
+          device.down ^= bit;
+          device.pending &= ~bit;
+          device.lastTransition[b] = t;
+        }
+        continue;
+      }
+      auto const flag = (flags & downFlag) ? downFlag : upFlag;
+      if ((flag == downFlag) == isDown)
+      {
+        /* Application already has this state: button was not seen before, so pass as is. */
+        if (!(device.pending & bit))
+          continue;
+        /* Transition back after suppressed one. */
+        flags &= ~flag;
+        device.pending &= ~bit;
+        device.suppressed.fetch_add(1, std::memory_order_relaxed);
+        logging::log(logging::LogSource::rawinput, logging::LogLevel::debug, "Debounce: dropped return of button "_lit, b + 1, " of device "_lit, device.handle);
+        continue;
+      }
+      auto const sameBatch = device.lastTransition[b] == t;
+      if (recent && (!sameBatch || returns_in_batch_(ppRawInput, count, i + 1, device.handle, flag == downFlag ? upFlag : downFlag)))
+      {
+        flags &= ~flag;
+        device.pending |= bit;
+        device.suppressed.fetch_add(1, std::memory_order_relaxed);
+        logging::log(logging::LogSource::rawinput, logging::LogLevel::debug, "Debounce: dropped bounce of button "_lit, b + 1, " of device "_lit, device.handle);
+        continue;
+      }
+      device.down ^= bit;
+      device.pending &= ~bit;
+      device.lastTransition[b] = t;
+    }
+  }
+}
+
+
+bool DebounceRawInputTransform::returns_in_batch_(PRAWINPUT const * ppRawInput, std::size_t count, std::size_t from, HANDLE hDevice, USHORT flag)
+{
+  for (std::size_t i = from; i < count; ++i)
+    if (ppRawInput[i]->header.hDevice == hDevice && ppRawInput[i]->header.dwType == RIM_TYPEMOUSE && (ppRawInput[i]->data.mouse.usButtonFlags & flag))
+      return true;
+  return false;
+}
+
+
+void DebounceRawInputTransform::set_window(HANDLE hDevice, clock_t::duration window)
+{
+  auto const size = index_.size();
+  auto const i = index_.add(hDevice);
+  if (i == size)
+  {
+    std::unique_ptr<Device[]> upDevices (new Device[index_.size()]);
+    for (std::size_t j = 0; j < size; ++j)
+    {
+      upDevices[j].handle = devices_[j].handle;
+      upDevices[j].window = devices_[j].window;
+      upDevices[j].lastTransition = devices_[j].lastTransition;
+      upDevices[j].down = devices_[j].down;
+      upDevices[j].pending = devices_[j].pending;
+      upDevices[j].suppressed.store(devices_[j].suppressed.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+    devices_ = std::move(upDevices);
+  }
+  auto & device = devices_[i];
+  device.handle = hDevice;
+  device.window = std::chrono::duration_cast<us>(window).count();
+}
+
+
+unsigned long DebounceRawInputTransform::report()
+{
+  std::unique_lock<std::mutex> lock (mutex_);
+  unsigned long total = 0;
+  for (std::size_t i = 0; i < index_.size(); ++i)
+  {
+    auto const suppressed = devices_[i].suppressed.exchange(0, std::memory_order_relaxed);
+    logging::log(logging::LogSource::wrapper, logging::LogLevel::info, "Debounce: device "_lit, devices_[i].handle, ": suppressed transitions: "_lit, suppressed);
+    total += suppressed;
+  }
+  return total;
+}
+
+
+DebounceRawInputTransform::DebounceRawInputTransform()
+  : index_(), devices_(), mutex_()
+{}
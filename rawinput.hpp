@@ -0,0 +1,430 @@
+/*
+*  MIT License
+*
+*  Copyright (c) 2025 Alexander Fedorov
+*
+*  Permission is hereby granted, free of charge, to any person obtaining a copy
+*  of this software and associated documentation files (the "Software"), to deal
+*  in the Software without restriction, including without limitation the rights
+*  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*  copies of the Software, and to permit persons to whom the Software is
+*  furnished to do so, subject to the following conditions:
+*
+*  The above copyright notice and this permission notice shall be included in all
+*  copies or substantial portions of the Software.
+*
+*  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*  SOFTWARE.
+*/
+
+#ifndef RAWINPUT_HPP_
+#define RAWINPUT_HPP_
+
+/* Tests and transforms of raw input filter. They only see raw input records and time of batch, so they are
+   built and tested on the host as well. */
+#include "threads.hpp"
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include "rawtypes.hpp"
+#endif
+
+#include <string>
+#include <vector>
+#include <array>
+#include <memory>
+#include <functional>
+#include <chrono>
+#include <atomic>
+#include <utility>
+#include <cstdint>
+#include <cstddef>
+
+/* Decides whether message passes filter. */
+class RawInputTest
+{
+public:
+  typedef std::chrono::steady_clock clock_t;
+
+  /* Called before messages of a batch are tested, so that tests do not read clock per message. */
+  virtual void begin_batch(clock_t::time_point) {}
+  virtual bool test(PRAWINPUT) =0;
+  virtual ~RawInputTest() {}
+};
+
+
+/* Rewrites messages that passed test, in place. Gets all messages of a batch at once, with time of batch. */
+class RawInputTransform
+{
+public:
+  typedef std::chrono::steady_clock clock_t;
+
+  virtual void transform(PRAWINPUT const * ppRawInput, std::size_t count, clock_t::time_point now) =0;
+  virtual ~RawInputTransform() {}
+};
+
+
+/* Maps device handles to dense indices with open addressing hash table, so that per-message lookup is O(1).
+   Filled while tests are built; read only afterwards. */
+class DeviceIndex
+{
+public:
+  static std::size_t const npos = static_cast<std::size_t>(-1);
+
+  std::size_t find(HANDLE handle) const;
+  /* Returns index of handle, adding it if needed. */
+  std::size_t add(HANDLE handle);
+  std::size_t size() const { return handles_.size(); }
+  HANDLE handle(std::size_t index) const { return handles_[index]; }
+
+  DeviceIndex();
+
+private:
+  std::size_t slot_(HANDLE handle) const;
+  void rehash_(std::size_t capacity);
+
+  std::vector<HANDLE> handles_;
+  /* Index + 1 of handle in slot; 0 for empty slot. Size is power of 2 and at least twice the number of handles. */
+  std::vector<std::size_t> table_;
+};
+
+
+class CompositeRawInputTest : public RawInputTest
+{
+public:
+  typedef std::function<bool(bool,bool)> combine_t;
+
+  virtual void begin_batch(clock_t::time_point now);
+  virtual bool test(PRAWINPUT pRawInput);
+
+  void add(std::shared_ptr<RawInputTest> const & spChild);
+
+  CompositeRawInputTest(combine_t const & combine, bool initial=true);
+
+private:
+  combine_t combine_;
+  bool initial_;
+  std::vector<std::shared_ptr<RawInputTest> > children_;
+};
+
+
+/* Enabled bit of every configured device is kept in shared mask, so that verdict is a single bit test and state
+   of a group of devices is changed by a single atomic operation per mask word (one word for up to 64 devices).
+   Mask is one of two blocks: switch_to() fills the inactive one with complete table and swaps pointer, so
+   filter never sees partially switched state. Devices must be added before test is set to filter. */
+class DeviceMaskRawInputTest : public RawInputTest
+{
+public:
+  static std::size_t const words = 4;
+  typedef std::array<uint64_t, words> mask_t;
+
+  virtual bool test(PRAWINPUT pRawInput);
+
+  /* Returns bit of device, adding it with given state if needed. */
+  std::size_t add(HANDLE hDevice, bool state);
+
+  void set(mask_t const & mask, bool state);
+  void toggle(mask_t const & mask);
+  mask_t get(mask_t const & mask) const;
+  /* Sets bits of mask to those of value. */
+  void assign(mask_t const & mask, mask_t const & value);
+  /* Replaces state of all devices. */
+  void switch_to(mask_t const & table);
+
+  std::size_t find(HANDLE hDevice) const { return index_.find(hDevice); }
+  std::size_t size() const { return index_.size(); }
+  HANDLE handle(std::size_t bit) const { return index_.handle(bit); }
+
+  DeviceMaskRawInputTest();
+
+private:
+  typedef std::array<std::atomic<uint64_t>, words> bits_t;
+
+  DeviceIndex index_;
+  bits_t blocks_[2];
+  std::atomic<bits_t *> pBits_;
+  /* Writers run on executor thread (actions) and worker thread (expiry of timed actions). They are serialized,
+     so that change to active block is not lost by concurrent switch_to(). Test itself does not lock. */
+  std::mutex writeMutex_;
+};
+
+
+/* Devices that actions apply to: one device or named group. Saved states of push_state are kept per set. */
+class DeviceSet
+{
+public:
+  typedef DeviceMaskRawInputTest::mask_t mask_t;
+
+  void set_state(bool state);
+  void toggle();
+  void push_state(bool state);
+  void pop_state();
+  mask_t save() const;
+  void restore(mask_t const & saved);
+  mask_t const & mask() const { return mask_; }
+
+  DeviceSet(std::shared_ptr<DeviceMaskRawInputTest> const & spTest, mask_t const & mask);
+
+private:
+  std::shared_ptr<DeviceMaskRawInputTest> const spTest_;
+  mask_t const mask_;
+  std::vector<mask_t> states_;
+  std::mutex mutex_;
+};
+
+
+/* Rejects input from target device within time window after input from source device. Clock is read once per
+   batch; last activity of each device is kept in array of atomics by device index, so that test takes no locks.
+   Rules must be added before test is set to filter. */
+class ActivityWindowRawInputTest : public RawInputTest
+{
+public:
+  virtual void begin_batch(clock_t::time_point now);
+  virtual bool test(PRAWINPUT pRawInput);
+
+  void add_rule(HANDLE hSource, HANDLE hTarget, clock_t::duration window);
+
+  ActivityWindowRawInputTest();
+
+private:
+  typedef std::chrono::microseconds us;
+
+  struct Block
+  {
+    std::size_t source;
+    int64_t window;
+  };
+
+  struct Device
+  {
+    bool isSource;
+    std::vector<Block> blockedBy;
+  };
+
+  DeviceIndex index_;
+  std::vector<Device> devices_;
+  /* Last activity of each device in us since clock epoch. */
+  std::unique_ptr<std::atomic<int64_t>[]> lastActivity_;
+  std::atomic<int64_t> now_;
+};
+
+
+/* Of each group of devices only owner passes. Another device takes over after it has been continuously active
+   (no gaps longer than gap) for takeover time while owner was silent, so bumping spare device or using both
+   at once does not switch. Groups must be added before test is set to filter. */
+class ArbitrationRawInputTest : public RawInputTest
+{
+public:
+  virtual void begin_batch(clock_t::time_point now);
+  virtual bool test(PRAWINPUT pRawInput);
+
+  /* Devices that are already in other group are ignored. */
+  void add_group(std::vector<HANDLE> const & handles, clock_t::duration takeover, clock_t::duration gap);
+
+  ArbitrationRawInputTest();
+
+private:
+  typedef std::chrono::microseconds us;
+
+  struct Group
+  {
+    int64_t takeover;
+    int64_t gap;
+  };
+
+  /* Times are in us since clock epoch. */
+  struct Device
+  {
+    std::size_t group;
+    std::atomic<int64_t> lastActivity;
+    std::atomic<int64_t> activeSince;
+  };
+
+  DeviceIndex index_;
+  std::vector<Group> groups_;
+  std::vector<std::size_t> groupOf_;
+  std::unique_ptr<Device[]> devices_;
+  std::unique_ptr<std::atomic<std::size_t>[]> owners_;
+  std::atomic<int64_t> now_;
+};
+
+
+class CompositeRawInputTransform : public RawInputTransform
+{
+public:
+  virtual void transform(PRAWINPUT const * ppRawInput, std::size_t count, clock_t::time_point now);
+
+  void add(std::shared_ptr<RawInputTransform> const & spChild);
+  bool empty() const { return children_.empty(); }
+
+  CompositeRawInputTransform();
+
+private:
+  std::vector<std::shared_ptr<RawInputTransform> > children_;
+};
+
+
+/* Remaps keys and mouse buttons of some devices. Key table is indexed by make code with E0 prefix as bit 8;
+   button flags are remapped through two tables of byte halves, built from per-button permutation. Tables
+   must be added before transform is set to filter. */
+class RemapRawInputTransform : public RawInputTransform
+{
+public:
+  struct Key
+  {
+    USHORT makeCode;
+    /* RI_KEY_E0 or 0. */
+    USHORT flags;
+    /* 0 if key is not remapped. */
+    USHORT vKey;
+  };
+  typedef std::array<Key, 512> key_table_t;
+  /* Button number (1-5) that each button is remapped to. */
+  typedef std::array<unsigned int, 5> button_table_t;
+
+  virtual void transform(PRAWINPUT const * ppRawInput, std::size_t count, clock_t::time_point now);
+
+  void set_keys(HANDLE hDevice, key_table_t const & keys);
+  void set_buttons(HANDLE hDevice, button_table_t const & buttons);
+
+  static key_table_t make_key_table();
+  /* Sets entry of key table for key named from to key named to; names are checked by config. */
+  static void map_key(key_table_t & keys, std::string const & from, std::string const & to);
+  static button_table_t make_button_table();
+
+  RemapRawInputTransform();
+
+private:
+  typedef std::array<std::array<USHORT, 256>, 2> button_flags_table_t;
+
+  struct Device
+  {
+    std::unique_ptr<key_table_t> upKeys;
+    std::unique_ptr<button_flags_table_t> upButtons;
+  };
+
+  Device & device_(HANDLE hDevice);
+
+  DeviceIndex index_;
+  std::vector<Device> devices_;
+};
+
+
+/* Scales relative motion of some mice by fixed-point factor and optional speed curve, swaps or inverts axes.
+   Fraction of count lost to rounding is carried to next message of device. Mouse records of a batch are
+   gathered into structure of arrays on stack, transformed in branchless loops and scattered back, so that
+   no memory is allocated. Parameters must be set before transform is set to filter. */
+class MotionRawInputTransform : public RawInputTransform
+{
+public:
+  /* Gains are 16.16 fixed point. */
+  static int const fractionBits = 16;
+  /* Curve is indexed by speed: |x| + |y| counts per message, clamped. */
+  static std::size_t const curveSize = 256;
+  typedef std::array<int32_t, curveSize> curve_t;
+
+  struct Params
+  {
+    int32_t scale;
+    curve_t curve;
+    bool swapAxes;
+    bool invertX;
+    bool invertY;
+  };
+
+  virtual void transform(PRAWINPUT const * ppRawInput, std::size_t count, clock_t::time_point now);
+
+  void set_params(HANDLE hDevice, Params const & params);
+
+  /* Curve points are (speed, gain); they are interpolated linearly and extended flat beyond first and last one.
+     Axes are not swapped or inverted. */
+  static Params make_params(double scale, std::vector<std::pair<double, double> > const & curve);
+
+  MotionRawInputTransform();
+
+private:
+  static std::size_t const chunkSize = 64;
+  static LONG const maxCounts = 1 << 24;
+
+  struct Chunk
+  {
+    std::size_t size;
+    PRAWINPUT pRawInput[chunkSize];
+    std::size_t device[chunkSize];
+    int32_t x[chunkSize];
+    int32_t y[chunkSize];
+    int32_t swap[chunkSize];
+    int32_t signX[chunkSize];
+    int32_t signY[chunkSize];
+    int32_t speed[chunkSize];
+    int64_t gain[chunkSize];
+    int64_t outX[chunkSize];
+    int64_t outY[chunkSize];
+  };
+
+  struct Device
+  {
+    Params params;
+    /* Accessed by input thread only. */
+    int64_t remainderX;
+    int64_t remainderY;
+  };
+
+  void process_(Chunk & chunk);
+
+  DeviceIndex index_;
+  std::vector<Device> devices_;
+};
+
+
+/* Suppresses mouse button chatter. Transition that reverses button within window after last accepted one is
+   dropped and kept pending; transition back cancels it, so bounce never reaches application. If window passes
+   without it, pending transition is merged into next record of device (move or wheel), since filter only
+   rewrites raw stream and does not inject input.
+   Reversal in the same batch as accepted transition passes unless transition back follows in that batch, since
+   records of a batch share one time. Transition to state application already has (e.g. release of button held
+   before start) passes as is. Parameters must be set before transform is set to filter. */
+class DebounceRawInputTransform : public RawInputTransform
+{
+public:
+  static std::size_t const buttons = 5;
+
+  virtual void transform(PRAWINPUT const * ppRawInput, std::size_t count, clock_t::time_point now);
+
+  void set_window(HANDLE hDevice, clock_t::duration window);
+  /* Logs and resets counters of suppressed transitions, returns their sum. Called from any thread. */
+  unsigned long report();
+
+  DebounceRawInputTransform();
+
+private:
+  typedef std::chrono::microseconds us;
+
+  /* Times are in us since clock epoch. Guarded by mutex_, except for counter. */
+  struct Device
+  {
+    HANDLE handle;
+    int64_t window;
+    std::array<int64_t, buttons> lastTransition;
+    /* Bit per button. */
+    unsigned int down;
+    unsigned int pending;
+    std::atomic<unsigned long> suppressed;
+
+    /* Last transitions are long ago, so first ones are never taken for bounce. */
+    Device() : handle(NULL), window(0), lastTransition(), down(0), pending(0), suppressed(0) { lastTransition.fill(std::numeric_limits<int64_t>::min() / 2); }
+  };
+
+  static bool returns_in_batch_(PRAWINPUT const * ppRawInput, std::size_t count, std::size_t from, HANDLE hDevice, USHORT flag);
+
+  DeviceIndex index_;
+  std::unique_ptr<Device[]> devices_;
+  std::mutex mutex_;
+};
+
+#endif
@@ -0,0 +1,79 @@
+/*
+*  MIT License
+*
+*  Copyright (c) 2025 Alexander Fedorov
+*
+*  Permission is hereby granted, free of charge, to any person obtaining a copy
+*  of this software and associated documentation files (the "Software"), to deal
+*  in the Software without restriction, including without limitation the rights
+*  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*  copies of the Software, and to permit persons to whom the Software is
+*  furnished to do so, subject to the following conditions:
+*
+*  The above copyright notice and this permission notice shall be included in all
+*  copies or substantial portions of the Software.
+*
+*  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*  SOFTWARE.
+*/
+
+
+/* Measures startup config load times: reading and parsing text, and converting it into typed settings.
+   Config is generated with many devices and bindings, so that parsing dominates file I/O. */
+
+#include "config.hpp"
+#include "testing.hpp"
+
+#include <fstream>
+#include <cstdio>
+
+static char const * const g_path = "tests/bench_config.cfg";
+
+
+static void write_config(unsigned int nDevices, unsigned int nBindings)
+{
+  std::ofstream os (g_path, std::ios::out|std::ios::trunc);
+  os << "{\n  \"logLevel\" : \"INFO\",\n  \"devices\" : {\n";
+  for (unsigned int i = 0; i < nDevices; ++i)
+    os << "    \"device" << i << "\" : { \"state\" : true, \"name\" : \"//?/HID#VID_845E&PID_" << i
+       << "#0&0000&0&0#{378de44c-56ef-11d1-bc8c-00a0c91405dd}\" }" << (i + 1 < nDevices ? ",\n" : "\n");
+  os << "  },\n  \"bindings\" : [\n";
+  for (unsigned int i = 0; i < nBindings; ++i)
+    os << "    {\n      \"on\" : { \"sequence\" : [ \"F" << 1 + i % 24 << "\", \"F" << 1 + (i / 24) % 24
+       << "\" ], \"modifiers\" : [ \"CTRL\" ], \"event\" : \"press\" },\n"
+       << "      \"do\" : { \"action\" : \"toggle\", \"name\" : \"device" << i % nDevices << "\" }\n    }"
+       << (i + 1 < nBindings ? ",\n" : "\n");
+  os << "  ]\n}\n";
+}
+
+
+template <class F>
+double measure(char const * name, F f)
+{
+  static unsigned long const n = 200;
+  auto const ns = testing::time_ns(n, f);
+  std::cout << name << ": " << ns / 1000.0 << " us/load" << std::endl;
+  return ns;
+}
+
+
+int main()
+{
+  write_config(32, 500);
+
+  auto const text = config::load(g_path);
+  auto const settings = config::parse_settings(text);
+  CHECK(settings.devices.size() == 32);
+  CHECK(settings.bindings.size() == 500);
+
+  measure("load", [](unsigned long) { config::load(g_path); });
+  measure("parse_settings", [&](unsigned long) { config::parse_settings(text); });
+
+  std::remove(g_path);
+  return testing::result("bench_config");
+}
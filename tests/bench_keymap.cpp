@@ -0,0 +1,119 @@
+/*
+*  MIT License
+*
+*  Copyright (c) 2025 Alexander Fedorov
+*
+*  Permission is hereby granted, free of charge, to any person obtaining a copy
+*  of this software and associated documentation files (the "Software"), to deal
+*  in the Software without restriction, including without limitation the rights
+*  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*  copies of the Software, and to permit persons to whom the Software is
+*  furnished to do so, subject to the following conditions:
+*
+*  The above copyright notice and this permission notice shall be included in all
+*  copies or substantial portions of the Software.
+*
+*  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*  SOFTWARE.
+*/
+
+
+/* Measures GKSKeyMap::update() with 0, 10 and 100 bindings, when no key changes and when a bound key is pressed
+   and released on every other update. Key state is simulated, so that only key map itself is measured. */
+
+#include "keymap.hpp"
+#include "logging.hpp"
+#include "testing.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+static std::atomic<unsigned long> g_allocations (0);
+
+void * operator new(std::size_t n)
+{
+  g_allocations.fetch_add(1, std::memory_order_relaxed);
+  if (void * p = std::malloc(n ? n : 1))
+    return p;
+  throw std::bad_alloc();
+}
+
+void operator delete(void * p) noexcept
+{
+  std::free(p);
+}
+
+void operator delete(void * p, std::size_t) noexcept
+{
+  std::free(p);
+}
+
+
+static bool g_keys[GKSKeyMap::keyCount];
+
+static bool is_key_down(GKSKeyMap::key_t key)
+{
+  return g_keys[key];
+}
+
+
+/* Bindings are spread over F1-F24 and letters: single keys on press and release, modified keys and sequences. */
+static std::vector<GKSKeyMap::binding_t> make_bindings(std::size_t n, unsigned long & fired)
+{
+  static GKSKeyMap::key_t const keys[] = { VK_F1, VK_F2, VK_F3, VK_F4, VK_F5, VK_F6, VK_F7, VK_F8, VK_F9, VK_F10, VK_F11, VK_F12,
+    'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P', 'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z' };
+  static std::size_t const nKeys = sizeof(keys) / sizeof(keys[0]);
+  std::vector<GKSKeyMap::binding_t> bindings;
+  for (std::size_t i = 0; i < n; ++i)
+  {
+    GKSKeyMap::Trigger trigger;
+    trigger.keys.push_back(keys[i % nKeys]);
+    if (i / nKeys == 1)
+      trigger.modifiers.push_back(VK_CONTROL);
+    else if (i / nKeys == 2)
+      trigger.keys.push_back(keys[(i + 1) % nKeys]);
+    trigger.event = i % 2 ? KeyEventType::release : KeyEventType::press;
+    trigger.hold = std::chrono::microseconds::zero();
+    trigger.interval = std::chrono::milliseconds(500);
+    bindings.push_back(GKSKeyMap::binding_t(trigger, [&fired]() { ++fired; }));
+  }
+  return bindings;
+}
+
+
+static void measure(std::size_t nBindings)
+{
+  static unsigned long const n = 1000000;
+  unsigned long fired = 0;
+  GKSKeyMap keyMap (is_key_down);
+  keyMap.assign(make_bindings(nBindings, fired));
+  keyMap.update();
+
+  auto before = g_allocations.load();
+  auto const idle = testing::time_ns(n, [&](unsigned long) { keyMap.update(); });
+  CHECK(g_allocations.load() == before);
+
+  before = g_allocations.load();
+  auto const active = testing::time_ns(n, [&](unsigned long i) { g_keys[VK_F1] = i % 2 == 0; keyMap.update(); });
+  CHECK(g_allocations.load() == before);
+  g_keys[VK_F1] = false;
+  if (nBindings != 0)
+    CHECK(fired >= n / 2);
+
+  std::cout << nBindings << " bindings: idle " << idle << " ns/update, F1 tapping " << active << " ns/update" << std::endl;
+}
+
+
+int main()
+{
+  logging::root_logger().set_level(logging::LogLevel::info);
+  for (auto const nBindings : { 0, 10, 100 })
+    measure(nBindings);
+  return testing::result("bench_keymap");
+}
@@ -0,0 +1,109 @@
+/*
+*  MIT License
+*
+*  Copyright (c) 2025 Alexander Fedorov
+*
+*  Permission is hereby granted, free of charge, to any person obtaining a copy
+*  of this software and associated documentation files (the "Software"), to deal
+*  in the Software without restriction, including without limitation the rights
+*  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*  copies of the Software, and to permit persons to whom the Software is
+*  furnished to do so, subject to the following conditions:
+*
+*  The above copyright notice and this permission notice shall be included in all
+*  copies or substantial portions of the Software.
+*
+*  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*  SOFTWARE.
+*/
+
+
+/* Counts heap allocations made while logging. Message is formatted into text by a printer that only
+   looks at it, so that cost of formatting path is measured without file I/O. */
+
+#include "logging.hpp"
+#include "testing.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+static std::atomic<unsigned long> g_allocations (0);
+
+void * operator new(std::size_t n)
+{
+  g_allocations.fetch_add(1, std::memory_order_relaxed);
+  if (void * p = std::malloc(n ? n : 1))
+    return p;
+  throw std::bad_alloc();
+}
+
+void operator delete(void * p) noexcept
+{
+  std::free(p);
+}
+
+void operator delete(void * p, std::size_t) noexcept
+{
+  std::free(p);
+}
+
+
+class NullLogPrinter : public logging::LogPrinter
+{
+public:
+  virtual void print(logging::LogMessage const & lm) const
+  {
+    static thread_local StrBuffer<logging::StreamLogPrinter::maxLineSize> line;
+    line.clear();
+    logging::format_default(line, lm);
+    size_ += line.size();
+  }
+
+  NullLogPrinter() : size_(0) {}
+
+private:
+  mutable std::size_t size_;
+};
+
+
+enum class Phase { idle, active };
+
+
+template <class F>
+void measure(char const * name, F f, double & ns, double & allocs)
+{
+  static unsigned long const n = 200000;
+  /* Thread-local buffers are allocated by first call. */
+  f(0);
+  auto const before = g_allocations.load();
+  ns = testing::time_ns(n, f);
+  allocs = double(g_allocations.load() - before) / n;
+  std::cout << name << ": " << ns << " ns/call, " << allocs << " allocations/call" << std::endl;
+}
+
+
+int main()
+{
+  logging::Logger logger (logging::LogLevel::debug);
+  logger.add_printer(std::make_shared<NullLogPrinter>());
+  void * const handle = &logger;
+  std::string const name = "HID#VID_845E&PID_0001";
+  double ns, allocs;
+
+  measure("stream_to_str", [&](unsigned long i) { auto const s = stream_to_str("device ", name, "; handle: ", handle, "; i: ", i, "; x: ", -1.5, "; phase: ", static_cast<int>(Phase::active)); static_cast<void>(s); }, ns, allocs);
+  CHECK(allocs > 0);
+
+  measure("Logger::log", [&](unsigned long i) { logger.log(logging::LogSource::wrapper, logging::LogLevel::info, "device "_lit, name, "; handle: "_lit, handle, "; i: "_lit, i, "; x: "_lit, -1.5, "; phase: "_lit, Phase::active); }, ns, allocs);
+  CHECK(allocs == 0);
+
+  measure("Logger::log (filtered out)", [&](unsigned long i) { logger.log(logging::LogSource::wrapper, logging::LogLevel::trace, "i: "_lit, i); }, ns, allocs);
+  CHECK(allocs == 0);
+
+  return testing::result("bench_logging");
+}
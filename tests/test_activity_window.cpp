@@ -0,0 +1,69 @@
+/*
+*  MIT License
+*
+*  Copyright (c) 2025 Alexander Fedorov
+*
+*  Permission is hereby granted, free of charge, to any person obtaining a copy
+*  of this software and associated documentation files (the "Software"), to deal
+*  in the Software without restriction, including without limitation the rights
+*  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*  copies of the Software, and to permit persons to whom the Software is
+*  furnished to do so, subject to the following conditions:
+*
+*  The above copyright notice and this permission notice shall be included in all
+*  copies or substantial portions of the Software.
+*
+*  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*  SOFTWARE.
+*/
+
+/* ActivityWindowRawInputTest: target is blocked within window after activity of source, activity of source is
+   recorded even if its own message is blocked, unknown devices pass. */
+
+#include "rawinput.hpp"
+#include "testing.hpp"
+
+typedef RawInputTest::clock_t input_clock_t;
+
+static HANDLE const mouse = reinterpret_cast<HANDLE>(0x10);
+static HANDLE const pad = reinterpret_cast<HANDLE>(0x20);
+static HANDLE const other = reinterpret_cast<HANDLE>(0x30);
+
+
+static bool test_at(RawInputTest & test, input_clock_t::time_point now, HANDLE hDevice)
+{
+  RAWINPUT ri {};
+  ri.header.dwType = RIM_TYPEMOUSE;
+  ri.header.hDevice = hDevice;
+  test.begin_batch(now);
+  return test.test(&ri);
+}
+
+
+int main()
+{
+  typedef std::chrono::milliseconds ms;
+  auto const t0 = input_clock_t::now();
+
+  ActivityWindowRawInputTest test;
+  test.add_rule(mouse, pad, ms(100));
+  test.add_rule(pad, mouse, ms(50));
+
+  CHECK(test_at(test, t0, pad));
+  CHECK(!test_at(test, t0 + ms(10), mouse));
+  CHECK(test_at(test, t0 + ms(60), mouse));
+
+  /* Mouse was active at 10 ms even though it was blocked, and at 60 ms. */
+  CHECK(!test_at(test, t0 + ms(100), pad));
+  CHECK(!test_at(test, t0 + ms(159), pad));
+  CHECK(test_at(test, t0 + ms(300), pad));
+
+  CHECK(test_at(test, t0 + ms(301), other));
+
+  return testing::result("test_activity_window");
+}
@@ -0,0 +1,83 @@
+/*
+*  MIT License
+*
+*  Copyright (c) 2025 Alexander Fedorov
+*
+*  Permission is hereby granted, free of charge, to any person obtaining a copy
+*  of this software and associated documentation files (the "Software"), to deal
+*  in the Software without restriction, including without limitation the rights
+*  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*  copies of the Software, and to permit persons to whom the Software is
+*  furnished to do so, subject to the following conditions:
+*
+*  The above copyright notice and this permission notice shall be included in all
+*  copies or substantial portions of the Software.
+*
+*  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*  SOFTWARE.
+*/
+
+/* ArbitrationRawInputTest: first active device owns group, another one takes over only after continuous
+   activity for takeover time while owner is silent; gaps restart its activity, other groups are independent. */
+
+#include "rawinput.hpp"
+#include "testing.hpp"
+
+typedef RawInputTest::clock_t input_clock_t;
+
+static HANDLE const mouse1 = reinterpret_cast<HANDLE>(0x10);
+static HANDLE const mouse2 = reinterpret_cast<HANDLE>(0x20);
+static HANDLE const pad1 = reinterpret_cast<HANDLE>(0x30);
+static HANDLE const pad2 = reinterpret_cast<HANDLE>(0x40);
+
+
+static bool test_at(RawInputTest & test, input_clock_t::time_point now, HANDLE hDevice)
+{
+  RAWINPUT ri {};
+  ri.header.dwType = RIM_TYPEMOUSE;
+  ri.header.hDevice = hDevice;
+  test.begin_batch(now);
+  return test.test(&ri);
+}
+
+
+int main()
+{
+  typedef std::chrono::milliseconds ms;
+  auto const t0 = input_clock_t::now();
+
+  ArbitrationRawInputTest test;
+  test.add_group({ mouse1, mouse2 }, ms(100), ms(20));
+  test.add_group({ pad1, pad2 }, ms(100), ms(20));
+
+  CHECK(test_at(test, t0, mouse1));
+  CHECK(!test_at(test, t0 + ms(10), mouse2));
+
+  /* Bumps with gaps longer than 20 ms never add up to takeover. */
+  for (int t = 40; t <= 400; t += 30)
+    CHECK(!test_at(test, t0 + ms(t), mouse2));
+
+  /* Continuous activity takes over 100 ms after it started. */
+  for (int t = 500; t < 600; t += 10)
+    CHECK(!test_at(test, t0 + ms(t), mouse2));
+  CHECK(test_at(test, t0 + ms(600), mouse2));
+  CHECK(!test_at(test, t0 + ms(610), mouse1));
+
+  /* Both used at once: former owner does not take back while new one stays active. */
+  for (int t = 620; t <= 800; t += 10)
+  {
+    CHECK(test_at(test, t0 + ms(t), mouse2));
+    CHECK(!test_at(test, t0 + ms(t), mouse1));
+  }
+
+  /* Other group got its own owner. */
+  CHECK(test_at(test, t0 + ms(810), pad2));
+  CHECK(!test_at(test, t0 + ms(820), pad1));
+
+  return testing::result("test_arbitration");
+}
@@ -0,0 +1,106 @@
+/*
+*  MIT License
+*
+*  Copyright (c) 2025 Alexander Fedorov
+*
+*  Permission is hereby granted, free of charge, to any person obtaining a copy
+*  of this software and associated documentation files (the "Software"), to deal
+*  in the Software without restriction, including without limitation the rights
+*  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*  copies of the Software, and to permit persons to whom the Software is
+*  furnished to do so, subject to the following conditions:
+*
+*  The above copyright notice and this permission notice shall be included in all
+*  copies or substantial portions of the Software.
+*
+*  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*  SOFTWARE.
+*/
+
+/* DebounceRawInputTransform: bounces within window are dropped and counted, fast click in one batch passes,
+   pending transition is merged into next record after window, release without known press passes, record
+   with both flags passes only pending transition. Other devices are not touched. */
+
+#include "rawinput.hpp"
+#include "testing.hpp"
+
+#include <string>
+#include <vector>
+
+typedef RawInputTransform::clock_t input_clock_t;
+
+static HANDLE const mouse = reinterpret_cast<HANDLE>(0x10);
+static HANDLE const other = reinterpret_cast<HANDLE>(0x20);
+
+static USHORT const down = RI_MOUSE_LEFT_BUTTON_DOWN;
+static USHORT const up = RI_MOUSE_LEFT_BUTTON_UP;
+
+
+/* Returns left button flags of records after transform: D, U, B(oth) or . for none. */
+static std::string batch(RawInputTransform & t, input_clock_t::time_point now, HANDLE hDevice, std::vector<USHORT> const & flags)
+{
+  std::vector<RAWINPUT> records (flags.size());
+  std::vector<PRAWINPUT> pointers;
+  for (std::size_t i = 0; i < flags.size(); ++i)
+  {
+    records[i].header.dwType = RIM_TYPEMOUSE;
+    records[i].header.hDevice = hDevice;
+    records[i].data.mouse.usButtonFlags = flags[i];
+    pointers.push_back(&records[i]);
+  }
+  t.transform(pointers.data(), pointers.size(), now);
+  std::string r;
+  for (auto const & ri : records)
+  {
+    auto const f = ri.data.mouse.usButtonFlags & (down | up);
+    r += f == down ? 'D' : f == up ? 'U' : f == (down | up) ? 'B' : '.';
+  }
+  return r;
+}
+
+
+int main()
+{
+  typedef std::chrono::milliseconds ms;
+  auto const t0 = input_clock_t::now();
+
+  DebounceRawInputTransform debounce;
+  debounce.set_window(mouse, ms(10));
+
+  CHECK(batch(debounce, t0, mouse, { up }) == "U");
+  CHECK(debounce.report() == 0);
+
+  CHECK(batch(debounce, t0 + ms(50), mouse, { down, up, down }) == "D..");
+  CHECK(batch(debounce, t0 + ms(100), mouse, { up }) == "U");
+  CHECK(batch(debounce, t0 + ms(200), mouse, { down, up }) == "DU");
+  CHECK(debounce.report() == 2);
+
+  CHECK(batch(debounce, t0 + ms(300), mouse, { down }) == "D");
+  CHECK(batch(debounce, t0 + ms(303), mouse, { up }) == ".");
+  CHECK(batch(debounce, t0 + ms(306), mouse, { down }) == ".");
+  CHECK(debounce.report() == 2);
+
+  /* Press bounced while releasing is real: it comes with next move after window. */
+  CHECK(batch(debounce, t0 + ms(400), mouse, { up }) == "U");
+  CHECK(batch(debounce, t0 + ms(402), mouse, { down }) == ".");
+  CHECK(batch(debounce, t0 + ms(405), mouse, { 0 }) == ".");
+  CHECK(batch(debounce, t0 + ms(420), mouse, { 0 }) == "D");
+  CHECK(debounce.report() == 1);
+
+  /* Physical button is down with pending press, so pair ends down: only press passes. */
+  CHECK(batch(debounce, t0 + ms(500), mouse, { up }) == "U");
+  CHECK(batch(debounce, t0 + ms(503), mouse, { down }) == ".");
+  CHECK(batch(debounce, t0 + ms(506), mouse, { down | up }) == "D");
+  CHECK(batch(debounce, t0 + ms(600), mouse, { down | up }) == "B");
+  CHECK(debounce.report() == 1);
+
+  CHECK(batch(debounce, t0 + ms(601), other, { down, up, down }) == "DUD");
+  CHECK(debounce.report() == 0);
+
+  return testing::result("test_debounce");
+}
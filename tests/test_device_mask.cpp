@@ -0,0 +1,103 @@
+/*
+*  MIT License
+*
+*  Copyright (c) 2025 Alexander Fedorov
+*
+*  Permission is hereby granted, free of charge, to any person obtaining a copy
+*  of this software and associated documentation files (the "Software"), to deal
+*  in the Software without restriction, including without limitation the rights
+*  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*  copies of the Software, and to permit persons to whom the Software is
+*  furnished to do so, subject to the following conditions:
+*
+*  The above copyright notice and this permission notice shall be included in all
+*  copies or substantial portions of the Software.
+*
+*  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*  SOFTWARE.
+*/
+
+/* DeviceMaskRawInputTest and DeviceSet: group changes all its devices at once, push/pop restores saved states
+   of group, profile switch replaces state of every device, unknown devices pass. */
+
+#include "rawinput.hpp"
+#include "testing.hpp"
+
+#include <initializer_list>
+
+static HANDLE const mouse = reinterpret_cast<HANDLE>(0x10);
+static HANDLE const pad = reinterpret_cast<HANDLE>(0x20);
+static HANDLE const keyboard = reinterpret_cast<HANDLE>(0x30);
+static HANDLE const other = reinterpret_cast<HANDLE>(0x40);
+
+
+static bool passes(RawInputTest & test, HANDLE hDevice)
+{
+  RAWINPUT ri {};
+  ri.header.dwType = RIM_TYPEMOUSE;
+  ri.header.hDevice = hDevice;
+  return test.test(&ri);
+}
+
+
+static DeviceMaskRawInputTest::mask_t make_mask(std::initializer_list<std::size_t> bits)
+{
+  DeviceMaskRawInputTest::mask_t mask {};
+  for (auto const bit : bits)
+    mask[bit / 64] |= uint64_t(1) << (bit % 64);
+  return mask;
+}
+
+
+int main()
+{
+  auto const spTest = std::make_shared<DeviceMaskRawInputTest>();
+  auto const m = spTest->add(mouse, true);
+  auto const p = spTest->add(pad, false);
+  auto const k = spTest->add(keyboard, true);
+  CHECK(spTest->add(mouse, false) == m);
+  CHECK(spTest->find(pad) == p);
+  CHECK(spTest->handle(k) == keyboard);
+  CHECK(spTest->size() == 3);
+
+  CHECK(passes(*spTest, mouse));
+  CHECK(!passes(*spTest, pad));
+  CHECK(passes(*spTest, other));
+
+  DeviceSet pointers (spTest, make_mask({ m, p }));
+  pointers.set_state(true);
+  CHECK(passes(*spTest, mouse) && passes(*spTest, pad));
+  pointers.toggle();
+  CHECK(!passes(*spTest, mouse) && !passes(*spTest, pad));
+  CHECK(passes(*spTest, keyboard));
+
+  /* Only pad is enabled before push, so pop restores exactly that. */
+  DeviceSet pads (spTest, make_mask({ p }));
+  pads.set_state(true);
+  pointers.push_state(false);
+  CHECK(!passes(*spTest, mouse) && !passes(*spTest, pad));
+  pointers.pop_state();
+  CHECK(!passes(*spTest, mouse) && passes(*spTest, pad));
+  /* Unbalanced pop is logged and ignored. */
+  pointers.pop_state();
+  CHECK(!passes(*spTest, mouse) && passes(*spTest, pad));
+
+  /* Profiles: complete tables, later changes go to the switched table. */
+  auto const gaming = make_mask({ m, p });
+  auto const typing = make_mask({ k });
+  spTest->switch_to(gaming);
+  CHECK(passes(*spTest, mouse) && passes(*spTest, pad) && !passes(*spTest, keyboard));
+  spTest->switch_to(typing);
+  CHECK(!passes(*spTest, mouse) && !passes(*spTest, pad) && passes(*spTest, keyboard));
+  pads.set_state(true);
+  CHECK(spTest->get(make_mask({ m, p, k })) == make_mask({ p, k }));
+  spTest->switch_to(gaming);
+  CHECK(spTest->get(make_mask({ m, p, k })) == gaming);
+
+  return testing::result("test_device_mask");
+}
@@ -0,0 +1,68 @@
+/*
+*  MIT License
+*
+*  Copyright (c) 2025 Alexander Fedorov
+*
+*  Permission is hereby granted, free of charge, to any person obtaining a copy
+*  of this software and associated documentation files (the "Software"), to deal
+*  in the Software without restriction, including without limitation the rights
+*  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*  copies of the Software, and to permit persons to whom the Software is
+*  furnished to do so, subject to the following conditions:
+*
+*  The above copyright notice and this permission notice shall be included in all
+*  copies or substantial portions of the Software.
+*
+*  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*  SOFTWARE.
+*/
+
+
+/* FileWatcher: reports edits that keep size and mtime second, creation and removal, but not rewrite
+   with the same contents. */
+
+#include "config.hpp"
+#include "testing.hpp"
+
+#include <fstream>
+#include <cstdio>
+
+static std::string const g_path = "test_file_watcher.cfg";
+
+
+static void write(std::string const & text)
+{
+  std::ofstream os (g_path, std::ios::out|std::ios::trunc|std::ios::binary);
+  os << text;
+}
+
+
+int main()
+{
+  std::remove(g_path.c_str());
+  write("{ \"updatePeriod\" : 0.1 }");
+  config::FileWatcher watcher (g_path);
+  CHECK(!watcher.poll());
+
+  write("{ \"updatePeriod\" : 0.2 }");
+  CHECK(watcher.poll());
+  CHECK(!watcher.poll());
+
+  write("{ \"updatePeriod\" : 0.2 }");
+  CHECK(!watcher.poll());
+
+  std::remove(g_path.c_str());
+  CHECK(watcher.poll());
+  CHECK(!watcher.poll());
+
+  write("");
+  CHECK(watcher.poll());
+
+  std::remove(g_path.c_str());
+  return testing::result("test_file_watcher");
+}
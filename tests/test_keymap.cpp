@@ -0,0 +1,162 @@
+/*
+*  MIT License
+*
+*  Copyright (c) 2025 Alexander Fedorov
+*
+*  Permission is hereby granted, free of charge, to any person obtaining a copy
+*  of this software and associated documentation files (the "Software"), to deal
+*  in the Software without restriction, including without limitation the rights
+*  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*  copies of the Software, and to permit persons to whom the Software is
+*  furnished to do so, subject to the following conditions:
+*
+*  The above copyright notice and this permission notice shall be included in all
+*  copies or substantial portions of the Software.
+*
+*  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*  SOFTWARE.
+*/
+
+
+/* GKSKeyMap: single key binding fires on every tap when sequence shares its prefix, sequence fires on every
+   second tap, modifiers and release events; hold binding fires once after its duration and not if key is
+   released early; sequence restarts if next key comes after interval. Key state is simulated, time is not. */
+
+#include "keymap.hpp"
+#include "testing.hpp"
+
+#include <thread>
+
+typedef GKSKeyMap::clock_t keymap_clock_t;
+
+static bool g_keys[GKSKeyMap::keyCount];
+
+static bool is_key_down(GKSKeyMap::key_t key)
+{
+  return g_keys[key];
+}
+
+
+static GKSKeyMap::binding_t make_binding(std::vector<GKSKeyMap::key_t> const & keys, std::vector<GKSKeyMap::key_t> const & modifiers,
+  KeyEventType event, unsigned int & fired, keymap_clock_t::duration hold=keymap_clock_t::duration::zero(),
+  keymap_clock_t::duration interval=std::chrono::seconds(10))
+{
+  GKSKeyMap::Trigger trigger;
+  trigger.keys = keys;
+  trigger.modifiers = modifiers;
+  trigger.event = event;
+  trigger.hold = hold;
+  trigger.interval = interval;
+  return GKSKeyMap::binding_t(trigger, [&fired]() { ++fired; });
+}
+
+
+static void tap(GKSKeyMap & keyMap, GKSKeyMap::key_t key)
+{
+  g_keys[key] = true;
+  keyMap.update();
+  g_keys[key] = false;
+  keyMap.update();
+}
+
+
+static void test_taps()
+{
+  unsigned int single = 0, twice = 0, released = 0, modified = 0;
+  GKSKeyMap keyMap (is_key_down);
+  keyMap.assign({
+    make_binding({ VK_F9 }, {}, KeyEventType::press, single),
+    make_binding({ VK_F9, VK_F9 }, {}, KeyEventType::press, twice),
+    make_binding({ VK_F10 }, {}, KeyEventType::release, released),
+    make_binding({ VK_F10 }, { VK_CONTROL }, KeyEventType::press, modified)
+  });
+  keyMap.update();
+
+  for (int i = 0; i < 5; ++i)
+    tap(keyMap, VK_F9);
+  CHECK(single == 5);
+  CHECK(twice == 2);
+
+  tap(keyMap, VK_F10);
+  CHECK(released == 1);
+  CHECK(modified == 0);
+
+  /* Other key breaks sequence. */
+  tap(keyMap, VK_F9);
+  CHECK(single == 6);
+  CHECK(twice == 2);
+
+  g_keys[VK_CONTROL] = true;
+  tap(keyMap, VK_F10);
+  g_keys[VK_CONTROL] = false;
+  keyMap.update();
+  CHECK(modified == 1);
+  /* Ctrl is modifier of other binding, so it must not be held for this one. */
+  CHECK(released == 1);
+}
+
+
+static void test_hold()
+{
+  unsigned int held = 0;
+  GKSKeyMap keyMap (is_key_down);
+  keyMap.assign({ make_binding({ VK_F11 }, {}, KeyEventType::hold, held, std::chrono::milliseconds(50)) });
+  keyMap.update();
+
+  g_keys[VK_F11] = true;
+  keyMap.update();
+  keyMap.update();
+  CHECK(held == 0);
+  CHECK(keyMap.has_pending_timers());
+  std::this_thread::sleep_for(std::chrono::milliseconds(70));
+  keyMap.update();
+  CHECK(held == 1);
+  /* Fires once per press however long key is held. */
+  std::this_thread::sleep_for(std::chrono::milliseconds(70));
+  keyMap.update();
+  g_keys[VK_F11] = false;
+  keyMap.update();
+  CHECK(held == 1);
+  CHECK(!keyMap.has_pending_timers());
+
+  /* Early release cancels timer. */
+  g_keys[VK_F11] = true;
+  keyMap.update();
+  g_keys[VK_F11] = false;
+  keyMap.update();
+  CHECK(!keyMap.has_pending_timers());
+  std::this_thread::sleep_for(std::chrono::milliseconds(70));
+  keyMap.update();
+  CHECK(held == 1);
+}
+
+
+static void test_interval()
+{
+  unsigned int twice = 0;
+  GKSKeyMap keyMap (is_key_down);
+  keyMap.assign({ make_binding({ VK_F12, VK_F12 }, {}, KeyEventType::press, twice, keymap_clock_t::duration::zero(), std::chrono::milliseconds(50)) });
+  keyMap.update();
+
+  tap(keyMap, VK_F12);
+  std::this_thread::sleep_for(std::chrono::milliseconds(80));
+  tap(keyMap, VK_F12);
+  CHECK(twice == 0);
+  /* Late press starts sequence anew, so next one completes it. */
+  tap(keyMap, VK_F12);
+  CHECK(twice == 1);
+}
+
+
+int main()
+{
+  test_taps();
+  test_hold();
+  test_interval();
+  return testing::result("test_keymap");
+}
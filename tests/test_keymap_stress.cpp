@@ -0,0 +1,176 @@
+/*
+*  MIT License
+*
+*  Copyright (c) 2025 Alexander Fedorov
+*
+*  Permission is hereby granted, free of charge, to any person obtaining a copy
+*  of this software and associated documentation files (the "Software"), to deal
+*  in the Software without restriction, including without limitation the rights
+*  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*  copies of the Software, and to permit persons to whom the Software is
+*  furnished to do so, subject to the following conditions:
+*
+*  The above copyright notice and this permission notice shall be included in all
+*  copies or substantial portions of the Software.
+*
+*  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*  SOFTWARE.
+*/
+
+
+/* GKSKeyMap snapshots: bindings are added, removed and replaced at high rate by one thread while poll thread
+   updates key map with simulated key activity and posts actions to executor thread. Replaced snapshots must
+   not be freed while poll thread or pending actions use them (run with -fsanitize=address to check). */
+
+#include "keymap.hpp"
+#include "logging.hpp"
+#include "testing.hpp"
+
+#include <deque>
+
+static std::atomic<unsigned long> g_tick (0);
+
+/* Every bound key is pressed on one tick and released on next. */
+static bool is_key_down(GKSKeyMap::key_t key)
+{
+  return ((g_tick.load(std::memory_order_relaxed) + key) & 1) != 0;
+}
+
+
+/* Runs posted actions on its own thread, some time after they were posted. */
+class TestExecutor : public ActionSink
+{
+public:
+  virtual void post(action_t const * pAction)
+  {
+    std::unique_lock<std::mutex> l (mutex_);
+    queue_.push_back(pAction);
+    ++posted_;
+    cv_.notify_one();
+  }
+
+  virtual bool idle() const { return done_.load(std::memory_order_acquire) == posted_; }
+
+  void stop()
+  {
+    {
+      std::unique_lock<std::mutex> l (mutex_);
+      stopping_ = true;
+      cv_.notify_one();
+    }
+    thread_.join();
+  }
+
+  TestExecutor() : mutex_(), cv_(), queue_(), posted_(0), done_(0), stopping_(false), thread_(&TestExecutor::run_, this) {}
+
+private:
+  void run_()
+  {
+    std::unique_lock<std::mutex> l (mutex_);
+    while (!stopping_ || !queue_.empty())
+    {
+      if (queue_.empty())
+      {
+        cv_.wait(l);
+        continue;
+      }
+      auto const pAction = queue_.front();
+      queue_.pop_front();
+      l.unlock();
+      std::this_thread::yield();
+      (*pAction)();
+      done_.fetch_add(1, std::memory_order_release);
+      l.lock();
+    }
+  }
+
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::deque<action_t const *> queue_;
+  unsigned long posted_;
+  std::atomic<unsigned long> done_;
+  bool stopping_;
+  std::thread thread_;
+};
+
+
+static GKSKeyMap::Trigger make_trigger(GKSKeyMap::key_t key, KeyEventType event)
+{
+  GKSKeyMap::Trigger trigger;
+  trigger.keys.push_back(key);
+  trigger.event = event;
+  trigger.hold = event == KeyEventType::hold ? std::chrono::microseconds(1) : std::chrono::microseconds::zero();
+  trigger.interval = std::chrono::milliseconds(500);
+  return trigger;
+}
+
+
+int main()
+{
+  logging::root_logger().set_level(logging::LogLevel::info);
+  static unsigned int const nChanges = 4000;
+  std::atomic<unsigned long> fired (0);
+  std::atomic<bool> done (false);
+  TestExecutor executor;
+  GKSKeyMap keyMap (is_key_down);
+  keyMap.set_executor(&executor);
+
+  std::thread poller ([&]()
+    {
+      while (!done.load())
+      {
+        g_tick.fetch_add(1, std::memory_order_relaxed);
+        keyMap.update();
+        keyMap.collect();
+      }
+    }
+  );
+
+  static KeyEventType const events[] = { KeyEventType::press, KeyEventType::release, KeyEventType::hold };
+  std::vector<unsigned int> ids;
+  for (unsigned int i = 0; i < nChanges; ++i)
+  {
+    /* Each callback has its own state, so that freeing it early is detected. */
+    auto const spCount = std::make_shared<unsigned long>(0);
+    auto const cb = [spCount, &fired]() { ++*spCount; fired.fetch_add(1, std::memory_order_relaxed); };
+    GKSKeyMap::key_t const key = 'A' + i % 26;
+    switch (i % 4)
+    {
+      case 0:
+      case 1:
+        ids.push_back(keyMap.add(make_trigger(key, events[i % 3]), cb));
+        break;
+      case 2:
+        if (!ids.empty())
+        {
+          keyMap.remove(ids.front());
+          ids.erase(ids.begin());
+        }
+        break;
+      case 3:
+        if (i % 400 == 3)
+        {
+          keyMap.assign({ GKSKeyMap::binding_t(make_trigger(key, KeyEventType::press), cb) });
+          ids.clear();
+        }
+        break;
+    }
+  }
+
+  /* Let poll thread see last snapshot, so that all retired ones can be freed. */
+  auto const deadline = std::chrono::steady_clock::now() + std::chrono::seconds(1);
+  while (fired.load() == 0 && std::chrono::steady_clock::now() < deadline)
+    std::this_thread::yield();
+  done.store(true);
+  poller.join();
+  executor.stop();
+
+  std::cout << "changes: " << nChanges << "; actions: " << fired.load() << std::endl;
+  CHECK(fired.load() > 0);
+  return testing::result("test_keymap_stress");
+}
@@ -0,0 +1,72 @@
+/*
+*  MIT License
+*
+*  Copyright (c) 2025 Alexander Fedorov
+*
+*  Permission is hereby granted, free of charge, to any person obtaining a copy
+*  of this software and associated documentation files (the "Software"), to deal
+*  in the Software without restriction, including without limitation the rights
+*  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*  copies of the Software, and to permit persons to whom the Software is
+*  furnished to do so, subject to the following conditions:
+*
+*  The above copyright notice and this permission notice shall be included in all
+*  copies or substantial portions of the Software.
+*
+*  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*  SOFTWARE.
+*/
+
+
+/* Encoding of log message arguments: "text"_lit is stored by pointer, char arrays (const or not) and strings
+   are copied into payload, so that record stays valid after buffer is gone. */
+
+#include "logging.hpp"
+#include "testing.hpp"
+
+#include <string>
+
+
+static std::string print(logging::LogRecord const & lr)
+{
+  StrBuffer<256> w;
+  logging::print_args(w, lr);
+  return std::string(w.str().data, w.str().size);
+}
+
+
+/* Buffer is gone when record is printed. */
+static void encode_local_name(logging::LogRecord & lr, char c)
+{
+  char const name[] = { c, c, '\0' };
+  logging::encode_args(lr, "name: "_lit, name);
+}
+
+
+int main()
+{
+  logging::LogRecord lr;
+  lr.reset("test", logging::LogLevel::info, 0);
+  encode_local_name(lr, 'a');
+  CHECK(lr.nArgs == 2);
+  CHECK(lr.kinds[0] == logging::ArgKind::literal);
+  CHECK(lr.kinds[1] == logging::ArgKind::string);
+  CHECK(print(lr) == "name: aa");
+
+  /* Unmarked literal is copied as well. */
+  char buffer[] = "buffer";
+  lr.reset("test", logging::LogLevel::info, 0);
+  logging::encode_args(lr, "text", buffer, std::string("string"), 'c');
+  CHECK(lr.kinds[0] == logging::ArgKind::string);
+  CHECK(lr.kinds[1] == logging::ArgKind::string);
+  CHECK(lr.kinds[2] == logging::ArgKind::string);
+  buffer[0] = 'B';
+  CHECK(print(lr) == "textbufferstringc");
+
+  return testing::result("test_log_record");
+}
@@ -0,0 +1,163 @@
+/*
+*  MIT License
+*
+*  Copyright (c) 2025 Alexander Fedorov
+*
+*  Permission is hereby granted, free of charge, to any person obtaining a copy
+*  of this software and associated documentation files (the "Software"), to deal
+*  in the Software without restriction, including without limitation the rights
+*  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*  copies of the Software, and to permit persons to whom the Software is
+*  furnished to do so, subject to the following conditions:
+*
+*  The above copyright notice and this permission notice shall be included in all
+*  copies or substantial portions of the Software.
+*
+*  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*  SOFTWARE.
+*/
+
+
+/* Suppression of repeated log messages: summary of a burst is printed by next other message, by
+   flush_repeats() once window has passed or on shutdown, but not on destruction of logger. Bursts are
+   tracked per thread. */
+
+#include "logging.hpp"
+#include "testing.hpp"
+
+#include <thread>
+#include <mutex>
+#include <vector>
+
+class VectorLogPrinter : public logging::LogPrinter
+{
+public:
+  virtual void print(logging::LogMessage const & lm) const
+  {
+    lines_.push_back(std::string(lm.msg.data, lm.msg.size));
+  }
+
+  VectorLogPrinter(std::vector<std::string> & lines) : lines_(lines) {}
+
+private:
+  std::vector<std::string> & lines_;
+};
+
+
+class LockedLogPrinter : public logging::LogPrinter
+{
+public:
+  virtual void print(logging::LogMessage const & lm) const
+  {
+    std::unique_lock<std::mutex> lock (mutex_);
+    lines_.push_back(std::string(lm.msg.data, lm.msg.size));
+  }
+
+  LockedLogPrinter(std::vector<std::string> & lines, std::mutex & mutex) : lines_(lines), mutex_(mutex) {}
+
+private:
+  std::vector<std::string> & lines_;
+  std::mutex & mutex_;
+};
+
+
+static void log_burst(logging::Logger & logger, int n)
+{
+  for (int i = 0; i < n; ++i)
+    logger.log(logging::LogSource::init, logging::LogLevel::info, "message "_lit, i);
+}
+
+
+static void test_other_message()
+{
+  std::vector<std::string> lines;
+  logging::Logger logger (logging::LogLevel::debug);
+  logger.add_printer(std::make_shared<VectorLogPrinter>(lines));
+  logger.set_repeat_window(std::chrono::milliseconds(10000));
+  log_burst(logger, 3);
+  logger.log(logging::LogSource::init, logging::LogLevel::info, "other"_lit);
+  CHECK((lines == std::vector<std::string>{ "message 0", "last message repeated 2 times", "other" }));
+}
+
+
+static void test_flush()
+{
+  std::vector<std::string> lines;
+  logging::Logger logger (logging::LogLevel::debug);
+  logger.add_printer(std::make_shared<VectorLogPrinter>(lines));
+  logger.set_repeat_window(std::chrono::milliseconds(20));
+  log_burst(logger, 4);
+  logger.flush_repeats();
+  CHECK(lines.size() == 1);
+  std::this_thread::sleep_for(std::chrono::milliseconds(30));
+  logger.flush_repeats();
+  CHECK((lines == std::vector<std::string>{ "message 0", "last message repeated 3 times" }));
+  /* Burst after flush starts with printed message. */
+  log_burst(logger, 1);
+  CHECK(lines.size() == 3 && lines.back() == "message 0");
+}
+
+
+static void test_shutdown()
+{
+  std::vector<std::string> lines;
+  {
+    logging::Logger logger (logging::LogLevel::debug);
+    logger.add_printer(std::make_shared<VectorLogPrinter>(lines));
+    logger.set_repeat_window(std::chrono::milliseconds(10000));
+    log_burst(logger, 2);
+    logger.flush_repeats();
+    CHECK(lines.size() == 1);
+    logger.flush_repeats(true);
+    CHECK((lines == std::vector<std::string>{ "message 0", "last message repeated 1 times" }));
+    log_burst(logger, 2);
+  }
+  /* Destructor does not print: printers may be gone during static destruction. */
+  CHECK(lines.size() == 3);
+}
+
+
+/* Bursts of other threads do not break each other. */
+static void test_threads()
+{
+  std::vector<std::string> lines;
+  std::mutex mutex;
+  logging::Logger logger (logging::LogLevel::debug);
+  logger.add_printer(std::make_shared<LockedLogPrinter>(lines, mutex));
+  logger.set_repeat_window(std::chrono::milliseconds(10000));
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 2; ++i)
+    threads.push_back(std::thread(log_burst, std::ref(logger), 100));
+  for (auto & t : threads)
+    t.join();
+  CHECK((lines == std::vector<std::string>{ "message 0", "message 0" }));
+  logger.flush_repeats(true);
+  CHECK((lines == std::vector<std::string>{ "message 0", "message 0", "last message repeated 99 times", "last message repeated 99 times" }));
+}
+
+
+static void test_disabled()
+{
+  std::vector<std::string> lines;
+  logging::Logger logger (logging::LogLevel::debug);
+  logger.add_printer(std::make_shared<VectorLogPrinter>(lines));
+  log_burst(logger, 3);
+  logger.flush_repeats();
+  CHECK(lines.size() == 3);
+}
+
+
+int main()
+{
+  test_other_message();
+  test_flush();
+  test_shutdown();
+  test_threads();
+  test_disabled();
+  return testing::result("test_log_repeats");
+}
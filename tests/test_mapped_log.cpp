@@ -0,0 +1,151 @@
+/*
+*  MIT License
+*
+*  Copyright (c) 2025 Alexander Fedorov
+*
+*  Permission is hereby granted, free of charge, to any person obtaining a copy
+*  of this software and associated documentation files (the "Software"), to deal
+*  in the Software without restriction, including without limitation the rights
+*  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*  copies of the Software, and to permit persons to whom the Software is
+*  furnished to do so, subject to the following conditions:
+*
+*  The above copyright notice and this permission notice shall be included in all
+*  copies or substantial portions of the Software.
+*
+*  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*  SOFTWARE.
+*/
+
+
+/* MappedFileLogPrinter: file is cut to written size on close, rotated when segment is full, and keeps at most
+   maxFiles old files. */
+
+#include "logging.hpp"
+#include "testing.hpp"
+
+#include <fstream>
+#include <sstream>
+#include <cstdio>
+
+static std::string const g_path = "test_mapped_log.log";
+
+
+static void print_msg(StrWriter & w, logging::LogMessage const & lm)
+{
+  w << lm.msg;
+}
+
+
+static void print(logging::MappedFileLogPrinter & printer, std::string const & msg)
+{
+  printer.print(logging::LogMessage("test", logging::LogLevel::info, 0, msg));
+}
+
+
+static bool exists(std::string const & path)
+{
+  return std::ifstream(path).is_open();
+}
+
+
+static std::string read(std::string const & path)
+{
+  std::ifstream is (path, std::ios::in|std::ios::binary);
+  std::stringstream ss;
+  ss << is.rdbuf();
+  return ss.str();
+}
+
+
+static void remove_all()
+{
+  std::remove(g_path.c_str());
+  for (int i = 1; i <= 4; ++i)
+    std::remove(stream_to_str(g_path, ".", i).c_str());
+}
+
+
+static void test_truncated_on_close()
+{
+  remove_all();
+  {
+    logging::MappedFileLogPrinter printer (print_msg, g_path, 4096, 2);
+    print(printer, "first");
+    print(printer, "second");
+    /* Segment is preallocated while printer is open. */
+    CHECK(read(g_path).size() == 4096);
+  }
+  CHECK(read(g_path) == "first\nsecond\n");
+  CHECK(!exists(g_path + ".1"));
+}
+
+
+static void test_rotation()
+{
+  remove_all();
+  {
+    /* Each line is 10 bytes, so each file holds 3 of them. */
+    logging::MappedFileLogPrinter printer (print_msg, g_path, 32, 2);
+    for (int i = 0; i < 10; ++i)
+      print(printer, stream_to_str("line ", i, "..."));
+  }
+  CHECK(read(g_path) == "line 9...\n");
+  CHECK(read(g_path + ".1") == "line 6...\nline 7...\nline 8...\n");
+  CHECK(read(g_path + ".2") == "line 3...\nline 4...\nline 5...\n");
+  CHECK(!exists(g_path + ".3"));
+}
+
+
+static void test_no_old_files()
+{
+  remove_all();
+  {
+    logging::MappedFileLogPrinter printer (print_msg, g_path, 16, 0);
+    print(printer, "aaaaaaaaa");
+    print(printer, "bbbbbbbbb");
+  }
+  CHECK(read(g_path) == "bbbbbbbbb\n");
+  CHECK(!exists(g_path + ".1"));
+}
+
+
+static void test_long_line()
+{
+  remove_all();
+  {
+    logging::MappedFileLogPrinter printer (print_msg, g_path, 8, 1);
+    print(printer, "0123456789");
+  }
+  CHECK(read(g_path) == "01234567");
+}
+
+
+static void test_zero_size()
+{
+  bool thrown = false;
+  try {
+    logging::MappedFileLogPrinter printer (print_msg, g_path, 0, 1);
+  } catch (std::exception const &)
+  {
+    thrown = true;
+  }
+  CHECK(thrown);
+}
+
+
+int main()
+{
+  test_truncated_on_close();
+  test_rotation();
+  test_no_old_files();
+  test_long_line();
+  test_zero_size();
+  remove_all();
+  return testing::result("test_mapped_log");
+}
@@ -0,0 +1,108 @@
+/*
+*  MIT License
+*
+*  Copyright (c) 2025 Alexander Fedorov
+*
+*  Permission is hereby granted, free of charge, to any person obtaining a copy
+*  of this software and associated documentation files (the "Software"), to deal
+*  in the Software without restriction, including without limitation the rights
+*  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*  copies of the Software, and to permit persons to whom the Software is
+*  furnished to do so, subject to the following conditions:
+*
+*  The above copyright notice and this permission notice shall be included in all
+*  copies or substantial portions of the Software.
+*
+*  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*  SOFTWARE.
+*/
+
+/* MotionRawInputTransform: 16.16 gain, fraction lost to rounding is carried per device in both directions,
+   speed curve is interpolated, axes are swapped and inverted, absolute motion is not touched. */
+
+#include "rawinput.hpp"
+#include "testing.hpp"
+
+#include <vector>
+
+typedef RawInputTransform::clock_t input_clock_t;
+
+static HANDLE const mouse = reinterpret_cast<HANDLE>(0x10);
+static HANDLE const trackball = reinterpret_cast<HANDLE>(0x20);
+
+
+static RAWINPUT make_move(HANDLE hDevice, LONG x, LONG y, USHORT flags=MOUSE_MOVE_RELATIVE)
+{
+  RAWINPUT ri {};
+  ri.header.dwType = RIM_TYPEMOUSE;
+  ri.header.hDevice = hDevice;
+  ri.data.mouse.usFlags = flags;
+  ri.data.mouse.lLastX = x;
+  ri.data.mouse.lLastY = y;
+  return ri;
+}
+
+
+/* All records as one batch. */
+static void transform(RawInputTransform & t, std::vector<RAWINPUT> & records)
+{
+  std::vector<PRAWINPUT> pointers;
+  for (auto & ri : records)
+    pointers.push_back(&ri);
+  t.transform(pointers.data(), pointers.size(), input_clock_t::now());
+}
+
+
+int main()
+{
+  auto const half = MotionRawInputTransform::make_params(0.5, {});
+  CHECK(half.scale == 0x8000);
+  CHECK(half.curve[0] == 0x10000 && half.curve[255] == 0x10000);
+
+  /* Gain 1 up to speed 10, 2 from speed 20, linear in between. */
+  auto const curved = MotionRawInputTransform::make_params(1.0, { { 10.0, 1.0 }, { 20.0, 2.0 } });
+  CHECK(curved.curve[0] == 0x10000 && curved.curve[10] == 0x10000);
+  CHECK(curved.curve[15] == 0x18000);
+  CHECK(curved.curve[20] == 0x20000 && curved.curve[255] == 0x20000);
+
+  auto swapped = MotionRawInputTransform::make_params(1.0, {});
+  swapped.swapAxes = true;
+  swapped.invertX = true;
+
+  MotionRawInputTransform motion;
+  motion.set_params(mouse, MotionRawInputTransform::make_params(1.5, {}));
+  motion.set_params(trackball, swapped);
+
+  /* Remainders of the two devices are separate, and carried across batches. */
+  std::vector<RAWINPUT> batch1 { make_move(mouse, 1, -1), make_move(trackball, 3, 4), make_move(mouse, 1, -1) };
+  transform(motion, batch1);
+  CHECK(batch1[0].data.mouse.lLastX == 1 && batch1[0].data.mouse.lLastY == -2);
+  CHECK(batch1[1].data.mouse.lLastX == -4 && batch1[1].data.mouse.lLastY == 3);
+  CHECK(batch1[2].data.mouse.lLastX == 2 && batch1[2].data.mouse.lLastY == -1);
+
+  std::vector<RAWINPUT> batch2 { make_move(mouse, 1, -1), make_move(mouse, 1, -1), make_move(mouse, 100, 0, MOUSE_MOVE_ABSOLUTE) };
+  transform(motion, batch2);
+  CHECK(batch2[0].data.mouse.lLastX == 1 && batch2[0].data.mouse.lLastY == -2);
+  CHECK(batch2[1].data.mouse.lLastX == 2 && batch2[1].data.mouse.lLastY == -1);
+  CHECK(batch2[2].data.mouse.lLastX == 100 && batch2[2].data.mouse.lLastY == 0);
+
+  /* More records than fit in one chunk: total is scaled exactly. */
+  MotionRawInputTransform slow;
+  slow.set_params(mouse, half);
+  std::vector<RAWINPUT> batch3 (1000, make_move(mouse, 3, -3));
+  transform(slow, batch3);
+  long sumX = 0, sumY = 0;
+  for (auto const & ri : batch3)
+  {
+    sumX += ri.data.mouse.lLastX;
+    sumY += ri.data.mouse.lLastY;
+  }
+  CHECK(sumX == 1500 && sumY == -1500);
+
+  return testing::result("test_motion");
+}
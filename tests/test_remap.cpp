@@ -0,0 +1,121 @@
+/*
+*  MIT License
+*
+*  Copyright (c) 2025 Alexander Fedorov
+*
+*  Permission is hereby granted, free of charge, to any person obtaining a copy
+*  of this software and associated documentation files (the "Software"), to deal
+*  in the Software without restriction, including without limitation the rights
+*  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*  copies of the Software, and to permit persons to whom the Software is
+*  furnished to do so, subject to the following conditions:
+*
+*  The above copyright notice and this permission notice shall be included in all
+*  copies or substantial portions of the Software.
+*
+*  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*  SOFTWARE.
+*/
+
+/* RemapRawInputTransform: key table is indexed by make code and E0 prefix, E0 prefix and generic modifier key
+   are set for target key, break flag is kept; button flags follow permutation in both byte halves (X buttons)
+   and wheel flags stay; other devices are not touched. */
+
+#include "rawinput.hpp"
+#include "testing.hpp"
+
+typedef RawInputTransform::clock_t input_clock_t;
+
+static HANDLE const keyboard = reinterpret_cast<HANDLE>(0x10);
+static HANDLE const mouse = reinterpret_cast<HANDLE>(0x20);
+static HANDLE const other = reinterpret_cast<HANDLE>(0x30);
+
+
+static RAWINPUT make_key(HANDLE hDevice, USHORT makeCode, USHORT flags, USHORT vKey)
+{
+  RAWINPUT ri {};
+  ri.header.dwType = RIM_TYPEKEYBOARD;
+  ri.header.hDevice = hDevice;
+  ri.data.keyboard.MakeCode = makeCode;
+  ri.data.keyboard.Flags = flags;
+  ri.data.keyboard.VKey = vKey;
+  return ri;
+}
+
+
+static RAWINPUT make_buttons(HANDLE hDevice, USHORT buttonFlags)
+{
+  RAWINPUT ri {};
+  ri.header.dwType = RIM_TYPEMOUSE;
+  ri.header.hDevice = hDevice;
+  ri.data.mouse.usButtonFlags = buttonFlags;
+  return ri;
+}
+
+
+static void transform(RawInputTransform & t, RAWINPUT & ri)
+{
+  PRAWINPUT p = &ri;
+  t.transform(&p, 1, input_clock_t::now());
+}
+
+
+int main()
+{
+  RemapRawInputTransform remap;
+  auto keys = RemapRawInputTransform::make_key_table();
+  RemapRawInputTransform::map_key(keys, "A", "B");
+  RemapRawInputTransform::map_key(keys, "B", "RIGHT");
+  RemapRawInputTransform::map_key(keys, "RCONTROL", "LSHIFT");
+  remap.set_keys(keyboard, keys);
+  auto buttons = RemapRawInputTransform::make_button_table();
+  buttons[0] = 2;
+  buttons[1] = 1;
+  buttons[3] = 5;
+  buttons[4] = 4;
+  remap.set_buttons(mouse, buttons);
+
+  auto a = make_key(keyboard, 0x1E, RI_KEY_BREAK, 'A');
+  transform(remap, a);
+  CHECK(a.data.keyboard.MakeCode == 0x30 && a.data.keyboard.Flags == RI_KEY_BREAK && a.data.keyboard.VKey == 'B');
+
+  auto b = make_key(keyboard, 0x30, RI_KEY_MAKE, 'B');
+  transform(remap, b);
+  CHECK(b.data.keyboard.MakeCode == 0x4D && b.data.keyboard.Flags == RI_KEY_E0 && b.data.keyboard.VKey == VK_RIGHT);
+
+  /* Right Ctrl has E0 prefix; left Ctrl with the same make code is not remapped. */
+  auto rctrl = make_key(keyboard, 0x1D, RI_KEY_E0 | RI_KEY_BREAK, VK_CONTROL);
+  transform(remap, rctrl);
+  CHECK(rctrl.data.keyboard.MakeCode == 0x2A && rctrl.data.keyboard.Flags == RI_KEY_BREAK && rctrl.data.keyboard.VKey == VK_SHIFT);
+  auto lctrl = make_key(keyboard, 0x1D, RI_KEY_MAKE, VK_CONTROL);
+  transform(remap, lctrl);
+  CHECK(lctrl.data.keyboard.MakeCode == 0x1D && lctrl.data.keyboard.Flags == RI_KEY_MAKE && lctrl.data.keyboard.VKey == VK_CONTROL);
+
+  auto otherKey = make_key(other, 0x1E, RI_KEY_MAKE, 'A');
+  transform(remap, otherKey);
+  CHECK(otherKey.data.keyboard.MakeCode == 0x1E && otherKey.data.keyboard.VKey == 'A');
+
+  auto left = make_buttons(mouse, RI_MOUSE_LEFT_BUTTON_DOWN | RI_MOUSE_WHEEL);
+  transform(remap, left);
+  CHECK(left.data.mouse.usButtonFlags == (RI_MOUSE_RIGHT_BUTTON_DOWN | RI_MOUSE_WHEEL));
+
+  auto right = make_buttons(mouse, RI_MOUSE_RIGHT_BUTTON_UP | RI_MOUSE_MIDDLE_BUTTON_DOWN);
+  transform(remap, right);
+  CHECK(right.data.mouse.usButtonFlags == (RI_MOUSE_LEFT_BUTTON_UP | RI_MOUSE_MIDDLE_BUTTON_DOWN));
+
+  /* Button 4 flags are in low byte and button 5 flags in high byte. */
+  auto x = make_buttons(mouse, RI_MOUSE_BUTTON_4_DOWN | RI_MOUSE_BUTTON_5_UP | RI_MOUSE_HWHEEL);
+  transform(remap, x);
+  CHECK(x.data.mouse.usButtonFlags == (RI_MOUSE_BUTTON_5_DOWN | RI_MOUSE_BUTTON_4_UP | RI_MOUSE_HWHEEL));
+
+  auto otherButtons = make_buttons(other, RI_MOUSE_LEFT_BUTTON_DOWN);
+  transform(remap, otherButtons);
+  CHECK(otherButtons.data.mouse.usButtonFlags == RI_MOUSE_LEFT_BUTTON_DOWN);
+
+  return testing::result("test_remap");
+}
@@ -0,0 +1,152 @@
+/*
+*  MIT License
+*
+*  Copyright (c) 2025 Alexander Fedorov
+*
+*  Permission is hereby granted, free of charge, to any person obtaining a copy
+*  of this software and associated documentation files (the "Software"), to deal
+*  in the Software without restriction, including without limitation the rights
+*  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*  copies of the Software, and to permit persons to whom the Software is
+*  furnished to do so, subject to the following conditions:
+*
+*  The above copyright notice and this permission notice shall be included in all
+*  copies or substantial portions of the Software.
+*
+*  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*  SOFTWARE.
+*/
+
+
+/* TimerWheel: tasks of every level and of overflow list are collected exactly when due, after slots are
+   cascaded; sub-millisecond deadlines; cancellation of waiting and running tasks; run time accounting;
+   periodic task that throws is rescheduled, one-shot one is cancelled. */
+
+#include "timerwheel.hpp"
+#include "testing.hpp"
+
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <stdexcept>
+
+typedef TimerWheel::clock_t wheel_clock_t;
+typedef std::chrono::milliseconds ms;
+
+
+static wheel_clock_t::time_point next_run(wheel_clock_t::time_point due)
+{
+  return due + ms(10);
+}
+
+
+static wheel_clock_t::time_point throw_error(wheel_clock_t::time_point)
+{
+  throw std::runtime_error("test");
+}
+
+
+/* Returns sorted names of tasks collected at now. */
+static std::string collect(TimerWheel & wheel, wheel_clock_t::time_point now)
+{
+  std::vector<TimerWheel::Task *> due;
+  wheel.collect_due(now, due);
+  std::string r;
+  for (auto const pTask : due)
+    r += pTask->name;
+  std::sort(r.begin(), r.end());
+  return r;
+}
+
+
+int main()
+{
+  auto const t0 = wheel_clock_t::now();
+  TimerWheel wheel (t0);
+  CHECK(wheel.next_deadline() == wheel_clock_t::time_point::max());
+
+  /* Level 0, 1, 2, 3 and overflow list. */
+  wheel.add("a", t0 + ms(5), next_run, ms(10));
+  wheel.add("b", t0 + ms(100), next_run, ms(10));
+  wheel.add("c", t0 + ms(5000), next_run, ms(10));
+  wheel.add("d", t0 + ms(300000), next_run, ms(10));
+  wheel.add("e", t0 + ms((1 << 24) + 10), next_run, ms(10));
+  wheel.add("f", t0 + std::chrono::microseconds(5500), next_run, ms(10));
+  CHECK(wheel.size() == 6);
+  CHECK(wheel.next_deadline() == t0 + ms(5));
+
+  CHECK(collect(wheel, t0 + ms(4)) == "");
+  CHECK(collect(wheel, t0 + ms(5)) == "a");
+  CHECK(wheel.next_deadline() == t0 + std::chrono::microseconds(5500));
+  CHECK(collect(wheel, t0 + std::chrono::microseconds(5400)) == "");
+  CHECK(collect(wheel, t0 + std::chrono::microseconds(5500)) == "f");
+  CHECK(wheel.next_deadline() == t0 + ms(100));
+  CHECK(collect(wheel, t0 + ms(99)) == "");
+  CHECK(collect(wheel, t0 + ms(100)) == "b");
+  CHECK(collect(wheel, t0 + ms(4999)) == "");
+  CHECK(collect(wheel, t0 + ms(5000)) == "c");
+  CHECK(collect(wheel, t0 + ms(299999)) == "");
+  CHECK(collect(wheel, t0 + ms(300000)) == "d");
+  CHECK(wheel.next_deadline() == t0 + ms((1 << 24) + 10));
+  CHECK(collect(wheel, t0 + ms((1 << 24) + 9)) == "");
+  CHECK(collect(wheel, t0 + ms((1 << 24) + 10)) == "e");
+  /* Collected tasks stay known until they complete. */
+  CHECK(wheel.size() == 6);
+  for (TimerWheel::task_id_t id = 1; id <= 6; ++id)
+    wheel.erase(wheel.find(id));
+  CHECK(wheel.size() == 0);
+  CHECK(wheel.next_deadline() == wheel_clock_t::time_point::max());
+
+  /* Waiting task is removed by cancel(), running one when it completes. */
+  auto const t1 = t0 + ms((1 << 24) + 10);
+  auto const waiting = wheel.add("g", t1 + ms(50), next_run, ms(10));
+  CHECK(wheel.cancel(waiting));
+  CHECK(wheel.find(waiting) == nullptr);
+  CHECK(!wheel.cancel(waiting));
+  CHECK(collect(wheel, t1 + ms(60)) == "");
+  auto const running = wheel.add("h", t1 + ms(70), next_run, ms(10));
+  CHECK(collect(wheel, t1 + ms(70)) == "h");
+  CHECK(!wheel.cancel(running));
+  CHECK(wheel.find(running) != nullptr);
+  wheel.complete(wheel.find(running), t1 + ms(80), ms(1));
+  CHECK(wheel.find(running) == nullptr);
+  CHECK(collect(wheel, t1 + ms(80)) == "");
+
+  /* Run time is accounted per run; task is put back due at time it returns. */
+  auto const t2 = wheel_clock_t::now() + ms(1000);
+  TimerWheel accounted (t2);
+  auto const pTask = accounted.find(accounted.add("p", t2, next_run, ms(10)));
+  CHECK(collect(accounted, t2) == "p");
+  auto next = TimerWheel::run(*pTask);
+  CHECK(next == t2 + ms(10));
+  accounted.complete(pTask, next, ms(3));
+  CHECK(pTask->due == t2 + ms(10));
+  CHECK(collect(accounted, t2 + ms(9)) == "");
+  CHECK(collect(accounted, t2 + ms(10)) == "p");
+  accounted.complete(pTask, TimerWheel::run(*pTask), ms(1));
+  CHECK(pTask->runs == 2);
+  CHECK(pTask->runTime == ms(4));
+  CHECK(pTask->maxRunTime == ms(3));
+
+  /* Periodic task that throws is run again after period, one-shot one is removed. */
+  auto const pPeriodic = accounted.find(accounted.add("q", t2, throw_error, ms(10)));
+  auto const pOneShot = accounted.find(accounted.add("r", t2, throw_error, wheel_clock_t::duration::zero()));
+  auto const oneShot = pOneShot->id;
+  CHECK(collect(accounted, t2 + ms(10)) == "qr");
+  next = TimerWheel::run(*pPeriodic);
+  CHECK(next == t2 + ms(10));
+  accounted.complete(pPeriodic, next, ms(1));
+  next = TimerWheel::run(*pOneShot);
+  CHECK(next == wheel_clock_t::time_point());
+  accounted.complete(pOneShot, next, ms(1));
+  CHECK(accounted.find(oneShot) == nullptr);
+  CHECK(accounted.size() == 2);
+  CHECK(collect(accounted, t2 + ms(10)) == "q");
+
+  return testing::result("test_timer_wheel");
+}
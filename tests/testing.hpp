@@ -0,0 +1,71 @@
+/*
+*  MIT License
+*
+*  Copyright (c) 2025 Alexander Fedorov
+*
+*  Permission is hereby granted, free of charge, to any person obtaining a copy
+*  of this software and associated documentation files (the "Software"), to deal
+*  in the Software without restriction, including without limitation the rights
+*  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*  copies of the Software, and to permit persons to whom the Software is
+*  furnished to do so, subject to the following conditions:
+*
+*  The above copyright notice and this permission notice shall be included in all
+*  copies or substantial portions of the Software.
+*
+*  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*  SOFTWARE.
+*/
+
+#ifndef TESTING_HPP_
+#define TESTING_HPP_
+
+#include <iostream>
+#include <chrono>
+
+/* Minimal checks for host tests and benchmarks (see "test" and "bench" targets in Makefile). */
+namespace testing
+{
+
+inline unsigned int & failures()
+{
+  static unsigned int n = 0;
+  return n;
+}
+
+inline void check(bool ok, char const * expr, char const * file, int line)
+{
+  if (ok)
+    return;
+  ++failures();
+  std::cerr << file << ":" << line << ": check failed: " << expr << std::endl;
+}
+
+/* Returns exit code of test. */
+inline int result(char const * name)
+{
+  std::cout << name << ": " << (failures() == 0 ? "passed" : "FAILED") << std::endl;
+  return failures() == 0 ? 0 : 1;
+}
+
+/* Runs f n times and returns mean time per run in ns. */
+template <class F>
+double time_ns(unsigned long n, F f)
+{
+  typedef std::chrono::steady_clock clock_t;
+  auto const start = clock_t::now();
+  for (unsigned long i = 0; i < n; ++i)
+    f(i);
+  return std::chrono::duration<double, std::nano>(clock_t::now() - start).count() / n;
+}
+
+} //testing
+
+#define CHECK(cond) testing::check((cond), #cond, __FILE__, __LINE__)
+
+#endif
@@ -0,0 +1,202 @@
+/*
+*  MIT License
+*
+*  Copyright (c) 2025 Alexander Fedorov
+*
+*  Permission is hereby granted, free of charge, to any person obtaining a copy
+*  of this software and associated documentation files (the "Software"), to deal
+*  in the Software without restriction, including without limitation the rights
+*  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*  copies of the Software, and to permit persons to whom the Software is
+*  furnished to do so, subject to the following conditions:
+*
+*  The above copyright notice and this permission notice shall be included in all
+*  copies or substantial portions of the Software.
+*
+*  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*  SOFTWARE.
+*/
+
+#include "timerwheel.hpp"
+#include "logging.hpp"
+#include <algorithm>
+#include <exception>
+
+
+TimerWheel::task_id_t TimerWheel::add(char const * name, clock_t::time_point first, task_t const & task, clock_t::duration period)
+{
+  std::unique_ptr<Task> upTask (new Task{++lastId_, name, task, first, period, nullptr, false, 0, clock_t::duration::zero(), clock_t::duration::zero()});
+  auto const pTask = upTask.get();
+  tasks_[pTask->id] = std::move(upTask);
+  insert_(pTask);
+  return pTask->id;
+}
+
+
+bool TimerWheel::cancel(task_id_t id)
+{
+  auto const pTask = find(id);
+  if (!pTask)
+    return false;
+  pTask->cancelled = true;
+  if (!pTask->pSlot)
+    return false;
+  remove_(pTask);
+  tasks_.erase(id);
+  return true;
+}
+
+
+/* Visits level 0 slots from current tick up to now, removing due and cancelled tasks. */
+void TimerWheel::collect_due(clock_t::time_point now, std::vector<Task *> & due)
+{
+  auto const nowTick = tick_of_(now);
+  while (true)
+  {
+    auto & slot = wheel_[0][currentTick_ & slotMask];
+    for (std::size_t i = 0; i < slot.size();)
+      if (slot[i]->cancelled || slot[i]->due <= now)
+      {
+        slot[i]->pSlot = nullptr;
+        due.push_back(slot[i]);
+        slot[i] = slot.back();
+        slot.pop_back();
+      }
+      else
+        ++i;
+    if (currentTick_ >= nowTick)
+      break;
+    ++currentTick_;
+    cascade_();
+  }
+}
+
+
+/* Periodic task that throws is run again on next multiple of its period, as if run had succeeded; one-shot
+   task has no next run to fall back to and is cancelled. */
+TimerWheel::clock_t::time_point TimerWheel::run(Task & task)
+{
+  try {
+    return task.fn(task.due);
+  } catch (std::exception const & e)
+  {
+    if (task.period == clock_t::duration::zero())
+    {
+      logging::log(logging::LogSource::wrapper, logging::LogLevel::error, "Exception in task "_lit, task.id, " ("_lit, task.name, "), task is cancelled: "_lit, e.what());
+      return clock_t::time_point();
+    }
+    logging::log(logging::LogSource::wrapper, logging::LogLevel::error, "Exception in task "_lit, task.id, " ("_lit, task.name, "), task is rescheduled: "_lit, e.what());
+    auto const next = task.due + task.period;
+    auto const now = clock_t::now();
+    return next > now ? next : now + task.period;
+  }
+}
+
+
+void TimerWheel::complete(Task * pTask, clock_t::time_point next, clock_t::duration runTime)
+{
+  ++pTask->runs;
+  pTask->runTime += runTime;
+  pTask->maxRunTime = std::max(pTask->maxRunTime, runTime);
+  if (pTask->cancelled || next == clock_t::time_point())
+    tasks_.erase(pTask->id);
+  else
+  {
+    pTask->due = next;
+    insert_(pTask);
+  }
+}
+
+
+void TimerWheel::erase(Task * pTask)
+{
+  tasks_.erase(pTask->id);
+}
+
+
+/* Level 0 slots hold tasks of their exact tick, so first non-empty one has earliest of them; tasks of higher
+   levels may be due earlier if their slot is cascaded soon, and are few, so all of them are checked. */
+TimerWheel::clock_t::time_point TimerWheel::next_deadline() const
+{
+  auto result = clock_t::time_point::max();
+  for (uint64_t i = 0; i <= slotMask && result == clock_t::time_point::max(); ++i)
+    for (auto const pTask : wheel_[0][(currentTick_ + i) & slotMask])
+      result = std::min(result, pTask->due);
+  for (std::size_t level = 1; level < levels; ++level)
+    for (auto const & slot : wheel_[level])
+      for (auto const pTask : slot)
+        result = std::min(result, pTask->due);
+  for (auto const pTask : overflow_)
+    result = std::min(result, pTask->due);
+  return result;
+}
+
+
+TimerWheel::Task * TimerWheel::find(task_id_t id) const
+{
+  auto const it = tasks_.find(id);
+  return it == tasks_.end() ? nullptr : it->second.get();
+}
+
+
+void TimerWheel::for_each(std::function<void(Task &)> const & f)
+{
+  for (auto const & p : tasks_)
+    f(*p.second);
+}
+
+
+/* Level is chosen by distance from current tick, so that slot comes up (or is cascaded) before task is due.
+   Tasks that are due already go to current slot. */
+void TimerWheel::insert_(Task * pTask)
+{
+  auto const tick = std::max(tick_of_(pTask->due), currentTick_);
+  auto const delta = tick - currentTick_;
+  pTask->pSlot = &overflow_;
+  for (std::size_t level = 0; level < levels; ++level)
+    if (delta < (uint64_t(1) << (slotBits * (level + 1))))
+    {
+      pTask->pSlot = &wheel_[level][(tick >> (slotBits * level)) & slotMask];
+      break;
+    }
+  pTask->pSlot->push_back(pTask);
+}
+
+
+void TimerWheel::remove_(Task * pTask)
+{
+  auto & slot = *pTask->pSlot;
+  auto const it = std::find(slot.begin(), slot.end(), pTask);
+  *it = slot.back();
+  slot.pop_back();
+  pTask->pSlot = nullptr;
+}
+
+
+/* Called after current tick is advanced. When tick crosses boundary of level slot, tasks of that slot are
+   reinserted into lower levels. */
+void TimerWheel::cascade_()
+{
+  slot_t tasks;
+  if ((currentTick_ & ((uint64_t(1) << (slotBits * levels)) - 1)) == 0)
+    tasks.swap(overflow_);
+  for (std::size_t level = levels - 1; level > 0; --level)
+    if ((currentTick_ & ((uint64_t(1) << (slotBits * level)) - 1)) == 0)
+    {
+      auto & slot = wheel_[level][(currentTick_ >> (slotBits * level)) & slotMask];
+      tasks.insert(tasks.end(), slot.begin(), slot.end());
+      slot.clear();
+    }
+  for (auto const pTask : tasks)
+    insert_(pTask);
+}
+
+
+TimerWheel::TimerWheel(clock_t::time_point now)
+  : tasks_(), wheel_(), overflow_(), currentTick_(tick_of_(now)), lastId_(0)
+{}
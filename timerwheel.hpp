@@ -0,0 +1,115 @@
+/*
+*  MIT License
+*
+*  Copyright (c) 2025 Alexander Fedorov
+*
+*  Permission is hereby granted, free of charge, to any person obtaining a copy
+*  of this software and associated documentation files (the "Software"), to deal
+*  in the Software without restriction, including without limitation the rights
+*  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*  copies of the Software, and to permit persons to whom the Software is
+*  furnished to do so, subject to the following conditions:
+*
+*  The above copyright notice and this permission notice shall be included in all
+*  copies or substantial portions of the Software.
+*
+*  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*  SOFTWARE.
+*/
+
+#ifndef TIMERWHEEL_HPP_
+#define TIMERWHEEL_HPP_
+
+#include <vector>
+#include <array>
+#include <map>
+#include <memory>
+#include <functional>
+#include <chrono>
+#include <cstdint>
+#include <cstddef>
+
+/* Tasks of worker kept in hierarchical timer wheel: level 0 has 1 ms slots, each next level has slots as long
+   as whole previous level, and tasks are moved down a level when their slot comes up. Each task keeps its exact
+   deadline, so sub-millisecond periods work. Run time of each task is accounted. Not thread safe: worker calls
+   it with its mutex locked, except for run(). */
+class TimerWheel
+{
+public:
+  typedef std::chrono::steady_clock clock_t;
+  /* Called with time at which run was due; returns time of next run, or clock_t::time_point() to finish. */
+  typedef std::function<clock_t::time_point(clock_t::time_point)> task_t;
+  typedef unsigned int task_id_t;
+
+  struct Task;
+  typedef std::vector<Task *> slot_t;
+
+  struct Task
+  {
+    task_id_t id;
+    char const * name;
+    task_t fn;
+    clock_t::time_point due;
+    /* Task that throws is run again after period; zero period (one-shot task) cancels it. */
+    clock_t::duration period;
+    /* Slot task is in; null while task is running. */
+    slot_t * pSlot;
+    bool cancelled;
+    unsigned long runs;
+    clock_t::duration runTime;
+    clock_t::duration maxRunTime;
+  };
+
+  task_id_t add(char const * name, clock_t::time_point first, task_t const & task, clock_t::duration period);
+  /* Marks task cancelled. Waiting task is removed at once and true is returned; running one is removed when
+     it completes. */
+  bool cancel(task_id_t id);
+  /* Moves tasks that are due at now (and cancelled ones) from wheel to due. */
+  void collect_due(clock_t::time_point now, std::vector<Task *> & due);
+  /* Runs collected task and returns time of its next run; called without lock. */
+  static clock_t::time_point run(Task & task);
+  /* Accounts run of collected task, then puts it back due at next, or removes it if next is
+     clock_t::time_point() or task was cancelled. */
+  void complete(Task * pTask, clock_t::time_point next, clock_t::duration runTime);
+  /* Removes collected task without running it. */
+  void erase(Task * pTask);
+  /* Returns clock_t::time_point::max() if there are no tasks. */
+  clock_t::time_point next_deadline() const;
+
+  Task * find(task_id_t id) const;
+  std::size_t size() const { return tasks_.size(); }
+  void for_each(std::function<void(Task &)> const & f);
+
+  explicit TimerWheel(clock_t::time_point now);
+
+private:
+  TimerWheel(TimerWheel const &) =delete;
+  TimerWheel & operator=(TimerWheel const &) =delete;
+
+  /* 64 slots per level; 4 levels cover 2^24 ms (4.6 h), later tasks wait in overflow list. */
+  static unsigned const slotBits = 6;
+  static std::size_t const levels = 4;
+  static uint64_t const slotMask = (1u << slotBits) - 1;
+
+  static uint64_t tick_of_(clock_t::time_point t)
+  {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(t.time_since_epoch()).count();
+  }
+
+  void insert_(Task * pTask);
+  void remove_(Task * pTask);
+  void cascade_();
+
+  std::map<task_id_t, std::unique_ptr<Task> > tasks_;
+  std::array<std::array<slot_t, 1u << slotBits>, levels> wheel_;
+  slot_t overflow_;
+  uint64_t currentTick_;
+  task_id_t lastId_;
+};
+
+#endif
@@ -37,7 +37,7 @@ bool IUser32::has_instance()
 }
 
 
-IUser32 * IUser32::get_instance()
+IUser32 * IUser32::get_instance(bool wait)
 {
   /* Check before acquiring mutex. */
   if (!upInstance_)
@@ -49,12 +49,20 @@ IUser32 * IUser32::get_instance()
     typedef std::unique_lock<mutex_t> lock_t;
 
     static mutex_t mutex;
-    lock_t lock (mutex);
+    lock_t lock (mutex, std::defer_lock);
+    auto const mayFallBack = !wait && getFallback_;
+    if (!mayFallBack)
+      lock.lock();
+    else if (!lock.try_lock())
+      return getFallback_();
 
     /* Check again after acquiring mutex. */
     if (!upInstance_)
     {
-      upInstance_ = instaceFactory_();
+      auto upInstance = instaceFactory_();
+      if (!upInstance && mayFallBack)
+        return getFallback_();
+      upInstance_ = std::move(upInstance);
       assert(upInstance_);
       if (postinitCallback_)
         postinitCallback_();
@@ -71,16 +79,19 @@ void IUser32::set_instance(IUser32::instance_ptr_t && upInstance)
 }
 
 
-void IUser32::set_instance_factory(IUser32::instance_factory_t const & instaceFactory, IUser32::postinit_callback_t const & postinitCallback)
+void IUser32::set_instance_factory(IUser32::instance_factory_t const & instaceFactory, IUser32::postinit_callback_t const & postinitCallback,
+  IUser32::fallback_getter_t const & getFallback)
 {
   instaceFactory_ = instaceFactory;
   postinitCallback_ = postinitCallback;
+  getFallback_ = getFallback;
 }
 
 
 IUser32::instance_ptr_t IUser32::upInstance_;
 IUser32::instance_factory_t IUser32::instaceFactory_;
 IUser32::postinit_callback_t IUser32::postinitCallback_;
+IUser32::fallback_getter_t IUser32::getFallback_;
 
 
 extern "C"
@@ -88,7 +99,7 @@ extern "C"
 
 DLLEXPORT int WINAPIV wsprintfA (LPSTR arg0, LPCSTR arg1, ...)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "wsprintfA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "wsprintfA()"_lit);
   va_list arglist;
   va_start(arglist, arg1);
   auto r = IUser32::get_instance()->wvsprintfA(arg0, arg1, arglist);
@@ -98,7 +109,7 @@ DLLEXPORT int WINAPIV wsprintfA (LPSTR arg0, LPCSTR arg1, ...)
 
 DLLEXPORT int WINAPIV wsprintfW (LPWSTR arg0, LPCWSTR arg1, ...)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "wsprintfW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "wsprintfW()"_lit);
   va_list arglist;
   va_start(arglist, arg1);
   auto r = IUser32::get_instance()->wvsprintfW(arg0, arg1, arglist);
@@ -108,668 +119,668 @@ DLLEXPORT int WINAPIV wsprintfW (LPWSTR arg0, LPCWSTR arg1, ...)
 
 DLLEXPORT int WINAPI wvsprintfA (LPSTR arg0, LPCSTR arg1, va_list arglist)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "wvsprintfA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "wvsprintfA()"_lit);
   return IUser32::get_instance()->wvsprintfA(arg0, arg1, arglist);
 }
 
 DLLEXPORT int WINAPI wvsprintfW (LPWSTR arg0, LPCWSTR arg1, va_list arglist)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "wvsprintfW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "wvsprintfW()"_lit);
   return IUser32::get_instance()->wvsprintfW(arg0, arg1, arglist);
 }
 
 DLLEXPORT HKL WINAPI LoadKeyboardLayoutA (LPCSTR pwszKLID, UINT Flags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "LoadKeyboardLayoutA()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "LoadKeyboardLayoutA()"_lit);
   return IUser32::get_instance()->LoadKeyboardLayoutA(pwszKLID, Flags);
 }
 
 DLLEXPORT HKL WINAPI LoadKeyboardLayoutW (LPCWSTR pwszKLID, UINT Flags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "LoadKeyboardLayoutW()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "LoadKeyboardLayoutW()"_lit);
   return IUser32::get_instance()->LoadKeyboardLayoutW(pwszKLID, Flags);
 }
 
 DLLEXPORT HKL WINAPI ActivateKeyboardLayout (HKL hkl, UINT Flags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ActivateKeyboardLayout()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "ActivateKeyboardLayout()"_lit);
   return IUser32::get_instance()->ActivateKeyboardLayout(hkl, Flags);
 }
 
 DLLEXPORT int WINAPI ToUnicodeEx (UINT wVirtKey, UINT wScanCode, CONST BYTE * lpKeyState, LPWSTR pwszBuff, int cchBuff, UINT wFlags, HKL dwhkl)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ToUnicodeEx()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "ToUnicodeEx()"_lit);
   return IUser32::get_instance()->ToUnicodeEx(wVirtKey, wScanCode, lpKeyState, pwszBuff, cchBuff, wFlags, dwhkl);
 }
 
 DLLEXPORT WINBOOL WINAPI UnloadKeyboardLayout (HKL hkl)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "UnloadKeyboardLayout()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "UnloadKeyboardLayout()"_lit);
   return IUser32::get_instance()->UnloadKeyboardLayout(hkl);
 }
 
 DLLEXPORT WINBOOL WINAPI GetKeyboardLayoutNameA (LPSTR pwszKLID)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetKeyboardLayoutNameA()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "GetKeyboardLayoutNameA()"_lit);
   return IUser32::get_instance()->GetKeyboardLayoutNameA(pwszKLID);
 }
 
 DLLEXPORT WINBOOL WINAPI GetKeyboardLayoutNameW (LPWSTR pwszKLID)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetKeyboardLayoutNameW()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "GetKeyboardLayoutNameW()"_lit);
   return IUser32::get_instance()->GetKeyboardLayoutNameW(pwszKLID);
 }
 
 DLLEXPORT int WINAPI GetKeyboardLayoutList (int nBuff, HKL * lpList)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetKeyboardLayoutList()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "GetKeyboardLayoutList()"_lit);
   return IUser32::get_instance()->GetKeyboardLayoutList(nBuff, lpList);
 }
 
 DLLEXPORT HKL WINAPI GetKeyboardLayout (DWORD idThread)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetKeyboardLayout()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "GetKeyboardLayout()"_lit);
   return IUser32::get_instance()->GetKeyboardLayout(idThread);
 }
 
 DLLEXPORT int WINAPI GetMouseMovePointsEx (UINT cbSize, LPMOUSEMOVEPOINT lppt, LPMOUSEMOVEPOINT lpptBuf, int nBufPoints, DWORD resolution)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetMouseMovePointsEx()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "GetMouseMovePointsEx()"_lit);
   return IUser32::get_instance()->GetMouseMovePointsEx(cbSize, lppt, lpptBuf, nBufPoints, resolution);
 }
 
 DLLEXPORT HDESK WINAPI CreateDesktopA (LPCSTR lpszDesktop, LPCSTR lpszDevice, LPDEVMODEA pDevmode, DWORD dwFlags, ACCESS_MASK dwDesiredAccess, LPSECURITY_ATTRIBUTES lpsa)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CreateDesktopA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "CreateDesktopA()"_lit);
   return IUser32::get_instance()->CreateDesktopA(lpszDesktop, lpszDevice, pDevmode, dwFlags, dwDesiredAccess, lpsa);
 }
 
 DLLEXPORT HDESK WINAPI CreateDesktopW (LPCWSTR lpszDesktop, LPCWSTR lpszDevice, LPDEVMODEW pDevmode, DWORD dwFlags, ACCESS_MASK dwDesiredAccess, LPSECURITY_ATTRIBUTES lpsa)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CreateDesktopW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "CreateDesktopW()"_lit);
   return IUser32::get_instance()->CreateDesktopW(lpszDesktop, lpszDevice, pDevmode, dwFlags, dwDesiredAccess, lpsa);
 }
 
 DLLEXPORT HDESK WINAPI CreateDesktopExA (LPCSTR lpszDesktop, LPCSTR lpszDevice, DEVMODEA * pDevmode, DWORD dwFlags, ACCESS_MASK dwDesiredAccess, LPSECURITY_ATTRIBUTES lpsa, ULONG ulHeapSize, PVOID pvoid)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CreateDesktopExA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "CreateDesktopExA()"_lit);
   return IUser32::get_instance()->CreateDesktopExA(lpszDesktop, lpszDevice, pDevmode, dwFlags, dwDesiredAccess, lpsa, ulHeapSize, pvoid);
 }
 
 DLLEXPORT HDESK WINAPI CreateDesktopExW (LPCWSTR lpszDesktop, LPCWSTR lpszDevice, DEVMODEW * pDevmode, DWORD dwFlags, ACCESS_MASK dwDesiredAccess, LPSECURITY_ATTRIBUTES lpsa, ULONG ulHeapSize, PVOID pvoid)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CreateDesktopExW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "CreateDesktopExW()"_lit);
   return IUser32::get_instance()->CreateDesktopExW(lpszDesktop, lpszDevice, pDevmode, dwFlags, dwDesiredAccess, lpsa, ulHeapSize, pvoid);
 }
 
 DLLEXPORT HDESK WINAPI OpenDesktopA (LPCSTR lpszDesktop, DWORD dwFlags, WINBOOL fInherit, ACCESS_MASK dwDesiredAccess)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "OpenDesktopA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "OpenDesktopA()"_lit);
   return IUser32::get_instance()->OpenDesktopA(lpszDesktop, dwFlags, fInherit, dwDesiredAccess);
 }
 
 DLLEXPORT HDESK WINAPI OpenDesktopW (LPCWSTR lpszDesktop, DWORD dwFlags, WINBOOL fInherit, ACCESS_MASK dwDesiredAccess)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "OpenDesktopW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "OpenDesktopW()"_lit);
   return IUser32::get_instance()->OpenDesktopW(lpszDesktop, dwFlags, fInherit, dwDesiredAccess);
 }
 
 DLLEXPORT HDESK WINAPI OpenInputDesktop (DWORD dwFlags, WINBOOL fInherit, ACCESS_MASK dwDesiredAccess)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "OpenInputDesktop()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "OpenInputDesktop()"_lit);
   return IUser32::get_instance()->OpenInputDesktop(dwFlags, fInherit, dwDesiredAccess);
 }
 
 DLLEXPORT WINBOOL WINAPI EnumDesktopsA (HWINSTA hwinsta, DESKTOPENUMPROCA lpEnumFunc, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "EnumDesktopsA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "EnumDesktopsA()"_lit);
   return IUser32::get_instance()->EnumDesktopsA(hwinsta, lpEnumFunc, lParam);
 }
 
 DLLEXPORT WINBOOL WINAPI EnumDesktopsW (HWINSTA hwinsta, DESKTOPENUMPROCW lpEnumFunc, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "EnumDesktopsW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "EnumDesktopsW()"_lit);
   return IUser32::get_instance()->EnumDesktopsW(hwinsta, lpEnumFunc, lParam);
 }
 
 DLLEXPORT WINBOOL WINAPI EnumDesktopWindows (HDESK hDesktop, WNDENUMPROC lpfn, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "EnumDesktopWindows()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "EnumDesktopWindows()"_lit);
   return IUser32::get_instance()->EnumDesktopWindows(hDesktop, lpfn, lParam);
 }
 
 DLLEXPORT WINBOOL WINAPI SwitchDesktop (HDESK hDesktop)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SwitchDesktop()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "SwitchDesktop()"_lit);
   return IUser32::get_instance()->SwitchDesktop(hDesktop);
 }
 
 DLLEXPORT WINBOOL WINAPI SetThreadDesktop (HDESK hDesktop)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetThreadDesktop()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "SetThreadDesktop()"_lit);
   return IUser32::get_instance()->SetThreadDesktop(hDesktop);
 }
 
 DLLEXPORT WINBOOL WINAPI CloseDesktop (HDESK hDesktop)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CloseDesktop()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "CloseDesktop()"_lit);
   return IUser32::get_instance()->CloseDesktop(hDesktop);
 }
 
 DLLEXPORT HDESK WINAPI GetThreadDesktop (DWORD dwThreadId)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetThreadDesktop()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetThreadDesktop()"_lit);
   return IUser32::get_instance()->GetThreadDesktop(dwThreadId);
 }
 
 DLLEXPORT HWINSTA WINAPI CreateWindowStationA (LPCSTR lpwinsta, DWORD dwFlags, ACCESS_MASK dwDesiredAccess, LPSECURITY_ATTRIBUTES lpsa)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CreateWindowStationA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "CreateWindowStationA()"_lit);
   return IUser32::get_instance()->CreateWindowStationA(lpwinsta, dwFlags, dwDesiredAccess, lpsa);
 }
 
 DLLEXPORT HWINSTA WINAPI CreateWindowStationW (LPCWSTR lpwinsta, DWORD dwFlags, ACCESS_MASK dwDesiredAccess, LPSECURITY_ATTRIBUTES lpsa)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CreateWindowStationW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "CreateWindowStationW()"_lit);
   return IUser32::get_instance()->CreateWindowStationW(lpwinsta, dwFlags, dwDesiredAccess, lpsa);
 }
 
 DLLEXPORT HWINSTA WINAPI OpenWindowStationA (LPCSTR lpszWinSta, WINBOOL fInherit, ACCESS_MASK dwDesiredAccess)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "OpenWindowStationA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "OpenWindowStationA()"_lit);
   return IUser32::get_instance()->OpenWindowStationA(lpszWinSta, fInherit, dwDesiredAccess);
 }
 
 DLLEXPORT HWINSTA WINAPI OpenWindowStationW (LPCWSTR lpszWinSta, WINBOOL fInherit, ACCESS_MASK dwDesiredAccess)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "OpenWindowStationW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "OpenWindowStationW()"_lit);
   return IUser32::get_instance()->OpenWindowStationW(lpszWinSta, fInherit, dwDesiredAccess);
 }
 
 DLLEXPORT WINBOOL WINAPI EnumWindowStationsA (WINSTAENUMPROCA lpEnumFunc, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "EnumWindowStationsA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "EnumWindowStationsA()"_lit);
   return IUser32::get_instance()->EnumWindowStationsA(lpEnumFunc, lParam);
 }
 
 DLLEXPORT WINBOOL WINAPI EnumWindowStationsW (WINSTAENUMPROCW lpEnumFunc, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "EnumWindowStationsW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "EnumWindowStationsW()"_lit);
   return IUser32::get_instance()->EnumWindowStationsW(lpEnumFunc, lParam);
 }
 
 DLLEXPORT WINBOOL WINAPI CloseWindowStation (HWINSTA hWinSta)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CloseWindowStation()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "CloseWindowStation()"_lit);
   return IUser32::get_instance()->CloseWindowStation(hWinSta);
 }
 
 DLLEXPORT WINBOOL WINAPI SetProcessWindowStation (HWINSTA hWinSta)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetProcessWindowStation()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "SetProcessWindowStation()"_lit);
   return IUser32::get_instance()->SetProcessWindowStation(hWinSta);
 }
 
 DLLEXPORT HWINSTA WINAPI GetProcessWindowStation (VOID)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetProcessWindowStation()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetProcessWindowStation()"_lit);
   return IUser32::get_instance()->GetProcessWindowStation();
 }
 
 DLLEXPORT WINBOOL WINAPI SetUserObjectSecurity (HANDLE hObj, PSECURITY_INFORMATION pSIRequested, PSECURITY_DESCRIPTOR pSID)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetUserObjectSecurity()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "SetUserObjectSecurity()"_lit);
   return IUser32::get_instance()->SetUserObjectSecurity(hObj, pSIRequested, pSID);
 }
 
 DLLEXPORT WINBOOL WINAPI GetUserObjectSecurity (HANDLE hObj, PSECURITY_INFORMATION pSIRequested, PSECURITY_DESCRIPTOR pSID, DWORD nLength, LPDWORD lpnLengthNeeded)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetUserObjectSecurity()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetUserObjectSecurity()"_lit);
   return IUser32::get_instance()->GetUserObjectSecurity(hObj, pSIRequested, pSID, nLength, lpnLengthNeeded);
 }
 
 DLLEXPORT WINBOOL WINAPI GetUserObjectInformationA (HANDLE hObj, int nIndex, PVOID pvInfo, DWORD nLength, LPDWORD lpnLengthNeeded)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetUserObjectInformationA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetUserObjectInformationA()"_lit);
   return IUser32::get_instance()->GetUserObjectInformationA(hObj, nIndex, pvInfo, nLength, lpnLengthNeeded);
 }
 
 DLLEXPORT WINBOOL WINAPI GetUserObjectInformationW (HANDLE hObj, int nIndex, PVOID pvInfo, DWORD nLength, LPDWORD lpnLengthNeeded)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetUserObjectInformationW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetUserObjectInformationW()"_lit);
   return IUser32::get_instance()->GetUserObjectInformationW(hObj, nIndex, pvInfo, nLength, lpnLengthNeeded);
 }
 
 DLLEXPORT WINBOOL WINAPI SetUserObjectInformationA (HANDLE hObj, int nIndex, PVOID pvInfo, DWORD nLength)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetUserObjectInformationA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "SetUserObjectInformationA()"_lit);
   return IUser32::get_instance()->SetUserObjectInformationA(hObj, nIndex, pvInfo, nLength);
 }
 
 DLLEXPORT WINBOOL WINAPI SetUserObjectInformationW (HANDLE hObj, int nIndex, PVOID pvInfo, DWORD nLength)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetUserObjectInformationW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "SetUserObjectInformationW()"_lit);
   return IUser32::get_instance()->SetUserObjectInformationW(hObj, nIndex, pvInfo, nLength);
 }
 
 DLLEXPORT WINBOOL WINAPI IsHungAppWindow (HWND hwnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "IsHungAppWindow()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "IsHungAppWindow()"_lit);
   return IUser32::get_instance()->IsHungAppWindow(hwnd);
 }
 
 DLLEXPORT VOID WINAPI DisableProcessWindowsGhosting (VOID)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DisableProcessWindowsGhosting()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "DisableProcessWindowsGhosting()"_lit);
   IUser32::get_instance()->DisableProcessWindowsGhosting();
 }
 
 DLLEXPORT UINT WINAPI RegisterWindowMessageA (LPCSTR lpString)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "RegisterWindowMessageA()");
+  logging::log(logging::LogSource::message_exports, logging::LogLevel::debug, "RegisterWindowMessageA()"_lit);
   return IUser32::get_instance()->RegisterWindowMessageA(lpString);
 }
 
 DLLEXPORT UINT WINAPI RegisterWindowMessageW (LPCWSTR lpString)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "RegisterWindowMessageW()");
+  logging::log(logging::LogSource::message_exports, logging::LogLevel::debug, "RegisterWindowMessageW()"_lit);
   return IUser32::get_instance()->RegisterWindowMessageW(lpString);
 }
 
 DLLEXPORT WINBOOL WINAPI TrackMouseEvent (LPTRACKMOUSEEVENT lpEventTrack)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "TrackMouseEvent()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "TrackMouseEvent()"_lit);
   return IUser32::get_instance()->TrackMouseEvent(lpEventTrack);
 }
 
 DLLEXPORT WINBOOL WINAPI DrawEdge (HDC hdc, LPRECT qrc, UINT edge, UINT grfFlags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DrawEdge()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "DrawEdge()"_lit);
   return IUser32::get_instance()->DrawEdge(hdc, qrc, edge, grfFlags);
 }
 
 DLLEXPORT WINBOOL WINAPI DrawFrameControl (HDC arg0, LPRECT arg1, UINT arg2, UINT arg3)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DrawFrameControl()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "DrawFrameControl()"_lit);
   return IUser32::get_instance()->DrawFrameControl(arg0, arg1, arg2, arg3);
 }
 
 DLLEXPORT WINBOOL WINAPI DrawCaption (HWND hwnd, HDC hdc, CONST RECT * lprect, UINT flags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DrawCaption()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "DrawCaption()"_lit);
   return IUser32::get_instance()->DrawCaption(hwnd, hdc, lprect, flags);
 }
 
 DLLEXPORT WINBOOL WINAPI DrawAnimatedRects (HWND hwnd, int idAni, CONST RECT * lprcFrom, CONST RECT * lprcTo)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DrawAnimatedRects()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "DrawAnimatedRects()"_lit);
   return IUser32::get_instance()->DrawAnimatedRects(hwnd, idAni, lprcFrom, lprcTo);
 }
 
 DLLEXPORT WINBOOL WINAPI GetMessageA (LPMSG lpMsg, HWND hWnd, UINT wMsgFilterMin, UINT wMsgFilterMax)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetMessageA()");
+  logging::log(logging::LogSource::message_exports, logging::LogLevel::debug, "GetMessageA()"_lit);
   return IUser32::get_instance()->GetMessageA(lpMsg, hWnd, wMsgFilterMin, wMsgFilterMax);
 }
 
 DLLEXPORT WINBOOL WINAPI GetMessageW (LPMSG lpMsg, HWND hWnd, UINT wMsgFilterMin, UINT wMsgFilterMax)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetMessageW()");
+  logging::log(logging::LogSource::message_exports, logging::LogLevel::debug, "GetMessageW()"_lit);
   return IUser32::get_instance()->GetMessageW(lpMsg, hWnd, wMsgFilterMin, wMsgFilterMax);
 }
 
 DLLEXPORT WINBOOL WINAPI TranslateMessage (CONST MSG * lpMsg)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "TranslateMessage()");
+  logging::log(logging::LogSource::message_exports, logging::LogLevel::debug, "TranslateMessage()"_lit);
   return IUser32::get_instance()->TranslateMessage(lpMsg);
 }
 
 DLLEXPORT LRESULT WINAPI DispatchMessageA (CONST MSG * lpMsg)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DispatchMessageA()");
+  logging::log(logging::LogSource::message_exports, logging::LogLevel::debug, "DispatchMessageA()"_lit);
   return IUser32::get_instance()->DispatchMessageA(lpMsg);
 }
 
 DLLEXPORT LRESULT WINAPI DispatchMessageW (CONST MSG * lpMsg)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DispatchMessageW()");
+  logging::log(logging::LogSource::message_exports, logging::LogLevel::debug, "DispatchMessageW()"_lit);
   return IUser32::get_instance()->DispatchMessageW(lpMsg);
 }
 
 DLLEXPORT WINBOOL WINAPI SetMessageQueue (int cMessagesMax)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetMessageQueue()");
+  logging::log(logging::LogSource::message_exports, logging::LogLevel::debug, "SetMessageQueue()"_lit);
   return IUser32::get_instance()->SetMessageQueue(cMessagesMax);
 }
 
 DLLEXPORT WINBOOL WINAPI PeekMessageA (LPMSG lpMsg, HWND hWnd, UINT wMsgFilterMin, UINT wMsgFilterMax, UINT wRemoveMsg)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "PeekMessageA()");
+  logging::log(logging::LogSource::message_exports, logging::LogLevel::debug, "PeekMessageA()"_lit);
   return IUser32::get_instance()->PeekMessageA(lpMsg, hWnd, wMsgFilterMin, wMsgFilterMax, wRemoveMsg);
 }
 
 DLLEXPORT WINBOOL WINAPI PeekMessageW (LPMSG lpMsg, HWND hWnd, UINT wMsgFilterMin, UINT wMsgFilterMax, UINT wRemoveMsg)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "PeekMessageW()");
+  logging::log(logging::LogSource::message_exports, logging::LogLevel::debug, "PeekMessageW()"_lit);
   return IUser32::get_instance()->PeekMessageW(lpMsg, hWnd, wMsgFilterMin, wMsgFilterMax, wRemoveMsg);
 }
 
 DLLEXPORT WINBOOL WINAPI RegisterHotKey (HWND hWnd, int id, UINT fsModifiers, UINT vk)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "RegisterHotKey()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "RegisterHotKey()"_lit);
   return IUser32::get_instance()->RegisterHotKey(hWnd, id, fsModifiers, vk);
 }
 
 DLLEXPORT WINBOOL WINAPI UnregisterHotKey (HWND hWnd, int id)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "UnregisterHotKey()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "UnregisterHotKey()"_lit);
   return IUser32::get_instance()->UnregisterHotKey(hWnd, id);
 }
 
 DLLEXPORT WINBOOL WINAPI ExitWindowsEx (UINT uFlags, DWORD dwReason)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ExitWindowsEx()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "ExitWindowsEx()"_lit);
   return IUser32::get_instance()->ExitWindowsEx(uFlags, dwReason);
 }
 
 DLLEXPORT WINBOOL WINAPI SwapMouseButton (WINBOOL fSwap)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SwapMouseButton()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "SwapMouseButton()"_lit);
   return IUser32::get_instance()->SwapMouseButton(fSwap);
 }
 
 DLLEXPORT DWORD WINAPI GetMessagePos (VOID)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetMessagePos()");
+  logging::log(logging::LogSource::message_exports, logging::LogLevel::debug, "GetMessagePos()"_lit);
   return IUser32::get_instance()->GetMessagePos();
 }
 
 DLLEXPORT LONG WINAPI GetMessageTime (VOID)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetMessageTime()");
+  logging::log(logging::LogSource::message_exports, logging::LogLevel::debug, "GetMessageTime()"_lit);
   return IUser32::get_instance()->GetMessageTime();
 }
 
 DLLEXPORT LPARAM WINAPI GetMessageExtraInfo (VOID)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetMessageExtraInfo()");
+  logging::log(logging::LogSource::message_exports, logging::LogLevel::debug, "GetMessageExtraInfo()"_lit);
   return IUser32::get_instance()->GetMessageExtraInfo();
 }
 
 DLLEXPORT DWORD WINAPI GetUnpredictedMessagePos (VOID)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetUnpredictedMessagePos()");
+  logging::log(logging::LogSource::message_exports, logging::LogLevel::debug, "GetUnpredictedMessagePos()"_lit);
   return IUser32::get_instance()->GetUnpredictedMessagePos();
 }
 
 DLLEXPORT WINBOOL WINAPI IsWow64Message (VOID)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "IsWow64Message()");
+  logging::log(logging::LogSource::message_exports, logging::LogLevel::debug, "IsWow64Message()"_lit);
   return IUser32::get_instance()->IsWow64Message();
 }
 
 DLLEXPORT LPARAM WINAPI SetMessageExtraInfo (LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetMessageExtraInfo()");
+  logging::log(logging::LogSource::message_exports, logging::LogLevel::debug, "SetMessageExtraInfo()"_lit);
   return IUser32::get_instance()->SetMessageExtraInfo(lParam);
 }
 
 DLLEXPORT LRESULT WINAPI SendMessageA (HWND hWnd, UINT Msg, WPARAM wParam, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SendMessageA()");
+  logging::log(logging::LogSource::message_exports, logging::LogLevel::debug, "SendMessageA()"_lit);
   return IUser32::get_instance()->SendMessageA(hWnd, Msg, wParam, lParam);
 }
 
 DLLEXPORT LRESULT WINAPI SendMessageW (HWND hWnd, UINT Msg, WPARAM wParam, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SendMessageW()");
+  logging::log(logging::LogSource::message_exports, logging::LogLevel::debug, "SendMessageW()"_lit);
   return IUser32::get_instance()->SendMessageW(hWnd, Msg, wParam, lParam);
 }
 
 DLLEXPORT LRESULT WINAPI SendMessageTimeoutA (HWND hWnd, UINT Msg, WPARAM wParam, LPARAM lParam, UINT fuFlags, UINT uTimeout, PDWORD_PTR lpdwResult)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SendMessageTimeoutA()");
+  logging::log(logging::LogSource::message_exports, logging::LogLevel::debug, "SendMessageTimeoutA()"_lit);
   return IUser32::get_instance()->SendMessageTimeoutA(hWnd, Msg, wParam, lParam, fuFlags, uTimeout, lpdwResult);
 }
 
 DLLEXPORT LRESULT WINAPI SendMessageTimeoutW (HWND hWnd, UINT Msg, WPARAM wParam, LPARAM lParam, UINT fuFlags, UINT uTimeout, PDWORD_PTR lpdwResult)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SendMessageTimeoutW()");
+  logging::log(logging::LogSource::message_exports, logging::LogLevel::debug, "SendMessageTimeoutW()"_lit);
   return IUser32::get_instance()->SendMessageTimeoutW(hWnd, Msg, wParam, lParam, fuFlags, uTimeout, lpdwResult);
 }
 
 DLLEXPORT WINBOOL WINAPI SendNotifyMessageA (HWND hWnd, UINT Msg, WPARAM wParam, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SendNotifyMessageA()");
+  logging::log(logging::LogSource::message_exports, logging::LogLevel::debug, "SendNotifyMessageA()"_lit);
   return IUser32::get_instance()->SendNotifyMessageA(hWnd, Msg, wParam, lParam);
 }
 
 DLLEXPORT WINBOOL WINAPI SendNotifyMessageW (HWND hWnd, UINT Msg, WPARAM wParam, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SendNotifyMessageW()");
+  logging::log(logging::LogSource::message_exports, logging::LogLevel::debug, "SendNotifyMessageW()"_lit);
   return IUser32::get_instance()->SendNotifyMessageW(hWnd, Msg, wParam, lParam);
 }
 
 DLLEXPORT WINBOOL WINAPI SendMessageCallbackA (HWND hWnd, UINT Msg, WPARAM wParam, LPARAM lParam, SENDASYNCPROC lpResultCallBack, ULONG_PTR dwData)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SendMessageCallbackA()");
+  logging::log(logging::LogSource::message_exports, logging::LogLevel::debug, "SendMessageCallbackA()"_lit);
   return IUser32::get_instance()->SendMessageCallbackA(hWnd, Msg, wParam, lParam, lpResultCallBack, dwData);
 }
 
 DLLEXPORT WINBOOL WINAPI SendMessageCallbackW (HWND hWnd, UINT Msg, WPARAM wParam, LPARAM lParam, SENDASYNCPROC lpResultCallBack, ULONG_PTR dwData)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SendMessageCallbackW()");
+  logging::log(logging::LogSource::message_exports, logging::LogLevel::debug, "SendMessageCallbackW()"_lit);
   return IUser32::get_instance()->SendMessageCallbackW(hWnd, Msg, wParam, lParam, lpResultCallBack, dwData);
 }
 
 DLLEXPORT LONG WINAPI BroadcastSystemMessageExA (DWORD flags, LPDWORD lpInfo, UINT Msg, WPARAM wParam, LPARAM lParam, PBSMINFO pbsmInfo)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "BroadcastSystemMessageExA()");
+  logging::log(logging::LogSource::message_exports, logging::LogLevel::debug, "BroadcastSystemMessageExA()"_lit);
   return IUser32::get_instance()->BroadcastSystemMessageExA(flags, lpInfo, Msg, wParam, lParam, pbsmInfo);
 }
 
 DLLEXPORT LONG WINAPI BroadcastSystemMessageExW (DWORD flags, LPDWORD lpInfo, UINT Msg, WPARAM wParam, LPARAM lParam, PBSMINFO pbsmInfo)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "BroadcastSystemMessageExW()");
+  logging::log(logging::LogSource::message_exports, logging::LogLevel::debug, "BroadcastSystemMessageExW()"_lit);
   return IUser32::get_instance()->BroadcastSystemMessageExW(flags, lpInfo, Msg, wParam, lParam, pbsmInfo);
 }
 
 DLLEXPORT LONG WINAPI BroadcastSystemMessageA (DWORD flags, LPDWORD lpInfo, UINT Msg, WPARAM wParam, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "BroadcastSystemMessageA()");
+  logging::log(logging::LogSource::message_exports, logging::LogLevel::debug, "BroadcastSystemMessageA()"_lit);
   return IUser32::get_instance()->BroadcastSystemMessageA(flags, lpInfo, Msg, wParam, lParam);
 }
 
 DLLEXPORT LONG WINAPI BroadcastSystemMessageW (DWORD flags, LPDWORD lpInfo, UINT Msg, WPARAM wParam, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "BroadcastSystemMessageW()");
+  logging::log(logging::LogSource::message_exports, logging::LogLevel::debug, "BroadcastSystemMessageW()"_lit);
   return IUser32::get_instance()->BroadcastSystemMessageW(flags, lpInfo, Msg, wParam, lParam);
 }
 
 DLLEXPORT HPOWERNOTIFY WINAPI RegisterPowerSettingNotification (HANDLE hRecipient, LPCGUID PowerSettingGuid, DWORD Flags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "RegisterPowerSettingNotification()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "RegisterPowerSettingNotification()"_lit);
   return IUser32::get_instance()->RegisterPowerSettingNotification(hRecipient, PowerSettingGuid, Flags);
 }
 
 DLLEXPORT WINBOOL WINAPI UnregisterPowerSettingNotification (HPOWERNOTIFY Handle)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "UnregisterPowerSettingNotification()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "UnregisterPowerSettingNotification()"_lit);
   return IUser32::get_instance()->UnregisterPowerSettingNotification(Handle);
 }
 
 DLLEXPORT HPOWERNOTIFY WINAPI RegisterSuspendResumeNotification (HANDLE hRecipient, DWORD Flags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "RegisterSuspendResumeNotification()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "RegisterSuspendResumeNotification()"_lit);
   return IUser32::get_instance()->RegisterSuspendResumeNotification(hRecipient, Flags);
 }
 
 DLLEXPORT WINBOOL WINAPI UnregisterSuspendResumeNotification (HPOWERNOTIFY Handle)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "UnregisterSuspendResumeNotification()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "UnregisterSuspendResumeNotification()"_lit);
   return IUser32::get_instance()->UnregisterSuspendResumeNotification(Handle);
 }
 
 DLLEXPORT WINBOOL WINAPI PostMessageA (HWND hWnd, UINT Msg, WPARAM wParam, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "PostMessageA()");
+  logging::log(logging::LogSource::message_exports, logging::LogLevel::debug, "PostMessageA()"_lit);
   return IUser32::get_instance()->PostMessageA(hWnd, Msg, wParam, lParam);
 }
 
 DLLEXPORT WINBOOL WINAPI PostMessageW (HWND hWnd, UINT Msg, WPARAM wParam, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "PostMessageW()");
+  logging::log(logging::LogSource::message_exports, logging::LogLevel::debug, "PostMessageW()"_lit);
   return IUser32::get_instance()->PostMessageW(hWnd, Msg, wParam, lParam);
 }
 
 DLLEXPORT WINBOOL WINAPI PostThreadMessageA (DWORD idThread, UINT Msg, WPARAM wParam, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "PostThreadMessageA()");
+  logging::log(logging::LogSource::message_exports, logging::LogLevel::debug, "PostThreadMessageA()"_lit);
   return IUser32::get_instance()->PostThreadMessageA(idThread, Msg, wParam, lParam);
 }
 
 DLLEXPORT WINBOOL WINAPI PostThreadMessageW (DWORD idThread, UINT Msg, WPARAM wParam, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "PostThreadMessageW()");
+  logging::log(logging::LogSource::message_exports, logging::LogLevel::debug, "PostThreadMessageW()"_lit);
   return IUser32::get_instance()->PostThreadMessageW(idThread, Msg, wParam, lParam);
 }
 
 DLLEXPORT WINBOOL WINAPI AttachThreadInput (DWORD idAttach, DWORD idAttachTo, WINBOOL fAttach)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "AttachThreadInput()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "AttachThreadInput()"_lit);
   return IUser32::get_instance()->AttachThreadInput(idAttach, idAttachTo, fAttach);
 }
 
 DLLEXPORT WINBOOL WINAPI ReplyMessage (LRESULT lResult)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ReplyMessage()");
+  logging::log(logging::LogSource::message_exports, logging::LogLevel::debug, "ReplyMessage()"_lit);
   return IUser32::get_instance()->ReplyMessage(lResult);
 }
 
 DLLEXPORT WINBOOL WINAPI WaitMessage (VOID)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "WaitMessage()");
+  logging::log(logging::LogSource::message_exports, logging::LogLevel::debug, "WaitMessage()"_lit);
   return IUser32::get_instance()->WaitMessage();
 }
 
 DLLEXPORT DWORD WINAPI WaitForInputIdle (HANDLE hProcess, DWORD dwMilliseconds)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "WaitForInputIdle()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "WaitForInputIdle()"_lit);
   return IUser32::get_instance()->WaitForInputIdle(hProcess, dwMilliseconds);
 }
 
 DLLEXPORT LRESULT WINAPI DefWindowProcA (HWND hWnd, UINT Msg, WPARAM wParam, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DefWindowProcA()");
+  logging::log(logging::LogSource::message_exports, logging::LogLevel::debug, "DefWindowProcA()"_lit);
   return IUser32::get_instance()->DefWindowProcA(hWnd, Msg, wParam, lParam);
 }
 
 DLLEXPORT LRESULT WINAPI DefWindowProcW (HWND hWnd, UINT Msg, WPARAM wParam, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DefWindowProcW()");
+  logging::log(logging::LogSource::message_exports, logging::LogLevel::debug, "DefWindowProcW()"_lit);
   return IUser32::get_instance()->DefWindowProcW(hWnd, Msg, wParam, lParam);
 }
 
 DLLEXPORT VOID WINAPI PostQuitMessage (int nExitCode)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "PostQuitMessage()");
+  logging::log(logging::LogSource::message_exports, logging::LogLevel::debug, "PostQuitMessage()"_lit);
   IUser32::get_instance()->PostQuitMessage(nExitCode);
 }
 
 DLLEXPORT WINBOOL WINAPI InSendMessage (VOID)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "InSendMessage()");
+  logging::log(logging::LogSource::message_exports, logging::LogLevel::debug, "InSendMessage()"_lit);
   return IUser32::get_instance()->InSendMessage();
 }
 
 DLLEXPORT DWORD WINAPI InSendMessageEx (LPVOID lpReserved)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "InSendMessageEx()");
+  logging::log(logging::LogSource::message_exports, logging::LogLevel::debug, "InSendMessageEx()"_lit);
   return IUser32::get_instance()->InSendMessageEx(lpReserved);
 }
 
 DLLEXPORT UINT WINAPI GetDoubleClickTime (VOID)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetDoubleClickTime()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetDoubleClickTime()"_lit);
   return IUser32::get_instance()->GetDoubleClickTime();
 }
 
 DLLEXPORT WINBOOL WINAPI SetDoubleClickTime (UINT arg0)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetDoubleClickTime()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "SetDoubleClickTime()"_lit);
   return IUser32::get_instance()->SetDoubleClickTime(arg0);
 }
 
 DLLEXPORT ATOM WINAPI RegisterClassA (CONST WNDCLASSA * lpWndClass)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "RegisterClassA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "RegisterClassA()"_lit);
   return IUser32::get_instance()->RegisterClassA(lpWndClass);
 }
 
 DLLEXPORT ATOM WINAPI RegisterClassW (CONST WNDCLASSW * lpWndClass)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "RegisterClassW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "RegisterClassW()"_lit);
   return IUser32::get_instance()->RegisterClassW(lpWndClass);
 }
 
 DLLEXPORT WINBOOL WINAPI UnregisterClassA (LPCSTR lpClassName, HINSTANCE hInstance)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "UnregisterClassA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "UnregisterClassA()"_lit);
   return IUser32::get_instance()->UnregisterClassA(lpClassName, hInstance);
 }
 
 DLLEXPORT WINBOOL WINAPI UnregisterClassW (LPCWSTR lpClassName, HINSTANCE hInstance)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "UnregisterClassW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "UnregisterClassW()"_lit);
   return IUser32::get_instance()->UnregisterClassW(lpClassName, hInstance);
 }
 
 DLLEXPORT WINBOOL WINAPI GetClassInfoA (HINSTANCE hInstance, LPCSTR lpClassName, LPWNDCLASSA lpWndClass)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetClassInfoA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetClassInfoA()"_lit);
   return IUser32::get_instance()->GetClassInfoA(hInstance, lpClassName, lpWndClass);
 }
 
 DLLEXPORT WINBOOL WINAPI GetClassInfoW (HINSTANCE hInstance, LPCWSTR lpClassName, LPWNDCLASSW lpWndClass)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetClassInfoW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetClassInfoW()"_lit);
   return IUser32::get_instance()->GetClassInfoW(hInstance, lpClassName, lpWndClass);
 }
 
 DLLEXPORT ATOM WINAPI RegisterClassExA (CONST WNDCLASSEXA * lpWndClass)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "RegisterClassExA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "RegisterClassExA()"_lit);
   return IUser32::get_instance()->RegisterClassExA(lpWndClass);
 }
 
 DLLEXPORT ATOM WINAPI RegisterClassExW (CONST WNDCLASSEXW * lpWndClass)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "RegisterClassExW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "RegisterClassExW()"_lit);
   return IUser32::get_instance()->RegisterClassExW(lpWndClass);
 }
 
 DLLEXPORT WINBOOL WINAPI GetClassInfoExA (HINSTANCE hInstance, LPCSTR lpszClass, LPWNDCLASSEXA lpwcx)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetClassInfoExA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetClassInfoExA()"_lit);
   return IUser32::get_instance()->GetClassInfoExA(hInstance, lpszClass, lpwcx);
 }
 
 DLLEXPORT WINBOOL WINAPI GetClassInfoExW (HINSTANCE hInstance, LPCWSTR lpszClass, LPWNDCLASSEXW lpwcx)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetClassInfoExW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetClassInfoExW()"_lit);
   return IUser32::get_instance()->GetClassInfoExW(hInstance, lpszClass, lpwcx);
 }
 
 #ifdef STRICT
 DLLEXPORT LRESULT WINAPI CallWindowProcA (WNDPROC lpPrevWndFunc, HWND hWnd, UINT Msg, WPARAM wParam, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CallWindowProcA()");
+  logging::log(logging::LogSource::message_exports, logging::LogLevel::debug, "CallWindowProcA()"_lit);
   return IUser32::get_instance()->CallWindowProcA(lpPrevWndFunc, hWnd, Msg, wParam, lParam);
 }
 
 DLLEXPORT LRESULT WINAPI CallWindowProcW (WNDPROC lpPrevWndFunc, HWND hWnd, UINT Msg, WPARAM wParam, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CallWindowProcW()");
+  logging::log(logging::LogSource::message_exports, logging::LogLevel::debug, "CallWindowProcW()"_lit);
   return IUser32::get_instance()->CallWindowProcW(lpPrevWndFunc, hWnd, Msg, wParam, lParam);
 }
 
@@ -777,13 +788,13 @@ DLLEXPORT LRESULT WINAPI CallWindowProcW (WNDPROC lpPrevWndFunc, HWND hWnd, UINT
 
 DLLEXPORT LRESULT WINAPI CallWindowProcA (FARPROC lpPrevWndFunc, HWND hWnd, UINT Msg, WPARAM wParam, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CallWindowProcA()");
+  logging::log(logging::LogSource::message_exports, logging::LogLevel::debug, "CallWindowProcA()"_lit);
   return IUser32::get_instance()->CallWindowProcA(lpPrevWndFunc, hWnd, Msg, wParam, lParam);
 }
 
 DLLEXPORT LRESULT WINAPI CallWindowProcW (FARPROC lpPrevWndFunc, HWND hWnd, UINT Msg, WPARAM wParam, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CallWindowProcW()");
+  logging::log(logging::LogSource::message_exports, logging::LogLevel::debug, "CallWindowProcW()"_lit);
   return IUser32::get_instance()->CallWindowProcW(lpPrevWndFunc, hWnd, Msg, wParam, lParam);
 }
 
@@ -791,2491 +802,2491 @@ DLLEXPORT LRESULT WINAPI CallWindowProcW (FARPROC lpPrevWndFunc, HWND hWnd, UINT
 
 DLLEXPORT HDEVNOTIFY WINAPI RegisterDeviceNotificationA (HANDLE hRecipient, LPVOID NotificationFilter, DWORD Flags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "RegisterDeviceNotificationA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "RegisterDeviceNotificationA()"_lit);
   return IUser32::get_instance()->RegisterDeviceNotificationA(hRecipient, NotificationFilter, Flags);
 }
 
 DLLEXPORT HDEVNOTIFY WINAPI RegisterDeviceNotificationW (HANDLE hRecipient, LPVOID NotificationFilter, DWORD Flags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "RegisterDeviceNotificationW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "RegisterDeviceNotificationW()"_lit);
   return IUser32::get_instance()->RegisterDeviceNotificationW(hRecipient, NotificationFilter, Flags);
 }
 
 DLLEXPORT WINBOOL WINAPI UnregisterDeviceNotification (HDEVNOTIFY Handle)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "UnregisterDeviceNotification()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "UnregisterDeviceNotification()"_lit);
   return IUser32::get_instance()->UnregisterDeviceNotification(Handle);
 }
 
 DLLEXPORT HWND WINAPI CreateWindowExA (DWORD dwExStyle, LPCSTR lpClassName, LPCSTR lpWindowName, DWORD dwStyle, int X, int Y, int nWidth, int nHeight, HWND hWndParent, HMENU hMenu, HINSTANCE hInstance, LPVOID lpParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CreateWindowExA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "CreateWindowExA()"_lit);
   return IUser32::get_instance()->CreateWindowExA(dwExStyle, lpClassName, lpWindowName, dwStyle, X, Y, nWidth, nHeight, hWndParent, hMenu, hInstance, lpParam);
 }
 
 DLLEXPORT HWND WINAPI CreateWindowExW (DWORD dwExStyle, LPCWSTR lpClassName, LPCWSTR lpWindowName, DWORD dwStyle, int X, int Y, int nWidth, int nHeight, HWND hWndParent, HMENU hMenu, HINSTANCE hInstance, LPVOID lpParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CreateWindowExW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "CreateWindowExW()"_lit);
   return IUser32::get_instance()->CreateWindowExW(dwExStyle, lpClassName, lpWindowName, dwStyle, X, Y, nWidth, nHeight, hWndParent, hMenu, hInstance, lpParam);
 }
 
 DLLEXPORT WINBOOL WINAPI IsWindow (HWND hWnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "IsWindow()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "IsWindow()"_lit);
   return IUser32::get_instance()->IsWindow(hWnd);
 }
 
 DLLEXPORT WINBOOL WINAPI IsMenu (HMENU hMenu)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "IsMenu()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "IsMenu()"_lit);
   return IUser32::get_instance()->IsMenu(hMenu);
 }
 
 DLLEXPORT WINBOOL WINAPI IsChild (HWND hWndParent, HWND hWnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "IsChild()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "IsChild()"_lit);
   return IUser32::get_instance()->IsChild(hWndParent, hWnd);
 }
 
 DLLEXPORT WINBOOL WINAPI DestroyWindow (HWND hWnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DestroyWindow()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "DestroyWindow()"_lit);
   return IUser32::get_instance()->DestroyWindow(hWnd);
 }
 
 DLLEXPORT WINBOOL WINAPI ShowWindow (HWND hWnd, int nCmdShow)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ShowWindow()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "ShowWindow()"_lit);
   return IUser32::get_instance()->ShowWindow(hWnd, nCmdShow);
 }
 
 DLLEXPORT WINBOOL WINAPI AnimateWindow (HWND hWnd, DWORD dwTime, DWORD dwFlags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "AnimateWindow()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "AnimateWindow()"_lit);
   return IUser32::get_instance()->AnimateWindow(hWnd, dwTime, dwFlags);
 }
 
 DLLEXPORT WINBOOL WINAPI UpdateLayeredWindow (HWND hWnd, HDC hdcDst, POINT * pptDst, SIZE * psize, HDC hdcSrc, POINT * pptSrc, COLORREF crKey, BLENDFUNCTION * pblend, DWORD dwFlags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "UpdateLayeredWindow()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "UpdateLayeredWindow()"_lit);
   return IUser32::get_instance()->UpdateLayeredWindow(hWnd, hdcDst, pptDst, psize, hdcSrc, pptSrc, crKey, pblend, dwFlags);
 }
 
 DLLEXPORT WINBOOL WINAPI UpdateLayeredWindowIndirect (HWND hWnd, const UPDATELAYEREDWINDOWINFO * pULWInfo)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "UpdateLayeredWindowIndirect()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "UpdateLayeredWindowIndirect()"_lit);
   return IUser32::get_instance()->UpdateLayeredWindowIndirect(hWnd, pULWInfo);
 }
 
 DLLEXPORT WINBOOL WINAPI GetLayeredWindowAttributes (HWND hwnd, COLORREF * pcrKey, BYTE * pbAlpha, DWORD * pdwFlags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetLayeredWindowAttributes()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetLayeredWindowAttributes()"_lit);
   return IUser32::get_instance()->GetLayeredWindowAttributes(hwnd, pcrKey, pbAlpha, pdwFlags);
 }
 
 DLLEXPORT WINBOOL WINAPI PrintWindow (HWND hwnd, HDC hdcBlt, UINT nFlags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "PrintWindow()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "PrintWindow()"_lit);
   return IUser32::get_instance()->PrintWindow(hwnd, hdcBlt, nFlags);
 }
 
 DLLEXPORT WINBOOL WINAPI SetLayeredWindowAttributes (HWND hwnd, COLORREF crKey, BYTE bAlpha, DWORD dwFlags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetLayeredWindowAttributes()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "SetLayeredWindowAttributes()"_lit);
   return IUser32::get_instance()->SetLayeredWindowAttributes(hwnd, crKey, bAlpha, dwFlags);
 }
 
 DLLEXPORT WINBOOL WINAPI ShowWindowAsync (HWND hWnd, int nCmdShow)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ShowWindowAsync()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "ShowWindowAsync()"_lit);
   return IUser32::get_instance()->ShowWindowAsync(hWnd, nCmdShow);
 }
 
 DLLEXPORT WINBOOL WINAPI FlashWindow (HWND hWnd, WINBOOL bInvert)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "FlashWindow()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "FlashWindow()"_lit);
   return IUser32::get_instance()->FlashWindow(hWnd, bInvert);
 }
 
 DLLEXPORT WINBOOL WINAPI FlashWindowEx (PFLASHWINFO pfwi)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "FlashWindowEx()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "FlashWindowEx()"_lit);
   return IUser32::get_instance()->FlashWindowEx(pfwi);
 }
 
 DLLEXPORT WINBOOL WINAPI ShowOwnedPopups (HWND hWnd, WINBOOL fShow)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ShowOwnedPopups()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "ShowOwnedPopups()"_lit);
   return IUser32::get_instance()->ShowOwnedPopups(hWnd, fShow);
 }
 
 DLLEXPORT WINBOOL WINAPI OpenIcon (HWND hWnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "OpenIcon()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "OpenIcon()"_lit);
   return IUser32::get_instance()->OpenIcon(hWnd);
 }
 
 DLLEXPORT WINBOOL WINAPI CloseWindow (HWND hWnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CloseWindow()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "CloseWindow()"_lit);
   return IUser32::get_instance()->CloseWindow(hWnd);
 }
 
 DLLEXPORT WINBOOL WINAPI MoveWindow (HWND hWnd, int X, int Y, int nWidth, int nHeight, WINBOOL bRepaint)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "MoveWindow()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "MoveWindow()"_lit);
   return IUser32::get_instance()->MoveWindow(hWnd, X, Y, nWidth, nHeight, bRepaint);
 }
 
 DLLEXPORT WINBOOL WINAPI SetWindowPos (HWND hWnd, HWND hWndInsertAfter, int X, int Y, int cx, int cy, UINT uFlags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetWindowPos()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "SetWindowPos()"_lit);
   return IUser32::get_instance()->SetWindowPos(hWnd, hWndInsertAfter, X, Y, cx, cy, uFlags);
 }
 
 DLLEXPORT WINBOOL WINAPI GetWindowPlacement (HWND hWnd, WINDOWPLACEMENT * lpwndpl)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetWindowPlacement()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetWindowPlacement()"_lit);
   return IUser32::get_instance()->GetWindowPlacement(hWnd, lpwndpl);
 }
 
 DLLEXPORT WINBOOL WINAPI SetWindowPlacement (HWND hWnd, CONST WINDOWPLACEMENT * lpwndpl)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetWindowPlacement()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "SetWindowPlacement()"_lit);
   return IUser32::get_instance()->SetWindowPlacement(hWnd, lpwndpl);
 }
 
 DLLEXPORT WINBOOL WINAPI GetWindowDisplayAffinity (HWND hWnd, DWORD * pdwAffinity)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetWindowDisplayAffinity()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetWindowDisplayAffinity()"_lit);
   return IUser32::get_instance()->GetWindowDisplayAffinity(hWnd, pdwAffinity);
 }
 
 DLLEXPORT WINBOOL WINAPI SetWindowDisplayAffinity (HWND hWnd, DWORD dwAffinity)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetWindowDisplayAffinity()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "SetWindowDisplayAffinity()"_lit);
   return IUser32::get_instance()->SetWindowDisplayAffinity(hWnd, dwAffinity);
 }
 
 DLLEXPORT HDWP WINAPI BeginDeferWindowPos (int nNumWindows)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "BeginDeferWindowPos()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "BeginDeferWindowPos()"_lit);
   return IUser32::get_instance()->BeginDeferWindowPos(nNumWindows);
 }
 
 DLLEXPORT HDWP WINAPI DeferWindowPos (HDWP hWinPosInfo, HWND hWnd, HWND hWndInsertAfter, int x, int y, int cx, int cy, UINT uFlags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DeferWindowPos()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "DeferWindowPos()"_lit);
   return IUser32::get_instance()->DeferWindowPos(hWinPosInfo, hWnd, hWndInsertAfter, x, y, cx, cy, uFlags);
 }
 
 DLLEXPORT WINBOOL WINAPI EndDeferWindowPos (HDWP hWinPosInfo)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "EndDeferWindowPos()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "EndDeferWindowPos()"_lit);
   return IUser32::get_instance()->EndDeferWindowPos(hWinPosInfo);
 }
 
 DLLEXPORT WINBOOL WINAPI IsWindowVisible (HWND hWnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "IsWindowVisible()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "IsWindowVisible()"_lit);
   return IUser32::get_instance()->IsWindowVisible(hWnd);
 }
 
 DLLEXPORT WINBOOL WINAPI IsIconic (HWND hWnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "IsIconic()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "IsIconic()"_lit);
   return IUser32::get_instance()->IsIconic(hWnd);
 }
 
 DLLEXPORT WINBOOL WINAPI AnyPopup (VOID)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "AnyPopup()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "AnyPopup()"_lit);
   return IUser32::get_instance()->AnyPopup();
 }
 
 DLLEXPORT WINBOOL WINAPI BringWindowToTop (HWND hWnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "BringWindowToTop()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "BringWindowToTop()"_lit);
   return IUser32::get_instance()->BringWindowToTop(hWnd);
 }
 
 DLLEXPORT WINBOOL WINAPI IsZoomed (HWND hWnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "IsZoomed()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "IsZoomed()"_lit);
   return IUser32::get_instance()->IsZoomed(hWnd);
 }
 
 DLLEXPORT HWND WINAPI CreateDialogParamA (HINSTANCE hInstance, LPCSTR lpTemplateName, HWND hWndParent, DLGPROC lpDialogFunc, LPARAM dwInitParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CreateDialogParamA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "CreateDialogParamA()"_lit);
   return IUser32::get_instance()->CreateDialogParamA(hInstance, lpTemplateName, hWndParent, lpDialogFunc, dwInitParam);
 }
 
 DLLEXPORT HWND WINAPI CreateDialogParamW (HINSTANCE hInstance, LPCWSTR lpTemplateName, HWND hWndParent, DLGPROC lpDialogFunc, LPARAM dwInitParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CreateDialogParamW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "CreateDialogParamW()"_lit);
   return IUser32::get_instance()->CreateDialogParamW(hInstance, lpTemplateName, hWndParent, lpDialogFunc, dwInitParam);
 }
 
 DLLEXPORT HWND WINAPI CreateDialogIndirectParamA (HINSTANCE hInstance, LPCDLGTEMPLATEA lpTemplate, HWND hWndParent, DLGPROC lpDialogFunc, LPARAM dwInitParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CreateDialogIndirectParamA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "CreateDialogIndirectParamA()"_lit);
   return IUser32::get_instance()->CreateDialogIndirectParamA(hInstance, lpTemplate, hWndParent, lpDialogFunc, dwInitParam);
 }
 
 DLLEXPORT HWND WINAPI CreateDialogIndirectParamW (HINSTANCE hInstance, LPCDLGTEMPLATEW lpTemplate, HWND hWndParent, DLGPROC lpDialogFunc, LPARAM dwInitParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CreateDialogIndirectParamW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "CreateDialogIndirectParamW()"_lit);
   return IUser32::get_instance()->CreateDialogIndirectParamW(hInstance, lpTemplate, hWndParent, lpDialogFunc, dwInitParam);
 }
 
 DLLEXPORT INT_PTR WINAPI DialogBoxParamA (HINSTANCE hInstance, LPCSTR lpTemplateName, HWND hWndParent, DLGPROC lpDialogFunc, LPARAM dwInitParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DialogBoxParamA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "DialogBoxParamA()"_lit);
   return IUser32::get_instance()->DialogBoxParamA(hInstance, lpTemplateName, hWndParent, lpDialogFunc, dwInitParam);
 }
 
 DLLEXPORT INT_PTR WINAPI DialogBoxParamW (HINSTANCE hInstance, LPCWSTR lpTemplateName, HWND hWndParent, DLGPROC lpDialogFunc, LPARAM dwInitParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DialogBoxParamW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "DialogBoxParamW()"_lit);
   return IUser32::get_instance()->DialogBoxParamW(hInstance, lpTemplateName, hWndParent, lpDialogFunc, dwInitParam);
 }
 
 DLLEXPORT INT_PTR WINAPI DialogBoxIndirectParamA (HINSTANCE hInstance, LPCDLGTEMPLATEA hDialogTemplate, HWND hWndParent, DLGPROC lpDialogFunc, LPARAM dwInitParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DialogBoxIndirectParamA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "DialogBoxIndirectParamA()"_lit);
   return IUser32::get_instance()->DialogBoxIndirectParamA(hInstance, hDialogTemplate, hWndParent, lpDialogFunc, dwInitParam);
 }
 
 DLLEXPORT INT_PTR WINAPI DialogBoxIndirectParamW (HINSTANCE hInstance, LPCDLGTEMPLATEW hDialogTemplate, HWND hWndParent, DLGPROC lpDialogFunc, LPARAM dwInitParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DialogBoxIndirectParamW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "DialogBoxIndirectParamW()"_lit);
   return IUser32::get_instance()->DialogBoxIndirectParamW(hInstance, hDialogTemplate, hWndParent, lpDialogFunc, dwInitParam);
 }
 
 DLLEXPORT WINBOOL WINAPI EndDialog (HWND hDlg, INT_PTR nResult)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "EndDialog()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "EndDialog()"_lit);
   return IUser32::get_instance()->EndDialog(hDlg, nResult);
 }
 
 DLLEXPORT HWND WINAPI GetDlgItem (HWND hDlg, int nIDDlgItem)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetDlgItem()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetDlgItem()"_lit);
   return IUser32::get_instance()->GetDlgItem(hDlg, nIDDlgItem);
 }
 
 DLLEXPORT WINBOOL WINAPI SetDlgItemInt (HWND hDlg, int nIDDlgItem, UINT uValue, WINBOOL bSigned)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetDlgItemInt()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "SetDlgItemInt()"_lit);
   return IUser32::get_instance()->SetDlgItemInt(hDlg, nIDDlgItem, uValue, bSigned);
 }
 
 DLLEXPORT UINT WINAPI GetDlgItemInt (HWND hDlg, int nIDDlgItem, WINBOOL * lpTranslated, WINBOOL bSigned)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetDlgItemInt()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetDlgItemInt()"_lit);
   return IUser32::get_instance()->GetDlgItemInt(hDlg, nIDDlgItem, lpTranslated, bSigned);
 }
 
 DLLEXPORT WINBOOL WINAPI SetDlgItemTextA (HWND hDlg, int nIDDlgItem, LPCSTR lpString)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetDlgItemTextA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "SetDlgItemTextA()"_lit);
   return IUser32::get_instance()->SetDlgItemTextA(hDlg, nIDDlgItem, lpString);
 }
 
 DLLEXPORT WINBOOL WINAPI SetDlgItemTextW (HWND hDlg, int nIDDlgItem, LPCWSTR lpString)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetDlgItemTextW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "SetDlgItemTextW()"_lit);
   return IUser32::get_instance()->SetDlgItemTextW(hDlg, nIDDlgItem, lpString);
 }
 
 DLLEXPORT UINT WINAPI GetDlgItemTextA (HWND hDlg, int nIDDlgItem, LPSTR lpString, int cchMax)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetDlgItemTextA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetDlgItemTextA()"_lit);
   return IUser32::get_instance()->GetDlgItemTextA(hDlg, nIDDlgItem, lpString, cchMax);
 }
 
 DLLEXPORT UINT WINAPI GetDlgItemTextW (HWND hDlg, int nIDDlgItem, LPWSTR lpString, int cchMax)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetDlgItemTextW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetDlgItemTextW()"_lit);
   return IUser32::get_instance()->GetDlgItemTextW(hDlg, nIDDlgItem, lpString, cchMax);
 }
 
 DLLEXPORT WINBOOL WINAPI CheckDlgButton (HWND hDlg, int nIDButton, UINT uCheck)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CheckDlgButton()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "CheckDlgButton()"_lit);
   return IUser32::get_instance()->CheckDlgButton(hDlg, nIDButton, uCheck);
 }
 
 DLLEXPORT WINBOOL WINAPI CheckRadioButton (HWND hDlg, int nIDFirstButton, int nIDLastButton, int nIDCheckButton)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CheckRadioButton()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "CheckRadioButton()"_lit);
   return IUser32::get_instance()->CheckRadioButton(hDlg, nIDFirstButton, nIDLastButton, nIDCheckButton);
 }
 
 DLLEXPORT UINT WINAPI IsDlgButtonChecked (HWND hDlg, int nIDButton)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "IsDlgButtonChecked()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "IsDlgButtonChecked()"_lit);
   return IUser32::get_instance()->IsDlgButtonChecked(hDlg, nIDButton);
 }
 
 DLLEXPORT LRESULT WINAPI SendDlgItemMessageA (HWND hDlg, int nIDDlgItem, UINT Msg, WPARAM wParam, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SendDlgItemMessageA()");
+  logging::log(logging::LogSource::message_exports, logging::LogLevel::debug, "SendDlgItemMessageA()"_lit);
   return IUser32::get_instance()->SendDlgItemMessageA(hDlg, nIDDlgItem, Msg, wParam, lParam);
 }
 
 DLLEXPORT LRESULT WINAPI SendDlgItemMessageW (HWND hDlg, int nIDDlgItem, UINT Msg, WPARAM wParam, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SendDlgItemMessageW()");
+  logging::log(logging::LogSource::message_exports, logging::LogLevel::debug, "SendDlgItemMessageW()"_lit);
   return IUser32::get_instance()->SendDlgItemMessageW(hDlg, nIDDlgItem, Msg, wParam, lParam);
 }
 
 DLLEXPORT HWND WINAPI GetNextDlgGroupItem (HWND hDlg, HWND hCtl, WINBOOL bPrevious)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetNextDlgGroupItem()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetNextDlgGroupItem()"_lit);
   return IUser32::get_instance()->GetNextDlgGroupItem(hDlg, hCtl, bPrevious);
 }
 
 DLLEXPORT HWND WINAPI GetNextDlgTabItem (HWND hDlg, HWND hCtl, WINBOOL bPrevious)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetNextDlgTabItem()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetNextDlgTabItem()"_lit);
   return IUser32::get_instance()->GetNextDlgTabItem(hDlg, hCtl, bPrevious);
 }
 
 DLLEXPORT int WINAPI GetDlgCtrlID (HWND hWnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetDlgCtrlID()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetDlgCtrlID()"_lit);
   return IUser32::get_instance()->GetDlgCtrlID(hWnd);
 }
 
 DLLEXPORT LONG WINAPI GetDialogBaseUnits (VOID)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetDialogBaseUnits()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetDialogBaseUnits()"_lit);
   return IUser32::get_instance()->GetDialogBaseUnits();
 }
 
 DLLEXPORT LRESULT WINAPI DefDlgProcA (HWND hDlg, UINT Msg, WPARAM wParam, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DefDlgProcA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "DefDlgProcA()"_lit);
   return IUser32::get_instance()->DefDlgProcA(hDlg, Msg, wParam, lParam);
 }
 
 DLLEXPORT LRESULT WINAPI DefDlgProcW (HWND hDlg, UINT Msg, WPARAM wParam, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DefDlgProcW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "DefDlgProcW()"_lit);
   return IUser32::get_instance()->DefDlgProcW(hDlg, Msg, wParam, lParam);
 }
 
 DLLEXPORT WINBOOL WINAPI CallMsgFilterA (LPMSG lpMsg, int nCode)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CallMsgFilterA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "CallMsgFilterA()"_lit);
   return IUser32::get_instance()->CallMsgFilterA(lpMsg, nCode);
 }
 
 DLLEXPORT WINBOOL WINAPI CallMsgFilterW (LPMSG lpMsg, int nCode)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CallMsgFilterW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "CallMsgFilterW()"_lit);
   return IUser32::get_instance()->CallMsgFilterW(lpMsg, nCode);
 }
 
 DLLEXPORT WINBOOL WINAPI OpenClipboard (HWND hWndNewOwner)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "OpenClipboard()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "OpenClipboard()"_lit);
   return IUser32::get_instance()->OpenClipboard(hWndNewOwner);
 }
 
 DLLEXPORT WINBOOL WINAPI CloseClipboard (VOID)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CloseClipboard()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "CloseClipboard()"_lit);
   return IUser32::get_instance()->CloseClipboard();
 }
 
 DLLEXPORT DWORD WINAPI GetClipboardSequenceNumber (VOID)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetClipboardSequenceNumber()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetClipboardSequenceNumber()"_lit);
   return IUser32::get_instance()->GetClipboardSequenceNumber();
 }
 
 DLLEXPORT HWND WINAPI GetClipboardOwner (VOID)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetClipboardOwner()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetClipboardOwner()"_lit);
   return IUser32::get_instance()->GetClipboardOwner();
 }
 
 DLLEXPORT HWND WINAPI SetClipboardViewer (HWND hWndNewViewer)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetClipboardViewer()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "SetClipboardViewer()"_lit);
   return IUser32::get_instance()->SetClipboardViewer(hWndNewViewer);
 }
 
 DLLEXPORT HWND WINAPI GetClipboardViewer (VOID)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetClipboardViewer()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetClipboardViewer()"_lit);
   return IUser32::get_instance()->GetClipboardViewer();
 }
 
 DLLEXPORT WINBOOL WINAPI ChangeClipboardChain (HWND hWndRemove, HWND hWndNewNext)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ChangeClipboardChain()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "ChangeClipboardChain()"_lit);
   return IUser32::get_instance()->ChangeClipboardChain(hWndRemove, hWndNewNext);
 }
 
 DLLEXPORT HANDLE WINAPI SetClipboardData (UINT uFormat, HANDLE hMem)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetClipboardData()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "SetClipboardData()"_lit);
   return IUser32::get_instance()->SetClipboardData(uFormat, hMem);
 }
 
 DLLEXPORT HANDLE WINAPI GetClipboardData (UINT uFormat)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetClipboardData()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetClipboardData()"_lit);
   return IUser32::get_instance()->GetClipboardData(uFormat);
 }
 
 DLLEXPORT UINT WINAPI RegisterClipboardFormatA (LPCSTR lpszFormat)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "RegisterClipboardFormatA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "RegisterClipboardFormatA()"_lit);
   return IUser32::get_instance()->RegisterClipboardFormatA(lpszFormat);
 }
 
 DLLEXPORT UINT WINAPI RegisterClipboardFormatW (LPCWSTR lpszFormat)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "RegisterClipboardFormatW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "RegisterClipboardFormatW()"_lit);
   return IUser32::get_instance()->RegisterClipboardFormatW(lpszFormat);
 }
 
 DLLEXPORT int WINAPI CountClipboardFormats (VOID)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CountClipboardFormats()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "CountClipboardFormats()"_lit);
   return IUser32::get_instance()->CountClipboardFormats();
 }
 
 DLLEXPORT UINT WINAPI EnumClipboardFormats (UINT format)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "EnumClipboardFormats()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "EnumClipboardFormats()"_lit);
   return IUser32::get_instance()->EnumClipboardFormats(format);
 }
 
 DLLEXPORT int WINAPI GetClipboardFormatNameA (UINT format, LPSTR lpszFormatName, int cchMaxCount)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetClipboardFormatNameA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetClipboardFormatNameA()"_lit);
   return IUser32::get_instance()->GetClipboardFormatNameA(format, lpszFormatName, cchMaxCount);
 }
 
 DLLEXPORT int WINAPI GetClipboardFormatNameW (UINT format, LPWSTR lpszFormatName, int cchMaxCount)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetClipboardFormatNameW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetClipboardFormatNameW()"_lit);
   return IUser32::get_instance()->GetClipboardFormatNameW(format, lpszFormatName, cchMaxCount);
 }
 
 DLLEXPORT WINBOOL WINAPI EmptyClipboard (VOID)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "EmptyClipboard()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "EmptyClipboard()"_lit);
   return IUser32::get_instance()->EmptyClipboard();
 }
 
 DLLEXPORT WINBOOL WINAPI IsClipboardFormatAvailable (UINT format)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "IsClipboardFormatAvailable()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "IsClipboardFormatAvailable()"_lit);
   return IUser32::get_instance()->IsClipboardFormatAvailable(format);
 }
 
 DLLEXPORT int WINAPI GetPriorityClipboardFormat (UINT * paFormatPriorityList, int cFormats)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetPriorityClipboardFormat()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetPriorityClipboardFormat()"_lit);
   return IUser32::get_instance()->GetPriorityClipboardFormat(paFormatPriorityList, cFormats);
 }
 
 DLLEXPORT HWND WINAPI GetOpenClipboardWindow (VOID)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetOpenClipboardWindow()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetOpenClipboardWindow()"_lit);
   return IUser32::get_instance()->GetOpenClipboardWindow();
 }
 
 DLLEXPORT WINBOOL WINAPI AddClipboardFormatListener (HWND hwnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "AddClipboardFormatListener()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "AddClipboardFormatListener()"_lit);
   return IUser32::get_instance()->AddClipboardFormatListener(hwnd);
 }
 
 DLLEXPORT WINBOOL WINAPI RemoveClipboardFormatListener (HWND hwnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "RemoveClipboardFormatListener()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "RemoveClipboardFormatListener()"_lit);
   return IUser32::get_instance()->RemoveClipboardFormatListener(hwnd);
 }
 
 DLLEXPORT WINBOOL WINAPI GetUpdatedClipboardFormats (PUINT lpuiFormats, UINT cFormats, PUINT pcFormatsOut)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetUpdatedClipboardFormats()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetUpdatedClipboardFormats()"_lit);
   return IUser32::get_instance()->GetUpdatedClipboardFormats(lpuiFormats, cFormats, pcFormatsOut);
 }
 
 DLLEXPORT WINBOOL WINAPI CharToOemA (LPCSTR lpszSrc, LPSTR lpszDst)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CharToOemA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "CharToOemA()"_lit);
   return IUser32::get_instance()->CharToOemA(lpszSrc, lpszDst);
 }
 
 DLLEXPORT WINBOOL WINAPI CharToOemW (LPCWSTR lpszSrc, LPSTR lpszDst)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CharToOemW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "CharToOemW()"_lit);
   return IUser32::get_instance()->CharToOemW(lpszSrc, lpszDst);
 }
 
 DLLEXPORT WINBOOL WINAPI OemToCharA (LPCSTR lpszSrc, LPSTR lpszDst)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "OemToCharA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "OemToCharA()"_lit);
   return IUser32::get_instance()->OemToCharA(lpszSrc, lpszDst);
 }
 
 DLLEXPORT WINBOOL WINAPI OemToCharW (LPCSTR lpszSrc, LPWSTR lpszDst)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "OemToCharW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "OemToCharW()"_lit);
   return IUser32::get_instance()->OemToCharW(lpszSrc, lpszDst);
 }
 
 DLLEXPORT WINBOOL WINAPI CharToOemBuffA (LPCSTR lpszSrc, LPSTR lpszDst, DWORD cchDstLength)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CharToOemBuffA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "CharToOemBuffA()"_lit);
   return IUser32::get_instance()->CharToOemBuffA(lpszSrc, lpszDst, cchDstLength);
 }
 
 DLLEXPORT WINBOOL WINAPI CharToOemBuffW (LPCWSTR lpszSrc, LPSTR lpszDst, DWORD cchDstLength)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CharToOemBuffW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "CharToOemBuffW()"_lit);
   return IUser32::get_instance()->CharToOemBuffW(lpszSrc, lpszDst, cchDstLength);
 }
 
 DLLEXPORT WINBOOL WINAPI OemToCharBuffA (LPCSTR lpszSrc, LPSTR lpszDst, DWORD cchDstLength)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "OemToCharBuffA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "OemToCharBuffA()"_lit);
   return IUser32::get_instance()->OemToCharBuffA(lpszSrc, lpszDst, cchDstLength);
 }
 
 DLLEXPORT WINBOOL WINAPI OemToCharBuffW (LPCSTR lpszSrc, LPWSTR lpszDst, DWORD cchDstLength)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "OemToCharBuffW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "OemToCharBuffW()"_lit);
   return IUser32::get_instance()->OemToCharBuffW(lpszSrc, lpszDst, cchDstLength);
 }
 
 DLLEXPORT LPSTR WINAPI CharUpperA (LPSTR lpsz)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CharUpperA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "CharUpperA()"_lit);
   return IUser32::get_instance()->CharUpperA(lpsz);
 }
 
 DLLEXPORT LPWSTR WINAPI CharUpperW (LPWSTR lpsz)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CharUpperW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "CharUpperW()"_lit);
   return IUser32::get_instance()->CharUpperW(lpsz);
 }
 
 DLLEXPORT DWORD WINAPI CharUpperBuffA (LPSTR lpsz, DWORD cchLength)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CharUpperBuffA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "CharUpperBuffA()"_lit);
   return IUser32::get_instance()->CharUpperBuffA(lpsz, cchLength);
 }
 
 DLLEXPORT DWORD WINAPI CharUpperBuffW (LPWSTR lpsz, DWORD cchLength)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CharUpperBuffW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "CharUpperBuffW()"_lit);
   return IUser32::get_instance()->CharUpperBuffW(lpsz, cchLength);
 }
 
 DLLEXPORT LPSTR WINAPI CharLowerA (LPSTR lpsz)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CharLowerA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "CharLowerA()"_lit);
   return IUser32::get_instance()->CharLowerA(lpsz);
 }
 
 DLLEXPORT LPWSTR WINAPI CharLowerW (LPWSTR lpsz)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CharLowerW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "CharLowerW()"_lit);
   return IUser32::get_instance()->CharLowerW(lpsz);
 }
 
 DLLEXPORT DWORD WINAPI CharLowerBuffA (LPSTR lpsz, DWORD cchLength)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CharLowerBuffA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "CharLowerBuffA()"_lit);
   return IUser32::get_instance()->CharLowerBuffA(lpsz, cchLength);
 }
 
 DLLEXPORT DWORD WINAPI CharLowerBuffW (LPWSTR lpsz, DWORD cchLength)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CharLowerBuffW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "CharLowerBuffW()"_lit);
   return IUser32::get_instance()->CharLowerBuffW(lpsz, cchLength);
 }
 
 DLLEXPORT LPSTR WINAPI CharNextA (LPCSTR lpsz)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CharNextA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "CharNextA()"_lit);
   return IUser32::get_instance()->CharNextA(lpsz);
 }
 
 DLLEXPORT LPWSTR WINAPI CharNextW (LPCWSTR lpsz)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CharNextW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "CharNextW()"_lit);
   return IUser32::get_instance()->CharNextW(lpsz);
 }
 
 DLLEXPORT LPSTR WINAPI CharPrevA (LPCSTR lpszStart, LPCSTR lpszCurrent)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CharPrevA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "CharPrevA()"_lit);
   return IUser32::get_instance()->CharPrevA(lpszStart, lpszCurrent);
 }
 
 DLLEXPORT LPWSTR WINAPI CharPrevW (LPCWSTR lpszStart, LPCWSTR lpszCurrent)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CharPrevW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "CharPrevW()"_lit);
   return IUser32::get_instance()->CharPrevW(lpszStart, lpszCurrent);
 }
 
 DLLEXPORT LPSTR WINAPI CharNextExA (WORD CodePage, LPCSTR lpCurrentChar, DWORD dwFlags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CharNextExA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "CharNextExA()"_lit);
   return IUser32::get_instance()->CharNextExA(CodePage, lpCurrentChar, dwFlags);
 }
 
 DLLEXPORT LPSTR WINAPI CharPrevExA (WORD CodePage, LPCSTR lpStart, LPCSTR lpCurrentChar, DWORD dwFlags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CharPrevExA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "CharPrevExA()"_lit);
   return IUser32::get_instance()->CharPrevExA(CodePage, lpStart, lpCurrentChar, dwFlags);
 }
 
 DLLEXPORT WINBOOL WINAPI IsCharAlphaA (CHAR ch)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "IsCharAlphaA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "IsCharAlphaA()"_lit);
   return IUser32::get_instance()->IsCharAlphaA(ch);
 }
 
 DLLEXPORT WINBOOL WINAPI IsCharAlphaW (WCHAR ch)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "IsCharAlphaW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "IsCharAlphaW()"_lit);
   return IUser32::get_instance()->IsCharAlphaW(ch);
 }
 
 DLLEXPORT WINBOOL WINAPI IsCharAlphaNumericA (CHAR ch)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "IsCharAlphaNumericA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "IsCharAlphaNumericA()"_lit);
   return IUser32::get_instance()->IsCharAlphaNumericA(ch);
 }
 
 DLLEXPORT WINBOOL WINAPI IsCharAlphaNumericW (WCHAR ch)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "IsCharAlphaNumericW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "IsCharAlphaNumericW()"_lit);
   return IUser32::get_instance()->IsCharAlphaNumericW(ch);
 }
 
 DLLEXPORT WINBOOL WINAPI IsCharUpperA (CHAR ch)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "IsCharUpperA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "IsCharUpperA()"_lit);
   return IUser32::get_instance()->IsCharUpperA(ch);
 }
 
 DLLEXPORT WINBOOL WINAPI IsCharUpperW (WCHAR ch)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "IsCharUpperW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "IsCharUpperW()"_lit);
   return IUser32::get_instance()->IsCharUpperW(ch);
 }
 
 DLLEXPORT WINBOOL WINAPI IsCharLowerA (CHAR ch)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "IsCharLowerA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "IsCharLowerA()"_lit);
   return IUser32::get_instance()->IsCharLowerA(ch);
 }
 
 DLLEXPORT WINBOOL WINAPI IsCharLowerW (WCHAR ch)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "IsCharLowerW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "IsCharLowerW()"_lit);
   return IUser32::get_instance()->IsCharLowerW(ch);
 }
 
 DLLEXPORT HWND WINAPI SetFocus (HWND hWnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetFocus()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "SetFocus()"_lit);
   return IUser32::get_instance()->SetFocus(hWnd);
 }
 
 DLLEXPORT HWND WINAPI GetActiveWindow (VOID)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetActiveWindow()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetActiveWindow()"_lit);
   return IUser32::get_instance()->GetActiveWindow();
 }
 
 DLLEXPORT HWND WINAPI GetFocus (VOID)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetFocus()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetFocus()"_lit);
   return IUser32::get_instance()->GetFocus();
 }
 
 DLLEXPORT UINT WINAPI GetKBCodePage (VOID)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetKBCodePage()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetKBCodePage()"_lit);
   return IUser32::get_instance()->GetKBCodePage();
 }
 
 DLLEXPORT SHORT WINAPI GetKeyState (int nVirtKey)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetKeyState()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "GetKeyState()"_lit);
   return IUser32::get_instance()->GetKeyState(nVirtKey);
 }
 
 DLLEXPORT SHORT WINAPI GetAsyncKeyState (int vKey)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetAsyncKeyState()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "GetAsyncKeyState()"_lit);
   return IUser32::get_instance()->GetAsyncKeyState(vKey);
 }
 
 DLLEXPORT WINBOOL WINAPI GetKeyboardState (PBYTE lpKeyState)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetKeyboardState()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "GetKeyboardState()"_lit);
   return IUser32::get_instance()->GetKeyboardState(lpKeyState);
 }
 
 DLLEXPORT WINBOOL WINAPI SetKeyboardState (LPBYTE lpKeyState)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetKeyboardState()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "SetKeyboardState()"_lit);
   return IUser32::get_instance()->SetKeyboardState(lpKeyState);
 }
 
 DLLEXPORT int WINAPI GetKeyNameTextA (LONG lParam, LPSTR lpString, int cchSize)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetKeyNameTextA()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "GetKeyNameTextA()"_lit);
   return IUser32::get_instance()->GetKeyNameTextA(lParam, lpString, cchSize);
 }
 
 DLLEXPORT int WINAPI GetKeyNameTextW (LONG lParam, LPWSTR lpString, int cchSize)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetKeyNameTextW()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "GetKeyNameTextW()"_lit);
   return IUser32::get_instance()->GetKeyNameTextW(lParam, lpString, cchSize);
 }
 
 DLLEXPORT int WINAPI GetKeyboardType (int nTypeFlag)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetKeyboardType()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "GetKeyboardType()"_lit);
   return IUser32::get_instance()->GetKeyboardType(nTypeFlag);
 }
 
 DLLEXPORT int WINAPI ToAscii (UINT uVirtKey, UINT uScanCode, CONST BYTE * lpKeyState, LPWORD lpChar, UINT uFlags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ToAscii()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "ToAscii()"_lit);
   return IUser32::get_instance()->ToAscii(uVirtKey, uScanCode, lpKeyState, lpChar, uFlags);
 }
 
 DLLEXPORT int WINAPI ToAsciiEx (UINT uVirtKey, UINT uScanCode, CONST BYTE * lpKeyState, LPWORD lpChar, UINT uFlags, HKL dwhkl)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ToAsciiEx()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "ToAsciiEx()"_lit);
   return IUser32::get_instance()->ToAsciiEx(uVirtKey, uScanCode, lpKeyState, lpChar, uFlags, dwhkl);
 }
 
 DLLEXPORT int WINAPI ToUnicode (UINT wVirtKey, UINT wScanCode, CONST BYTE * lpKeyState, LPWSTR pwszBuff, int cchBuff, UINT wFlags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ToUnicode()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "ToUnicode()"_lit);
   return IUser32::get_instance()->ToUnicode(wVirtKey, wScanCode, lpKeyState, pwszBuff, cchBuff, wFlags);
 }
 
 DLLEXPORT DWORD WINAPI OemKeyScan (WORD wOemChar)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "OemKeyScan()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "OemKeyScan()"_lit);
   return IUser32::get_instance()->OemKeyScan(wOemChar);
 }
 
 DLLEXPORT SHORT WINAPI VkKeyScanA (CHAR ch)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "VkKeyScanA()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "VkKeyScanA()"_lit);
   return IUser32::get_instance()->VkKeyScanA(ch);
 }
 
 DLLEXPORT SHORT WINAPI VkKeyScanW (WCHAR ch)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "VkKeyScanW()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "VkKeyScanW()"_lit);
   return IUser32::get_instance()->VkKeyScanW(ch);
 }
 
 DLLEXPORT SHORT WINAPI VkKeyScanExA (CHAR ch, HKL dwhkl)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "VkKeyScanExA()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "VkKeyScanExA()"_lit);
   return IUser32::get_instance()->VkKeyScanExA(ch, dwhkl);
 }
 
 DLLEXPORT SHORT WINAPI VkKeyScanExW (WCHAR ch, HKL dwhkl)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "VkKeyScanExW()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "VkKeyScanExW()"_lit);
   return IUser32::get_instance()->VkKeyScanExW(ch, dwhkl);
 }
 
 DLLEXPORT VOID WINAPI keybd_event (BYTE bVk, BYTE bScan, DWORD dwFlags, ULONG_PTR dwExtraInfo)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "keybd_event()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "keybd_event()"_lit);
   IUser32::get_instance()->keybd_event(bVk, bScan, dwFlags, dwExtraInfo);
 }
 
 DLLEXPORT VOID WINAPI mouse_event (DWORD dwFlags, DWORD dx, DWORD dy, DWORD dwData, ULONG_PTR dwExtraInfo)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "mouse_event()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "mouse_event()"_lit);
   IUser32::get_instance()->mouse_event(dwFlags, dx, dy, dwData, dwExtraInfo);
 }
 
 DLLEXPORT UINT WINAPI SendInput (UINT cInputs, LPINPUT pInputs, int cbSize)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SendInput()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "SendInput()"_lit);
   return IUser32::get_instance()->SendInput(cInputs, pInputs, cbSize);
 }
 
 DLLEXPORT WINBOOL WINAPI GetTouchInputInfo (HTOUCHINPUT hTouchInput, UINT cInputs, PTOUCHINPUT pInputs, int cbSize)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetTouchInputInfo()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "GetTouchInputInfo()"_lit);
   return IUser32::get_instance()->GetTouchInputInfo(hTouchInput, cInputs, pInputs, cbSize);
 }
 
 DLLEXPORT WINBOOL WINAPI CloseTouchInputHandle (HTOUCHINPUT hTouchInput)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CloseTouchInputHandle()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "CloseTouchInputHandle()"_lit);
   return IUser32::get_instance()->CloseTouchInputHandle(hTouchInput);
 }
 
 DLLEXPORT WINBOOL WINAPI RegisterTouchWindow (HWND hwnd, ULONG ulFlags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "RegisterTouchWindow()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "RegisterTouchWindow()"_lit);
   return IUser32::get_instance()->RegisterTouchWindow(hwnd, ulFlags);
 }
 
 DLLEXPORT WINBOOL WINAPI UnregisterTouchWindow (HWND hwnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "UnregisterTouchWindow()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "UnregisterTouchWindow()"_lit);
   return IUser32::get_instance()->UnregisterTouchWindow(hwnd);
 }
 
 DLLEXPORT WINBOOL WINAPI IsTouchWindow (HWND hwnd, PULONG pulFlags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "IsTouchWindow()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "IsTouchWindow()"_lit);
   return IUser32::get_instance()->IsTouchWindow(hwnd, pulFlags);
 }
 
 DLLEXPORT WINBOOL WINAPI InitializeTouchInjection (UINT32 maxCount, DWORD dwMode)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "InitializeTouchInjection()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "InitializeTouchInjection()"_lit);
   return IUser32::get_instance()->InitializeTouchInjection(maxCount, dwMode);
 }
 
 DLLEXPORT WINBOOL WINAPI InjectTouchInput (UINT32 count, CONST POINTER_TOUCH_INFO * contacts)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "InjectTouchInput()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "InjectTouchInput()"_lit);
   return IUser32::get_instance()->InjectTouchInput(count, contacts);
 }
 
 DLLEXPORT WINBOOL WINAPI GetPointerType (UINT32 pointerId, POINTER_INPUT_TYPE * pointerType)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetPointerType()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "GetPointerType()"_lit);
   return IUser32::get_instance()->GetPointerType(pointerId, pointerType);
 }
 
 DLLEXPORT WINBOOL WINAPI GetPointerCursorId (UINT32 pointerId, UINT32 * cursorId)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetPointerCursorId()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "GetPointerCursorId()"_lit);
   return IUser32::get_instance()->GetPointerCursorId(pointerId, cursorId);
 }
 
 DLLEXPORT WINBOOL WINAPI GetPointerInfo (UINT32 pointerId, POINTER_INFO * pointerInfo)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetPointerInfo()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "GetPointerInfo()"_lit);
   return IUser32::get_instance()->GetPointerInfo(pointerId, pointerInfo);
 }
 
 DLLEXPORT WINBOOL WINAPI GetPointerInfoHistory (UINT32 pointerId, UINT32 * entriesCount, POINTER_INFO * pointerInfo)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetPointerInfoHistory()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "GetPointerInfoHistory()"_lit);
   return IUser32::get_instance()->GetPointerInfoHistory(pointerId, entriesCount, pointerInfo);
 }
 
 DLLEXPORT WINBOOL WINAPI GetPointerFrameInfo (UINT32 pointerId, UINT32 * pointerCount, POINTER_INFO * pointerInfo)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetPointerFrameInfo()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "GetPointerFrameInfo()"_lit);
   return IUser32::get_instance()->GetPointerFrameInfo(pointerId, pointerCount, pointerInfo);
 }
 
 DLLEXPORT WINBOOL WINAPI GetPointerFrameInfoHistory (UINT32 pointerId, UINT32 * entriesCount, UINT32 * pointerCount, POINTER_INFO * pointerInfo)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetPointerFrameInfoHistory()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "GetPointerFrameInfoHistory()"_lit);
   return IUser32::get_instance()->GetPointerFrameInfoHistory(pointerId, entriesCount, pointerCount, pointerInfo);
 }
 
 DLLEXPORT WINBOOL WINAPI GetPointerTouchInfo (UINT32 pointerId, POINTER_TOUCH_INFO * touchInfo)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetPointerTouchInfo()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "GetPointerTouchInfo()"_lit);
   return IUser32::get_instance()->GetPointerTouchInfo(pointerId, touchInfo);
 }
 
 DLLEXPORT WINBOOL WINAPI GetPointerTouchInfoHistory (UINT32 pointerId, UINT32 * entriesCount, POINTER_TOUCH_INFO * touchInfo)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetPointerTouchInfoHistory()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "GetPointerTouchInfoHistory()"_lit);
   return IUser32::get_instance()->GetPointerTouchInfoHistory(pointerId, entriesCount, touchInfo);
 }
 
 DLLEXPORT WINBOOL WINAPI GetPointerFrameTouchInfo (UINT32 pointerId, UINT32 * pointerCount, POINTER_TOUCH_INFO * touchInfo)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetPointerFrameTouchInfo()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "GetPointerFrameTouchInfo()"_lit);
   return IUser32::get_instance()->GetPointerFrameTouchInfo(pointerId, pointerCount, touchInfo);
 }
 
 DLLEXPORT WINBOOL WINAPI GetPointerFrameTouchInfoHistory (UINT32 pointerId, UINT32 * entriesCount, UINT32 * pointerCount, POINTER_TOUCH_INFO * touchInfo)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetPointerFrameTouchInfoHistory()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "GetPointerFrameTouchInfoHistory()"_lit);
   return IUser32::get_instance()->GetPointerFrameTouchInfoHistory(pointerId, entriesCount, pointerCount, touchInfo);
 }
 
 DLLEXPORT WINBOOL WINAPI GetPointerPenInfo (UINT32 pointerId, POINTER_PEN_INFO * penInfo)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetPointerPenInfo()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "GetPointerPenInfo()"_lit);
   return IUser32::get_instance()->GetPointerPenInfo(pointerId, penInfo);
 }
 
 DLLEXPORT WINBOOL WINAPI GetPointerPenInfoHistory (UINT32 pointerId, UINT32 * entriesCount, POINTER_PEN_INFO * penInfo)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetPointerPenInfoHistory()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "GetPointerPenInfoHistory()"_lit);
   return IUser32::get_instance()->GetPointerPenInfoHistory(pointerId, entriesCount, penInfo);
 }
 
 DLLEXPORT WINBOOL WINAPI GetPointerFramePenInfo (UINT32 pointerId, UINT32 * pointerCount, POINTER_PEN_INFO * penInfo)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetPointerFramePenInfo()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "GetPointerFramePenInfo()"_lit);
   return IUser32::get_instance()->GetPointerFramePenInfo(pointerId, pointerCount, penInfo);
 }
 
 DLLEXPORT WINBOOL WINAPI GetPointerFramePenInfoHistory (UINT32 pointerId, UINT32 * entriesCount, UINT32 * pointerCount, POINTER_PEN_INFO * penInfo)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetPointerFramePenInfoHistory()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "GetPointerFramePenInfoHistory()"_lit);
   return IUser32::get_instance()->GetPointerFramePenInfoHistory(pointerId, entriesCount, pointerCount, penInfo);
 }
 
 DLLEXPORT WINBOOL WINAPI SkipPointerFrameMessages (UINT32 pointerId)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SkipPointerFrameMessages()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "SkipPointerFrameMessages()"_lit);
   return IUser32::get_instance()->SkipPointerFrameMessages(pointerId);
 }
 
 DLLEXPORT WINBOOL WINAPI RegisterPointerInputTarget (HWND hwnd, POINTER_INPUT_TYPE pointerType)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "RegisterPointerInputTarget()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "RegisterPointerInputTarget()"_lit);
   return IUser32::get_instance()->RegisterPointerInputTarget(hwnd, pointerType);
 }
 
 DLLEXPORT WINBOOL WINAPI UnregisterPointerInputTarget (HWND hwnd, POINTER_INPUT_TYPE pointerType)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "UnregisterPointerInputTarget()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "UnregisterPointerInputTarget()"_lit);
   return IUser32::get_instance()->UnregisterPointerInputTarget(hwnd, pointerType);
 }
 
 DLLEXPORT WINBOOL WINAPI EnableMouseInPointer (WINBOOL fEnable)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "EnableMouseInPointer()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "EnableMouseInPointer()"_lit);
   return IUser32::get_instance()->EnableMouseInPointer(fEnable);
 }
 
 DLLEXPORT WINBOOL WINAPI IsMouseInPointerEnabled (VOID)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "IsMouseInPointerEnabled()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "IsMouseInPointerEnabled()"_lit);
   return IUser32::get_instance()->IsMouseInPointerEnabled();
 }
 
 DLLEXPORT WINBOOL WINAPI RegisterTouchHitTestingWindow (HWND hwnd, ULONG value)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "RegisterTouchHitTestingWindow()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "RegisterTouchHitTestingWindow()"_lit);
   return IUser32::get_instance()->RegisterTouchHitTestingWindow(hwnd, value);
 }
 
 DLLEXPORT WINBOOL WINAPI EvaluateProximityToRect (const RECT * controlBoundingBox, const TOUCH_HIT_TESTING_INPUT * pHitTestingInput, TOUCH_HIT_TESTING_PROXIMITY_EVALUATION * pProximityEval)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "EvaluateProximityToRect()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "EvaluateProximityToRect()"_lit);
   return IUser32::get_instance()->EvaluateProximityToRect(controlBoundingBox, pHitTestingInput, pProximityEval);
 }
 
 DLLEXPORT WINBOOL WINAPI EvaluateProximityToPolygon (UINT32 numVertices, const POINT * controlPolygon, const TOUCH_HIT_TESTING_INPUT * pHitTestingInput, TOUCH_HIT_TESTING_PROXIMITY_EVALUATION * pProximityEval)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "EvaluateProximityToPolygon()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "EvaluateProximityToPolygon()"_lit);
   return IUser32::get_instance()->EvaluateProximityToPolygon(numVertices, controlPolygon, pHitTestingInput, pProximityEval);
 }
 
 DLLEXPORT LRESULT WINAPI PackTouchHitTestingProximityEvaluation (const TOUCH_HIT_TESTING_INPUT * pHitTestingInput, const TOUCH_HIT_TESTING_PROXIMITY_EVALUATION * pProximityEval)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "PackTouchHitTestingProximityEvaluation()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "PackTouchHitTestingProximityEvaluation()"_lit);
   return IUser32::get_instance()->PackTouchHitTestingProximityEvaluation(pHitTestingInput, pProximityEval);
 }
 
 DLLEXPORT WINBOOL WINAPI GetWindowFeedbackSetting (HWND hwnd, FEEDBACK_TYPE feedback, DWORD dwFlags, UINT32 * pSize, VOID * config)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetWindowFeedbackSetting()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetWindowFeedbackSetting()"_lit);
   return IUser32::get_instance()->GetWindowFeedbackSetting(hwnd, feedback, dwFlags, pSize, config);
 }
 
 DLLEXPORT WINBOOL WINAPI SetWindowFeedbackSetting (HWND hwnd, FEEDBACK_TYPE feedback, DWORD dwFlags, UINT32 size, CONST VOID * configuration)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetWindowFeedbackSetting()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "SetWindowFeedbackSetting()"_lit);
   return IUser32::get_instance()->SetWindowFeedbackSetting(hwnd, feedback, dwFlags, size, configuration);
 }
 
 DLLEXPORT WINBOOL WINAPI GetLastInputInfo (PLASTINPUTINFO plii)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetLastInputInfo()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "GetLastInputInfo()"_lit);
   return IUser32::get_instance()->GetLastInputInfo(plii);
 }
 
 DLLEXPORT UINT WINAPI MapVirtualKeyA (UINT uCode, UINT uMapType)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "MapVirtualKeyA()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "MapVirtualKeyA()"_lit);
   return IUser32::get_instance()->MapVirtualKeyA(uCode, uMapType);
 }
 
 DLLEXPORT UINT WINAPI MapVirtualKeyW (UINT uCode, UINT uMapType)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "MapVirtualKeyW()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "MapVirtualKeyW()"_lit);
   return IUser32::get_instance()->MapVirtualKeyW(uCode, uMapType);
 }
 
 DLLEXPORT UINT WINAPI MapVirtualKeyExA (UINT uCode, UINT uMapType, HKL dwhkl)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "MapVirtualKeyExA()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "MapVirtualKeyExA()"_lit);
   return IUser32::get_instance()->MapVirtualKeyExA(uCode, uMapType, dwhkl);
 }
 
 DLLEXPORT UINT WINAPI MapVirtualKeyExW (UINT uCode, UINT uMapType, HKL dwhkl)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "MapVirtualKeyExW()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "MapVirtualKeyExW()"_lit);
   return IUser32::get_instance()->MapVirtualKeyExW(uCode, uMapType, dwhkl);
 }
 
 DLLEXPORT WINBOOL WINAPI GetInputState (VOID)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetInputState()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "GetInputState()"_lit);
   return IUser32::get_instance()->GetInputState();
 }
 
 DLLEXPORT DWORD WINAPI GetQueueStatus (UINT flags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetQueueStatus()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetQueueStatus()"_lit);
   return IUser32::get_instance()->GetQueueStatus(flags);
 }
 
 DLLEXPORT HWND WINAPI GetCapture (VOID)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetCapture()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "GetCapture()"_lit);
   return IUser32::get_instance()->GetCapture();
 }
 
 DLLEXPORT HWND WINAPI SetCapture (HWND hWnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetCapture()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "SetCapture()"_lit);
   return IUser32::get_instance()->SetCapture(hWnd);
 }
 
 DLLEXPORT WINBOOL WINAPI ReleaseCapture (VOID)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ReleaseCapture()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "ReleaseCapture()"_lit);
   return IUser32::get_instance()->ReleaseCapture();
 }
 
 DLLEXPORT DWORD WINAPI MsgWaitForMultipleObjects (DWORD nCount, CONST HANDLE * pHandles, WINBOOL fWaitAll, DWORD dwMilliseconds, DWORD dwWakeMask)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "MsgWaitForMultipleObjects()");
+  logging::log(logging::LogSource::message_exports, logging::LogLevel::debug, "MsgWaitForMultipleObjects()"_lit);
   return IUser32::get_instance()->MsgWaitForMultipleObjects(nCount, pHandles, fWaitAll, dwMilliseconds, dwWakeMask);
 }
 
 DLLEXPORT DWORD WINAPI MsgWaitForMultipleObjectsEx (DWORD nCount, CONST HANDLE * pHandles, DWORD dwMilliseconds, DWORD dwWakeMask, DWORD dwFlags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "MsgWaitForMultipleObjectsEx()");
+  logging::log(logging::LogSource::message_exports, logging::LogLevel::debug, "MsgWaitForMultipleObjectsEx()"_lit);
   return IUser32::get_instance()->MsgWaitForMultipleObjectsEx(nCount, pHandles, dwMilliseconds, dwWakeMask, dwFlags);
 }
 
 DLLEXPORT UINT_PTR WINAPI SetTimer (HWND hWnd, UINT_PTR nIDEvent, UINT uElapse, TIMERPROC lpTimerFunc)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetTimer()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "SetTimer()"_lit);
   return IUser32::get_instance()->SetTimer(hWnd, nIDEvent, uElapse, lpTimerFunc);
 }
 
 DLLEXPORT WINBOOL WINAPI KillTimer (HWND hWnd, UINT_PTR uIDEvent)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "KillTimer()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "KillTimer()"_lit);
   return IUser32::get_instance()->KillTimer(hWnd, uIDEvent);
 }
 
 DLLEXPORT WINBOOL WINAPI IsWindowUnicode (HWND hWnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "IsWindowUnicode()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "IsWindowUnicode()"_lit);
   return IUser32::get_instance()->IsWindowUnicode(hWnd);
 }
 
 DLLEXPORT WINBOOL WINAPI EnableWindow (HWND hWnd, WINBOOL bEnable)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "EnableWindow()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "EnableWindow()"_lit);
   return IUser32::get_instance()->EnableWindow(hWnd, bEnable);
 }
 
 DLLEXPORT WINBOOL WINAPI IsWindowEnabled (HWND hWnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "IsWindowEnabled()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "IsWindowEnabled()"_lit);
   return IUser32::get_instance()->IsWindowEnabled(hWnd);
 }
 
 DLLEXPORT HACCEL WINAPI LoadAcceleratorsA (HINSTANCE hInstance, LPCSTR lpTableName)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "LoadAcceleratorsA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "LoadAcceleratorsA()"_lit);
   return IUser32::get_instance()->LoadAcceleratorsA(hInstance, lpTableName);
 }
 
 DLLEXPORT HACCEL WINAPI LoadAcceleratorsW (HINSTANCE hInstance, LPCWSTR lpTableName)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "LoadAcceleratorsW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "LoadAcceleratorsW()"_lit);
   return IUser32::get_instance()->LoadAcceleratorsW(hInstance, lpTableName);
 }
 
 DLLEXPORT HACCEL WINAPI CreateAcceleratorTableA (LPACCEL paccel, int cAccel)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CreateAcceleratorTableA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "CreateAcceleratorTableA()"_lit);
   return IUser32::get_instance()->CreateAcceleratorTableA(paccel, cAccel);
 }
 
 DLLEXPORT HACCEL WINAPI CreateAcceleratorTableW (LPACCEL paccel, int cAccel)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CreateAcceleratorTableW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "CreateAcceleratorTableW()"_lit);
   return IUser32::get_instance()->CreateAcceleratorTableW(paccel, cAccel);
 }
 
 DLLEXPORT WINBOOL WINAPI DestroyAcceleratorTable (HACCEL hAccel)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DestroyAcceleratorTable()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "DestroyAcceleratorTable()"_lit);
   return IUser32::get_instance()->DestroyAcceleratorTable(hAccel);
 }
 
 DLLEXPORT int WINAPI CopyAcceleratorTableA (HACCEL hAccelSrc, LPACCEL lpAccelDst, int cAccelEntries)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CopyAcceleratorTableA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "CopyAcceleratorTableA()"_lit);
   return IUser32::get_instance()->CopyAcceleratorTableA(hAccelSrc, lpAccelDst, cAccelEntries);
 }
 
 DLLEXPORT int WINAPI CopyAcceleratorTableW (HACCEL hAccelSrc, LPACCEL lpAccelDst, int cAccelEntries)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CopyAcceleratorTableW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "CopyAcceleratorTableW()"_lit);
   return IUser32::get_instance()->CopyAcceleratorTableW(hAccelSrc, lpAccelDst, cAccelEntries);
 }
 
 DLLEXPORT int WINAPI TranslateAcceleratorA (HWND hWnd, HACCEL hAccTable, LPMSG lpMsg)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "TranslateAcceleratorA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "TranslateAcceleratorA()"_lit);
   return IUser32::get_instance()->TranslateAcceleratorA(hWnd, hAccTable, lpMsg);
 }
 
 DLLEXPORT int WINAPI TranslateAcceleratorW (HWND hWnd, HACCEL hAccTable, LPMSG lpMsg)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "TranslateAcceleratorW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "TranslateAcceleratorW()"_lit);
   return IUser32::get_instance()->TranslateAcceleratorW(hWnd, hAccTable, lpMsg);
 }
 
 DLLEXPORT UINT_PTR WINAPI SetCoalescableTimer (HWND hWnd, UINT_PTR nIDEvent, UINT uElapse, TIMERPROC lpTimerFunc, ULONG uToleranceDelay)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetCoalescableTimer()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "SetCoalescableTimer()"_lit);
   return IUser32::get_instance()->SetCoalescableTimer(hWnd, nIDEvent, uElapse, lpTimerFunc, uToleranceDelay);
 }
 
 DLLEXPORT int WINAPI GetSystemMetrics (int nIndex)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetSystemMetrics()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetSystemMetrics()"_lit);
   return IUser32::get_instance()->GetSystemMetrics(nIndex);
 }
 
 DLLEXPORT HMENU WINAPI LoadMenuA (HINSTANCE hInstance, LPCSTR lpMenuName)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "LoadMenuA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "LoadMenuA()"_lit);
   return IUser32::get_instance()->LoadMenuA(hInstance, lpMenuName);
 }
 
 DLLEXPORT HMENU WINAPI LoadMenuW (HINSTANCE hInstance, LPCWSTR lpMenuName)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "LoadMenuW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "LoadMenuW()"_lit);
   return IUser32::get_instance()->LoadMenuW(hInstance, lpMenuName);
 }
 
 DLLEXPORT HMENU WINAPI LoadMenuIndirectA (CONST MENUTEMPLATEA * lpMenuTemplate)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "LoadMenuIndirectA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "LoadMenuIndirectA()"_lit);
   return IUser32::get_instance()->LoadMenuIndirectA(lpMenuTemplate);
 }
 
 DLLEXPORT HMENU WINAPI LoadMenuIndirectW (CONST MENUTEMPLATEW * lpMenuTemplate)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "LoadMenuIndirectW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "LoadMenuIndirectW()"_lit);
   return IUser32::get_instance()->LoadMenuIndirectW(lpMenuTemplate);
 }
 
 DLLEXPORT HMENU WINAPI GetMenu (HWND hWnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetMenu()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetMenu()"_lit);
   return IUser32::get_instance()->GetMenu(hWnd);
 }
 
 DLLEXPORT WINBOOL WINAPI SetMenu (HWND hWnd, HMENU hMenu)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetMenu()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "SetMenu()"_lit);
   return IUser32::get_instance()->SetMenu(hWnd, hMenu);
 }
 
 DLLEXPORT WINBOOL WINAPI ChangeMenuA (HMENU hMenu, UINT cmd, LPCSTR lpszNewItem, UINT cmdInsert, UINT flags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ChangeMenuA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "ChangeMenuA()"_lit);
   return IUser32::get_instance()->ChangeMenuA(hMenu, cmd, lpszNewItem, cmdInsert, flags);
 }
 
 DLLEXPORT WINBOOL WINAPI ChangeMenuW (HMENU hMenu, UINT cmd, LPCWSTR lpszNewItem, UINT cmdInsert, UINT flags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ChangeMenuW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "ChangeMenuW()"_lit);
   return IUser32::get_instance()->ChangeMenuW(hMenu, cmd, lpszNewItem, cmdInsert, flags);
 }
 
 DLLEXPORT WINBOOL WINAPI HiliteMenuItem (HWND hWnd, HMENU hMenu, UINT uIDHiliteItem, UINT uHilite)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "HiliteMenuItem()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "HiliteMenuItem()"_lit);
   return IUser32::get_instance()->HiliteMenuItem(hWnd, hMenu, uIDHiliteItem, uHilite);
 }
 
 DLLEXPORT int WINAPI GetMenuStringA (HMENU hMenu, UINT uIDItem, LPSTR lpString, int cchMax, UINT flags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetMenuStringA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetMenuStringA()"_lit);
   return IUser32::get_instance()->GetMenuStringA(hMenu, uIDItem, lpString, cchMax, flags);
 }
 
 DLLEXPORT int WINAPI GetMenuStringW (HMENU hMenu, UINT uIDItem, LPWSTR lpString, int cchMax, UINT flags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetMenuStringW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetMenuStringW()"_lit);
   return IUser32::get_instance()->GetMenuStringW(hMenu, uIDItem, lpString, cchMax, flags);
 }
 
 DLLEXPORT UINT WINAPI GetMenuState (HMENU hMenu, UINT uId, UINT uFlags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetMenuState()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetMenuState()"_lit);
   return IUser32::get_instance()->GetMenuState(hMenu, uId, uFlags);
 }
 
 DLLEXPORT WINBOOL WINAPI DrawMenuBar (HWND hWnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DrawMenuBar()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "DrawMenuBar()"_lit);
   return IUser32::get_instance()->DrawMenuBar(hWnd);
 }
 
 DLLEXPORT HMENU WINAPI GetSystemMenu (HWND hWnd, WINBOOL bRevert)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetSystemMenu()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetSystemMenu()"_lit);
   return IUser32::get_instance()->GetSystemMenu(hWnd, bRevert);
 }
 
 DLLEXPORT HMENU WINAPI CreateMenu (VOID)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CreateMenu()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "CreateMenu()"_lit);
   return IUser32::get_instance()->CreateMenu();
 }
 
 DLLEXPORT HMENU WINAPI CreatePopupMenu (VOID)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CreatePopupMenu()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "CreatePopupMenu()"_lit);
   return IUser32::get_instance()->CreatePopupMenu();
 }
 
 DLLEXPORT WINBOOL WINAPI DestroyMenu (HMENU hMenu)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DestroyMenu()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "DestroyMenu()"_lit);
   return IUser32::get_instance()->DestroyMenu(hMenu);
 }
 
 DLLEXPORT DWORD WINAPI CheckMenuItem (HMENU hMenu, UINT uIDCheckItem, UINT uCheck)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CheckMenuItem()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "CheckMenuItem()"_lit);
   return IUser32::get_instance()->CheckMenuItem(hMenu, uIDCheckItem, uCheck);
 }
 
 DLLEXPORT WINBOOL WINAPI EnableMenuItem (HMENU hMenu, UINT uIDEnableItem, UINT uEnable)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "EnableMenuItem()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "EnableMenuItem()"_lit);
   return IUser32::get_instance()->EnableMenuItem(hMenu, uIDEnableItem, uEnable);
 }
 
 DLLEXPORT HMENU WINAPI GetSubMenu (HMENU hMenu, int nPos)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetSubMenu()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetSubMenu()"_lit);
   return IUser32::get_instance()->GetSubMenu(hMenu, nPos);
 }
 
 DLLEXPORT UINT WINAPI GetMenuItemID (HMENU hMenu, int nPos)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetMenuItemID()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetMenuItemID()"_lit);
   return IUser32::get_instance()->GetMenuItemID(hMenu, nPos);
 }
 
 DLLEXPORT int WINAPI GetMenuItemCount (HMENU hMenu)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetMenuItemCount()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetMenuItemCount()"_lit);
   return IUser32::get_instance()->GetMenuItemCount(hMenu);
 }
 
 DLLEXPORT WINBOOL WINAPI InsertMenuA (HMENU hMenu, UINT uPosition, UINT uFlags, UINT_PTR uIDNewItem, LPCSTR lpNewItem)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "InsertMenuA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "InsertMenuA()"_lit);
   return IUser32::get_instance()->InsertMenuA(hMenu, uPosition, uFlags, uIDNewItem, lpNewItem);
 }
 
 DLLEXPORT WINBOOL WINAPI InsertMenuW (HMENU hMenu, UINT uPosition, UINT uFlags, UINT_PTR uIDNewItem, LPCWSTR lpNewItem)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "InsertMenuW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "InsertMenuW()"_lit);
   return IUser32::get_instance()->InsertMenuW(hMenu, uPosition, uFlags, uIDNewItem, lpNewItem);
 }
 
 DLLEXPORT WINBOOL WINAPI AppendMenuA (HMENU hMenu, UINT uFlags, UINT_PTR uIDNewItem, LPCSTR lpNewItem)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "AppendMenuA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "AppendMenuA()"_lit);
   return IUser32::get_instance()->AppendMenuA(hMenu, uFlags, uIDNewItem, lpNewItem);
 }
 
 DLLEXPORT WINBOOL WINAPI AppendMenuW (HMENU hMenu, UINT uFlags, UINT_PTR uIDNewItem, LPCWSTR lpNewItem)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "AppendMenuW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "AppendMenuW()"_lit);
   return IUser32::get_instance()->AppendMenuW(hMenu, uFlags, uIDNewItem, lpNewItem);
 }
 
 DLLEXPORT WINBOOL WINAPI ModifyMenuA (HMENU hMnu, UINT uPosition, UINT uFlags, UINT_PTR uIDNewItem, LPCSTR lpNewItem)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ModifyMenuA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "ModifyMenuA()"_lit);
   return IUser32::get_instance()->ModifyMenuA(hMnu, uPosition, uFlags, uIDNewItem, lpNewItem);
 }
 
 DLLEXPORT WINBOOL WINAPI ModifyMenuW (HMENU hMnu, UINT uPosition, UINT uFlags, UINT_PTR uIDNewItem, LPCWSTR lpNewItem)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ModifyMenuW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "ModifyMenuW()"_lit);
   return IUser32::get_instance()->ModifyMenuW(hMnu, uPosition, uFlags, uIDNewItem, lpNewItem);
 }
 
 DLLEXPORT WINBOOL WINAPI RemoveMenu (HMENU hMenu, UINT uPosition, UINT uFlags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "RemoveMenu()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "RemoveMenu()"_lit);
   return IUser32::get_instance()->RemoveMenu(hMenu, uPosition, uFlags);
 }
 
 DLLEXPORT WINBOOL WINAPI DeleteMenu (HMENU hMenu, UINT uPosition, UINT uFlags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DeleteMenu()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "DeleteMenu()"_lit);
   return IUser32::get_instance()->DeleteMenu(hMenu, uPosition, uFlags);
 }
 
 DLLEXPORT WINBOOL WINAPI SetMenuItemBitmaps (HMENU hMenu, UINT uPosition, UINT uFlags, HBITMAP hBitmapUnchecked, HBITMAP hBitmapChecked)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetMenuItemBitmaps()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "SetMenuItemBitmaps()"_lit);
   return IUser32::get_instance()->SetMenuItemBitmaps(hMenu, uPosition, uFlags, hBitmapUnchecked, hBitmapChecked);
 }
 
 DLLEXPORT LONG WINAPI GetMenuCheckMarkDimensions (VOID)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetMenuCheckMarkDimensions()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetMenuCheckMarkDimensions()"_lit);
   return IUser32::get_instance()->GetMenuCheckMarkDimensions();
 }
 
 DLLEXPORT WINBOOL WINAPI TrackPopupMenu (HMENU hMenu, UINT uFlags, int x, int y, int nReserved, HWND hWnd, CONST RECT * prcRect)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "TrackPopupMenu()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "TrackPopupMenu()"_lit);
   return IUser32::get_instance()->TrackPopupMenu(hMenu, uFlags, x, y, nReserved, hWnd, prcRect);
 }
 
 DLLEXPORT WINBOOL WINAPI TrackPopupMenuEx (HMENU arg0, UINT arg1, int arg2, int arg3, HWND arg4, LPTPMPARAMS arg5)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "TrackPopupMenuEx()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "TrackPopupMenuEx()"_lit);
   return IUser32::get_instance()->TrackPopupMenuEx(arg0, arg1, arg2, arg3, arg4, arg5);
 }
 
 DLLEXPORT WINBOOL WINAPI GetMenuInfo (HMENU arg0, LPMENUINFO arg1)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetMenuInfo()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetMenuInfo()"_lit);
   return IUser32::get_instance()->GetMenuInfo(arg0, arg1);
 }
 
 DLLEXPORT WINBOOL WINAPI SetMenuInfo (HMENU arg0, LPCMENUINFO arg1)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetMenuInfo()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "SetMenuInfo()"_lit);
   return IUser32::get_instance()->SetMenuInfo(arg0, arg1);
 }
 
 DLLEXPORT WINBOOL WINAPI EndMenu (VOID)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "EndMenu()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "EndMenu()"_lit);
   return IUser32::get_instance()->EndMenu();
 }
 
 DLLEXPORT WINBOOL WINAPI CalculatePopupWindowPosition (const POINT * anchorPoint, const SIZE * windowSize, UINT flags, RECT * excludeRect, RECT * popupWindowPosition)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CalculatePopupWindowPosition()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "CalculatePopupWindowPosition()"_lit);
   return IUser32::get_instance()->CalculatePopupWindowPosition(anchorPoint, windowSize, flags, excludeRect, popupWindowPosition);
 }
 
 DLLEXPORT WINBOOL WINAPI InsertMenuItemA (HMENU hmenu, UINT item, WINBOOL fByPosition, LPCMENUITEMINFOA lpmi)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "InsertMenuItemA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "InsertMenuItemA()"_lit);
   return IUser32::get_instance()->InsertMenuItemA(hmenu, item, fByPosition, lpmi);
 }
 
 DLLEXPORT WINBOOL WINAPI InsertMenuItemW (HMENU hmenu, UINT item, WINBOOL fByPosition, LPCMENUITEMINFOW lpmi)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "InsertMenuItemW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "InsertMenuItemW()"_lit);
   return IUser32::get_instance()->InsertMenuItemW(hmenu, item, fByPosition, lpmi);
 }
 
 DLLEXPORT WINBOOL WINAPI GetMenuItemInfoA (HMENU hmenu, UINT item, WINBOOL fByPosition, LPMENUITEMINFOA lpmii)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetMenuItemInfoA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetMenuItemInfoA()"_lit);
   return IUser32::get_instance()->GetMenuItemInfoA(hmenu, item, fByPosition, lpmii);
 }
 
 DLLEXPORT WINBOOL WINAPI GetMenuItemInfoW (HMENU hmenu, UINT item, WINBOOL fByPosition, LPMENUITEMINFOW lpmii)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetMenuItemInfoW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetMenuItemInfoW()"_lit);
   return IUser32::get_instance()->GetMenuItemInfoW(hmenu, item, fByPosition, lpmii);
 }
 
 DLLEXPORT WINBOOL WINAPI SetMenuItemInfoA (HMENU hmenu, UINT item, WINBOOL fByPositon, LPCMENUITEMINFOA lpmii)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetMenuItemInfoA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "SetMenuItemInfoA()"_lit);
   return IUser32::get_instance()->SetMenuItemInfoA(hmenu, item, fByPositon, lpmii);
 }
 
 DLLEXPORT WINBOOL WINAPI SetMenuItemInfoW (HMENU hmenu, UINT item, WINBOOL fByPositon, LPCMENUITEMINFOW lpmii)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetMenuItemInfoW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "SetMenuItemInfoW()"_lit);
   return IUser32::get_instance()->SetMenuItemInfoW(hmenu, item, fByPositon, lpmii);
 }
 
 DLLEXPORT UINT WINAPI GetMenuDefaultItem (HMENU hMenu, UINT fByPos, UINT gmdiFlags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetMenuDefaultItem()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetMenuDefaultItem()"_lit);
   return IUser32::get_instance()->GetMenuDefaultItem(hMenu, fByPos, gmdiFlags);
 }
 
 DLLEXPORT WINBOOL WINAPI SetMenuDefaultItem (HMENU hMenu, UINT uItem, UINT fByPos)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetMenuDefaultItem()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "SetMenuDefaultItem()"_lit);
   return IUser32::get_instance()->SetMenuDefaultItem(hMenu, uItem, fByPos);
 }
 
 DLLEXPORT WINBOOL WINAPI GetMenuItemRect (HWND hWnd, HMENU hMenu, UINT uItem, LPRECT lprcItem)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetMenuItemRect()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetMenuItemRect()"_lit);
   return IUser32::get_instance()->GetMenuItemRect(hWnd, hMenu, uItem, lprcItem);
 }
 
 DLLEXPORT int WINAPI MenuItemFromPoint (HWND hWnd, HMENU hMenu, POINT ptScreen)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "MenuItemFromPoint()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "MenuItemFromPoint()"_lit);
   return IUser32::get_instance()->MenuItemFromPoint(hWnd, hMenu, ptScreen);
 }
 
 DLLEXPORT DWORD WINAPI DragObject (HWND hwndParent, HWND hwndFrom, UINT fmt, ULONG_PTR data, HCURSOR hcur)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DragObject()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "DragObject()"_lit);
   return IUser32::get_instance()->DragObject(hwndParent, hwndFrom, fmt, data, hcur);
 }
 
 DLLEXPORT WINBOOL WINAPI DragDetect (HWND hwnd, POINT pt)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DragDetect()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "DragDetect()"_lit);
   return IUser32::get_instance()->DragDetect(hwnd, pt);
 }
 
 DLLEXPORT WINBOOL WINAPI DrawIcon (HDC hDC, int X, int Y, HICON hIcon)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DrawIcon()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "DrawIcon()"_lit);
   return IUser32::get_instance()->DrawIcon(hDC, X, Y, hIcon);
 }
 
 DLLEXPORT int WINAPI DrawTextA (HDC hdc, LPCSTR lpchText, int cchText, LPRECT lprc, UINT format)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DrawTextA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "DrawTextA()"_lit);
   return IUser32::get_instance()->DrawTextA(hdc, lpchText, cchText, lprc, format);
 }
 
 DLLEXPORT int WINAPI DrawTextW (HDC hdc, LPCWSTR lpchText, int cchText, LPRECT lprc, UINT format)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DrawTextW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "DrawTextW()"_lit);
   return IUser32::get_instance()->DrawTextW(hdc, lpchText, cchText, lprc, format);
 }
 
 DLLEXPORT int WINAPI DrawTextExA (HDC hdc, LPSTR lpchText, int cchText, LPRECT lprc, UINT format, LPDRAWTEXTPARAMS lpdtp)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DrawTextExA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "DrawTextExA()"_lit);
   return IUser32::get_instance()->DrawTextExA(hdc, lpchText, cchText, lprc, format, lpdtp);
 }
 
 DLLEXPORT int WINAPI DrawTextExW (HDC hdc, LPWSTR lpchText, int cchText, LPRECT lprc, UINT format, LPDRAWTEXTPARAMS lpdtp)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DrawTextExW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "DrawTextExW()"_lit);
   return IUser32::get_instance()->DrawTextExW(hdc, lpchText, cchText, lprc, format, lpdtp);
 }
 
 DLLEXPORT WINBOOL WINAPI GrayStringA (HDC hDC, HBRUSH hBrush, GRAYSTRINGPROC lpOutputFunc, LPARAM lpData, int nCount, int X, int Y, int nWidth, int nHeight)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GrayStringA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GrayStringA()"_lit);
   return IUser32::get_instance()->GrayStringA(hDC, hBrush, lpOutputFunc, lpData, nCount, X, Y, nWidth, nHeight);
 }
 
 DLLEXPORT WINBOOL WINAPI GrayStringW (HDC hDC, HBRUSH hBrush, GRAYSTRINGPROC lpOutputFunc, LPARAM lpData, int nCount, int X, int Y, int nWidth, int nHeight)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GrayStringW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GrayStringW()"_lit);
   return IUser32::get_instance()->GrayStringW(hDC, hBrush, lpOutputFunc, lpData, nCount, X, Y, nWidth, nHeight);
 }
 
 DLLEXPORT WINBOOL WINAPI DrawStateA (HDC hdc, HBRUSH hbrFore, DRAWSTATEPROC qfnCallBack, LPARAM lData, WPARAM wData, int x, int y, int cx, int cy, UINT uFlags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DrawStateA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "DrawStateA()"_lit);
   return IUser32::get_instance()->DrawStateA(hdc, hbrFore, qfnCallBack, lData, wData, x, y, cx, cy, uFlags);
 }
 
 DLLEXPORT WINBOOL WINAPI DrawStateW (HDC hdc, HBRUSH hbrFore, DRAWSTATEPROC qfnCallBack, LPARAM lData, WPARAM wData, int x, int y, int cx, int cy, UINT uFlags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DrawStateW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "DrawStateW()"_lit);
   return IUser32::get_instance()->DrawStateW(hdc, hbrFore, qfnCallBack, lData, wData, x, y, cx, cy, uFlags);
 }
 
 DLLEXPORT LONG WINAPI TabbedTextOutA (HDC hdc, int x, int y, LPCSTR lpString, int chCount, int nTabPositions, CONST INT * lpnTabStopPositions, int nTabOrigin)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "TabbedTextOutA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "TabbedTextOutA()"_lit);
   return IUser32::get_instance()->TabbedTextOutA(hdc, x, y, lpString, chCount, nTabPositions, lpnTabStopPositions, nTabOrigin);
 }
 
 DLLEXPORT LONG WINAPI TabbedTextOutW (HDC hdc, int x, int y, LPCWSTR lpString, int chCount, int nTabPositions, CONST INT * lpnTabStopPositions, int nTabOrigin)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "TabbedTextOutW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "TabbedTextOutW()"_lit);
   return IUser32::get_instance()->TabbedTextOutW(hdc, x, y, lpString, chCount, nTabPositions, lpnTabStopPositions, nTabOrigin);
 }
 
 DLLEXPORT DWORD WINAPI GetTabbedTextExtentA (HDC hdc, LPCSTR lpString, int chCount, int nTabPositions, CONST INT * lpnTabStopPositions)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetTabbedTextExtentA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetTabbedTextExtentA()"_lit);
   return IUser32::get_instance()->GetTabbedTextExtentA(hdc, lpString, chCount, nTabPositions, lpnTabStopPositions);
 }
 
 DLLEXPORT DWORD WINAPI GetTabbedTextExtentW (HDC hdc, LPCWSTR lpString, int chCount, int nTabPositions, CONST INT * lpnTabStopPositions)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetTabbedTextExtentW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetTabbedTextExtentW()"_lit);
   return IUser32::get_instance()->GetTabbedTextExtentW(hdc, lpString, chCount, nTabPositions, lpnTabStopPositions);
 }
 
 DLLEXPORT WINBOOL WINAPI UpdateWindow (HWND hWnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "UpdateWindow()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "UpdateWindow()"_lit);
   return IUser32::get_instance()->UpdateWindow(hWnd);
 }
 
 DLLEXPORT HWND WINAPI SetActiveWindow (HWND hWnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetActiveWindow()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "SetActiveWindow()"_lit);
   return IUser32::get_instance()->SetActiveWindow(hWnd);
 }
 
 DLLEXPORT HWND WINAPI GetForegroundWindow (VOID)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetForegroundWindow()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetForegroundWindow()"_lit);
   return IUser32::get_instance()->GetForegroundWindow();
 }
 
 DLLEXPORT WINBOOL WINAPI PaintDesktop (HDC hdc)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "PaintDesktop()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "PaintDesktop()"_lit);
   return IUser32::get_instance()->PaintDesktop(hdc);
 }
 
 DLLEXPORT VOID WINAPI SwitchToThisWindow (HWND hwnd, WINBOOL fUnknown)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SwitchToThisWindow()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "SwitchToThisWindow()"_lit);
   IUser32::get_instance()->SwitchToThisWindow(hwnd, fUnknown);
 }
 
 DLLEXPORT WINBOOL WINAPI SetForegroundWindow (HWND hWnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetForegroundWindow()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "SetForegroundWindow()"_lit);
   return IUser32::get_instance()->SetForegroundWindow(hWnd);
 }
 
 DLLEXPORT WINBOOL WINAPI AllowSetForegroundWindow (DWORD dwProcessId)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "AllowSetForegroundWindow()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "AllowSetForegroundWindow()"_lit);
   return IUser32::get_instance()->AllowSetForegroundWindow(dwProcessId);
 }
 
 DLLEXPORT WINBOOL WINAPI LockSetForegroundWindow (UINT uLockCode)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "LockSetForegroundWindow()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "LockSetForegroundWindow()"_lit);
   return IUser32::get_instance()->LockSetForegroundWindow(uLockCode);
 }
 
 DLLEXPORT HWND WINAPI WindowFromDC (HDC hDC)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "WindowFromDC()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "WindowFromDC()"_lit);
   return IUser32::get_instance()->WindowFromDC(hDC);
 }
 
 DLLEXPORT HDC WINAPI GetDC (HWND hWnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetDC()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetDC()"_lit);
   return IUser32::get_instance()->GetDC(hWnd);
 }
 
 DLLEXPORT HDC WINAPI GetDCEx (HWND hWnd, HRGN hrgnClip, DWORD flags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetDCEx()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetDCEx()"_lit);
   return IUser32::get_instance()->GetDCEx(hWnd, hrgnClip, flags);
 }
 
 DLLEXPORT HDC WINAPI GetWindowDC (HWND hWnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetWindowDC()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetWindowDC()"_lit);
   return IUser32::get_instance()->GetWindowDC(hWnd);
 }
 
 DLLEXPORT int WINAPI ReleaseDC (HWND hWnd, HDC hDC)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ReleaseDC()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "ReleaseDC()"_lit);
   return IUser32::get_instance()->ReleaseDC(hWnd, hDC);
 }
 
 DLLEXPORT HDC WINAPI BeginPaint (HWND hWnd, LPPAINTSTRUCT lpPaint)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "BeginPaint()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "BeginPaint()"_lit);
   return IUser32::get_instance()->BeginPaint(hWnd, lpPaint);
 }
 
 DLLEXPORT WINBOOL WINAPI EndPaint (HWND hWnd, CONST PAINTSTRUCT * lpPaint)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "EndPaint()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "EndPaint()"_lit);
   return IUser32::get_instance()->EndPaint(hWnd, lpPaint);
 }
 
 DLLEXPORT WINBOOL WINAPI GetUpdateRect (HWND hWnd, LPRECT lpRect, WINBOOL bErase)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetUpdateRect()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetUpdateRect()"_lit);
   return IUser32::get_instance()->GetUpdateRect(hWnd, lpRect, bErase);
 }
 
 DLLEXPORT int WINAPI GetUpdateRgn (HWND hWnd, HRGN hRgn, WINBOOL bErase)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetUpdateRgn()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetUpdateRgn()"_lit);
   return IUser32::get_instance()->GetUpdateRgn(hWnd, hRgn, bErase);
 }
 
 DLLEXPORT int WINAPI SetWindowRgn (HWND hWnd, HRGN hRgn, WINBOOL bRedraw)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetWindowRgn()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "SetWindowRgn()"_lit);
   return IUser32::get_instance()->SetWindowRgn(hWnd, hRgn, bRedraw);
 }
 
 DLLEXPORT int WINAPI GetWindowRgn (HWND hWnd, HRGN hRgn)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetWindowRgn()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetWindowRgn()"_lit);
   return IUser32::get_instance()->GetWindowRgn(hWnd, hRgn);
 }
 
 DLLEXPORT int WINAPI GetWindowRgnBox (HWND hWnd, LPRECT lprc)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetWindowRgnBox()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetWindowRgnBox()"_lit);
   return IUser32::get_instance()->GetWindowRgnBox(hWnd, lprc);
 }
 
 DLLEXPORT int WINAPI ExcludeUpdateRgn (HDC hDC, HWND hWnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ExcludeUpdateRgn()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "ExcludeUpdateRgn()"_lit);
   return IUser32::get_instance()->ExcludeUpdateRgn(hDC, hWnd);
 }
 
 DLLEXPORT WINBOOL WINAPI InvalidateRect (HWND hWnd, CONST RECT * lpRect, WINBOOL bErase)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "InvalidateRect()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "InvalidateRect()"_lit);
   return IUser32::get_instance()->InvalidateRect(hWnd, lpRect, bErase);
 }
 
 DLLEXPORT WINBOOL WINAPI ValidateRect (HWND hWnd, CONST RECT * lpRect)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ValidateRect()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "ValidateRect()"_lit);
   return IUser32::get_instance()->ValidateRect(hWnd, lpRect);
 }
 
 DLLEXPORT WINBOOL WINAPI InvalidateRgn (HWND hWnd, HRGN hRgn, WINBOOL bErase)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "InvalidateRgn()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "InvalidateRgn()"_lit);
   return IUser32::get_instance()->InvalidateRgn(hWnd, hRgn, bErase);
 }
 
 DLLEXPORT WINBOOL WINAPI ValidateRgn (HWND hWnd, HRGN hRgn)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ValidateRgn()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "ValidateRgn()"_lit);
   return IUser32::get_instance()->ValidateRgn(hWnd, hRgn);
 }
 
 DLLEXPORT WINBOOL WINAPI RedrawWindow (HWND hWnd, CONST RECT * lprcUpdate, HRGN hrgnUpdate, UINT flags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "RedrawWindow()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "RedrawWindow()"_lit);
   return IUser32::get_instance()->RedrawWindow(hWnd, lprcUpdate, hrgnUpdate, flags);
 }
 
 DLLEXPORT WINBOOL WINAPI LockWindowUpdate (HWND hWndLock)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "LockWindowUpdate()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "LockWindowUpdate()"_lit);
   return IUser32::get_instance()->LockWindowUpdate(hWndLock);
 }
 
 DLLEXPORT WINBOOL WINAPI ScrollWindow (HWND hWnd, int XAmount, int YAmount, CONST RECT * lpRect, CONST RECT * lpClipRect)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ScrollWindow()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "ScrollWindow()"_lit);
   return IUser32::get_instance()->ScrollWindow(hWnd, XAmount, YAmount, lpRect, lpClipRect);
 }
 
 DLLEXPORT WINBOOL WINAPI ScrollDC (HDC hDC, int dx, int dy, CONST RECT * lprcScroll, CONST RECT * lprcClip, HRGN hrgnUpdate, LPRECT lprcUpdate)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ScrollDC()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "ScrollDC()"_lit);
   return IUser32::get_instance()->ScrollDC(hDC, dx, dy, lprcScroll, lprcClip, hrgnUpdate, lprcUpdate);
 }
 
 DLLEXPORT int WINAPI ScrollWindowEx (HWND hWnd, int dx, int dy, CONST RECT * prcScroll, CONST RECT * prcClip, HRGN hrgnUpdate, LPRECT prcUpdate, UINT flags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ScrollWindowEx()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "ScrollWindowEx()"_lit);
   return IUser32::get_instance()->ScrollWindowEx(hWnd, dx, dy, prcScroll, prcClip, hrgnUpdate, prcUpdate, flags);
 }
 
 DLLEXPORT int WINAPI SetScrollPos (HWND hWnd, int nBar, int nPos, WINBOOL bRedraw)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetScrollPos()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "SetScrollPos()"_lit);
   return IUser32::get_instance()->SetScrollPos(hWnd, nBar, nPos, bRedraw);
 }
 
 DLLEXPORT int WINAPI GetScrollPos (HWND hWnd, int nBar)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetScrollPos()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetScrollPos()"_lit);
   return IUser32::get_instance()->GetScrollPos(hWnd, nBar);
 }
 
 DLLEXPORT WINBOOL WINAPI SetScrollRange (HWND hWnd, int nBar, int nMinPos, int nMaxPos, WINBOOL bRedraw)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetScrollRange()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "SetScrollRange()"_lit);
   return IUser32::get_instance()->SetScrollRange(hWnd, nBar, nMinPos, nMaxPos, bRedraw);
 }
 
 DLLEXPORT WINBOOL WINAPI GetScrollRange (HWND hWnd, int nBar, LPINT lpMinPos, LPINT lpMaxPos)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetScrollRange()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetScrollRange()"_lit);
   return IUser32::get_instance()->GetScrollRange(hWnd, nBar, lpMinPos, lpMaxPos);
 }
 
 DLLEXPORT WINBOOL WINAPI ShowScrollBar (HWND hWnd, int wBar, WINBOOL bShow)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ShowScrollBar()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "ShowScrollBar()"_lit);
   return IUser32::get_instance()->ShowScrollBar(hWnd, wBar, bShow);
 }
 
 DLLEXPORT WINBOOL WINAPI EnableScrollBar (HWND hWnd, UINT wSBflags, UINT wArrows)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "EnableScrollBar()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "EnableScrollBar()"_lit);
   return IUser32::get_instance()->EnableScrollBar(hWnd, wSBflags, wArrows);
 }
 
 DLLEXPORT WINBOOL WINAPI SetPropA (HWND hWnd, LPCSTR lpString, HANDLE hData)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetPropA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "SetPropA()"_lit);
   return IUser32::get_instance()->SetPropA(hWnd, lpString, hData);
 }
 
 DLLEXPORT WINBOOL WINAPI SetPropW (HWND hWnd, LPCWSTR lpString, HANDLE hData)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetPropW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "SetPropW()"_lit);
   return IUser32::get_instance()->SetPropW(hWnd, lpString, hData);
 }
 
 DLLEXPORT HANDLE WINAPI GetPropA (HWND hWnd, LPCSTR lpString)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetPropA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetPropA()"_lit);
   return IUser32::get_instance()->GetPropA(hWnd, lpString);
 }
 
 DLLEXPORT HANDLE WINAPI GetPropW (HWND hWnd, LPCWSTR lpString)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetPropW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetPropW()"_lit);
   return IUser32::get_instance()->GetPropW(hWnd, lpString);
 }
 
 DLLEXPORT HANDLE WINAPI RemovePropA (HWND hWnd, LPCSTR lpString)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "RemovePropA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "RemovePropA()"_lit);
   return IUser32::get_instance()->RemovePropA(hWnd, lpString);
 }
 
 DLLEXPORT HANDLE WINAPI RemovePropW (HWND hWnd, LPCWSTR lpString)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "RemovePropW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "RemovePropW()"_lit);
   return IUser32::get_instance()->RemovePropW(hWnd, lpString);
 }
 
 DLLEXPORT int WINAPI EnumPropsExA (HWND hWnd, PROPENUMPROCEXA lpEnumFunc, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "EnumPropsExA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "EnumPropsExA()"_lit);
   return IUser32::get_instance()->EnumPropsExA(hWnd, lpEnumFunc, lParam);
 }
 
 DLLEXPORT int WINAPI EnumPropsExW (HWND hWnd, PROPENUMPROCEXW lpEnumFunc, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "EnumPropsExW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "EnumPropsExW()"_lit);
   return IUser32::get_instance()->EnumPropsExW(hWnd, lpEnumFunc, lParam);
 }
 
 DLLEXPORT int WINAPI EnumPropsA (HWND hWnd, PROPENUMPROCA lpEnumFunc)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "EnumPropsA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "EnumPropsA()"_lit);
   return IUser32::get_instance()->EnumPropsA(hWnd, lpEnumFunc);
 }
 
 DLLEXPORT int WINAPI EnumPropsW (HWND hWnd, PROPENUMPROCW lpEnumFunc)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "EnumPropsW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "EnumPropsW()"_lit);
   return IUser32::get_instance()->EnumPropsW(hWnd, lpEnumFunc);
 }
 
 DLLEXPORT WINBOOL WINAPI SetWindowTextA (HWND hWnd, LPCSTR lpString)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetWindowTextA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "SetWindowTextA()"_lit);
   return IUser32::get_instance()->SetWindowTextA(hWnd, lpString);
 }
 
 DLLEXPORT WINBOOL WINAPI SetWindowTextW (HWND hWnd, LPCWSTR lpString)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetWindowTextW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "SetWindowTextW()"_lit);
   return IUser32::get_instance()->SetWindowTextW(hWnd, lpString);
 }
 
 DLLEXPORT int WINAPI GetWindowTextA (HWND hWnd, LPSTR lpString, int nMaxCount)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetWindowTextA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetWindowTextA()"_lit);
   return IUser32::get_instance()->GetWindowTextA(hWnd, lpString, nMaxCount);
 }
 
 DLLEXPORT int WINAPI GetWindowTextW (HWND hWnd, LPWSTR lpString, int nMaxCount)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetWindowTextW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetWindowTextW()"_lit);
   return IUser32::get_instance()->GetWindowTextW(hWnd, lpString, nMaxCount);
 }
 
 DLLEXPORT int WINAPI GetWindowTextLengthA (HWND hWnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetWindowTextLengthA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetWindowTextLengthA()"_lit);
   return IUser32::get_instance()->GetWindowTextLengthA(hWnd);
 }
 
 DLLEXPORT int WINAPI GetWindowTextLengthW (HWND hWnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetWindowTextLengthW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetWindowTextLengthW()"_lit);
   return IUser32::get_instance()->GetWindowTextLengthW(hWnd);
 }
 
 DLLEXPORT WINBOOL WINAPI GetClientRect (HWND hWnd, LPRECT lpRect)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetClientRect()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetClientRect()"_lit);
   return IUser32::get_instance()->GetClientRect(hWnd, lpRect);
 }
 
 DLLEXPORT WINBOOL WINAPI GetWindowRect (HWND hWnd, LPRECT lpRect)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetWindowRect()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetWindowRect()"_lit);
   return IUser32::get_instance()->GetWindowRect(hWnd, lpRect);
 }
 
 DLLEXPORT WINBOOL WINAPI AdjustWindowRect (LPRECT lpRect, DWORD dwStyle, WINBOOL bMenu)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "AdjustWindowRect()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "AdjustWindowRect()"_lit);
   return IUser32::get_instance()->AdjustWindowRect(lpRect, dwStyle, bMenu);
 }
 
 DLLEXPORT WINBOOL WINAPI AdjustWindowRectEx (LPRECT lpRect, DWORD dwStyle, WINBOOL bMenu, DWORD dwExStyle)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "AdjustWindowRectEx()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "AdjustWindowRectEx()"_lit);
   return IUser32::get_instance()->AdjustWindowRectEx(lpRect, dwStyle, bMenu, dwExStyle);
 }
 
 DLLEXPORT WINBOOL WINAPI SetWindowContextHelpId (HWND arg0, DWORD arg1)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetWindowContextHelpId()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "SetWindowContextHelpId()"_lit);
   return IUser32::get_instance()->SetWindowContextHelpId(arg0, arg1);
 }
 
 DLLEXPORT DWORD WINAPI GetWindowContextHelpId (HWND arg0)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetWindowContextHelpId()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetWindowContextHelpId()"_lit);
   return IUser32::get_instance()->GetWindowContextHelpId(arg0);
 }
 
 DLLEXPORT WINBOOL WINAPI SetMenuContextHelpId (HMENU arg0, DWORD arg1)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetMenuContextHelpId()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "SetMenuContextHelpId()"_lit);
   return IUser32::get_instance()->SetMenuContextHelpId(arg0, arg1);
 }
 
 DLLEXPORT DWORD WINAPI GetMenuContextHelpId (HMENU arg0)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetMenuContextHelpId()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetMenuContextHelpId()"_lit);
   return IUser32::get_instance()->GetMenuContextHelpId(arg0);
 }
 
 DLLEXPORT int WINAPI MessageBoxA (HWND hWnd, LPCSTR lpText, LPCSTR lpCaption, UINT uType)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "MessageBoxA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "MessageBoxA()"_lit);
   return IUser32::get_instance()->MessageBoxA(hWnd, lpText, lpCaption, uType);
 }
 
 DLLEXPORT int WINAPI MessageBoxW (HWND hWnd, LPCWSTR lpText, LPCWSTR lpCaption, UINT uType)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "MessageBoxW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "MessageBoxW()"_lit);
   return IUser32::get_instance()->MessageBoxW(hWnd, lpText, lpCaption, uType);
 }
 
 DLLEXPORT int WINAPI MessageBoxExA (HWND hWnd, LPCSTR lpText, LPCSTR lpCaption, UINT uType, WORD wLanguageId)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "MessageBoxExA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "MessageBoxExA()"_lit);
   return IUser32::get_instance()->MessageBoxExA(hWnd, lpText, lpCaption, uType, wLanguageId);
 }
 
 DLLEXPORT int WINAPI MessageBoxExW (HWND hWnd, LPCWSTR lpText, LPCWSTR lpCaption, UINT uType, WORD wLanguageId)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "MessageBoxExW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "MessageBoxExW()"_lit);
   return IUser32::get_instance()->MessageBoxExW(hWnd, lpText, lpCaption, uType, wLanguageId);
 }
 
 DLLEXPORT int WINAPI MessageBoxIndirectA (CONST MSGBOXPARAMSA * lpmbp)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "MessageBoxIndirectA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "MessageBoxIndirectA()"_lit);
   return IUser32::get_instance()->MessageBoxIndirectA(lpmbp);
 }
 
 DLLEXPORT int WINAPI MessageBoxIndirectW (CONST MSGBOXPARAMSW * lpmbp)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "MessageBoxIndirectW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "MessageBoxIndirectW()"_lit);
   return IUser32::get_instance()->MessageBoxIndirectW(lpmbp);
 }
 
 DLLEXPORT WINBOOL WINAPI MessageBeep (UINT uType)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "MessageBeep()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "MessageBeep()"_lit);
   return IUser32::get_instance()->MessageBeep(uType);
 }
 
 DLLEXPORT int WINAPI ShowCursor (WINBOOL bShow)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ShowCursor()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "ShowCursor()"_lit);
   return IUser32::get_instance()->ShowCursor(bShow);
 }
 
 DLLEXPORT WINBOOL WINAPI SetCursorPos (int X, int Y)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetCursorPos()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "SetCursorPos()"_lit);
   return IUser32::get_instance()->SetCursorPos(X, Y);
 }
 
 DLLEXPORT HCURSOR WINAPI SetCursor (HCURSOR hCursor)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetCursor()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "SetCursor()"_lit);
   return IUser32::get_instance()->SetCursor(hCursor);
 }
 
 DLLEXPORT WINBOOL WINAPI GetCursorPos (LPPOINT lpPoint)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetCursorPos()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "GetCursorPos()"_lit);
   return IUser32::get_instance()->GetCursorPos(lpPoint);
 }
 
 DLLEXPORT WINBOOL WINAPI ClipCursor (CONST RECT * lpRect)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ClipCursor()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "ClipCursor()"_lit);
   return IUser32::get_instance()->ClipCursor(lpRect);
 }
 
 DLLEXPORT WINBOOL WINAPI GetClipCursor (LPRECT lpRect)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetClipCursor()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "GetClipCursor()"_lit);
   return IUser32::get_instance()->GetClipCursor(lpRect);
 }
 
 DLLEXPORT HCURSOR WINAPI GetCursor (VOID)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetCursor()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "GetCursor()"_lit);
   return IUser32::get_instance()->GetCursor();
 }
 
 DLLEXPORT WINBOOL WINAPI CreateCaret (HWND hWnd, HBITMAP hBitmap, int nWidth, int nHeight)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CreateCaret()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "CreateCaret()"_lit);
   return IUser32::get_instance()->CreateCaret(hWnd, hBitmap, nWidth, nHeight);
 }
 
 DLLEXPORT UINT WINAPI GetCaretBlinkTime (VOID)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetCaretBlinkTime()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetCaretBlinkTime()"_lit);
   return IUser32::get_instance()->GetCaretBlinkTime();
 }
 
 DLLEXPORT WINBOOL WINAPI SetCaretBlinkTime (UINT uMSeconds)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetCaretBlinkTime()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "SetCaretBlinkTime()"_lit);
   return IUser32::get_instance()->SetCaretBlinkTime(uMSeconds);
 }
 
 DLLEXPORT WINBOOL WINAPI DestroyCaret (VOID)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DestroyCaret()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "DestroyCaret()"_lit);
   return IUser32::get_instance()->DestroyCaret();
 }
 
 DLLEXPORT WINBOOL WINAPI HideCaret (HWND hWnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "HideCaret()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "HideCaret()"_lit);
   return IUser32::get_instance()->HideCaret(hWnd);
 }
 
 DLLEXPORT WINBOOL WINAPI ShowCaret (HWND hWnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ShowCaret()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "ShowCaret()"_lit);
   return IUser32::get_instance()->ShowCaret(hWnd);
 }
 
 DLLEXPORT WINBOOL WINAPI SetCaretPos (int X, int Y)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetCaretPos()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "SetCaretPos()"_lit);
   return IUser32::get_instance()->SetCaretPos(X, Y);
 }
 
 DLLEXPORT WINBOOL WINAPI GetCaretPos (LPPOINT lpPoint)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetCaretPos()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetCaretPos()"_lit);
   return IUser32::get_instance()->GetCaretPos(lpPoint);
 }
 
 DLLEXPORT WINBOOL WINAPI ClientToScreen (HWND hWnd, LPPOINT lpPoint)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ClientToScreen()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "ClientToScreen()"_lit);
   return IUser32::get_instance()->ClientToScreen(hWnd, lpPoint);
 }
 
 DLLEXPORT WINBOOL WINAPI ScreenToClient (HWND hWnd, LPPOINT lpPoint)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ScreenToClient()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "ScreenToClient()"_lit);
   return IUser32::get_instance()->ScreenToClient(hWnd, lpPoint);
 }
 
 DLLEXPORT int WINAPI MapWindowPoints (HWND hWndFrom, HWND hWndTo, LPPOINT lpPoints, UINT cPoints)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "MapWindowPoints()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "MapWindowPoints()"_lit);
   return IUser32::get_instance()->MapWindowPoints(hWndFrom, hWndTo, lpPoints, cPoints);
 }
 
 DLLEXPORT HWND WINAPI WindowFromPoint (POINT Point)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "WindowFromPoint()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "WindowFromPoint()"_lit);
   return IUser32::get_instance()->WindowFromPoint(Point);
 }
 
 DLLEXPORT HWND WINAPI ChildWindowFromPoint (HWND hWndParent, POINT Point)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ChildWindowFromPoint()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "ChildWindowFromPoint()"_lit);
   return IUser32::get_instance()->ChildWindowFromPoint(hWndParent, Point);
 }
 
 DLLEXPORT HWND WINAPI ChildWindowFromPointEx (HWND hwnd, POINT pt, UINT flags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ChildWindowFromPointEx()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "ChildWindowFromPointEx()"_lit);
   return IUser32::get_instance()->ChildWindowFromPointEx(hwnd, pt, flags);
 }
 
 DLLEXPORT WINBOOL WINAPI SetPhysicalCursorPos (int X, int Y)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetPhysicalCursorPos()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "SetPhysicalCursorPos()"_lit);
   return IUser32::get_instance()->SetPhysicalCursorPos(X, Y);
 }
 
 DLLEXPORT WINBOOL WINAPI GetPhysicalCursorPos (LPPOINT lpPoint)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetPhysicalCursorPos()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "GetPhysicalCursorPos()"_lit);
   return IUser32::get_instance()->GetPhysicalCursorPos(lpPoint);
 }
 
 DLLEXPORT WINBOOL WINAPI LogicalToPhysicalPoint (HWND hWnd, LPPOINT lpPoint)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "LogicalToPhysicalPoint()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "LogicalToPhysicalPoint()"_lit);
   return IUser32::get_instance()->LogicalToPhysicalPoint(hWnd, lpPoint);
 }
 
 DLLEXPORT WINBOOL WINAPI PhysicalToLogicalPoint (HWND hWnd, LPPOINT lpPoint)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "PhysicalToLogicalPoint()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "PhysicalToLogicalPoint()"_lit);
   return IUser32::get_instance()->PhysicalToLogicalPoint(hWnd, lpPoint);
 }
 
 DLLEXPORT HWND WINAPI WindowFromPhysicalPoint (POINT Point)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "WindowFromPhysicalPoint()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "WindowFromPhysicalPoint()"_lit);
   return IUser32::get_instance()->WindowFromPhysicalPoint(Point);
 }
 
 DLLEXPORT DWORD WINAPI GetSysColor (int nIndex)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetSysColor()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetSysColor()"_lit);
   return IUser32::get_instance()->GetSysColor(nIndex);
 }
 
 DLLEXPORT HBRUSH WINAPI GetSysColorBrush (int nIndex)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetSysColorBrush()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetSysColorBrush()"_lit);
   return IUser32::get_instance()->GetSysColorBrush(nIndex);
 }
 
 DLLEXPORT WINBOOL WINAPI SetSysColors (int cElements, CONST INT * lpaElements, CONST COLORREF * lpaRgbValues)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetSysColors()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "SetSysColors()"_lit);
   return IUser32::get_instance()->SetSysColors(cElements, lpaElements, lpaRgbValues);
 }
 
 DLLEXPORT WINBOOL WINAPI DrawFocusRect (HDC hDC, CONST RECT * lprc)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DrawFocusRect()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "DrawFocusRect()"_lit);
   return IUser32::get_instance()->DrawFocusRect(hDC, lprc);
 }
 
 DLLEXPORT int WINAPI FillRect (HDC hDC, CONST RECT * lprc, HBRUSH hbr)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "FillRect()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "FillRect()"_lit);
   return IUser32::get_instance()->FillRect(hDC, lprc, hbr);
 }
 
 DLLEXPORT int WINAPI FrameRect (HDC hDC, CONST RECT * lprc, HBRUSH hbr)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "FrameRect()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "FrameRect()"_lit);
   return IUser32::get_instance()->FrameRect(hDC, lprc, hbr);
 }
 
 DLLEXPORT WINBOOL WINAPI InvertRect (HDC hDC, CONST RECT * lprc)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "InvertRect()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "InvertRect()"_lit);
   return IUser32::get_instance()->InvertRect(hDC, lprc);
 }
 
 DLLEXPORT WINBOOL WINAPI SetRect (LPRECT lprc, int xLeft, int yTop, int xRight, int yBottom)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetRect()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "SetRect()"_lit);
   return IUser32::get_instance()->SetRect(lprc, xLeft, yTop, xRight, yBottom);
 }
 
 DLLEXPORT WINBOOL WINAPI SetRectEmpty (LPRECT lprc)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetRectEmpty()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "SetRectEmpty()"_lit);
   return IUser32::get_instance()->SetRectEmpty(lprc);
 }
 
 DLLEXPORT WINBOOL WINAPI CopyRect (LPRECT lprcDst, CONST RECT * lprcSrc)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CopyRect()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "CopyRect()"_lit);
   return IUser32::get_instance()->CopyRect(lprcDst, lprcSrc);
 }
 
 DLLEXPORT WINBOOL WINAPI InflateRect (LPRECT lprc, int dx, int dy)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "InflateRect()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "InflateRect()"_lit);
   return IUser32::get_instance()->InflateRect(lprc, dx, dy);
 }
 
 DLLEXPORT WINBOOL WINAPI IntersectRect (LPRECT lprcDst, CONST RECT * lprcSrc1, CONST RECT * lprcSrc2)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "IntersectRect()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "IntersectRect()"_lit);
   return IUser32::get_instance()->IntersectRect(lprcDst, lprcSrc1, lprcSrc2);
 }
 
 DLLEXPORT WINBOOL WINAPI UnionRect (LPRECT lprcDst, CONST RECT * lprcSrc1, CONST RECT * lprcSrc2)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "UnionRect()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "UnionRect()"_lit);
   return IUser32::get_instance()->UnionRect(lprcDst, lprcSrc1, lprcSrc2);
 }
 
 DLLEXPORT WINBOOL WINAPI SubtractRect (LPRECT lprcDst, CONST RECT * lprcSrc1, CONST RECT * lprcSrc2)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SubtractRect()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "SubtractRect()"_lit);
   return IUser32::get_instance()->SubtractRect(lprcDst, lprcSrc1, lprcSrc2);
 }
 
 DLLEXPORT WINBOOL WINAPI OffsetRect (LPRECT lprc, int dx, int dy)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "OffsetRect()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "OffsetRect()"_lit);
   return IUser32::get_instance()->OffsetRect(lprc, dx, dy);
 }
 
 DLLEXPORT WINBOOL WINAPI IsRectEmpty (CONST RECT * lprc)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "IsRectEmpty()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "IsRectEmpty()"_lit);
   return IUser32::get_instance()->IsRectEmpty(lprc);
 }
 
 DLLEXPORT WINBOOL WINAPI EqualRect (CONST RECT * lprc1, CONST RECT * lprc2)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "EqualRect()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "EqualRect()"_lit);
   return IUser32::get_instance()->EqualRect(lprc1, lprc2);
 }
 
 DLLEXPORT WINBOOL WINAPI PtInRect (CONST RECT * lprc, POINT pt)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "PtInRect()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "PtInRect()"_lit);
   return IUser32::get_instance()->PtInRect(lprc, pt);
 }
 
 DLLEXPORT WORD WINAPI GetWindowWord (HWND hWnd, int nIndex)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetWindowWord()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetWindowWord()"_lit);
   return IUser32::get_instance()->GetWindowWord(hWnd, nIndex);
 }
 
 DLLEXPORT WORD WINAPI SetWindowWord (HWND hWnd, int nIndex, WORD wNewWord)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetWindowWord()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "SetWindowWord()"_lit);
   return IUser32::get_instance()->SetWindowWord(hWnd, nIndex, wNewWord);
 }
 
 DLLEXPORT LONG WINAPI GetWindowLongA (HWND hWnd, int nIndex)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetWindowLongA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetWindowLongA()"_lit);
   return IUser32::get_instance()->GetWindowLongA(hWnd, nIndex);
 }
 
 DLLEXPORT LONG WINAPI GetWindowLongW (HWND hWnd, int nIndex)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetWindowLongW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetWindowLongW()"_lit);
   return IUser32::get_instance()->GetWindowLongW(hWnd, nIndex);
 }
 
 DLLEXPORT LONG WINAPI SetWindowLongA (HWND hWnd, int nIndex, LONG dwNewLong)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetWindowLongA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "SetWindowLongA()"_lit);
   return IUser32::get_instance()->SetWindowLongA(hWnd, nIndex, dwNewLong);
 }
 
 DLLEXPORT LONG WINAPI SetWindowLongW (HWND hWnd, int nIndex, LONG dwNewLong)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetWindowLongW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "SetWindowLongW()"_lit);
   return IUser32::get_instance()->SetWindowLongW(hWnd, nIndex, dwNewLong);
 }
 
 DLLEXPORT LONG_PTR WINAPI GetWindowLongPtrA (HWND hWnd, int nIndex)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetWindowLongPtrA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetWindowLongPtrA()"_lit);
   return IUser32::get_instance()->GetWindowLongPtrA(hWnd, nIndex);
 }
 
 DLLEXPORT LONG_PTR WINAPI GetWindowLongPtrW (HWND hWnd, int nIndex)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetWindowLongPtrW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetWindowLongPtrW()"_lit);
   return IUser32::get_instance()->GetWindowLongPtrW(hWnd, nIndex);
 }
 
 DLLEXPORT LONG_PTR WINAPI SetWindowLongPtrA (HWND hWnd, int nIndex, LONG_PTR dwNewLong)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetWindowLongPtrA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "SetWindowLongPtrA()"_lit);
   return IUser32::get_instance()->SetWindowLongPtrA(hWnd, nIndex, dwNewLong);
 }
 
 DLLEXPORT LONG_PTR WINAPI SetWindowLongPtrW (HWND hWnd, int nIndex, LONG_PTR dwNewLong)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetWindowLongPtrW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "SetWindowLongPtrW()"_lit);
   return IUser32::get_instance()->SetWindowLongPtrW(hWnd, nIndex, dwNewLong);
 }
 
 DLLEXPORT WORD WINAPI GetClassWord (HWND hWnd, int nIndex)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetClassWord()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetClassWord()"_lit);
   return IUser32::get_instance()->GetClassWord(hWnd, nIndex);
 }
 
 DLLEXPORT WORD WINAPI SetClassWord (HWND hWnd, int nIndex, WORD wNewWord)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetClassWord()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "SetClassWord()"_lit);
   return IUser32::get_instance()->SetClassWord(hWnd, nIndex, wNewWord);
 }
 
 DLLEXPORT DWORD WINAPI GetClassLongA (HWND hWnd, int nIndex)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetClassLongA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetClassLongA()"_lit);
   return IUser32::get_instance()->GetClassLongA(hWnd, nIndex);
 }
 
 DLLEXPORT DWORD WINAPI GetClassLongW (HWND hWnd, int nIndex)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetClassLongW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetClassLongW()"_lit);
   return IUser32::get_instance()->GetClassLongW(hWnd, nIndex);
 }
 
 DLLEXPORT DWORD WINAPI SetClassLongA (HWND hWnd, int nIndex, LONG dwNewLong)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetClassLongA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "SetClassLongA()"_lit);
   return IUser32::get_instance()->SetClassLongA(hWnd, nIndex, dwNewLong);
 }
 
 DLLEXPORT DWORD WINAPI SetClassLongW (HWND hWnd, int nIndex, LONG dwNewLong)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetClassLongW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "SetClassLongW()"_lit);
   return IUser32::get_instance()->SetClassLongW(hWnd, nIndex, dwNewLong);
 }
 
 DLLEXPORT ULONG_PTR WINAPI GetClassLongPtrA (HWND hWnd, int nIndex)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetClassLongPtrA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetClassLongPtrA()"_lit);
   return IUser32::get_instance()->GetClassLongPtrA(hWnd, nIndex);
 }
 
 DLLEXPORT ULONG_PTR WINAPI GetClassLongPtrW (HWND hWnd, int nIndex)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetClassLongPtrW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetClassLongPtrW()"_lit);
   return IUser32::get_instance()->GetClassLongPtrW(hWnd, nIndex);
 }
 
 DLLEXPORT ULONG_PTR WINAPI SetClassLongPtrA (HWND hWnd, int nIndex, LONG_PTR dwNewLong)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetClassLongPtrA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "SetClassLongPtrA()"_lit);
   return IUser32::get_instance()->SetClassLongPtrA(hWnd, nIndex, dwNewLong);
 }
 
 DLLEXPORT ULONG_PTR WINAPI SetClassLongPtrW (HWND hWnd, int nIndex, LONG_PTR dwNewLong)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetClassLongPtrW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "SetClassLongPtrW()"_lit);
   return IUser32::get_instance()->SetClassLongPtrW(hWnd, nIndex, dwNewLong);
 }
 
 DLLEXPORT WINBOOL WINAPI GetProcessDefaultLayout (DWORD * pdwDefaultLayout)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetProcessDefaultLayout()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetProcessDefaultLayout()"_lit);
   return IUser32::get_instance()->GetProcessDefaultLayout(pdwDefaultLayout);
 }
 
 DLLEXPORT WINBOOL WINAPI SetProcessDefaultLayout (DWORD dwDefaultLayout)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetProcessDefaultLayout()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "SetProcessDefaultLayout()"_lit);
   return IUser32::get_instance()->SetProcessDefaultLayout(dwDefaultLayout);
 }
 
 DLLEXPORT HWND WINAPI GetDesktopWindow (VOID)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetDesktopWindow()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetDesktopWindow()"_lit);
   return IUser32::get_instance()->GetDesktopWindow();
 }
 
 DLLEXPORT HWND WINAPI GetParent (HWND hWnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetParent()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetParent()"_lit);
   return IUser32::get_instance()->GetParent(hWnd);
 }
 
 DLLEXPORT HWND WINAPI SetParent (HWND hWndChild, HWND hWndNewParent)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetParent()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "SetParent()"_lit);
   return IUser32::get_instance()->SetParent(hWndChild, hWndNewParent);
 }
 
 DLLEXPORT WINBOOL WINAPI EnumChildWindows (HWND hWndParent, WNDENUMPROC lpEnumFunc, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "EnumChildWindows()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "EnumChildWindows()"_lit);
   return IUser32::get_instance()->EnumChildWindows(hWndParent, lpEnumFunc, lParam);
 }
 
 DLLEXPORT HWND WINAPI FindWindowA (LPCSTR lpClassName, LPCSTR lpWindowName)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "FindWindowA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "FindWindowA()"_lit);
   return IUser32::get_instance()->FindWindowA(lpClassName, lpWindowName);
 }
 
 DLLEXPORT HWND WINAPI FindWindowW (LPCWSTR lpClassName, LPCWSTR lpWindowName)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "FindWindowW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "FindWindowW()"_lit);
   return IUser32::get_instance()->FindWindowW(lpClassName, lpWindowName);
 }
 
 DLLEXPORT HWND WINAPI FindWindowExA (HWND hWndParent, HWND hWndChildAfter, LPCSTR lpszClass, LPCSTR lpszWindow)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "FindWindowExA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "FindWindowExA()"_lit);
   return IUser32::get_instance()->FindWindowExA(hWndParent, hWndChildAfter, lpszClass, lpszWindow);
 }
 
 DLLEXPORT HWND WINAPI FindWindowExW (HWND hWndParent, HWND hWndChildAfter, LPCWSTR lpszClass, LPCWSTR lpszWindow)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "FindWindowExW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "FindWindowExW()"_lit);
   return IUser32::get_instance()->FindWindowExW(hWndParent, hWndChildAfter, lpszClass, lpszWindow);
 }
 
 DLLEXPORT HWND WINAPI GetShellWindow (VOID)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetShellWindow()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetShellWindow()"_lit);
   return IUser32::get_instance()->GetShellWindow();
 }
 
 DLLEXPORT WINBOOL WINAPI RegisterShellHookWindow (HWND hwnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "RegisterShellHookWindow()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "RegisterShellHookWindow()"_lit);
   return IUser32::get_instance()->RegisterShellHookWindow(hwnd);
 }
 
 DLLEXPORT WINBOOL WINAPI DeregisterShellHookWindow (HWND hwnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DeregisterShellHookWindow()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "DeregisterShellHookWindow()"_lit);
   return IUser32::get_instance()->DeregisterShellHookWindow(hwnd);
 }
 
 DLLEXPORT WINBOOL WINAPI EnumWindows (WNDENUMPROC lpEnumFunc, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "EnumWindows()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "EnumWindows()"_lit);
   return IUser32::get_instance()->EnumWindows(lpEnumFunc, lParam);
 }
 
 DLLEXPORT WINBOOL WINAPI EnumThreadWindows (DWORD dwThreadId, WNDENUMPROC lpfn, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "EnumThreadWindows()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "EnumThreadWindows()"_lit);
   return IUser32::get_instance()->EnumThreadWindows(dwThreadId, lpfn, lParam);
 }
 
 DLLEXPORT int WINAPI GetClassNameA (HWND hWnd, LPSTR lpClassName, int nMaxCount)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetClassNameA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetClassNameA()"_lit);
   return IUser32::get_instance()->GetClassNameA(hWnd, lpClassName, nMaxCount);
 }
 
 DLLEXPORT int WINAPI GetClassNameW (HWND hWnd, LPWSTR lpClassName, int nMaxCount)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetClassNameW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetClassNameW()"_lit);
   return IUser32::get_instance()->GetClassNameW(hWnd, lpClassName, nMaxCount);
 }
 
 DLLEXPORT HWND WINAPI GetTopWindow (HWND hWnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetTopWindow()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetTopWindow()"_lit);
   return IUser32::get_instance()->GetTopWindow(hWnd);
 }
 
 DLLEXPORT DWORD WINAPI GetWindowThreadProcessId (HWND hWnd, LPDWORD lpdwProcessId)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetWindowThreadProcessId()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetWindowThreadProcessId()"_lit);
   return IUser32::get_instance()->GetWindowThreadProcessId(hWnd, lpdwProcessId);
 }
 
 DLLEXPORT WINBOOL WINAPI IsGUIThread (WINBOOL bConvert)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "IsGUIThread()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "IsGUIThread()"_lit);
   return IUser32::get_instance()->IsGUIThread(bConvert);
 }
 
 DLLEXPORT HWND WINAPI GetLastActivePopup (HWND hWnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetLastActivePopup()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetLastActivePopup()"_lit);
   return IUser32::get_instance()->GetLastActivePopup(hWnd);
 }
 
 DLLEXPORT HWND WINAPI GetWindow (HWND hWnd, UINT uCmd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetWindow()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetWindow()"_lit);
   return IUser32::get_instance()->GetWindow(hWnd, uCmd);
 }
 
@@ -3283,13 +3294,13 @@ DLLEXPORT HWND WINAPI GetWindow (HWND hWnd, UINT uCmd)
 
 DLLEXPORT HHOOK WINAPI SetWindowsHookA (int nFilterType, HOOKPROC pfnFilterProc)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetWindowsHookA()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "SetWindowsHookA()"_lit);
   return IUser32::get_instance()->SetWindowsHookA(nFilterType, pfnFilterProc);
 }
 
 DLLEXPORT HHOOK WINAPI SetWindowsHookW (int nFilterType, HOOKPROC pfnFilterProc)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetWindowsHookW()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "SetWindowsHookW()"_lit);
   return IUser32::get_instance()->SetWindowsHookW(nFilterType, pfnFilterProc);
 }
 
@@ -3297,13 +3308,13 @@ DLLEXPORT HHOOK WINAPI SetWindowsHookW (int nFilterType, HOOKPROC pfnFilterProc)
 
 DLLEXPORT HOOKPROC WINAPI SetWindowsHookA (int nFilterType, HOOKPROC pfnFilterProc)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetWindowsHookA()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "SetWindowsHookA()"_lit);
   return IUser32::get_instance()->SetWindowsHookA(nFilterType, pfnFilterProc);
 }
 
 DLLEXPORT HOOKPROC WINAPI SetWindowsHookW (int nFilterType, HOOKPROC pfnFilterProc)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetWindowsHookW()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "SetWindowsHookW()"_lit);
   return IUser32::get_instance()->SetWindowsHookW(nFilterType, pfnFilterProc);
 }
 
@@ -3311,1623 +3322,1623 @@ DLLEXPORT HOOKPROC WINAPI SetWindowsHookW (int nFilterType, HOOKPROC pfnFilterPr
 
 DLLEXPORT WINBOOL WINAPI UnhookWindowsHook (int nCode, HOOKPROC pfnFilterProc)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "UnhookWindowsHook()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "UnhookWindowsHook()"_lit);
   return IUser32::get_instance()->UnhookWindowsHook(nCode, pfnFilterProc);
 }
 
 DLLEXPORT HHOOK WINAPI SetWindowsHookExA (int idHook, HOOKPROC lpfn, HINSTANCE hmod, DWORD dwThreadId)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetWindowsHookExA()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "SetWindowsHookExA()"_lit);
   return IUser32::get_instance()->SetWindowsHookExA(idHook, lpfn, hmod, dwThreadId);
 }
 
 DLLEXPORT HHOOK WINAPI SetWindowsHookExW (int idHook, HOOKPROC lpfn, HINSTANCE hmod, DWORD dwThreadId)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetWindowsHookExW()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "SetWindowsHookExW()"_lit);
   return IUser32::get_instance()->SetWindowsHookExW(idHook, lpfn, hmod, dwThreadId);
 }
 
 DLLEXPORT WINBOOL WINAPI UnhookWindowsHookEx (HHOOK hhk)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "UnhookWindowsHookEx()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "UnhookWindowsHookEx()"_lit);
   return IUser32::get_instance()->UnhookWindowsHookEx(hhk);
 }
 
 DLLEXPORT LRESULT WINAPI CallNextHookEx (HHOOK hhk, int nCode, WPARAM wParam, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CallNextHookEx()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "CallNextHookEx()"_lit);
   return IUser32::get_instance()->CallNextHookEx(hhk, nCode, wParam, lParam);
 }
 
 DLLEXPORT WINBOOL WINAPI CheckMenuRadioItem (HMENU hmenu, UINT first, UINT last, UINT check, UINT flags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CheckMenuRadioItem()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "CheckMenuRadioItem()"_lit);
   return IUser32::get_instance()->CheckMenuRadioItem(hmenu, first, last, check, flags);
 }
 
 DLLEXPORT HBITMAP WINAPI LoadBitmapA (HINSTANCE hInstance, LPCSTR lpBitmapName)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "LoadBitmapA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "LoadBitmapA()"_lit);
   return IUser32::get_instance()->LoadBitmapA(hInstance, lpBitmapName);
 }
 
 DLLEXPORT HBITMAP WINAPI LoadBitmapW (HINSTANCE hInstance, LPCWSTR lpBitmapName)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "LoadBitmapW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "LoadBitmapW()"_lit);
   return IUser32::get_instance()->LoadBitmapW(hInstance, lpBitmapName);
 }
 
 DLLEXPORT HCURSOR WINAPI LoadCursorA (HINSTANCE hInstance, LPCSTR lpCursorName)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "LoadCursorA()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "LoadCursorA()"_lit);
   return IUser32::get_instance()->LoadCursorA(hInstance, lpCursorName);
 }
 
 DLLEXPORT HCURSOR WINAPI LoadCursorW (HINSTANCE hInstance, LPCWSTR lpCursorName)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "LoadCursorW()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "LoadCursorW()"_lit);
   return IUser32::get_instance()->LoadCursorW(hInstance, lpCursorName);
 }
 
 DLLEXPORT HCURSOR WINAPI LoadCursorFromFileA (LPCSTR lpFileName)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "LoadCursorFromFileA()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "LoadCursorFromFileA()"_lit);
   return IUser32::get_instance()->LoadCursorFromFileA(lpFileName);
 }
 
 DLLEXPORT HCURSOR WINAPI LoadCursorFromFileW (LPCWSTR lpFileName)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "LoadCursorFromFileW()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "LoadCursorFromFileW()"_lit);
   return IUser32::get_instance()->LoadCursorFromFileW(lpFileName);
 }
 
 DLLEXPORT HCURSOR WINAPI CreateCursor (HINSTANCE hInst, int xHotSpot, int yHotSpot, int nWidth, int nHeight, CONST VOID * pvANDPlane, CONST VOID * pvXORPlane)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CreateCursor()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "CreateCursor()"_lit);
   return IUser32::get_instance()->CreateCursor(hInst, xHotSpot, yHotSpot, nWidth, nHeight, pvANDPlane, pvXORPlane);
 }
 
 DLLEXPORT WINBOOL WINAPI DestroyCursor (HCURSOR hCursor)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DestroyCursor()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "DestroyCursor()"_lit);
   return IUser32::get_instance()->DestroyCursor(hCursor);
 }
 
 DLLEXPORT WINBOOL WINAPI SetSystemCursor (HCURSOR hcur, DWORD id)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetSystemCursor()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "SetSystemCursor()"_lit);
   return IUser32::get_instance()->SetSystemCursor(hcur, id);
 }
 
 DLLEXPORT HICON WINAPI LoadIconA (HINSTANCE hInstance, LPCSTR lpIconName)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "LoadIconA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "LoadIconA()"_lit);
   return IUser32::get_instance()->LoadIconA(hInstance, lpIconName);
 }
 
 DLLEXPORT HICON WINAPI LoadIconW (HINSTANCE hInstance, LPCWSTR lpIconName)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "LoadIconW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "LoadIconW()"_lit);
   return IUser32::get_instance()->LoadIconW(hInstance, lpIconName);
 }
 
 DLLEXPORT UINT WINAPI PrivateExtractIconsA (LPCSTR szFileName, int nIconIndex, int cxIcon, int cyIcon, HICON * phicon, UINT * piconid, UINT nIcons, UINT flags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "PrivateExtractIconsA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "PrivateExtractIconsA()"_lit);
   return IUser32::get_instance()->PrivateExtractIconsA(szFileName, nIconIndex, cxIcon, cyIcon, phicon, piconid, nIcons, flags);
 }
 
 DLLEXPORT UINT WINAPI PrivateExtractIconsW (LPCWSTR szFileName, int nIconIndex, int cxIcon, int cyIcon, HICON * phicon, UINT * piconid, UINT nIcons, UINT flags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "PrivateExtractIconsW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "PrivateExtractIconsW()"_lit);
   return IUser32::get_instance()->PrivateExtractIconsW(szFileName, nIconIndex, cxIcon, cyIcon, phicon, piconid, nIcons, flags);
 }
 
 DLLEXPORT HICON WINAPI CreateIcon (HINSTANCE hInstance, int nWidth, int nHeight, BYTE cPlanes, BYTE cBitsPixel, CONST BYTE * lpbANDbits, CONST BYTE * lpbXORbits)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CreateIcon()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "CreateIcon()"_lit);
   return IUser32::get_instance()->CreateIcon(hInstance, nWidth, nHeight, cPlanes, cBitsPixel, lpbANDbits, lpbXORbits);
 }
 
 DLLEXPORT WINBOOL WINAPI DestroyIcon (HICON hIcon)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DestroyIcon()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "DestroyIcon()"_lit);
   return IUser32::get_instance()->DestroyIcon(hIcon);
 }
 
 DLLEXPORT int WINAPI LookupIconIdFromDirectory (PBYTE presbits, WINBOOL fIcon)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "LookupIconIdFromDirectory()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "LookupIconIdFromDirectory()"_lit);
   return IUser32::get_instance()->LookupIconIdFromDirectory(presbits, fIcon);
 }
 
 DLLEXPORT int WINAPI LookupIconIdFromDirectoryEx (PBYTE presbits, WINBOOL fIcon, int cxDesired, int cyDesired, UINT Flags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "LookupIconIdFromDirectoryEx()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "LookupIconIdFromDirectoryEx()"_lit);
   return IUser32::get_instance()->LookupIconIdFromDirectoryEx(presbits, fIcon, cxDesired, cyDesired, Flags);
 }
 
 DLLEXPORT HICON WINAPI CreateIconFromResource (PBYTE presbits, DWORD dwResSize, WINBOOL fIcon, DWORD dwVer)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CreateIconFromResource()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "CreateIconFromResource()"_lit);
   return IUser32::get_instance()->CreateIconFromResource(presbits, dwResSize, fIcon, dwVer);
 }
 
 DLLEXPORT HICON WINAPI CreateIconFromResourceEx (PBYTE presbits, DWORD dwResSize, WINBOOL fIcon, DWORD dwVer, int cxDesired, int cyDesired, UINT Flags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CreateIconFromResourceEx()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "CreateIconFromResourceEx()"_lit);
   return IUser32::get_instance()->CreateIconFromResourceEx(presbits, dwResSize, fIcon, dwVer, cxDesired, cyDesired, Flags);
 }
 
 DLLEXPORT HANDLE WINAPI LoadImageA (HINSTANCE hInst, LPCSTR name, UINT type, int cx, int cy, UINT fuLoad)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "LoadImageA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "LoadImageA()"_lit);
   return IUser32::get_instance()->LoadImageA(hInst, name, type, cx, cy, fuLoad);
 }
 
 DLLEXPORT HANDLE WINAPI LoadImageW (HINSTANCE hInst, LPCWSTR name, UINT type, int cx, int cy, UINT fuLoad)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "LoadImageW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "LoadImageW()"_lit);
   return IUser32::get_instance()->LoadImageW(hInst, name, type, cx, cy, fuLoad);
 }
 
 DLLEXPORT HANDLE WINAPI CopyImage (HANDLE h, UINT type, int cx, int cy, UINT flags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CopyImage()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "CopyImage()"_lit);
   return IUser32::get_instance()->CopyImage(h, type, cx, cy, flags);
 }
 
 DLLEXPORT WINBOOL WINAPI DrawIconEx (HDC hdc, int xLeft, int yTop, HICON hIcon, int cxWidth, int cyWidth, UINT istepIfAniCur, HBRUSH hbrFlickerFreeDraw, UINT diFlags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DrawIconEx()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "DrawIconEx()"_lit);
   return IUser32::get_instance()->DrawIconEx(hdc, xLeft, yTop, hIcon, cxWidth, cyWidth, istepIfAniCur, hbrFlickerFreeDraw, diFlags);
 }
 
 DLLEXPORT HICON WINAPI CreateIconIndirect (PICONINFO piconinfo)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CreateIconIndirect()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "CreateIconIndirect()"_lit);
   return IUser32::get_instance()->CreateIconIndirect(piconinfo);
 }
 
 DLLEXPORT HICON WINAPI CopyIcon (HICON hIcon)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CopyIcon()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "CopyIcon()"_lit);
   return IUser32::get_instance()->CopyIcon(hIcon);
 }
 
 DLLEXPORT WINBOOL WINAPI GetIconInfo (HICON hIcon, PICONINFO piconinfo)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetIconInfo()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetIconInfo()"_lit);
   return IUser32::get_instance()->GetIconInfo(hIcon, piconinfo);
 }
 
 DLLEXPORT WINBOOL WINAPI GetIconInfoExA (HICON hicon, PICONINFOEXA piconinfo)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetIconInfoExA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetIconInfoExA()"_lit);
   return IUser32::get_instance()->GetIconInfoExA(hicon, piconinfo);
 }
 
 DLLEXPORT WINBOOL WINAPI GetIconInfoExW (HICON hicon, PICONINFOEXW piconinfo)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetIconInfoExW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetIconInfoExW()"_lit);
   return IUser32::get_instance()->GetIconInfoExW(hicon, piconinfo);
 }
 
 DLLEXPORT int WINAPI LoadStringA (HINSTANCE hInstance, UINT uID, LPSTR lpBuffer, int cchBufferMax)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "LoadStringA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "LoadStringA()"_lit);
   return IUser32::get_instance()->LoadStringA(hInstance, uID, lpBuffer, cchBufferMax);
 }
 
 DLLEXPORT int WINAPI LoadStringW (HINSTANCE hInstance, UINT uID, LPWSTR lpBuffer, int cchBufferMax)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "LoadStringW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "LoadStringW()"_lit);
   return IUser32::get_instance()->LoadStringW(hInstance, uID, lpBuffer, cchBufferMax);
 }
 
 DLLEXPORT WINBOOL WINAPI IsDialogMessageA (HWND hDlg, LPMSG lpMsg)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "IsDialogMessageA()");
+  logging::log(logging::LogSource::message_exports, logging::LogLevel::debug, "IsDialogMessageA()"_lit);
   return IUser32::get_instance()->IsDialogMessageA(hDlg, lpMsg);
 }
 
 DLLEXPORT WINBOOL WINAPI IsDialogMessageW (HWND hDlg, LPMSG lpMsg)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "IsDialogMessageW()");
+  logging::log(logging::LogSource::message_exports, logging::LogLevel::debug, "IsDialogMessageW()"_lit);
   return IUser32::get_instance()->IsDialogMessageW(hDlg, lpMsg);
 }
 
 DLLEXPORT WINBOOL WINAPI MapDialogRect (HWND hDlg, LPRECT lpRect)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "MapDialogRect()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "MapDialogRect()"_lit);
   return IUser32::get_instance()->MapDialogRect(hDlg, lpRect);
 }
 
 DLLEXPORT int WINAPI DlgDirListA (HWND hDlg, LPSTR lpPathSpec, int nIDListBox, int nIDStaticPath, UINT uFileType)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DlgDirListA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "DlgDirListA()"_lit);
   return IUser32::get_instance()->DlgDirListA(hDlg, lpPathSpec, nIDListBox, nIDStaticPath, uFileType);
 }
 
 DLLEXPORT int WINAPI DlgDirListW (HWND hDlg, LPWSTR lpPathSpec, int nIDListBox, int nIDStaticPath, UINT uFileType)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DlgDirListW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "DlgDirListW()"_lit);
   return IUser32::get_instance()->DlgDirListW(hDlg, lpPathSpec, nIDListBox, nIDStaticPath, uFileType);
 }
 
 DLLEXPORT WINBOOL WINAPI DlgDirSelectExA (HWND hwndDlg, LPSTR lpString, int chCount, int idListBox)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DlgDirSelectExA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "DlgDirSelectExA()"_lit);
   return IUser32::get_instance()->DlgDirSelectExA(hwndDlg, lpString, chCount, idListBox);
 }
 
 DLLEXPORT WINBOOL WINAPI DlgDirSelectExW (HWND hwndDlg, LPWSTR lpString, int chCount, int idListBox)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DlgDirSelectExW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "DlgDirSelectExW()"_lit);
   return IUser32::get_instance()->DlgDirSelectExW(hwndDlg, lpString, chCount, idListBox);
 }
 
 DLLEXPORT int WINAPI DlgDirListComboBoxA (HWND hDlg, LPSTR lpPathSpec, int nIDComboBox, int nIDStaticPath, UINT uFiletype)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DlgDirListComboBoxA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "DlgDirListComboBoxA()"_lit);
   return IUser32::get_instance()->DlgDirListComboBoxA(hDlg, lpPathSpec, nIDComboBox, nIDStaticPath, uFiletype);
 }
 
 DLLEXPORT int WINAPI DlgDirListComboBoxW (HWND hDlg, LPWSTR lpPathSpec, int nIDComboBox, int nIDStaticPath, UINT uFiletype)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DlgDirListComboBoxW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "DlgDirListComboBoxW()"_lit);
   return IUser32::get_instance()->DlgDirListComboBoxW(hDlg, lpPathSpec, nIDComboBox, nIDStaticPath, uFiletype);
 }
 
 DLLEXPORT WINBOOL WINAPI DlgDirSelectComboBoxExA (HWND hwndDlg, LPSTR lpString, int cchOut, int idComboBox)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DlgDirSelectComboBoxExA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "DlgDirSelectComboBoxExA()"_lit);
   return IUser32::get_instance()->DlgDirSelectComboBoxExA(hwndDlg, lpString, cchOut, idComboBox);
 }
 
 DLLEXPORT WINBOOL WINAPI DlgDirSelectComboBoxExW (HWND hwndDlg, LPWSTR lpString, int cchOut, int idComboBox)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DlgDirSelectComboBoxExW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "DlgDirSelectComboBoxExW()"_lit);
   return IUser32::get_instance()->DlgDirSelectComboBoxExW(hwndDlg, lpString, cchOut, idComboBox);
 }
 
 DLLEXPORT int WINAPI SetScrollInfo (HWND hwnd, int nBar, LPCSCROLLINFO lpsi, WINBOOL redraw)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetScrollInfo()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "SetScrollInfo()"_lit);
   return IUser32::get_instance()->SetScrollInfo(hwnd, nBar, lpsi, redraw);
 }
 
 DLLEXPORT WINBOOL WINAPI GetScrollInfo (HWND hwnd, int nBar, LPSCROLLINFO lpsi)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetScrollInfo()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetScrollInfo()"_lit);
   return IUser32::get_instance()->GetScrollInfo(hwnd, nBar, lpsi);
 }
 
 DLLEXPORT LRESULT WINAPI DefFrameProcA (HWND hWnd, HWND hWndMDIClient, UINT uMsg, WPARAM wParam, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DefFrameProcA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "DefFrameProcA()"_lit);
   return IUser32::get_instance()->DefFrameProcA(hWnd, hWndMDIClient, uMsg, wParam, lParam);
 }
 
 DLLEXPORT LRESULT WINAPI DefFrameProcW (HWND hWnd, HWND hWndMDIClient, UINT uMsg, WPARAM wParam, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DefFrameProcW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "DefFrameProcW()"_lit);
   return IUser32::get_instance()->DefFrameProcW(hWnd, hWndMDIClient, uMsg, wParam, lParam);
 }
 
 DLLEXPORT LRESULT WINAPI DefMDIChildProcA (HWND hWnd, UINT uMsg, WPARAM wParam, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DefMDIChildProcA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "DefMDIChildProcA()"_lit);
   return IUser32::get_instance()->DefMDIChildProcA(hWnd, uMsg, wParam, lParam);
 }
 
 DLLEXPORT LRESULT WINAPI DefMDIChildProcW (HWND hWnd, UINT uMsg, WPARAM wParam, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DefMDIChildProcW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "DefMDIChildProcW()"_lit);
   return IUser32::get_instance()->DefMDIChildProcW(hWnd, uMsg, wParam, lParam);
 }
 
 DLLEXPORT WINBOOL WINAPI TranslateMDISysAccel (HWND hWndClient, LPMSG lpMsg)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "TranslateMDISysAccel()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "TranslateMDISysAccel()"_lit);
   return IUser32::get_instance()->TranslateMDISysAccel(hWndClient, lpMsg);
 }
 
 DLLEXPORT UINT WINAPI ArrangeIconicWindows (HWND hWnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ArrangeIconicWindows()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "ArrangeIconicWindows()"_lit);
   return IUser32::get_instance()->ArrangeIconicWindows(hWnd);
 }
 
 DLLEXPORT HWND WINAPI CreateMDIWindowA (LPCSTR lpClassName, LPCSTR lpWindowName, DWORD dwStyle, int X, int Y, int nWidth, int nHeight, HWND hWndParent, HINSTANCE hInstance, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CreateMDIWindowA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "CreateMDIWindowA()"_lit);
   return IUser32::get_instance()->CreateMDIWindowA(lpClassName, lpWindowName, dwStyle, X, Y, nWidth, nHeight, hWndParent, hInstance, lParam);
 }
 
 DLLEXPORT HWND WINAPI CreateMDIWindowW (LPCWSTR lpClassName, LPCWSTR lpWindowName, DWORD dwStyle, int X, int Y, int nWidth, int nHeight, HWND hWndParent, HINSTANCE hInstance, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CreateMDIWindowW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "CreateMDIWindowW()"_lit);
   return IUser32::get_instance()->CreateMDIWindowW(lpClassName, lpWindowName, dwStyle, X, Y, nWidth, nHeight, hWndParent, hInstance, lParam);
 }
 
 DLLEXPORT WORD WINAPI TileWindows (HWND hwndParent, UINT wHow, CONST RECT * lpRect, UINT cKids, const HWND * lpKids)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "TileWindows()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "TileWindows()"_lit);
   return IUser32::get_instance()->TileWindows(hwndParent, wHow, lpRect, cKids, lpKids);
 }
 
 DLLEXPORT WORD WINAPI CascadeWindows (HWND hwndParent, UINT wHow, CONST RECT * lpRect, UINT cKids, const HWND * lpKids)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CascadeWindows()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "CascadeWindows()"_lit);
   return IUser32::get_instance()->CascadeWindows(hwndParent, wHow, lpRect, cKids, lpKids);
 }
 
 DLLEXPORT WINBOOL WINAPI WinHelpA (HWND hWndMain, LPCSTR lpszHelp, UINT uCommand, ULONG_PTR dwData)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "WinHelpA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "WinHelpA()"_lit);
   return IUser32::get_instance()->WinHelpA(hWndMain, lpszHelp, uCommand, dwData);
 }
 
 DLLEXPORT WINBOOL WINAPI WinHelpW (HWND hWndMain, LPCWSTR lpszHelp, UINT uCommand, ULONG_PTR dwData)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "WinHelpW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "WinHelpW()"_lit);
   return IUser32::get_instance()->WinHelpW(hWndMain, lpszHelp, uCommand, dwData);
 }
 
 DLLEXPORT DWORD WINAPI GetGuiResources (HANDLE hProcess, DWORD uiFlags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetGuiResources()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetGuiResources()"_lit);
   return IUser32::get_instance()->GetGuiResources(hProcess, uiFlags);
 }
 
 DLLEXPORT LONG WINAPI ChangeDisplaySettingsA (LPDEVMODEA lpDevMode, DWORD dwFlags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ChangeDisplaySettingsA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "ChangeDisplaySettingsA()"_lit);
   return IUser32::get_instance()->ChangeDisplaySettingsA(lpDevMode, dwFlags);
 }
 
 DLLEXPORT LONG WINAPI ChangeDisplaySettingsW (LPDEVMODEW lpDevMode, DWORD dwFlags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ChangeDisplaySettingsW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "ChangeDisplaySettingsW()"_lit);
   return IUser32::get_instance()->ChangeDisplaySettingsW(lpDevMode, dwFlags);
 }
 
 DLLEXPORT LONG WINAPI ChangeDisplaySettingsExA (LPCSTR lpszDeviceName, LPDEVMODEA lpDevMode, HWND hwnd, DWORD dwflags, LPVOID lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ChangeDisplaySettingsExA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "ChangeDisplaySettingsExA()"_lit);
   return IUser32::get_instance()->ChangeDisplaySettingsExA(lpszDeviceName, lpDevMode, hwnd, dwflags, lParam);
 }
 
 DLLEXPORT LONG WINAPI ChangeDisplaySettingsExW (LPCWSTR lpszDeviceName, LPDEVMODEW lpDevMode, HWND hwnd, DWORD dwflags, LPVOID lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ChangeDisplaySettingsExW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "ChangeDisplaySettingsExW()"_lit);
   return IUser32::get_instance()->ChangeDisplaySettingsExW(lpszDeviceName, lpDevMode, hwnd, dwflags, lParam);
 }
 
 DLLEXPORT WINBOOL WINAPI EnumDisplaySettingsA (LPCSTR lpszDeviceName, DWORD iModeNum, LPDEVMODEA lpDevMode)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "EnumDisplaySettingsA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "EnumDisplaySettingsA()"_lit);
   return IUser32::get_instance()->EnumDisplaySettingsA(lpszDeviceName, iModeNum, lpDevMode);
 }
 
 DLLEXPORT WINBOOL WINAPI EnumDisplaySettingsW (LPCWSTR lpszDeviceName, DWORD iModeNum, LPDEVMODEW lpDevMode)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "EnumDisplaySettingsW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "EnumDisplaySettingsW()"_lit);
   return IUser32::get_instance()->EnumDisplaySettingsW(lpszDeviceName, iModeNum, lpDevMode);
 }
 
 DLLEXPORT WINBOOL WINAPI EnumDisplaySettingsExA (LPCSTR lpszDeviceName, DWORD iModeNum, LPDEVMODEA lpDevMode, DWORD dwFlags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "EnumDisplaySettingsExA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "EnumDisplaySettingsExA()"_lit);
   return IUser32::get_instance()->EnumDisplaySettingsExA(lpszDeviceName, iModeNum, lpDevMode, dwFlags);
 }
 
 DLLEXPORT WINBOOL WINAPI EnumDisplaySettingsExW (LPCWSTR lpszDeviceName, DWORD iModeNum, LPDEVMODEW lpDevMode, DWORD dwFlags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "EnumDisplaySettingsExW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "EnumDisplaySettingsExW()"_lit);
   return IUser32::get_instance()->EnumDisplaySettingsExW(lpszDeviceName, iModeNum, lpDevMode, dwFlags);
 }
 
 DLLEXPORT WINBOOL WINAPI EnumDisplayDevicesA (LPCSTR lpDevice, DWORD iDevNum, PDISPLAY_DEVICEA lpDisplayDevice, DWORD dwFlags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "EnumDisplayDevicesA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "EnumDisplayDevicesA()"_lit);
   return IUser32::get_instance()->EnumDisplayDevicesA(lpDevice, iDevNum, lpDisplayDevice, dwFlags);
 }
 
 DLLEXPORT WINBOOL WINAPI EnumDisplayDevicesW (LPCWSTR lpDevice, DWORD iDevNum, PDISPLAY_DEVICEW lpDisplayDevice, DWORD dwFlags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "EnumDisplayDevicesW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "EnumDisplayDevicesW()"_lit);
   return IUser32::get_instance()->EnumDisplayDevicesW(lpDevice, iDevNum, lpDisplayDevice, dwFlags);
 }
 
 DLLEXPORT LONG WINAPI GetDisplayConfigBufferSizes (UINT32 flags, UINT32 * numPathArrayElements, UINT32 * numModeInfoArrayElements)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetDisplayConfigBufferSizes()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetDisplayConfigBufferSizes()"_lit);
   return IUser32::get_instance()->GetDisplayConfigBufferSizes(flags, numPathArrayElements, numModeInfoArrayElements);
 }
 
 DLLEXPORT LONG WINAPI SetDisplayConfig (UINT32 numPathArrayElements, DISPLAYCONFIG_PATH_INFO * pathArray, UINT32 numModeInfoArrayElements, DISPLAYCONFIG_MODE_INFO * modeInfoArray, UINT32 flags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetDisplayConfig()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "SetDisplayConfig()"_lit);
   return IUser32::get_instance()->SetDisplayConfig(numPathArrayElements, pathArray, numModeInfoArrayElements, modeInfoArray, flags);
 }
 
 DLLEXPORT LONG WINAPI QueryDisplayConfig (UINT32 flags, UINT32 * numPathArrayElements, DISPLAYCONFIG_PATH_INFO * pathArray, UINT32 * numModeInfoArrayElements, DISPLAYCONFIG_MODE_INFO * modeInfoArray, DISPLAYCONFIG_TOPOLOGY_ID * currentTopologyId)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "QueryDisplayConfig()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "QueryDisplayConfig()"_lit);
   return IUser32::get_instance()->QueryDisplayConfig(flags, numPathArrayElements, pathArray, numModeInfoArrayElements, modeInfoArray, currentTopologyId);
 }
 
 DLLEXPORT LONG WINAPI DisplayConfigGetDeviceInfo (DISPLAYCONFIG_DEVICE_INFO_HEADER * requestPacket)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DisplayConfigGetDeviceInfo()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "DisplayConfigGetDeviceInfo()"_lit);
   return IUser32::get_instance()->DisplayConfigGetDeviceInfo(requestPacket);
 }
 
 DLLEXPORT LONG WINAPI DisplayConfigSetDeviceInfo (DISPLAYCONFIG_DEVICE_INFO_HEADER * setPacket)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DisplayConfigSetDeviceInfo()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "DisplayConfigSetDeviceInfo()"_lit);
   return IUser32::get_instance()->DisplayConfigSetDeviceInfo(setPacket);
 }
 
 DLLEXPORT WINBOOL WINAPI SystemParametersInfoA (UINT uiAction, UINT uiParam, PVOID pvParam, UINT fWinIni)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SystemParametersInfoA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "SystemParametersInfoA()"_lit);
   return IUser32::get_instance()->SystemParametersInfoA(uiAction, uiParam, pvParam, fWinIni);
 }
 
 DLLEXPORT WINBOOL WINAPI SystemParametersInfoW (UINT uiAction, UINT uiParam, PVOID pvParam, UINT fWinIni)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SystemParametersInfoW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "SystemParametersInfoW()"_lit);
   return IUser32::get_instance()->SystemParametersInfoW(uiAction, uiParam, pvParam, fWinIni);
 }
 
 DLLEXPORT VOID WINAPI SetDebugErrorLevel (DWORD dwLevel)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetDebugErrorLevel()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "SetDebugErrorLevel()"_lit);
   IUser32::get_instance()->SetDebugErrorLevel(dwLevel);
 }
 
 DLLEXPORT VOID WINAPI SetLastErrorEx (DWORD dwErrCode, DWORD dwType)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetLastErrorEx()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "SetLastErrorEx()"_lit);
   IUser32::get_instance()->SetLastErrorEx(dwErrCode, dwType);
 }
 
 DLLEXPORT int WINAPI InternalGetWindowText (HWND hWnd, LPWSTR pString, int cchMaxCount)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "InternalGetWindowText()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "InternalGetWindowText()"_lit);
   return IUser32::get_instance()->InternalGetWindowText(hWnd, pString, cchMaxCount);
 }
 
 DLLEXPORT WINBOOL WINAPI CancelShutdown (VOID)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CancelShutdown()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "CancelShutdown()"_lit);
   return IUser32::get_instance()->CancelShutdown();
 }
 
 DLLEXPORT HMONITOR WINAPI MonitorFromPoint (POINT pt, DWORD dwFlags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "MonitorFromPoint()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "MonitorFromPoint()"_lit);
   return IUser32::get_instance()->MonitorFromPoint(pt, dwFlags);
 }
 
 DLLEXPORT HMONITOR WINAPI MonitorFromRect (LPCRECT lprc, DWORD dwFlags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "MonitorFromRect()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "MonitorFromRect()"_lit);
   return IUser32::get_instance()->MonitorFromRect(lprc, dwFlags);
 }
 
 DLLEXPORT HMONITOR WINAPI MonitorFromWindow (HWND hwnd, DWORD dwFlags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "MonitorFromWindow()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "MonitorFromWindow()"_lit);
   return IUser32::get_instance()->MonitorFromWindow(hwnd, dwFlags);
 }
 
 DLLEXPORT WINBOOL WINAPI EndTask (HWND hWnd, WINBOOL fShutDown, WINBOOL fForce)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "EndTask()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "EndTask()"_lit);
   return IUser32::get_instance()->EndTask(hWnd, fShutDown, fForce);
 }
 
 DLLEXPORT WINBOOL WINAPI SoundSentry (VOID)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SoundSentry()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "SoundSentry()"_lit);
   return IUser32::get_instance()->SoundSentry();
 }
 
 DLLEXPORT WINBOOL WINAPI GetMonitorInfoA (HMONITOR hMonitor, LPMONITORINFO lpmi)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetMonitorInfoA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetMonitorInfoA()"_lit);
   return IUser32::get_instance()->GetMonitorInfoA(hMonitor, lpmi);
 }
 
 DLLEXPORT WINBOOL WINAPI GetMonitorInfoW (HMONITOR hMonitor, LPMONITORINFO lpmi)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetMonitorInfoW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetMonitorInfoW()"_lit);
   return IUser32::get_instance()->GetMonitorInfoW(hMonitor, lpmi);
 }
 
 DLLEXPORT WINBOOL WINAPI EnumDisplayMonitors (HDC hdc, LPCRECT lprcClip, MONITORENUMPROC lpfnEnum, LPARAM dwData)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "EnumDisplayMonitors()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "EnumDisplayMonitors()"_lit);
   return IUser32::get_instance()->EnumDisplayMonitors(hdc, lprcClip, lpfnEnum, dwData);
 }
 
 DLLEXPORT VOID WINAPI NotifyWinEvent (DWORD event, HWND hwnd, LONG idObject, LONG idChild)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "NotifyWinEvent()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "NotifyWinEvent()"_lit);
   IUser32::get_instance()->NotifyWinEvent(event, hwnd, idObject, idChild);
 }
 
 DLLEXPORT HWINEVENTHOOK WINAPI SetWinEventHook (DWORD eventMin, DWORD eventMax, HMODULE hmodWinEventProc, WINEVENTPROC pfnWinEventProc, DWORD idProcess, DWORD idThread, DWORD dwFlags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetWinEventHook()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "SetWinEventHook()"_lit);
   return IUser32::get_instance()->SetWinEventHook(eventMin, eventMax, hmodWinEventProc, pfnWinEventProc, idProcess, idThread, dwFlags);
 }
 
 DLLEXPORT WINBOOL WINAPI IsWinEventHookInstalled (DWORD event)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "IsWinEventHookInstalled()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "IsWinEventHookInstalled()"_lit);
   return IUser32::get_instance()->IsWinEventHookInstalled(event);
 }
 
 DLLEXPORT WINBOOL WINAPI UnhookWinEvent (HWINEVENTHOOK hWinEventHook)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "UnhookWinEvent()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "UnhookWinEvent()"_lit);
   return IUser32::get_instance()->UnhookWinEvent(hWinEventHook);
 }
 
 DLLEXPORT WINBOOL WINAPI GetGUIThreadInfo (DWORD idThread, PGUITHREADINFO pgui)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetGUIThreadInfo()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetGUIThreadInfo()"_lit);
   return IUser32::get_instance()->GetGUIThreadInfo(idThread, pgui);
 }
 
 DLLEXPORT WINBOOL WINAPI BlockInput (WINBOOL fBlockIt)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "BlockInput()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "BlockInput()"_lit);
   return IUser32::get_instance()->BlockInput(fBlockIt);
 }
 
 DLLEXPORT UINT WINAPI GetWindowModuleFileNameA (HWND hwnd, LPSTR pszFileName, UINT cchFileNameMax)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetWindowModuleFileNameA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetWindowModuleFileNameA()"_lit);
   return IUser32::get_instance()->GetWindowModuleFileNameA(hwnd, pszFileName, cchFileNameMax);
 }
 
 DLLEXPORT UINT WINAPI GetWindowModuleFileNameW (HWND hwnd, LPWSTR pszFileName, UINT cchFileNameMax)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetWindowModuleFileNameW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetWindowModuleFileNameW()"_lit);
   return IUser32::get_instance()->GetWindowModuleFileNameW(hwnd, pszFileName, cchFileNameMax);
 }
 
 DLLEXPORT WINBOOL WINAPI SetProcessDPIAware (VOID)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetProcessDPIAware()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "SetProcessDPIAware()"_lit);
   return IUser32::get_instance()->SetProcessDPIAware();
 }
 
 DLLEXPORT WINBOOL WINAPI IsProcessDPIAware (VOID)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "IsProcessDPIAware()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "IsProcessDPIAware()"_lit);
   return IUser32::get_instance()->IsProcessDPIAware();
 }
 
 DLLEXPORT WINBOOL WINAPI GetCursorInfo (PCURSORINFO pci)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetCursorInfo()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "GetCursorInfo()"_lit);
   return IUser32::get_instance()->GetCursorInfo(pci);
 }
 
 DLLEXPORT WINBOOL WINAPI GetWindowInfo (HWND hwnd, PWINDOWINFO pwi)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetWindowInfo()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetWindowInfo()"_lit);
   return IUser32::get_instance()->GetWindowInfo(hwnd, pwi);
 }
 
 DLLEXPORT WINBOOL WINAPI GetTitleBarInfo (HWND hwnd, PTITLEBARINFO pti)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetTitleBarInfo()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetTitleBarInfo()"_lit);
   return IUser32::get_instance()->GetTitleBarInfo(hwnd, pti);
 }
 
 DLLEXPORT WINBOOL WINAPI GetMenuBarInfo (HWND hwnd, LONG idObject, LONG idItem, PMENUBARINFO pmbi)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetMenuBarInfo()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetMenuBarInfo()"_lit);
   return IUser32::get_instance()->GetMenuBarInfo(hwnd, idObject, idItem, pmbi);
 }
 
 DLLEXPORT WINBOOL WINAPI GetScrollBarInfo (HWND hwnd, LONG idObject, PSCROLLBARINFO psbi)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetScrollBarInfo()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetScrollBarInfo()"_lit);
   return IUser32::get_instance()->GetScrollBarInfo(hwnd, idObject, psbi);
 }
 
 DLLEXPORT WINBOOL WINAPI GetComboBoxInfo (HWND hwndCombo, PCOMBOBOXINFO pcbi)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetComboBoxInfo()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetComboBoxInfo()"_lit);
   return IUser32::get_instance()->GetComboBoxInfo(hwndCombo, pcbi);
 }
 
 DLLEXPORT HWND WINAPI GetAncestor (HWND hwnd, UINT gaFlags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetAncestor()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetAncestor()"_lit);
   return IUser32::get_instance()->GetAncestor(hwnd, gaFlags);
 }
 
 DLLEXPORT HWND WINAPI RealChildWindowFromPoint (HWND hwndParent, POINT ptParentClientCoords)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "RealChildWindowFromPoint()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "RealChildWindowFromPoint()"_lit);
   return IUser32::get_instance()->RealChildWindowFromPoint(hwndParent, ptParentClientCoords);
 }
 
 DLLEXPORT UINT WINAPI RealGetWindowClassA (HWND hwnd, LPSTR ptszClassName, UINT cchClassNameMax)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "RealGetWindowClassA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "RealGetWindowClassA()"_lit);
   return IUser32::get_instance()->RealGetWindowClassA(hwnd, ptszClassName, cchClassNameMax);
 }
 
 DLLEXPORT UINT WINAPI RealGetWindowClassW (HWND hwnd, LPWSTR ptszClassName, UINT cchClassNameMax)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "RealGetWindowClassW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "RealGetWindowClassW()"_lit);
   return IUser32::get_instance()->RealGetWindowClassW(hwnd, ptszClassName, cchClassNameMax);
 }
 
 DLLEXPORT WINBOOL WINAPI GetAltTabInfoA (HWND hwnd, int iItem, PALTTABINFO pati, LPSTR pszItemText, UINT cchItemText)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetAltTabInfoA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetAltTabInfoA()"_lit);
   return IUser32::get_instance()->GetAltTabInfoA(hwnd, iItem, pati, pszItemText, cchItemText);
 }
 
 DLLEXPORT WINBOOL WINAPI GetAltTabInfoW (HWND hwnd, int iItem, PALTTABINFO pati, LPWSTR pszItemText, UINT cchItemText)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetAltTabInfoW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetAltTabInfoW()"_lit);
   return IUser32::get_instance()->GetAltTabInfoW(hwnd, iItem, pati, pszItemText, cchItemText);
 }
 
 DLLEXPORT DWORD WINAPI GetListBoxInfo (HWND hwnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetListBoxInfo()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetListBoxInfo()"_lit);
   return IUser32::get_instance()->GetListBoxInfo(hwnd);
 }
 
 DLLEXPORT WINBOOL WINAPI LockWorkStation (VOID)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "LockWorkStation()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "LockWorkStation()"_lit);
   return IUser32::get_instance()->LockWorkStation();
 }
 
 DLLEXPORT WINBOOL WINAPI UserHandleGrantAccess (HANDLE hUserHandle, HANDLE hJob, WINBOOL bGrant)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "UserHandleGrantAccess()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "UserHandleGrantAccess()"_lit);
   return IUser32::get_instance()->UserHandleGrantAccess(hUserHandle, hJob, bGrant);
 }
 
 DLLEXPORT UINT WINAPI GetRawInputData (HRAWINPUT hRawInput, UINT uiCommand, LPVOID pData, PUINT pcbSize, UINT cbSizeHeader)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetRawInputData");
+  logging::log(logging::LogSource::rawinput, logging::LogLevel::debug, "GetRawInputData"_lit);
   return IUser32::get_instance()->GetRawInputData(hRawInput, uiCommand, pData, pcbSize, cbSizeHeader);
 }
 
 DLLEXPORT UINT WINAPI GetRawInputDeviceInfoA (HANDLE hDevice, UINT uiCommand, LPVOID pData, PUINT pcbSize)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetRawInputDeviceInfoA");
+  logging::log(logging::LogSource::rawinput, logging::LogLevel::debug, "GetRawInputDeviceInfoA"_lit);
   return IUser32::get_instance()->GetRawInputDeviceInfoA(hDevice, uiCommand, pData, pcbSize);
 }
 
 DLLEXPORT UINT WINAPI GetRawInputDeviceInfoW (HANDLE hDevice, UINT uiCommand, LPVOID pData, PUINT pcbSize)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetRawInputDeviceInfoW");
+  logging::log(logging::LogSource::rawinput, logging::LogLevel::debug, "GetRawInputDeviceInfoW"_lit);
   return IUser32::get_instance()->GetRawInputDeviceInfoW(hDevice, uiCommand, pData, pcbSize);
 }
 
 DLLEXPORT UINT WINAPI GetRawInputBuffer (PRAWINPUT pData, PUINT pcbSize, UINT cbSizeHeader)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetRawInputBuffer");
+  logging::log(logging::LogSource::rawinput, logging::LogLevel::debug, "GetRawInputBuffer"_lit);
   return IUser32::get_instance()->GetRawInputBuffer(pData, pcbSize, cbSizeHeader);
 }
 
 DLLEXPORT WINBOOL WINAPI RegisterRawInputDevices (PCRAWINPUTDEVICE pRawInputDevices, UINT uiNumDevices, UINT cbSize)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "RegisterRawInputDevices");
+  logging::log(logging::LogSource::rawinput, logging::LogLevel::debug, "RegisterRawInputDevices"_lit);
   return IUser32::get_instance()->RegisterRawInputDevices(pRawInputDevices, uiNumDevices, cbSize);
 }
 
 DLLEXPORT UINT WINAPI GetRegisteredRawInputDevices (PRAWINPUTDEVICE pRawInputDevices, PUINT puiNumDevices, UINT cbSize)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetRegisteredRawInputDevices");
+  logging::log(logging::LogSource::rawinput, logging::LogLevel::debug, "GetRegisteredRawInputDevices"_lit);
   return IUser32::get_instance()->GetRegisteredRawInputDevices(pRawInputDevices, puiNumDevices, cbSize);
 }
 
 DLLEXPORT UINT WINAPI GetRawInputDeviceList (PRAWINPUTDEVICELIST pRawInputDeviceList, PUINT puiNumDevices, UINT cbSize)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetRawInputDeviceList");
+  logging::log(logging::LogSource::rawinput, logging::LogLevel::debug, "GetRawInputDeviceList"_lit);
   return IUser32::get_instance()->GetRawInputDeviceList(pRawInputDeviceList, puiNumDevices, cbSize);
 }
 
 DLLEXPORT LRESULT WINAPI DefRawInputProc (PRAWINPUT * paRawInput, INT nInput, UINT cbSizeHeader)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DefRawInputProc");
+  logging::log(logging::LogSource::rawinput, logging::LogLevel::debug, "DefRawInputProc"_lit);
   return IUser32::get_instance()->DefRawInputProc(paRawInput, nInput, cbSizeHeader);
 }
 
 DLLEXPORT WINBOOL WINAPI GetPointerDevices (UINT32 * deviceCount, POINTER_DEVICE_INFO * pointerDevices)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetPointerDevices()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "GetPointerDevices()"_lit);
   return IUser32::get_instance()->GetPointerDevices(deviceCount, pointerDevices);
 }
 
 DLLEXPORT WINBOOL WINAPI GetPointerDevice (HANDLE device, POINTER_DEVICE_INFO * pointerDevice)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetPointerDevice()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "GetPointerDevice()"_lit);
   return IUser32::get_instance()->GetPointerDevice(device, pointerDevice);
 }
 
 DLLEXPORT WINBOOL WINAPI GetPointerDeviceProperties (HANDLE device, UINT32 * propertyCount, POINTER_DEVICE_PROPERTY * pointerProperties)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetPointerDeviceProperties()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "GetPointerDeviceProperties()"_lit);
   return IUser32::get_instance()->GetPointerDeviceProperties(device, propertyCount, pointerProperties);
 }
 
 DLLEXPORT WINBOOL WINAPI RegisterPointerDeviceNotifications (HWND window, WINBOOL notifyRange)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "RegisterPointerDeviceNotifications()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "RegisterPointerDeviceNotifications()"_lit);
   return IUser32::get_instance()->RegisterPointerDeviceNotifications(window, notifyRange);
 }
 
 DLLEXPORT WINBOOL WINAPI GetPointerDeviceRects (HANDLE device, RECT * pointerDeviceRect, RECT * displayRect)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetPointerDeviceRects()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "GetPointerDeviceRects()"_lit);
   return IUser32::get_instance()->GetPointerDeviceRects(device, pointerDeviceRect, displayRect);
 }
 
 DLLEXPORT WINBOOL WINAPI GetPointerDeviceCursors (HANDLE device, UINT32 * cursorCount, POINTER_DEVICE_CURSOR_INFO * deviceCursors)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetPointerDeviceCursors()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "GetPointerDeviceCursors()"_lit);
   return IUser32::get_instance()->GetPointerDeviceCursors(device, cursorCount, deviceCursors);
 }
 
 DLLEXPORT WINBOOL WINAPI GetRawPointerDeviceData (UINT32 pointerId, UINT32 historyCount, UINT32 propertiesCount, POINTER_DEVICE_PROPERTY * pProperties, LONG * pValues)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetRawPointerDeviceData()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "GetRawPointerDeviceData()"_lit);
   return IUser32::get_instance()->GetRawPointerDeviceData(pointerId, historyCount, propertiesCount, pProperties, pValues);
 }
 
 DLLEXPORT WINBOOL WINAPI ChangeWindowMessageFilter (UINT message, DWORD dwFlag)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ChangeWindowMessageFilter()");
+  logging::log(logging::LogSource::message_exports, logging::LogLevel::debug, "ChangeWindowMessageFilter()"_lit);
   return IUser32::get_instance()->ChangeWindowMessageFilter(message, dwFlag);
 }
 
 DLLEXPORT WINBOOL WINAPI ChangeWindowMessageFilterEx (HWND hwnd, UINT message, DWORD action, PCHANGEFILTERSTRUCT pChangeFilterStruct)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ChangeWindowMessageFilterEx()");
+  logging::log(logging::LogSource::message_exports, logging::LogLevel::debug, "ChangeWindowMessageFilterEx()"_lit);
   return IUser32::get_instance()->ChangeWindowMessageFilterEx(hwnd, message, action, pChangeFilterStruct);
 }
 
 DLLEXPORT WINBOOL WINAPI GetGestureInfo (HGESTUREINFO hGestureInfo, PGESTUREINFO pGestureInfo)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetGestureInfo()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetGestureInfo()"_lit);
   return IUser32::get_instance()->GetGestureInfo(hGestureInfo, pGestureInfo);
 }
 
 DLLEXPORT WINBOOL WINAPI GetGestureExtraArgs (HGESTUREINFO hGestureInfo, UINT cbExtraArgs, PBYTE pExtraArgs)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetGestureExtraArgs()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetGestureExtraArgs()"_lit);
   return IUser32::get_instance()->GetGestureExtraArgs(hGestureInfo, cbExtraArgs, pExtraArgs);
 }
 
 DLLEXPORT WINBOOL WINAPI CloseGestureInfoHandle (HGESTUREINFO hGestureInfo)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CloseGestureInfoHandle()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "CloseGestureInfoHandle()"_lit);
   return IUser32::get_instance()->CloseGestureInfoHandle(hGestureInfo);
 }
 
 DLLEXPORT WINBOOL WINAPI SetGestureConfig (HWND hwnd, DWORD dwReserved, UINT cIDs, PGESTURECONFIG pGestureConfig, UINT cbSize)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetGestureConfig()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "SetGestureConfig()"_lit);
   return IUser32::get_instance()->SetGestureConfig(hwnd, dwReserved, cIDs, pGestureConfig, cbSize);
 }
 
 DLLEXPORT WINBOOL WINAPI GetGestureConfig (HWND hwnd, DWORD dwReserved, DWORD dwFlags, PUINT pcIDs, PGESTURECONFIG pGestureConfig, UINT cbSize)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetGestureConfig()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetGestureConfig()"_lit);
   return IUser32::get_instance()->GetGestureConfig(hwnd, dwReserved, dwFlags, pcIDs, pGestureConfig, cbSize);
 }
 
 DLLEXPORT WINBOOL WINAPI ShutdownBlockReasonCreate (HWND hWnd, LPCWSTR pwszReason)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ShutdownBlockReasonCreate()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "ShutdownBlockReasonCreate()"_lit);
   return IUser32::get_instance()->ShutdownBlockReasonCreate(hWnd, pwszReason);
 }
 
 DLLEXPORT WINBOOL WINAPI ShutdownBlockReasonQuery (HWND hWnd, LPWSTR pwszBuff, DWORD * pcchBuff)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ShutdownBlockReasonQuery()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "ShutdownBlockReasonQuery()"_lit);
   return IUser32::get_instance()->ShutdownBlockReasonQuery(hWnd, pwszBuff, pcchBuff);
 }
 
 DLLEXPORT WINBOOL WINAPI ShutdownBlockReasonDestroy (HWND hWnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ShutdownBlockReasonDestroy()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "ShutdownBlockReasonDestroy()"_lit);
   return IUser32::get_instance()->ShutdownBlockReasonDestroy(hWnd);
 }
 
 DLLEXPORT WINBOOL WINAPI GetCurrentInputMessageSource (INPUT_MESSAGE_SOURCE * inputMessageSource)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetCurrentInputMessageSource()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "GetCurrentInputMessageSource()"_lit);
   return IUser32::get_instance()->GetCurrentInputMessageSource(inputMessageSource);
 }
 
 DLLEXPORT WINBOOL WINAPI GetCIMSSM (INPUT_MESSAGE_SOURCE * inputMessageSource)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetCIMSSM()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetCIMSSM()"_lit);
   return IUser32::get_instance()->GetCIMSSM(inputMessageSource);
 }
 
 DLLEXPORT WINBOOL WINAPI GetAutoRotationState (PAR_STATE pState)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetAutoRotationState()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetAutoRotationState()"_lit);
   return IUser32::get_instance()->GetAutoRotationState(pState);
 }
 
 DLLEXPORT WINBOOL WINAPI GetDisplayAutoRotationPreferences (ORIENTATION_PREFERENCE * pOrientation)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetDisplayAutoRotationPreferences()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetDisplayAutoRotationPreferences()"_lit);
   return IUser32::get_instance()->GetDisplayAutoRotationPreferences(pOrientation);
 }
 
 DLLEXPORT WINBOOL WINAPI GetDisplayAutoRotationPreferencesByProcessId (DWORD dwProcessId, ORIENTATION_PREFERENCE * pOrientation, WINBOOL * fRotateScreen)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetDisplayAutoRotationPreferencesByProcessId()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetDisplayAutoRotationPreferencesByProcessId()"_lit);
   return IUser32::get_instance()->GetDisplayAutoRotationPreferencesByProcessId(dwProcessId, pOrientation, fRotateScreen);
 }
 
 DLLEXPORT WINBOOL WINAPI SetDisplayAutoRotationPreferences (ORIENTATION_PREFERENCE orientation)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetDisplayAutoRotationPreferences()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "SetDisplayAutoRotationPreferences()"_lit);
   return IUser32::get_instance()->SetDisplayAutoRotationPreferences(orientation);
 }
 
 DLLEXPORT WINBOOL WINAPI IsImmersiveProcess (HANDLE hProcess)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "IsImmersiveProcess()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "IsImmersiveProcess()"_lit);
   return IUser32::get_instance()->IsImmersiveProcess(hProcess);
 }
 
 DLLEXPORT WINBOOL WINAPI SetProcessRestrictionExemption (WINBOOL fEnableExemption)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetProcessRestrictionExemption()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "SetProcessRestrictionExemption()"_lit);
   return IUser32::get_instance()->SetProcessRestrictionExemption(fEnableExemption);
 }
 
 DLLEXPORT WINBOOL WINAPI GetPointerInputTransform (UINT32 pointerId, UINT32 historyCount, UINT32 * inputTransform)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetPointerInputTransform()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "GetPointerInputTransform()"_lit);
   return IUser32::get_instance()->GetPointerInputTransform(pointerId, historyCount, inputTransform);
 }
 
 DLLEXPORT WINBOOL WINAPI IsMousePointerEnabled (void)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "IsMousePointerEnabled()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "IsMousePointerEnabled()"_lit);
   return IUser32::get_instance()->IsMousePointerEnabled();
 }
 
 DLLEXPORT UINT_PTR WINAPI SetSystemTimer (HWND hwnd, UINT_PTR id, UINT timeout, void * unknown)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetSystemTimer()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "SetSystemTimer()"_lit);
   return IUser32::get_instance()->SetSystemTimer(hwnd, id, timeout, unknown);
 }
 
 DLLEXPORT DWORD WINAPI CalcMenuBar (HWND hwnd, DWORD left, DWORD right, DWORD top, RECT * rect)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CalcMenuBar()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "CalcMenuBar()"_lit);
   return IUser32::get_instance()->CalcMenuBar(hwnd, left, right, top, rect);
 }
 
 DLLEXPORT UINT WINAPI WINNLSGetIMEHotkey (HWND hwnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "WINNLSGetIMEHotkey()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "WINNLSGetIMEHotkey()"_lit);
   return IUser32::get_instance()->WINNLSGetIMEHotkey(hwnd);
 }
 
 DLLEXPORT HWND WINAPI GetTaskmanWindow (void)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetTaskmanWindow()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetTaskmanWindow()"_lit);
   return IUser32::get_instance()->GetTaskmanWindow();
 }
 
 DLLEXPORT BOOL WINAPI DdeDisconnect (HCONV hConv)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DdeDisconnect()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "DdeDisconnect()"_lit);
   return IUser32::get_instance()->DdeDisconnect(hConv);
 }
 
 DLLEXPORT HSZ WINAPI DdeCreateStringHandleA (DWORD idInst, LPCSTR psz, INT codepage)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DdeCreateStringHandleA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "DdeCreateStringHandleA()"_lit);
   return IUser32::get_instance()->DdeCreateStringHandleA(idInst, psz, codepage);
 }
 
 DLLEXPORT BOOL WINAPI SetProcessDpiAwarenessInternal (DPI_AWARENESS awareness)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetProcessDpiAwarenessInternal()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "SetProcessDpiAwarenessInternal()"_lit);
   return IUser32::get_instance()->SetProcessDpiAwarenessInternal(awareness);
 }
 
 DLLEXPORT BOOL WINAPI SetDeskWallpaper (const char * filename)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetDeskWallpaper()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "SetDeskWallpaper()"_lit);
   return IUser32::get_instance()->SetDeskWallpaper(filename);
 }
 
 DLLEXPORT NTSTATUS WINAPI User32ImmTranslateMessage (void * args, ULONG size)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "User32ImmTranslateMessage()");
+  logging::log(logging::LogSource::message_exports, logging::LogLevel::debug, "User32ImmTranslateMessage()"_lit);
   return IUser32::get_instance()->User32ImmTranslateMessage(args, size);
 }
 
 DLLEXPORT DWORD WINAPI DdeGetData (HDDEDATA hData, LPBYTE pDst, DWORD cbMax, DWORD cbOff)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DdeGetData()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "DdeGetData()"_lit);
   return IUser32::get_instance()->DdeGetData(hData, pDst, cbMax, cbOff);
 }
 
 DLLEXPORT DWORD_PTR WINAPI SetSysColorsTemp (const COLORREF * pPens, const HBRUSH * pBrushes, DWORD_PTR n)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetSysColorsTemp()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "SetSysColorsTemp()"_lit);
   return IUser32::get_instance()->SetSysColorsTemp(pPens, pBrushes, n);
 }
 
 DLLEXPORT LRESULT WINAPI StaticWndProcW (HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "StaticWndProcW()");
+  logging::log(logging::LogSource::message_exports, logging::LogLevel::debug, "StaticWndProcW()"_lit);
   return IUser32::get_instance()->StaticWndProcW(hwnd, msg, wParam, lParam);
 }
 
 DLLEXPORT LPBYTE WINAPI DdeAccessData (HDDEDATA hData, LPDWORD pcbDataSize)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DdeAccessData()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "DdeAccessData()"_lit);
   return IUser32::get_instance()->DdeAccessData(hData, pcbDataSize);
 }
 
 DLLEXPORT BOOL WINAPI DdeUnaccessData (HDDEDATA hData)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DdeUnaccessData()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "DdeUnaccessData()"_lit);
   return IUser32::get_instance()->DdeUnaccessData(hData);
 }
 
 DLLEXPORT UINT WINAPI DdeInitializeA (LPDWORD pidInst, PFNCALLBACK pfnCallback, DWORD afCmd, DWORD ulRes)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DdeInitializeA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "DdeInitializeA()"_lit);
   return IUser32::get_instance()->DdeInitializeA(pidInst, pfnCallback, afCmd, ulRes);
 }
 
 DLLEXPORT UINT WINAPI DdeInitializeW (LPDWORD pidInst, PFNCALLBACK pfnCallback, DWORD afCmd, DWORD ulRes)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DdeInitializeW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "DdeInitializeW()"_lit);
   return IUser32::get_instance()->DdeInitializeW(pidInst, pfnCallback, afCmd, ulRes);
 }
 
 DLLEXPORT BOOL WINAPI DdeUninitialize (DWORD idInst)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DdeUninitialize()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "DdeUninitialize()"_lit);
   return IUser32::get_instance()->DdeUninitialize(idInst);
 }
 
 DLLEXPORT VOID WINAPI LoadLocalFonts (VOID)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "LoadLocalFonts()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "LoadLocalFonts()"_lit);
   IUser32::get_instance()->LoadLocalFonts();
 }
 
 DLLEXPORT LPSTR WINAPI CharPrevExW (WORD codepage, LPCWSTR start, LPCWSTR ptr, DWORD flags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CharPrevExW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "CharPrevExW()"_lit);
   return IUser32::get_instance()->CharPrevExW(codepage, start, ptr, flags);
 }
 
 DLLEXPORT HWND WINAPI GetProgmanWindow (void)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetProgmanWindow()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetProgmanWindow()"_lit);
   return IUser32::get_instance()->GetProgmanWindow();
 }
 
 DLLEXPORT DPI_AWARENESS_CONTEXT WINAPI SetThreadDpiAwarenessContext (DPI_AWARENESS_CONTEXT context)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetThreadDpiAwarenessContext()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "SetThreadDpiAwarenessContext()"_lit);
   return IUser32::get_instance()->SetThreadDpiAwarenessContext(context);
 }
 
 DLLEXPORT LPARAM WINAPI PackDDElParam (UINT msg, UINT_PTR uiLo, UINT_PTR uiHi)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "PackDDElParam()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "PackDDElParam()"_lit);
   return IUser32::get_instance()->PackDDElParam(msg, uiLo, uiHi);
 }
 
 DLLEXPORT BOOL WINAPI DdeFreeDataHandle (HDDEDATA hData)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DdeFreeDataHandle()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "DdeFreeDataHandle()"_lit);
   return IUser32::get_instance()->DdeFreeDataHandle(hData);
 }
 
 DLLEXPORT BOOL WINAPI AlignRects (LPRECT rect, DWORD b, DWORD c, DWORD d)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "AlignRects()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "AlignRects()"_lit);
   return IUser32::get_instance()->AlignRects(rect, b, c, d);
 }
 
 DLLEXPORT DWORD WINAPI DdeQueryStringW (DWORD idInst, HSZ hsz, LPWSTR psz, DWORD cchMax, INT iCodePage)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DdeQueryStringW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "DdeQueryStringW()"_lit);
   return IUser32::get_instance()->DdeQueryStringW(idInst, hsz, psz, cchMax, iCodePage);
 }
 
 DLLEXPORT DWORD WINAPI SetLogonNotifyWindow (HWINSTA hwinsta, HWND hwnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetLogonNotifyWindow()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "SetLogonNotifyWindow()"_lit);
   return IUser32::get_instance()->SetLogonNotifyWindow(hwinsta, hwnd);
 }
 
 DLLEXPORT HCURSOR WINAPI GetCursorFrameInfo (HCURSOR handle, DWORD reserved, DWORD istep, DWORD * rate, DWORD * steps)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetCursorFrameInfo()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "GetCursorFrameInfo()"_lit);
   return IUser32::get_instance()->GetCursorFrameInfo(handle, reserved, istep, rate, steps);
 }
 
 DLLEXPORT DWORD WINAPI DdeQueryStringA (DWORD idInst, HSZ hsz, LPSTR psz, DWORD cchMax, INT iCodePage)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DdeQueryStringA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "DdeQueryStringA()"_lit);
   return IUser32::get_instance()->DdeQueryStringA(idInst, hsz, psz, cchMax, iCodePage);
 }
 
 DLLEXPORT BOOL WINAPI DdeSetQualityOfService (HWND hwndClient, const SECURITY_QUALITY_OF_SERVICE * pqosNew, PSECURITY_QUALITY_OF_SERVICE pqosPrev)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DdeSetQualityOfService()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "DdeSetQualityOfService()"_lit);
   return IUser32::get_instance()->DdeSetQualityOfService(hwndClient, pqosNew, pqosPrev);
 }
 
 DLLEXPORT UINT WINAPI DdeGetLastError (DWORD idInst)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DdeGetLastError()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "DdeGetLastError()"_lit);
   return IUser32::get_instance()->DdeGetLastError(idInst);
 }
 
 DLLEXPORT LRESULT WINAPI ComboWndProcA (HWND hwnd, UINT message, WPARAM wParam, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ComboWndProcA()");
+  logging::log(logging::LogSource::message_exports, logging::LogLevel::debug, "ComboWndProcA()"_lit);
   return IUser32::get_instance()->ComboWndProcA(hwnd, message, wParam, lParam);
 }
 
 DLLEXPORT BOOL WINAPI DdeDisconnectList (HCONVLIST hConvList)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DdeDisconnectList()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "DdeDisconnectList()"_lit);
   return IUser32::get_instance()->DdeDisconnectList(hConvList);
 }
 
 DLLEXPORT LRESULT WINAPI SendIMEMessageExA (HWND hwnd, LPARAM lparam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SendIMEMessageExA()");
+  logging::log(logging::LogSource::message_exports, logging::LogLevel::debug, "SendIMEMessageExA()"_lit);
   return IUser32::get_instance()->SendIMEMessageExA(hwnd, lparam);
 }
 
 DLLEXPORT INT WINAPI DdeCmpStringHandles (HSZ hsz1, HSZ hsz2)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DdeCmpStringHandles()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "DdeCmpStringHandles()"_lit);
   return IUser32::get_instance()->DdeCmpStringHandles(hsz1, hsz2);
 }
 
 DLLEXPORT DWORD WINAPI RegisterTasklist (DWORD x)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "RegisterTasklist()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "RegisterTasklist()"_lit);
   return IUser32::get_instance()->RegisterTasklist(x);
 }
 
 DLLEXPORT LRESULT WINAPI IconTitleWndProc (HWND hWnd, UINT msg, WPARAM wParam, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "IconTitleWndProc()");
+  logging::log(logging::LogSource::message_exports, logging::LogLevel::debug, "IconTitleWndProc()"_lit);
   return IUser32::get_instance()->IconTitleWndProc(hWnd, msg, wParam, lParam);
 }
 
 DLLEXPORT LRESULT WINAPI SendIMEMessageExW (HWND hwnd, LPARAM lparam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SendIMEMessageExW()");
+  logging::log(logging::LogSource::message_exports, logging::LogLevel::debug, "SendIMEMessageExW()"_lit);
   return IUser32::get_instance()->SendIMEMessageExW(hwnd, lparam);
 }
 
 DLLEXPORT LRESULT WINAPI ComboWndProcW (HWND hwnd, UINT message, WPARAM wParam, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ComboWndProcW()");
+  logging::log(logging::LogSource::message_exports, logging::LogLevel::debug, "ComboWndProcW()"_lit);
   return IUser32::get_instance()->ComboWndProcW(hwnd, message, wParam, lParam);
 }
 
 DLLEXPORT HCONVLIST WINAPI DdeConnectList (DWORD idInst, HSZ hszService, HSZ hszTopic, HCONVLIST hConvList, PCONVCONTEXT pCC)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DdeConnectList()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "DdeConnectList()"_lit);
   return IUser32::get_instance()->DdeConnectList(idInst, hszService, hszTopic, hConvList, pCC);
 }
 
 DLLEXPORT HCONV WINAPI DdeQueryNextServer (HCONVLIST hConvList, HCONV hConvPrev)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DdeQueryNextServer()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "DdeQueryNextServer()"_lit);
   return IUser32::get_instance()->DdeQueryNextServer(hConvList, hConvPrev);
 }
 
 DLLEXPORT BOOL WINAPI RegisterUserApiHook (const struct user_api_hook * new_hook, struct user_api_hook * old_hook)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "RegisterUserApiHook()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "RegisterUserApiHook()"_lit);
   return IUser32::get_instance()->RegisterUserApiHook(new_hook, old_hook);
 }
 
 DLLEXPORT void WINAPI UnregisterUserApiHook (void)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "UnregisterUserApiHook()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "UnregisterUserApiHook()"_lit);
   IUser32::get_instance()->UnregisterUserApiHook();
 }
 
 DLLEXPORT LRESULT WINAPI StaticWndProcA (HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "StaticWndProcA()");
+  logging::log(logging::LogSource::message_exports, logging::LogLevel::debug, "StaticWndProcA()"_lit);
   return IUser32::get_instance()->StaticWndProcA(hwnd, msg, wParam, lParam);
 }
 
 DLLEXPORT LRESULT WINAPI MDIClientWndProcW (HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "MDIClientWndProcW()");
+  logging::log(logging::LogSource::message_exports, logging::LogLevel::debug, "MDIClientWndProcW()"_lit);
   return IUser32::get_instance()->MDIClientWndProcW(hwnd, msg, wParam, lParam);
 }
 
 DLLEXPORT BOOL WINAPI DdeKeepStringHandle (DWORD idInst, HSZ hsz)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DdeKeepStringHandle()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "DdeKeepStringHandle()"_lit);
   return IUser32::get_instance()->DdeKeepStringHandle(idInst, hsz);
 }
 
 DLLEXPORT DWORD WINAPI GetAppCompatFlags (HTASK hTask)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetAppCompatFlags()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetAppCompatFlags()"_lit);
   return IUser32::get_instance()->GetAppCompatFlags(hTask);
 }
 
 DLLEXPORT HWND WINAPI SetProgmanWindow (HWND hwnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetProgmanWindow()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "SetProgmanWindow()"_lit);
   return IUser32::get_instance()->SetProgmanWindow(hwnd);
 }
 
 DLLEXPORT BOOL WINAPI DdeEnableCallback (DWORD idInst, HCONV hConv, UINT wCmd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DdeEnableCallback()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "DdeEnableCallback()"_lit);
   return IUser32::get_instance()->DdeEnableCallback(idInst, hConv, wCmd);
 }
 
 DLLEXPORT DPI_HOSTING_BEHAVIOR WINAPI GetThreadDpiHostingBehavior (void)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetThreadDpiHostingBehavior()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetThreadDpiHostingBehavior()"_lit);
   return IUser32::get_instance()->GetThreadDpiHostingBehavior();
 }
 
 DLLEXPORT LRESULT WINAPI MDIClientWndProcA (HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "MDIClientWndProcA()");
+  logging::log(logging::LogSource::message_exports, logging::LogLevel::debug, "MDIClientWndProcA()"_lit);
   return IUser32::get_instance()->MDIClientWndProcA(hwnd, msg, wParam, lParam);
 }
 
 DLLEXPORT LRESULT WINAPI EditWndProcW (HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "EditWndProcW()");
+  logging::log(logging::LogSource::message_exports, logging::LogLevel::debug, "EditWndProcW()"_lit);
   return IUser32::get_instance()->EditWndProcW(hwnd, msg, wParam, lParam);
 }
 
 DLLEXPORT LRESULT WINAPI ButtonWndProcW (HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ButtonWndProcW()");
+  logging::log(logging::LogSource::message_exports, logging::LogLevel::debug, "ButtonWndProcW()"_lit);
   return IUser32::get_instance()->ButtonWndProcW(hwnd, msg, wParam, lParam);
 }
 
 DLLEXPORT HWND WINAPI SetTaskmanWindow (HWND hwnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetTaskmanWindow()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "SetTaskmanWindow()"_lit);
   return IUser32::get_instance()->SetTaskmanWindow(hwnd);
 }
 
 DLLEXPORT BOOL WINAPI DdeImpersonateClient (HCONV hConv)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DdeImpersonateClient()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "DdeImpersonateClient()"_lit);
   return IUser32::get_instance()->DdeImpersonateClient(hConv);
 }
 
 DLLEXPORT UINT WINAPI DdeQueryConvInfo (HCONV hConv, DWORD id, PCONVINFO lpConvInfo)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DdeQueryConvInfo()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "DdeQueryConvInfo()"_lit);
   return IUser32::get_instance()->DdeQueryConvInfo(hConv, id, lpConvInfo);
 }
 
 DLLEXPORT void WINAPI CalcChildScroll (HWND hwnd, INT scroll)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CalcChildScroll()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "CalcChildScroll()"_lit);
   IUser32::get_instance()->CalcChildScroll(hwnd, scroll);
 }
 
 DLLEXPORT HCONV WINAPI DdeConnect (DWORD idInst, HSZ hszService, HSZ hszTopic, PCONVCONTEXT pCC)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DdeConnect()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "DdeConnect()"_lit);
   return IUser32::get_instance()->DdeConnect(idInst, hszService, hszTopic, pCC);
 }
 
 DLLEXPORT HCONV WINAPI DdeReconnect (HCONV hConv)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DdeReconnect()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "DdeReconnect()"_lit);
   return IUser32::get_instance()->DdeReconnect(hConv);
 }
 
 DLLEXPORT LPWSTR WINAPI CharNextExW (WORD codepage, LPCWSTR ptr, DWORD flags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CharNextExW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "CharNextExW()"_lit);
   return IUser32::get_instance()->CharNextExW(codepage, ptr, flags);
 }
 
 DLLEXPORT LRESULT WINAPI EditWndProcA (HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "EditWndProcA()");
+  logging::log(logging::LogSource::message_exports, logging::LogLevel::debug, "EditWndProcA()"_lit);
   return IUser32::get_instance()->EditWndProcA(hwnd, msg, wParam, lParam);
 }
 
 DLLEXPORT BOOL WINAPI GetProcessDpiAwarenessInternal (HANDLE process, DPI_AWARENESS * awareness)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetProcessDpiAwarenessInternal()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetProcessDpiAwarenessInternal()"_lit);
   return IUser32::get_instance()->GetProcessDpiAwarenessInternal(process, awareness);
 }
 
 DLLEXPORT void WINAPI RegisterSystemThread (DWORD flags, DWORD reserved)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "RegisterSystemThread()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "RegisterSystemThread()"_lit);
   IUser32::get_instance()->RegisterSystemThread(flags, reserved);
 }
 
 DLLEXPORT BOOL WINAPI SetWindowCompositionAttribute (HWND hwnd, WINDOWCOMPOSITIONATTRIBDATA const * pwcad)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetWindowCompositionAttribute()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "SetWindowCompositionAttribute()"_lit);
   return IUser32::get_instance()->SetWindowCompositionAttribute(hwnd, pwcad);
 }
 
 DLLEXPORT HDDEDATA WINAPI DdeClientTransaction (LPBYTE pData, DWORD cbData, HCONV hConv, HSZ hszItem, UINT wFmt, UINT wType, DWORD dwTimeout, LPDWORD pdwResult)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DdeClientTransaction()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "DdeClientTransaction()"_lit);
   return IUser32::get_instance()->DdeClientTransaction(pData, cbData, hConv, hszItem, wFmt, wType, dwTimeout, pdwResult);
 }
 
 DLLEXPORT BOOL WINAPI DdeAbandonTransaction (DWORD idInst, HCONV hConv, DWORD idTransaction)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DdeAbandonTransaction()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "DdeAbandonTransaction()"_lit);
   return IUser32::get_instance()->DdeAbandonTransaction(idInst, hConv, idTransaction);
 }
 
 DLLEXPORT LRESULT WINAPI ScrollBarWndProcA (HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ScrollBarWndProcA()");
+  logging::log(logging::LogSource::message_exports, logging::LogLevel::debug, "ScrollBarWndProcA()"_lit);
   return IUser32::get_instance()->ScrollBarWndProcA(hwnd, msg, wParam, lParam);
 }
 
 DLLEXPORT HKL WINAPI LoadKeyboardLayoutEx (HKL layout, const WCHAR * name, UINT flags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "LoadKeyboardLayoutEx()");
+  logging::log(logging::LogSource::input_exports, logging::LogLevel::debug, "LoadKeyboardLayoutEx()"_lit);
   return IUser32::get_instance()->LoadKeyboardLayoutEx(layout, name, flags);
 }
 
 DLLEXPORT int WINAPI RegisterServicesProcess (DWORD ServicesProcessId)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "RegisterServicesProcess()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "RegisterServicesProcess()"_lit);
   return IUser32::get_instance()->RegisterServicesProcess(ServicesProcessId);
 }
 
 DLLEXPORT HDDEDATA WINAPI DdeCreateDataHandle (DWORD idInst, LPBYTE pSrc, DWORD cb, DWORD cbOff, HSZ hszItem, UINT wFmt, UINT afCmd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DdeCreateDataHandle()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "DdeCreateDataHandle()"_lit);
   return IUser32::get_instance()->DdeCreateDataHandle(idInst, pSrc, cb, cbOff, hszItem, wFmt, afCmd);
 }
 
 DLLEXPORT HDDEDATA WINAPI DdeAddData (HDDEDATA hData, LPBYTE pSrc, DWORD cb, DWORD cbOff)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DdeAddData()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "DdeAddData()"_lit);
   return IUser32::get_instance()->DdeAddData(hData, pSrc, cb, cbOff);
 }
 
 DLLEXPORT LRESULT WINAPI ScrollBarWndProcW (HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ScrollBarWndProcW()");
+  logging::log(logging::LogSource::message_exports, logging::LogLevel::debug, "ScrollBarWndProcW()"_lit);
   return IUser32::get_instance()->ScrollBarWndProcW(hwnd, msg, wParam, lParam);
 }
 
 DLLEXPORT HDDEDATA WINAPI DdeNameService (DWORD idInst, HSZ hsz1, HSZ hsz2, UINT afCmd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DdeNameService()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "DdeNameService()"_lit);
   return IUser32::get_instance()->DdeNameService(idInst, hsz1, hsz2, afCmd);
 }
 
 DLLEXPORT LRESULT WINAPI ButtonWndProcA (HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ButtonWndProcA()");
+  logging::log(logging::LogSource::message_exports, logging::LogLevel::debug, "ButtonWndProcA()"_lit);
   return IUser32::get_instance()->ButtonWndProcA(hwnd, msg, wParam, lParam);
 }
 
 DLLEXPORT INT WINAPI GetSystemMetricsForDpi (INT index, UINT dpi)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetSystemMetricsForDpi()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetSystemMetricsForDpi()"_lit);
   return IUser32::get_instance()->GetSystemMetricsForDpi(index, dpi);
 }
 
 DLLEXPORT DPI_HOSTING_BEHAVIOR WINAPI GetWindowDpiHostingBehavior (HWND hwnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetWindowDpiHostingBehavior()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetWindowDpiHostingBehavior()"_lit);
   return IUser32::get_instance()->GetWindowDpiHostingBehavior(hwnd);
 }
 
 DLLEXPORT DWORD WINAPI SetWindowStationUser (DWORD x1, DWORD x2)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetWindowStationUser()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "SetWindowStationUser()"_lit);
   return IUser32::get_instance()->SetWindowStationUser(x1, x2);
 }
 
 DLLEXPORT BOOL WINAPI SystemParametersInfoForDpi (UINT action, UINT val, PVOID ptr, UINT winini, UINT dpi)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SystemParametersInfoForDpi()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "SystemParametersInfoForDpi()"_lit);
   return IUser32::get_instance()->SystemParametersInfoForDpi(action, val, ptr, winini, dpi);
 }
 
 DLLEXPORT LRESULT WINAPI MessageWndProc (HWND hwnd, UINT message, WPARAM wParam, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "MessageWndProc()");
+  logging::log(logging::LogSource::message_exports, logging::LogLevel::debug, "MessageWndProc()"_lit);
   return IUser32::get_instance()->MessageWndProc(hwnd, message, wParam, lParam);
 }
 
 DLLEXPORT BOOL WINAPI IsWindowRedirectedForPrint (HWND hwnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "IsWindowRedirectedForPrint()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "IsWindowRedirectedForPrint()"_lit);
   return IUser32::get_instance()->IsWindowRedirectedForPrint(hwnd);
 }
 
 DLLEXPORT BOOL WINAPI WINNLSGetEnableStatus (HWND hwnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "WINNLSGetEnableStatus()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "WINNLSGetEnableStatus()"_lit);
   return IUser32::get_instance()->WINNLSGetEnableStatus(hwnd);
 }
 
 DLLEXPORT BOOL WINAPI KillSystemTimer (HWND hwnd, UINT_PTR id)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "KillSystemTimer()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "KillSystemTimer()"_lit);
   return IUser32::get_instance()->KillSystemTimer(hwnd, id);
 }
 
 DLLEXPORT HSZ WINAPI DdeCreateStringHandleW (DWORD idInst, LPCWSTR psz, INT codepage)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DdeCreateStringHandleW()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "DdeCreateStringHandleW()"_lit);
   return IUser32::get_instance()->DdeCreateStringHandleW(idInst, psz, codepage);
 }
 
 DLLEXPORT INT_PTR WINAPI MDI_MoreWindowsDlgProc (HWND hDlg, UINT iMsg, WPARAM wParam, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "MDI_MoreWindowsDlgProc()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "MDI_MoreWindowsDlgProc()"_lit);
   return IUser32::get_instance()->MDI_MoreWindowsDlgProc(hDlg, iMsg, wParam, lParam);
 }
 
 DLLEXPORT BOOL WINAPI WINNLSEnableIME (HWND hwnd, BOOL enable)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "WINNLSEnableIME()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "WINNLSEnableIME()"_lit);
   return IUser32::get_instance()->WINNLSEnableIME(hwnd, enable);
 }
 
 DLLEXPORT BOOL WINAPI AdjustWindowRectExForDpi (LPRECT rect, DWORD style, BOOL menu, DWORD dwExStyle, UINT dpi)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "AdjustWindowRectExForDpi()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "AdjustWindowRectExForDpi()"_lit);
   return IUser32::get_instance()->AdjustWindowRectExForDpi(rect, style, menu, dwExStyle, dpi);
 }
 
 DLLEXPORT DPI_AWARENESS_CONTEXT WINAPI GetThreadDpiAwarenessContext (void)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetThreadDpiAwarenessContext()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetThreadDpiAwarenessContext()"_lit);
   return IUser32::get_instance()->GetThreadDpiAwarenessContext();
 }
 
 DLLEXPORT BOOL WINAPI DdeFreeStringHandle (DWORD idInst, HSZ hsz)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DdeFreeStringHandle()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "DdeFreeStringHandle()"_lit);
   return IUser32::get_instance()->DdeFreeStringHandle(idInst, hsz);
 }
 
 DLLEXPORT BOOL WINAPI DrawCaptionTempA (HWND hwnd, HDC hdc, const RECT * rect, HFONT hFont, HICON hIcon, LPCSTR str, UINT uFlags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DrawCaptionTempA()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "DrawCaptionTempA()"_lit);
   return IUser32::get_instance()->DrawCaptionTempA(hwnd, hdc, rect, hFont, hIcon, str, uFlags);
 }
 
 DLLEXPORT WORD WINAPI TileChildWindows (HWND parent, UINT flags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "TileChildWindows()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "TileChildWindows()"_lit);
   return IUser32::get_instance()->TileChildWindows(parent, flags);
 }
 
 DLLEXPORT LPARAM WINAPI ReuseDDElParam (LPARAM lParam, UINT msgIn, UINT msgOut, UINT_PTR uiLo, UINT_PTR uiHi)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ReuseDDElParam()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "ReuseDDElParam()"_lit);
   return IUser32::get_instance()->ReuseDDElParam(lParam, msgIn, msgOut, uiLo, uiHi);
 }
 
 DLLEXPORT BOOL WINAPI ImpersonateDdeClientWindow (HWND hWndClient, HWND hWndServer)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ImpersonateDdeClientWindow()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "ImpersonateDdeClientWindow()"_lit);
   return IUser32::get_instance()->ImpersonateDdeClientWindow(hWndClient, hWndServer);
 }
 
 DLLEXPORT UINT WINAPI GetDpiForSystem (void)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetDpiForSystem()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetDpiForSystem()"_lit);
   return IUser32::get_instance()->GetDpiForSystem();
 }
 
 DLLEXPORT BOOL WINAPI User32InitializeImmEntryTable (DWORD magic)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "User32InitializeImmEntryTable()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "User32InitializeImmEntryTable()"_lit);
   /* Cannot just always return FALSE here, because DLL won't load. */
   try
   {
     if (!IUser32::has_instance())
     {
-      logging::log("wrapper", logging::LogLevel::debug, "User32InitializeImmEntryTable(): User32 instance not ready, returning FALSE");
+      logging::log(logging::LogSource::exports, logging::LogLevel::debug, "User32InitializeImmEntryTable(): User32 instance not ready, returning FALSE"_lit);
       return FALSE;
     }
     return IUser32::get_instance()->User32InitializeImmEntryTable(magic);
   }
   catch (std::runtime_error & e)
   {
-    logging::log("wrapper", logging::LogLevel::debug, "Exception in User32InitializeImmEntryTable(): ", e.what());
+    logging::log(logging::LogSource::exports, logging::LogLevel::debug, "Exception in User32InitializeImmEntryTable(): "_lit, e.what());
     return FALSE;
   }
 }
 
 DLLEXPORT BOOL WINAPI EnableNonClientDpiScaling (HWND hwnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "EnableNonClientDpiScaling()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "EnableNonClientDpiScaling()"_lit);
   return IUser32::get_instance()->EnableNonClientDpiScaling(hwnd);
 }
 
 DLLEXPORT BOOL WINAPI ImmSetActiveContext (HWND arg0, HIMC arg1, BOOL arg2)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ImmSetActiveContext()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "ImmSetActiveContext()"_lit);
   return IUser32::get_instance()->ImmSetActiveContext(arg0, arg1, arg2);
 }
 
 DLLEXPORT BOOL WINAPI IsValidDpiAwarenessContext (DPI_AWARENESS_CONTEXT context)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "IsValidDpiAwarenessContext()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "IsValidDpiAwarenessContext()"_lit);
   return IUser32::get_instance()->IsValidDpiAwarenessContext(context);
 }
 
 DLLEXPORT void WINAPI ScrollChildren (HWND hWnd, UINT uMsg, WPARAM wParam, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ScrollChildren()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "ScrollChildren()"_lit);
   IUser32::get_instance()->ScrollChildren(hWnd, uMsg, wParam, lParam);
 }
 
 DLLEXPORT WORD WINAPI CascadeChildWindows (HWND parent, UINT flags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CascadeChildWindows()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "CascadeChildWindows()"_lit);
   return IUser32::get_instance()->CascadeChildWindows(parent, flags);
 }
 
 DLLEXPORT DPI_AWARENESS_CONTEXT WINAPI GetWindowDpiAwarenessContext (HWND hwnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetWindowDpiAwarenessContext()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetWindowDpiAwarenessContext()"_lit);
   return IUser32::get_instance()->GetWindowDpiAwarenessContext(hwnd);
 }
 
 DLLEXPORT HDEVNOTIFY WINAPI I_ScRegisterDeviceNotification (DEVICE_NOTIFICATION_DETAILS * details, LPVOID filter, DWORD flags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "I_ScRegisterDeviceNotification()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "I_ScRegisterDeviceNotification()"_lit);
   return IUser32::get_instance()->I_ScRegisterDeviceNotification(details, filter, flags);
 }
 
 DLLEXPORT BOOL WINAPI I_ScUnregisterDeviceNotification (HDEVNOTIFY handle)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "I_ScUnregisterDeviceNotification()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "I_ScUnregisterDeviceNotification()"_lit);
   return IUser32::get_instance()->I_ScUnregisterDeviceNotification(handle);
 }
 
 DLLEXPORT BOOL WINAPI DdeSetUserHandle (HCONV hConv, DWORD id, DWORD_PTR hUser)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DdeSetUserHandle()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "DdeSetUserHandle()"_lit);
   return IUser32::get_instance()->DdeSetUserHandle(hConv, id, hUser);
 }
 
 DLLEXPORT BOOL WINAPI DdePostAdvise (DWORD idInst, HSZ hszTopic, HSZ hszItem)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DdePostAdvise()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "DdePostAdvise()"_lit);
   return IUser32::get_instance()->DdePostAdvise(idInst, hszTopic, hszItem);
 }
 
 DLLEXPORT DWORD WINAPI GetAppCompatFlags2 (HTASK hTask)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetAppCompatFlags2()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetAppCompatFlags2()"_lit);
   return IUser32::get_instance()->GetAppCompatFlags2(hTask);
 }
 
 DLLEXPORT BOOL WINAPI AreDpiAwarenessContextsEqual (DPI_AWARENESS_CONTEXT ctx1, DPI_AWARENESS_CONTEXT ctx2)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "AreDpiAwarenessContextsEqual()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "AreDpiAwarenessContextsEqual()"_lit);
   return IUser32::get_instance()->AreDpiAwarenessContextsEqual(ctx1, ctx2);
 }
 
 DLLEXPORT DPI_AWARENESS WINAPI GetAwarenessFromDpiAwarenessContext (DPI_AWARENESS_CONTEXT context)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetAwarenessFromDpiAwarenessContext()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetAwarenessFromDpiAwarenessContext()"_lit);
   return IUser32::get_instance()->GetAwarenessFromDpiAwarenessContext(context);
 }
 
 DLLEXPORT BOOL WINAPI SetShellWindow (HWND hwnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetShellWindow()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "SetShellWindow()"_lit);
   return IUser32::get_instance()->SetShellWindow(hwnd);
 }
 
 DLLEXPORT LRESULT WINAPI ImeWndProcW (HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ImeWndProcW()");
+  logging::log(logging::LogSource::message_exports, logging::LogLevel::debug, "ImeWndProcW()"_lit);
   return IUser32::get_instance()->ImeWndProcW(hwnd, msg, wParam, lParam);
 }
 
 DLLEXPORT UINT WINAPI GetDpiForWindow (HWND hwnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetDpiForWindow()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "GetDpiForWindow()"_lit);
   return IUser32::get_instance()->GetDpiForWindow(hwnd);
 }
 
 DLLEXPORT BOOL WINAPI UnpackDDElParam (UINT msg, LPARAM lParam, PUINT_PTR puiLo, PUINT_PTR puiHi)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "UnpackDDElParam()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "UnpackDDElParam()"_lit);
   return IUser32::get_instance()->UnpackDDElParam(msg, lParam, puiLo, puiHi);
 }
 
 DLLEXPORT BOOL WINAPI FreeDDElParam (UINT msg, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "FreeDDElParam()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "FreeDDElParam()"_lit);
   return IUser32::get_instance()->FreeDDElParam(msg, lParam);
 }
 
 DLLEXPORT void WINAPI UserRegisterWowHandlers (const struct wow_handlers16 * new_, struct wow_handlers32 * orig)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "UserRegisterWowHandlers()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "UserRegisterWowHandlers()"_lit);
   IUser32::get_instance()->UserRegisterWowHandlers(new_, orig);
 }
 
 DLLEXPORT LRESULT WINAPI ImeWndProcA (HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ImeWndProcA()");
+  logging::log(logging::LogSource::message_exports, logging::LogLevel::debug, "ImeWndProcA()"_lit);
   return IUser32::get_instance()->ImeWndProcA(hwnd, msg, wParam, lParam);
 }
 
 DLLEXPORT LRESULT WINAPI ListBoxWndProcW (HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ListBoxWndProcW()");
+  logging::log(logging::LogSource::message_exports, logging::LogLevel::debug, "ListBoxWndProcW()"_lit);
   return IUser32::get_instance()->ListBoxWndProcW(hwnd, msg, wParam, lParam);
 }
 
 DLLEXPORT LRESULT WINAPI ListBoxWndProcA (HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ListBoxWndProcA()");
+  logging::log(logging::LogSource::message_exports, logging::LogLevel::debug, "ListBoxWndProcA()"_lit);
   return IUser32::get_instance()->ListBoxWndProcA(hwnd, msg, wParam, lParam);
 }
 
 DLLEXPORT DPI_HOSTING_BEHAVIOR WINAPI SetThreadDpiHostingBehavior (DPI_HOSTING_BEHAVIOR value)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetThreadDpiHostingBehavior()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "SetThreadDpiHostingBehavior()"_lit);
   return IUser32::get_instance()->SetThreadDpiHostingBehavior(value);
 }
 
 DLLEXPORT DWORD WINAPI RegisterLogonProcess (HANDLE hprocess, BOOL x)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "RegisterLogonProcess()");
+  logging::log(logging::LogSource::exports, logging::LogLevel::debug, "RegisterLogonProcess()"_lit);
   return IUser32::get_instance()->RegisterLogonProcess(hprocess, x);
 }
 
@@ -4937,668 +4948,668 @@ DLLEXPORT DWORD WINAPI RegisterLogonProcess (HANDLE hprocess, BOOL x)
 /* APIUser32 */
 int APIUser32::wvsprintfA (LPSTR arg0, LPCSTR arg1, va_list arglist)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "wvsprintfA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "wvsprintfA()"_lit);
   return wvsprintfA_(arg0, arg1, arglist);
 }
 
 int APIUser32::wvsprintfW (LPWSTR arg0, LPCWSTR arg1, va_list arglist)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "wvsprintfW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "wvsprintfW()"_lit);
   return wvsprintfW_(arg0, arg1, arglist);
 }
 
 HKL APIUser32::LoadKeyboardLayoutA (LPCSTR pwszKLID, UINT Flags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "LoadKeyboardLayoutA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "LoadKeyboardLayoutA()"_lit);
   return LoadKeyboardLayoutA_(pwszKLID, Flags);
 }
 
 HKL APIUser32::LoadKeyboardLayoutW (LPCWSTR pwszKLID, UINT Flags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "LoadKeyboardLayoutW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "LoadKeyboardLayoutW()"_lit);
   return LoadKeyboardLayoutW_(pwszKLID, Flags);
 }
 
 HKL APIUser32::ActivateKeyboardLayout (HKL hkl, UINT Flags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ActivateKeyboardLayout()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "ActivateKeyboardLayout()"_lit);
   return ActivateKeyboardLayout_(hkl, Flags);
 }
 
 int APIUser32::ToUnicodeEx (UINT wVirtKey, UINT wScanCode, CONST BYTE * lpKeyState, LPWSTR pwszBuff, int cchBuff, UINT wFlags, HKL dwhkl)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ToUnicodeEx()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "ToUnicodeEx()"_lit);
   return ToUnicodeEx_(wVirtKey, wScanCode, lpKeyState, pwszBuff, cchBuff, wFlags, dwhkl);
 }
 
 WINBOOL APIUser32::UnloadKeyboardLayout (HKL hkl)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "UnloadKeyboardLayout()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "UnloadKeyboardLayout()"_lit);
   return UnloadKeyboardLayout_(hkl);
 }
 
 WINBOOL APIUser32::GetKeyboardLayoutNameA (LPSTR pwszKLID)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetKeyboardLayoutNameA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetKeyboardLayoutNameA()"_lit);
   return GetKeyboardLayoutNameA_(pwszKLID);
 }
 
 WINBOOL APIUser32::GetKeyboardLayoutNameW (LPWSTR pwszKLID)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetKeyboardLayoutNameW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetKeyboardLayoutNameW()"_lit);
   return GetKeyboardLayoutNameW_(pwszKLID);
 }
 
 int APIUser32::GetKeyboardLayoutList (int nBuff, HKL * lpList)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetKeyboardLayoutList()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetKeyboardLayoutList()"_lit);
   return GetKeyboardLayoutList_(nBuff, lpList);
 }
 
 HKL APIUser32::GetKeyboardLayout (DWORD idThread)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetKeyboardLayout()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetKeyboardLayout()"_lit);
   return GetKeyboardLayout_(idThread);
 }
 
 int APIUser32::GetMouseMovePointsEx (UINT cbSize, LPMOUSEMOVEPOINT lppt, LPMOUSEMOVEPOINT lpptBuf, int nBufPoints, DWORD resolution)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetMouseMovePointsEx()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetMouseMovePointsEx()"_lit);
   return GetMouseMovePointsEx_(cbSize, lppt, lpptBuf, nBufPoints, resolution);
 }
 
 HDESK APIUser32::CreateDesktopA (LPCSTR lpszDesktop, LPCSTR lpszDevice, LPDEVMODEA pDevmode, DWORD dwFlags, ACCESS_MASK dwDesiredAccess, LPSECURITY_ATTRIBUTES lpsa)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CreateDesktopA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "CreateDesktopA()"_lit);
   return CreateDesktopA_(lpszDesktop, lpszDevice, pDevmode, dwFlags, dwDesiredAccess, lpsa);
 }
 
 HDESK APIUser32::CreateDesktopW (LPCWSTR lpszDesktop, LPCWSTR lpszDevice, LPDEVMODEW pDevmode, DWORD dwFlags, ACCESS_MASK dwDesiredAccess, LPSECURITY_ATTRIBUTES lpsa)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CreateDesktopW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "CreateDesktopW()"_lit);
   return CreateDesktopW_(lpszDesktop, lpszDevice, pDevmode, dwFlags, dwDesiredAccess, lpsa);
 }
 
 HDESK APIUser32::CreateDesktopExA (LPCSTR lpszDesktop, LPCSTR lpszDevice, DEVMODEA * pDevmode, DWORD dwFlags, ACCESS_MASK dwDesiredAccess, LPSECURITY_ATTRIBUTES lpsa, ULONG ulHeapSize, PVOID pvoid)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CreateDesktopExA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "CreateDesktopExA()"_lit);
   return CreateDesktopExA_(lpszDesktop, lpszDevice, pDevmode, dwFlags, dwDesiredAccess, lpsa, ulHeapSize, pvoid);
 }
 
 HDESK APIUser32::CreateDesktopExW (LPCWSTR lpszDesktop, LPCWSTR lpszDevice, DEVMODEW * pDevmode, DWORD dwFlags, ACCESS_MASK dwDesiredAccess, LPSECURITY_ATTRIBUTES lpsa, ULONG ulHeapSize, PVOID pvoid)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CreateDesktopExW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "CreateDesktopExW()"_lit);
   return CreateDesktopExW_(lpszDesktop, lpszDevice, pDevmode, dwFlags, dwDesiredAccess, lpsa, ulHeapSize, pvoid);
 }
 
 HDESK APIUser32::OpenDesktopA (LPCSTR lpszDesktop, DWORD dwFlags, WINBOOL fInherit, ACCESS_MASK dwDesiredAccess)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "OpenDesktopA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "OpenDesktopA()"_lit);
   return OpenDesktopA_(lpszDesktop, dwFlags, fInherit, dwDesiredAccess);
 }
 
 HDESK APIUser32::OpenDesktopW (LPCWSTR lpszDesktop, DWORD dwFlags, WINBOOL fInherit, ACCESS_MASK dwDesiredAccess)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "OpenDesktopW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "OpenDesktopW()"_lit);
   return OpenDesktopW_(lpszDesktop, dwFlags, fInherit, dwDesiredAccess);
 }
 
 HDESK APIUser32::OpenInputDesktop (DWORD dwFlags, WINBOOL fInherit, ACCESS_MASK dwDesiredAccess)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "OpenInputDesktop()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "OpenInputDesktop()"_lit);
   return OpenInputDesktop_(dwFlags, fInherit, dwDesiredAccess);
 }
 
 WINBOOL APIUser32::EnumDesktopsA (HWINSTA hwinsta, DESKTOPENUMPROCA lpEnumFunc, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "EnumDesktopsA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "EnumDesktopsA()"_lit);
   return EnumDesktopsA_(hwinsta, lpEnumFunc, lParam);
 }
 
 WINBOOL APIUser32::EnumDesktopsW (HWINSTA hwinsta, DESKTOPENUMPROCW lpEnumFunc, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "EnumDesktopsW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "EnumDesktopsW()"_lit);
   return EnumDesktopsW_(hwinsta, lpEnumFunc, lParam);
 }
 
 WINBOOL APIUser32::EnumDesktopWindows (HDESK hDesktop, WNDENUMPROC lpfn, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "EnumDesktopWindows()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "EnumDesktopWindows()"_lit);
   return EnumDesktopWindows_(hDesktop, lpfn, lParam);
 }
 
 WINBOOL APIUser32::SwitchDesktop (HDESK hDesktop)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SwitchDesktop()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SwitchDesktop()"_lit);
   return SwitchDesktop_(hDesktop);
 }
 
 WINBOOL APIUser32::SetThreadDesktop (HDESK hDesktop)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetThreadDesktop()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SetThreadDesktop()"_lit);
   return SetThreadDesktop_(hDesktop);
 }
 
 WINBOOL APIUser32::CloseDesktop (HDESK hDesktop)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CloseDesktop()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "CloseDesktop()"_lit);
   return CloseDesktop_(hDesktop);
 }
 
 HDESK APIUser32::GetThreadDesktop (DWORD dwThreadId)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetThreadDesktop()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetThreadDesktop()"_lit);
   return GetThreadDesktop_(dwThreadId);
 }
 
 HWINSTA APIUser32::CreateWindowStationA (LPCSTR lpwinsta, DWORD dwFlags, ACCESS_MASK dwDesiredAccess, LPSECURITY_ATTRIBUTES lpsa)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CreateWindowStationA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "CreateWindowStationA()"_lit);
   return CreateWindowStationA_(lpwinsta, dwFlags, dwDesiredAccess, lpsa);
 }
 
 HWINSTA APIUser32::CreateWindowStationW (LPCWSTR lpwinsta, DWORD dwFlags, ACCESS_MASK dwDesiredAccess, LPSECURITY_ATTRIBUTES lpsa)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CreateWindowStationW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "CreateWindowStationW()"_lit);
   return CreateWindowStationW_(lpwinsta, dwFlags, dwDesiredAccess, lpsa);
 }
 
 HWINSTA APIUser32::OpenWindowStationA (LPCSTR lpszWinSta, WINBOOL fInherit, ACCESS_MASK dwDesiredAccess)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "OpenWindowStationA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "OpenWindowStationA()"_lit);
   return OpenWindowStationA_(lpszWinSta, fInherit, dwDesiredAccess);
 }
 
 HWINSTA APIUser32::OpenWindowStationW (LPCWSTR lpszWinSta, WINBOOL fInherit, ACCESS_MASK dwDesiredAccess)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "OpenWindowStationW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "OpenWindowStationW()"_lit);
   return OpenWindowStationW_(lpszWinSta, fInherit, dwDesiredAccess);
 }
 
 WINBOOL APIUser32::EnumWindowStationsA (WINSTAENUMPROCA lpEnumFunc, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "EnumWindowStationsA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "EnumWindowStationsA()"_lit);
   return EnumWindowStationsA_(lpEnumFunc, lParam);
 }
 
 WINBOOL APIUser32::EnumWindowStationsW (WINSTAENUMPROCW lpEnumFunc, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "EnumWindowStationsW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "EnumWindowStationsW()"_lit);
   return EnumWindowStationsW_(lpEnumFunc, lParam);
 }
 
 WINBOOL APIUser32::CloseWindowStation (HWINSTA hWinSta)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CloseWindowStation()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "CloseWindowStation()"_lit);
   return CloseWindowStation_(hWinSta);
 }
 
 WINBOOL APIUser32::SetProcessWindowStation (HWINSTA hWinSta)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetProcessWindowStation()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SetProcessWindowStation()"_lit);
   return SetProcessWindowStation_(hWinSta);
 }
 
 HWINSTA APIUser32::GetProcessWindowStation (VOID)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetProcessWindowStation()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetProcessWindowStation()"_lit);
   return GetProcessWindowStation_();
 }
 
 WINBOOL APIUser32::SetUserObjectSecurity (HANDLE hObj, PSECURITY_INFORMATION pSIRequested, PSECURITY_DESCRIPTOR pSID)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetUserObjectSecurity()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SetUserObjectSecurity()"_lit);
   return SetUserObjectSecurity_(hObj, pSIRequested, pSID);
 }
 
 WINBOOL APIUser32::GetUserObjectSecurity (HANDLE hObj, PSECURITY_INFORMATION pSIRequested, PSECURITY_DESCRIPTOR pSID, DWORD nLength, LPDWORD lpnLengthNeeded)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetUserObjectSecurity()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetUserObjectSecurity()"_lit);
   return GetUserObjectSecurity_(hObj, pSIRequested, pSID, nLength, lpnLengthNeeded);
 }
 
 WINBOOL APIUser32::GetUserObjectInformationA (HANDLE hObj, int nIndex, PVOID pvInfo, DWORD nLength, LPDWORD lpnLengthNeeded)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetUserObjectInformationA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetUserObjectInformationA()"_lit);
   return GetUserObjectInformationA_(hObj, nIndex, pvInfo, nLength, lpnLengthNeeded);
 }
 
 WINBOOL APIUser32::GetUserObjectInformationW (HANDLE hObj, int nIndex, PVOID pvInfo, DWORD nLength, LPDWORD lpnLengthNeeded)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetUserObjectInformationW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetUserObjectInformationW()"_lit);
   return GetUserObjectInformationW_(hObj, nIndex, pvInfo, nLength, lpnLengthNeeded);
 }
 
 WINBOOL APIUser32::SetUserObjectInformationA (HANDLE hObj, int nIndex, PVOID pvInfo, DWORD nLength)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetUserObjectInformationA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SetUserObjectInformationA()"_lit);
   return SetUserObjectInformationA_(hObj, nIndex, pvInfo, nLength);
 }
 
 WINBOOL APIUser32::SetUserObjectInformationW (HANDLE hObj, int nIndex, PVOID pvInfo, DWORD nLength)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetUserObjectInformationW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SetUserObjectInformationW()"_lit);
   return SetUserObjectInformationW_(hObj, nIndex, pvInfo, nLength);
 }
 
 WINBOOL APIUser32::IsHungAppWindow (HWND hwnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "IsHungAppWindow()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "IsHungAppWindow()"_lit);
   return IsHungAppWindow_(hwnd);
 }
 
 VOID APIUser32::DisableProcessWindowsGhosting (VOID)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DisableProcessWindowsGhosting()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "DisableProcessWindowsGhosting()"_lit);
   DisableProcessWindowsGhosting_();
 }
 
 UINT APIUser32::RegisterWindowMessageA (LPCSTR lpString)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "RegisterWindowMessageA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "RegisterWindowMessageA()"_lit);
   return RegisterWindowMessageA_(lpString);
 }
 
 UINT APIUser32::RegisterWindowMessageW (LPCWSTR lpString)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "RegisterWindowMessageW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "RegisterWindowMessageW()"_lit);
   return RegisterWindowMessageW_(lpString);
 }
 
 WINBOOL APIUser32::TrackMouseEvent (LPTRACKMOUSEEVENT lpEventTrack)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "TrackMouseEvent()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "TrackMouseEvent()"_lit);
   return TrackMouseEvent_(lpEventTrack);
 }
 
 WINBOOL APIUser32::DrawEdge (HDC hdc, LPRECT qrc, UINT edge, UINT grfFlags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DrawEdge()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "DrawEdge()"_lit);
   return DrawEdge_(hdc, qrc, edge, grfFlags);
 }
 
 WINBOOL APIUser32::DrawFrameControl (HDC arg0, LPRECT arg1, UINT arg2, UINT arg3)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DrawFrameControl()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "DrawFrameControl()"_lit);
   return DrawFrameControl_(arg0, arg1, arg2, arg3);
 }
 
 WINBOOL APIUser32::DrawCaption (HWND hwnd, HDC hdc, CONST RECT * lprect, UINT flags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DrawCaption()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "DrawCaption()"_lit);
   return DrawCaption_(hwnd, hdc, lprect, flags);
 }
 
 WINBOOL APIUser32::DrawAnimatedRects (HWND hwnd, int idAni, CONST RECT * lprcFrom, CONST RECT * lprcTo)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DrawAnimatedRects()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "DrawAnimatedRects()"_lit);
   return DrawAnimatedRects_(hwnd, idAni, lprcFrom, lprcTo);
 }
 
 WINBOOL APIUser32::GetMessageA (LPMSG lpMsg, HWND hWnd, UINT wMsgFilterMin, UINT wMsgFilterMax)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetMessageA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetMessageA()"_lit);
   return GetMessageA_(lpMsg, hWnd, wMsgFilterMin, wMsgFilterMax);
 }
 
 WINBOOL APIUser32::GetMessageW (LPMSG lpMsg, HWND hWnd, UINT wMsgFilterMin, UINT wMsgFilterMax)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetMessageW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetMessageW()"_lit);
   return GetMessageW_(lpMsg, hWnd, wMsgFilterMin, wMsgFilterMax);
 }
 
 WINBOOL APIUser32::TranslateMessage (CONST MSG * lpMsg)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "TranslateMessage()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "TranslateMessage()"_lit);
   return TranslateMessage_(lpMsg);
 }
 
 LRESULT APIUser32::DispatchMessageA (CONST MSG * lpMsg)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DispatchMessageA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "DispatchMessageA()"_lit);
   return DispatchMessageA_(lpMsg);
 }
 
 LRESULT APIUser32::DispatchMessageW (CONST MSG * lpMsg)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DispatchMessageW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "DispatchMessageW()"_lit);
   return DispatchMessageW_(lpMsg);
 }
 
 WINBOOL APIUser32::SetMessageQueue (int cMessagesMax)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetMessageQueue()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SetMessageQueue()"_lit);
   return SetMessageQueue_(cMessagesMax);
 }
 
 WINBOOL APIUser32::PeekMessageA (LPMSG lpMsg, HWND hWnd, UINT wMsgFilterMin, UINT wMsgFilterMax, UINT wRemoveMsg)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "PeekMessageA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "PeekMessageA()"_lit);
   return PeekMessageA_(lpMsg, hWnd, wMsgFilterMin, wMsgFilterMax, wRemoveMsg);
 }
 
 WINBOOL APIUser32::PeekMessageW (LPMSG lpMsg, HWND hWnd, UINT wMsgFilterMin, UINT wMsgFilterMax, UINT wRemoveMsg)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "PeekMessageW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "PeekMessageW()"_lit);
   return PeekMessageW_(lpMsg, hWnd, wMsgFilterMin, wMsgFilterMax, wRemoveMsg);
 }
 
 WINBOOL APIUser32::RegisterHotKey (HWND hWnd, int id, UINT fsModifiers, UINT vk)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "RegisterHotKey()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "RegisterHotKey()"_lit);
   return RegisterHotKey_(hWnd, id, fsModifiers, vk);
 }
 
 WINBOOL APIUser32::UnregisterHotKey (HWND hWnd, int id)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "UnregisterHotKey()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "UnregisterHotKey()"_lit);
   return UnregisterHotKey_(hWnd, id);
 }
 
 WINBOOL APIUser32::ExitWindowsEx (UINT uFlags, DWORD dwReason)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ExitWindowsEx()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "ExitWindowsEx()"_lit);
   return ExitWindowsEx_(uFlags, dwReason);
 }
 
 WINBOOL APIUser32::SwapMouseButton (WINBOOL fSwap)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SwapMouseButton()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SwapMouseButton()"_lit);
   return SwapMouseButton_(fSwap);
 }
 
 DWORD APIUser32::GetMessagePos (VOID)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetMessagePos()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetMessagePos()"_lit);
   return GetMessagePos_();
 }
 
 LONG APIUser32::GetMessageTime (VOID)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetMessageTime()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetMessageTime()"_lit);
   return GetMessageTime_();
 }
 
 LPARAM APIUser32::GetMessageExtraInfo (VOID)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetMessageExtraInfo()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetMessageExtraInfo()"_lit);
   return GetMessageExtraInfo_();
 }
 
 DWORD APIUser32::GetUnpredictedMessagePos (VOID)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetUnpredictedMessagePos()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetUnpredictedMessagePos()"_lit);
   return GetUnpredictedMessagePos_();
 }
 
 WINBOOL APIUser32::IsWow64Message (VOID)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "IsWow64Message()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "IsWow64Message()"_lit);
   return IsWow64Message_();
 }
 
 LPARAM APIUser32::SetMessageExtraInfo (LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetMessageExtraInfo()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SetMessageExtraInfo()"_lit);
   return SetMessageExtraInfo_(lParam);
 }
 
 LRESULT APIUser32::SendMessageA (HWND hWnd, UINT Msg, WPARAM wParam, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SendMessageA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SendMessageA()"_lit);
   return SendMessageA_(hWnd, Msg, wParam, lParam);
 }
 
 LRESULT APIUser32::SendMessageW (HWND hWnd, UINT Msg, WPARAM wParam, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SendMessageW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SendMessageW()"_lit);
   return SendMessageW_(hWnd, Msg, wParam, lParam);
 }
 
 LRESULT APIUser32::SendMessageTimeoutA (HWND hWnd, UINT Msg, WPARAM wParam, LPARAM lParam, UINT fuFlags, UINT uTimeout, PDWORD_PTR lpdwResult)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SendMessageTimeoutA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SendMessageTimeoutA()"_lit);
   return SendMessageTimeoutA_(hWnd, Msg, wParam, lParam, fuFlags, uTimeout, lpdwResult);
 }
 
 LRESULT APIUser32::SendMessageTimeoutW (HWND hWnd, UINT Msg, WPARAM wParam, LPARAM lParam, UINT fuFlags, UINT uTimeout, PDWORD_PTR lpdwResult)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SendMessageTimeoutW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SendMessageTimeoutW()"_lit);
   return SendMessageTimeoutW_(hWnd, Msg, wParam, lParam, fuFlags, uTimeout, lpdwResult);
 }
 
 WINBOOL APIUser32::SendNotifyMessageA (HWND hWnd, UINT Msg, WPARAM wParam, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SendNotifyMessageA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SendNotifyMessageA()"_lit);
   return SendNotifyMessageA_(hWnd, Msg, wParam, lParam);
 }
 
 WINBOOL APIUser32::SendNotifyMessageW (HWND hWnd, UINT Msg, WPARAM wParam, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SendNotifyMessageW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SendNotifyMessageW()"_lit);
   return SendNotifyMessageW_(hWnd, Msg, wParam, lParam);
 }
 
 WINBOOL APIUser32::SendMessageCallbackA (HWND hWnd, UINT Msg, WPARAM wParam, LPARAM lParam, SENDASYNCPROC lpResultCallBack, ULONG_PTR dwData)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SendMessageCallbackA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SendMessageCallbackA()"_lit);
   return SendMessageCallbackA_(hWnd, Msg, wParam, lParam, lpResultCallBack, dwData);
 }
 
 WINBOOL APIUser32::SendMessageCallbackW (HWND hWnd, UINT Msg, WPARAM wParam, LPARAM lParam, SENDASYNCPROC lpResultCallBack, ULONG_PTR dwData)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SendMessageCallbackW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SendMessageCallbackW()"_lit);
   return SendMessageCallbackW_(hWnd, Msg, wParam, lParam, lpResultCallBack, dwData);
 }
 
 LONG APIUser32::BroadcastSystemMessageExA (DWORD flags, LPDWORD lpInfo, UINT Msg, WPARAM wParam, LPARAM lParam, PBSMINFO pbsmInfo)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "BroadcastSystemMessageExA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "BroadcastSystemMessageExA()"_lit);
   return BroadcastSystemMessageExA_(flags, lpInfo, Msg, wParam, lParam, pbsmInfo);
 }
 
 LONG APIUser32::BroadcastSystemMessageExW (DWORD flags, LPDWORD lpInfo, UINT Msg, WPARAM wParam, LPARAM lParam, PBSMINFO pbsmInfo)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "BroadcastSystemMessageExW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "BroadcastSystemMessageExW()"_lit);
   return BroadcastSystemMessageExW_(flags, lpInfo, Msg, wParam, lParam, pbsmInfo);
 }
 
 LONG APIUser32::BroadcastSystemMessageA (DWORD flags, LPDWORD lpInfo, UINT Msg, WPARAM wParam, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "BroadcastSystemMessageA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "BroadcastSystemMessageA()"_lit);
   return BroadcastSystemMessageA_(flags, lpInfo, Msg, wParam, lParam);
 }
 
 LONG APIUser32::BroadcastSystemMessageW (DWORD flags, LPDWORD lpInfo, UINT Msg, WPARAM wParam, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "BroadcastSystemMessageW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "BroadcastSystemMessageW()"_lit);
   return BroadcastSystemMessageW_(flags, lpInfo, Msg, wParam, lParam);
 }
 
 HPOWERNOTIFY APIUser32::RegisterPowerSettingNotification (HANDLE hRecipient, LPCGUID PowerSettingGuid, DWORD Flags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "RegisterPowerSettingNotification()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "RegisterPowerSettingNotification()"_lit);
   return RegisterPowerSettingNotification_(hRecipient, PowerSettingGuid, Flags);
 }
 
 WINBOOL APIUser32::UnregisterPowerSettingNotification (HPOWERNOTIFY Handle)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "UnregisterPowerSettingNotification()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "UnregisterPowerSettingNotification()"_lit);
   return UnregisterPowerSettingNotification_(Handle);
 }
 
 HPOWERNOTIFY APIUser32::RegisterSuspendResumeNotification (HANDLE hRecipient, DWORD Flags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "RegisterSuspendResumeNotification()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "RegisterSuspendResumeNotification()"_lit);
   return RegisterSuspendResumeNotification_(hRecipient, Flags);
 }
 
 WINBOOL APIUser32::UnregisterSuspendResumeNotification (HPOWERNOTIFY Handle)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "UnregisterSuspendResumeNotification()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "UnregisterSuspendResumeNotification()"_lit);
   return UnregisterSuspendResumeNotification_(Handle);
 }
 
 WINBOOL APIUser32::PostMessageA (HWND hWnd, UINT Msg, WPARAM wParam, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "PostMessageA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "PostMessageA()"_lit);
   return PostMessageA_(hWnd, Msg, wParam, lParam);
 }
 
 WINBOOL APIUser32::PostMessageW (HWND hWnd, UINT Msg, WPARAM wParam, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "PostMessageW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "PostMessageW()"_lit);
   return PostMessageW_(hWnd, Msg, wParam, lParam);
 }
 
 WINBOOL APIUser32::PostThreadMessageA (DWORD idThread, UINT Msg, WPARAM wParam, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "PostThreadMessageA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "PostThreadMessageA()"_lit);
   return PostThreadMessageA_(idThread, Msg, wParam, lParam);
 }
 
 WINBOOL APIUser32::PostThreadMessageW (DWORD idThread, UINT Msg, WPARAM wParam, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "PostThreadMessageW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "PostThreadMessageW()"_lit);
   return PostThreadMessageW_(idThread, Msg, wParam, lParam);
 }
 
 WINBOOL APIUser32::AttachThreadInput (DWORD idAttach, DWORD idAttachTo, WINBOOL fAttach)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "AttachThreadInput()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "AttachThreadInput()"_lit);
   return AttachThreadInput_(idAttach, idAttachTo, fAttach);
 }
 
 WINBOOL APIUser32::ReplyMessage (LRESULT lResult)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ReplyMessage()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "ReplyMessage()"_lit);
   return ReplyMessage_(lResult);
 }
 
 WINBOOL APIUser32::WaitMessage (VOID)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "WaitMessage()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "WaitMessage()"_lit);
   return WaitMessage_();
 }
 
 DWORD APIUser32::WaitForInputIdle (HANDLE hProcess, DWORD dwMilliseconds)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "WaitForInputIdle()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "WaitForInputIdle()"_lit);
   return WaitForInputIdle_(hProcess, dwMilliseconds);
 }
 
 LRESULT APIUser32::DefWindowProcA (HWND hWnd, UINT Msg, WPARAM wParam, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DefWindowProcA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "DefWindowProcA()"_lit);
   return DefWindowProcA_(hWnd, Msg, wParam, lParam);
 }
 
 LRESULT APIUser32::DefWindowProcW (HWND hWnd, UINT Msg, WPARAM wParam, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DefWindowProcW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "DefWindowProcW()"_lit);
   return DefWindowProcW_(hWnd, Msg, wParam, lParam);
 }
 
 VOID APIUser32::PostQuitMessage (int nExitCode)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "PostQuitMessage()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "PostQuitMessage()"_lit);
   PostQuitMessage_(nExitCode);
 }
 
 WINBOOL APIUser32::InSendMessage (VOID)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "InSendMessage()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "InSendMessage()"_lit);
   return InSendMessage_();
 }
 
 DWORD APIUser32::InSendMessageEx (LPVOID lpReserved)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "InSendMessageEx()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "InSendMessageEx()"_lit);
   return InSendMessageEx_(lpReserved);
 }
 
 UINT APIUser32::GetDoubleClickTime (VOID)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetDoubleClickTime()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetDoubleClickTime()"_lit);
   return GetDoubleClickTime_();
 }
 
 WINBOOL APIUser32::SetDoubleClickTime (UINT arg0)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetDoubleClickTime()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SetDoubleClickTime()"_lit);
   return SetDoubleClickTime_(arg0);
 }
 
 ATOM APIUser32::RegisterClassA (CONST WNDCLASSA * lpWndClass)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "RegisterClassA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "RegisterClassA()"_lit);
   return RegisterClassA_(lpWndClass);
 }
 
 ATOM APIUser32::RegisterClassW (CONST WNDCLASSW * lpWndClass)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "RegisterClassW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "RegisterClassW()"_lit);
   return RegisterClassW_(lpWndClass);
 }
 
 WINBOOL APIUser32::UnregisterClassA (LPCSTR lpClassName, HINSTANCE hInstance)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "UnregisterClassA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "UnregisterClassA()"_lit);
   return UnregisterClassA_(lpClassName, hInstance);
 }
 
 WINBOOL APIUser32::UnregisterClassW (LPCWSTR lpClassName, HINSTANCE hInstance)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "UnregisterClassW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "UnregisterClassW()"_lit);
   return UnregisterClassW_(lpClassName, hInstance);
 }
 
 WINBOOL APIUser32::GetClassInfoA (HINSTANCE hInstance, LPCSTR lpClassName, LPWNDCLASSA lpWndClass)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetClassInfoA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetClassInfoA()"_lit);
   return GetClassInfoA_(hInstance, lpClassName, lpWndClass);
 }
 
 WINBOOL APIUser32::GetClassInfoW (HINSTANCE hInstance, LPCWSTR lpClassName, LPWNDCLASSW lpWndClass)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetClassInfoW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetClassInfoW()"_lit);
   return GetClassInfoW_(hInstance, lpClassName, lpWndClass);
 }
 
 ATOM APIUser32::RegisterClassExA (CONST WNDCLASSEXA * lpWndClass)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "RegisterClassExA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "RegisterClassExA()"_lit);
   return RegisterClassExA_(lpWndClass);
 }
 
 ATOM APIUser32::RegisterClassExW (CONST WNDCLASSEXW * lpWndClass)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "RegisterClassExW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "RegisterClassExW()"_lit);
   return RegisterClassExW_(lpWndClass);
 }
 
 WINBOOL APIUser32::GetClassInfoExA (HINSTANCE hInstance, LPCSTR lpszClass, LPWNDCLASSEXA lpwcx)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetClassInfoExA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetClassInfoExA()"_lit);
   return GetClassInfoExA_(hInstance, lpszClass, lpwcx);
 }
 
 WINBOOL APIUser32::GetClassInfoExW (HINSTANCE hInstance, LPCWSTR lpszClass, LPWNDCLASSEXW lpwcx)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetClassInfoExW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetClassInfoExW()"_lit);
   return GetClassInfoExW_(hInstance, lpszClass, lpwcx);
 }
 
 #ifdef STRICT
 LRESULT APIUser32::CallWindowProcA (WNDPROC lpPrevWndFunc, HWND hWnd, UINT Msg, WPARAM wParam, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CallWindowProcA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "CallWindowProcA()"_lit);
   return CallWindowProcA_(lpPrevWndFunc, hWnd, Msg, wParam, lParam);
 }
 
 LRESULT APIUser32::CallWindowProcW (WNDPROC lpPrevWndFunc, HWND hWnd, UINT Msg, WPARAM wParam, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CallWindowProcW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "CallWindowProcW()"_lit);
   return CallWindowProcW_(lpPrevWndFunc, hWnd, Msg, wParam, lParam);
 }
 
@@ -5606,13 +5617,13 @@ LRESULT APIUser32::CallWindowProcW (WNDPROC lpPrevWndFunc, HWND hWnd, UINT Msg,
 
 LRESULT APIUser32::CallWindowProcA (FARPROC lpPrevWndFunc, HWND hWnd, UINT Msg, WPARAM wParam, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CallWindowProcA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "CallWindowProcA()"_lit);
   return CallWindowProcA_(lpPrevWndFunc, hWnd, Msg, wParam, lParam);
 }
 
 LRESULT APIUser32::CallWindowProcW (FARPROC lpPrevWndFunc, HWND hWnd, UINT Msg, WPARAM wParam, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CallWindowProcW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "CallWindowProcW()"_lit);
   return CallWindowProcW_(lpPrevWndFunc, hWnd, Msg, wParam, lParam);
 }
 
@@ -5620,2491 +5631,2491 @@ LRESULT APIUser32::CallWindowProcW (FARPROC lpPrevWndFunc, HWND hWnd, UINT Msg,
 
 HDEVNOTIFY APIUser32::RegisterDeviceNotificationA (HANDLE hRecipient, LPVOID NotificationFilter, DWORD Flags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "RegisterDeviceNotificationA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "RegisterDeviceNotificationA()"_lit);
   return RegisterDeviceNotificationA_(hRecipient, NotificationFilter, Flags);
 }
 
 HDEVNOTIFY APIUser32::RegisterDeviceNotificationW (HANDLE hRecipient, LPVOID NotificationFilter, DWORD Flags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "RegisterDeviceNotificationW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "RegisterDeviceNotificationW()"_lit);
   return RegisterDeviceNotificationW_(hRecipient, NotificationFilter, Flags);
 }
 
 WINBOOL APIUser32::UnregisterDeviceNotification (HDEVNOTIFY Handle)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "UnregisterDeviceNotification()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "UnregisterDeviceNotification()"_lit);
   return UnregisterDeviceNotification_(Handle);
 }
 
 HWND APIUser32::CreateWindowExA (DWORD dwExStyle, LPCSTR lpClassName, LPCSTR lpWindowName, DWORD dwStyle, int X, int Y, int nWidth, int nHeight, HWND hWndParent, HMENU hMenu, HINSTANCE hInstance, LPVOID lpParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CreateWindowExA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "CreateWindowExA()"_lit);
   return CreateWindowExA_(dwExStyle, lpClassName, lpWindowName, dwStyle, X, Y, nWidth, nHeight, hWndParent, hMenu, hInstance, lpParam);
 }
 
 HWND APIUser32::CreateWindowExW (DWORD dwExStyle, LPCWSTR lpClassName, LPCWSTR lpWindowName, DWORD dwStyle, int X, int Y, int nWidth, int nHeight, HWND hWndParent, HMENU hMenu, HINSTANCE hInstance, LPVOID lpParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CreateWindowExW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "CreateWindowExW()"_lit);
   return CreateWindowExW_(dwExStyle, lpClassName, lpWindowName, dwStyle, X, Y, nWidth, nHeight, hWndParent, hMenu, hInstance, lpParam);
 }
 
 WINBOOL APIUser32::IsWindow (HWND hWnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "IsWindow()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "IsWindow()"_lit);
   return IsWindow_(hWnd);
 }
 
 WINBOOL APIUser32::IsMenu (HMENU hMenu)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "IsMenu()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "IsMenu()"_lit);
   return IsMenu_(hMenu);
 }
 
 WINBOOL APIUser32::IsChild (HWND hWndParent, HWND hWnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "IsChild()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "IsChild()"_lit);
   return IsChild_(hWndParent, hWnd);
 }
 
 WINBOOL APIUser32::DestroyWindow (HWND hWnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DestroyWindow()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "DestroyWindow()"_lit);
   return DestroyWindow_(hWnd);
 }
 
 WINBOOL APIUser32::ShowWindow (HWND hWnd, int nCmdShow)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ShowWindow()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "ShowWindow()"_lit);
   return ShowWindow_(hWnd, nCmdShow);
 }
 
 WINBOOL APIUser32::AnimateWindow (HWND hWnd, DWORD dwTime, DWORD dwFlags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "AnimateWindow()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "AnimateWindow()"_lit);
   return AnimateWindow_(hWnd, dwTime, dwFlags);
 }
 
 WINBOOL APIUser32::UpdateLayeredWindow (HWND hWnd, HDC hdcDst, POINT * pptDst, SIZE * psize, HDC hdcSrc, POINT * pptSrc, COLORREF crKey, BLENDFUNCTION * pblend, DWORD dwFlags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "UpdateLayeredWindow()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "UpdateLayeredWindow()"_lit);
   return UpdateLayeredWindow_(hWnd, hdcDst, pptDst, psize, hdcSrc, pptSrc, crKey, pblend, dwFlags);
 }
 
 WINBOOL APIUser32::UpdateLayeredWindowIndirect (HWND hWnd, const UPDATELAYEREDWINDOWINFO * pULWInfo)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "UpdateLayeredWindowIndirect()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "UpdateLayeredWindowIndirect()"_lit);
   return UpdateLayeredWindowIndirect_(hWnd, pULWInfo);
 }
 
 WINBOOL APIUser32::GetLayeredWindowAttributes (HWND hwnd, COLORREF * pcrKey, BYTE * pbAlpha, DWORD * pdwFlags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetLayeredWindowAttributes()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetLayeredWindowAttributes()"_lit);
   return GetLayeredWindowAttributes_(hwnd, pcrKey, pbAlpha, pdwFlags);
 }
 
 WINBOOL APIUser32::PrintWindow (HWND hwnd, HDC hdcBlt, UINT nFlags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "PrintWindow()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "PrintWindow()"_lit);
   return PrintWindow_(hwnd, hdcBlt, nFlags);
 }
 
 WINBOOL APIUser32::SetLayeredWindowAttributes (HWND hwnd, COLORREF crKey, BYTE bAlpha, DWORD dwFlags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetLayeredWindowAttributes()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SetLayeredWindowAttributes()"_lit);
   return SetLayeredWindowAttributes_(hwnd, crKey, bAlpha, dwFlags);
 }
 
 WINBOOL APIUser32::ShowWindowAsync (HWND hWnd, int nCmdShow)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ShowWindowAsync()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "ShowWindowAsync()"_lit);
   return ShowWindowAsync_(hWnd, nCmdShow);
 }
 
 WINBOOL APIUser32::FlashWindow (HWND hWnd, WINBOOL bInvert)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "FlashWindow()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "FlashWindow()"_lit);
   return FlashWindow_(hWnd, bInvert);
 }
 
 WINBOOL APIUser32::FlashWindowEx (PFLASHWINFO pfwi)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "FlashWindowEx()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "FlashWindowEx()"_lit);
   return FlashWindowEx_(pfwi);
 }
 
 WINBOOL APIUser32::ShowOwnedPopups (HWND hWnd, WINBOOL fShow)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ShowOwnedPopups()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "ShowOwnedPopups()"_lit);
   return ShowOwnedPopups_(hWnd, fShow);
 }
 
 WINBOOL APIUser32::OpenIcon (HWND hWnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "OpenIcon()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "OpenIcon()"_lit);
   return OpenIcon_(hWnd);
 }
 
 WINBOOL APIUser32::CloseWindow (HWND hWnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CloseWindow()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "CloseWindow()"_lit);
   return CloseWindow_(hWnd);
 }
 
 WINBOOL APIUser32::MoveWindow (HWND hWnd, int X, int Y, int nWidth, int nHeight, WINBOOL bRepaint)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "MoveWindow()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "MoveWindow()"_lit);
   return MoveWindow_(hWnd, X, Y, nWidth, nHeight, bRepaint);
 }
 
 WINBOOL APIUser32::SetWindowPos (HWND hWnd, HWND hWndInsertAfter, int X, int Y, int cx, int cy, UINT uFlags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetWindowPos()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SetWindowPos()"_lit);
   return SetWindowPos_(hWnd, hWndInsertAfter, X, Y, cx, cy, uFlags);
 }
 
 WINBOOL APIUser32::GetWindowPlacement (HWND hWnd, WINDOWPLACEMENT * lpwndpl)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetWindowPlacement()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetWindowPlacement()"_lit);
   return GetWindowPlacement_(hWnd, lpwndpl);
 }
 
 WINBOOL APIUser32::SetWindowPlacement (HWND hWnd, CONST WINDOWPLACEMENT * lpwndpl)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetWindowPlacement()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SetWindowPlacement()"_lit);
   return SetWindowPlacement_(hWnd, lpwndpl);
 }
 
 WINBOOL APIUser32::GetWindowDisplayAffinity (HWND hWnd, DWORD * pdwAffinity)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetWindowDisplayAffinity()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetWindowDisplayAffinity()"_lit);
   return GetWindowDisplayAffinity_(hWnd, pdwAffinity);
 }
 
 WINBOOL APIUser32::SetWindowDisplayAffinity (HWND hWnd, DWORD dwAffinity)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetWindowDisplayAffinity()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SetWindowDisplayAffinity()"_lit);
   return SetWindowDisplayAffinity_(hWnd, dwAffinity);
 }
 
 HDWP APIUser32::BeginDeferWindowPos (int nNumWindows)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "BeginDeferWindowPos()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "BeginDeferWindowPos()"_lit);
   return BeginDeferWindowPos_(nNumWindows);
 }
 
 HDWP APIUser32::DeferWindowPos (HDWP hWinPosInfo, HWND hWnd, HWND hWndInsertAfter, int x, int y, int cx, int cy, UINT uFlags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DeferWindowPos()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "DeferWindowPos()"_lit);
   return DeferWindowPos_(hWinPosInfo, hWnd, hWndInsertAfter, x, y, cx, cy, uFlags);
 }
 
 WINBOOL APIUser32::EndDeferWindowPos (HDWP hWinPosInfo)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "EndDeferWindowPos()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "EndDeferWindowPos()"_lit);
   return EndDeferWindowPos_(hWinPosInfo);
 }
 
 WINBOOL APIUser32::IsWindowVisible (HWND hWnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "IsWindowVisible()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "IsWindowVisible()"_lit);
   return IsWindowVisible_(hWnd);
 }
 
 WINBOOL APIUser32::IsIconic (HWND hWnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "IsIconic()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "IsIconic()"_lit);
   return IsIconic_(hWnd);
 }
 
 WINBOOL APIUser32::AnyPopup (VOID)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "AnyPopup()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "AnyPopup()"_lit);
   return AnyPopup_();
 }
 
 WINBOOL APIUser32::BringWindowToTop (HWND hWnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "BringWindowToTop()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "BringWindowToTop()"_lit);
   return BringWindowToTop_(hWnd);
 }
 
 WINBOOL APIUser32::IsZoomed (HWND hWnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "IsZoomed()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "IsZoomed()"_lit);
   return IsZoomed_(hWnd);
 }
 
 HWND APIUser32::CreateDialogParamA (HINSTANCE hInstance, LPCSTR lpTemplateName, HWND hWndParent, DLGPROC lpDialogFunc, LPARAM dwInitParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CreateDialogParamA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "CreateDialogParamA()"_lit);
   return CreateDialogParamA_(hInstance, lpTemplateName, hWndParent, lpDialogFunc, dwInitParam);
 }
 
 HWND APIUser32::CreateDialogParamW (HINSTANCE hInstance, LPCWSTR lpTemplateName, HWND hWndParent, DLGPROC lpDialogFunc, LPARAM dwInitParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CreateDialogParamW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "CreateDialogParamW()"_lit);
   return CreateDialogParamW_(hInstance, lpTemplateName, hWndParent, lpDialogFunc, dwInitParam);
 }
 
 HWND APIUser32::CreateDialogIndirectParamA (HINSTANCE hInstance, LPCDLGTEMPLATEA lpTemplate, HWND hWndParent, DLGPROC lpDialogFunc, LPARAM dwInitParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CreateDialogIndirectParamA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "CreateDialogIndirectParamA()"_lit);
   return CreateDialogIndirectParamA_(hInstance, lpTemplate, hWndParent, lpDialogFunc, dwInitParam);
 }
 
 HWND APIUser32::CreateDialogIndirectParamW (HINSTANCE hInstance, LPCDLGTEMPLATEW lpTemplate, HWND hWndParent, DLGPROC lpDialogFunc, LPARAM dwInitParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CreateDialogIndirectParamW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "CreateDialogIndirectParamW()"_lit);
   return CreateDialogIndirectParamW_(hInstance, lpTemplate, hWndParent, lpDialogFunc, dwInitParam);
 }
 
 INT_PTR APIUser32::DialogBoxParamA (HINSTANCE hInstance, LPCSTR lpTemplateName, HWND hWndParent, DLGPROC lpDialogFunc, LPARAM dwInitParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DialogBoxParamA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "DialogBoxParamA()"_lit);
   return DialogBoxParamA_(hInstance, lpTemplateName, hWndParent, lpDialogFunc, dwInitParam);
 }
 
 INT_PTR APIUser32::DialogBoxParamW (HINSTANCE hInstance, LPCWSTR lpTemplateName, HWND hWndParent, DLGPROC lpDialogFunc, LPARAM dwInitParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DialogBoxParamW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "DialogBoxParamW()"_lit);
   return DialogBoxParamW_(hInstance, lpTemplateName, hWndParent, lpDialogFunc, dwInitParam);
 }
 
 INT_PTR APIUser32::DialogBoxIndirectParamA (HINSTANCE hInstance, LPCDLGTEMPLATEA hDialogTemplate, HWND hWndParent, DLGPROC lpDialogFunc, LPARAM dwInitParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DialogBoxIndirectParamA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "DialogBoxIndirectParamA()"_lit);
   return DialogBoxIndirectParamA_(hInstance, hDialogTemplate, hWndParent, lpDialogFunc, dwInitParam);
 }
 
 INT_PTR APIUser32::DialogBoxIndirectParamW (HINSTANCE hInstance, LPCDLGTEMPLATEW hDialogTemplate, HWND hWndParent, DLGPROC lpDialogFunc, LPARAM dwInitParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DialogBoxIndirectParamW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "DialogBoxIndirectParamW()"_lit);
   return DialogBoxIndirectParamW_(hInstance, hDialogTemplate, hWndParent, lpDialogFunc, dwInitParam);
 }
 
 WINBOOL APIUser32::EndDialog (HWND hDlg, INT_PTR nResult)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "EndDialog()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "EndDialog()"_lit);
   return EndDialog_(hDlg, nResult);
 }
 
 HWND APIUser32::GetDlgItem (HWND hDlg, int nIDDlgItem)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetDlgItem()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetDlgItem()"_lit);
   return GetDlgItem_(hDlg, nIDDlgItem);
 }
 
 WINBOOL APIUser32::SetDlgItemInt (HWND hDlg, int nIDDlgItem, UINT uValue, WINBOOL bSigned)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetDlgItemInt()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SetDlgItemInt()"_lit);
   return SetDlgItemInt_(hDlg, nIDDlgItem, uValue, bSigned);
 }
 
 UINT APIUser32::GetDlgItemInt (HWND hDlg, int nIDDlgItem, WINBOOL * lpTranslated, WINBOOL bSigned)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetDlgItemInt()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetDlgItemInt()"_lit);
   return GetDlgItemInt_(hDlg, nIDDlgItem, lpTranslated, bSigned);
 }
 
 WINBOOL APIUser32::SetDlgItemTextA (HWND hDlg, int nIDDlgItem, LPCSTR lpString)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetDlgItemTextA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SetDlgItemTextA()"_lit);
   return SetDlgItemTextA_(hDlg, nIDDlgItem, lpString);
 }
 
 WINBOOL APIUser32::SetDlgItemTextW (HWND hDlg, int nIDDlgItem, LPCWSTR lpString)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetDlgItemTextW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SetDlgItemTextW()"_lit);
   return SetDlgItemTextW_(hDlg, nIDDlgItem, lpString);
 }
 
 UINT APIUser32::GetDlgItemTextA (HWND hDlg, int nIDDlgItem, LPSTR lpString, int cchMax)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetDlgItemTextA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetDlgItemTextA()"_lit);
   return GetDlgItemTextA_(hDlg, nIDDlgItem, lpString, cchMax);
 }
 
 UINT APIUser32::GetDlgItemTextW (HWND hDlg, int nIDDlgItem, LPWSTR lpString, int cchMax)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetDlgItemTextW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetDlgItemTextW()"_lit);
   return GetDlgItemTextW_(hDlg, nIDDlgItem, lpString, cchMax);
 }
 
 WINBOOL APIUser32::CheckDlgButton (HWND hDlg, int nIDButton, UINT uCheck)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CheckDlgButton()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "CheckDlgButton()"_lit);
   return CheckDlgButton_(hDlg, nIDButton, uCheck);
 }
 
 WINBOOL APIUser32::CheckRadioButton (HWND hDlg, int nIDFirstButton, int nIDLastButton, int nIDCheckButton)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CheckRadioButton()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "CheckRadioButton()"_lit);
   return CheckRadioButton_(hDlg, nIDFirstButton, nIDLastButton, nIDCheckButton);
 }
 
 UINT APIUser32::IsDlgButtonChecked (HWND hDlg, int nIDButton)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "IsDlgButtonChecked()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "IsDlgButtonChecked()"_lit);
   return IsDlgButtonChecked_(hDlg, nIDButton);
 }
 
 LRESULT APIUser32::SendDlgItemMessageA (HWND hDlg, int nIDDlgItem, UINT Msg, WPARAM wParam, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SendDlgItemMessageA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SendDlgItemMessageA()"_lit);
   return SendDlgItemMessageA_(hDlg, nIDDlgItem, Msg, wParam, lParam);
 }
 
 LRESULT APIUser32::SendDlgItemMessageW (HWND hDlg, int nIDDlgItem, UINT Msg, WPARAM wParam, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SendDlgItemMessageW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SendDlgItemMessageW()"_lit);
   return SendDlgItemMessageW_(hDlg, nIDDlgItem, Msg, wParam, lParam);
 }
 
 HWND APIUser32::GetNextDlgGroupItem (HWND hDlg, HWND hCtl, WINBOOL bPrevious)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetNextDlgGroupItem()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetNextDlgGroupItem()"_lit);
   return GetNextDlgGroupItem_(hDlg, hCtl, bPrevious);
 }
 
 HWND APIUser32::GetNextDlgTabItem (HWND hDlg, HWND hCtl, WINBOOL bPrevious)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetNextDlgTabItem()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetNextDlgTabItem()"_lit);
   return GetNextDlgTabItem_(hDlg, hCtl, bPrevious);
 }
 
 int APIUser32::GetDlgCtrlID (HWND hWnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetDlgCtrlID()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetDlgCtrlID()"_lit);
   return GetDlgCtrlID_(hWnd);
 }
 
 LONG APIUser32::GetDialogBaseUnits (VOID)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetDialogBaseUnits()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetDialogBaseUnits()"_lit);
   return GetDialogBaseUnits_();
 }
 
 LRESULT APIUser32::DefDlgProcA (HWND hDlg, UINT Msg, WPARAM wParam, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DefDlgProcA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "DefDlgProcA()"_lit);
   return DefDlgProcA_(hDlg, Msg, wParam, lParam);
 }
 
 LRESULT APIUser32::DefDlgProcW (HWND hDlg, UINT Msg, WPARAM wParam, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DefDlgProcW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "DefDlgProcW()"_lit);
   return DefDlgProcW_(hDlg, Msg, wParam, lParam);
 }
 
 WINBOOL APIUser32::CallMsgFilterA (LPMSG lpMsg, int nCode)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CallMsgFilterA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "CallMsgFilterA()"_lit);
   return CallMsgFilterA_(lpMsg, nCode);
 }
 
 WINBOOL APIUser32::CallMsgFilterW (LPMSG lpMsg, int nCode)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CallMsgFilterW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "CallMsgFilterW()"_lit);
   return CallMsgFilterW_(lpMsg, nCode);
 }
 
 WINBOOL APIUser32::OpenClipboard (HWND hWndNewOwner)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "OpenClipboard()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "OpenClipboard()"_lit);
   return OpenClipboard_(hWndNewOwner);
 }
 
 WINBOOL APIUser32::CloseClipboard (VOID)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CloseClipboard()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "CloseClipboard()"_lit);
   return CloseClipboard_();
 }
 
 DWORD APIUser32::GetClipboardSequenceNumber (VOID)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetClipboardSequenceNumber()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetClipboardSequenceNumber()"_lit);
   return GetClipboardSequenceNumber_();
 }
 
 HWND APIUser32::GetClipboardOwner (VOID)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetClipboardOwner()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetClipboardOwner()"_lit);
   return GetClipboardOwner_();
 }
 
 HWND APIUser32::SetClipboardViewer (HWND hWndNewViewer)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetClipboardViewer()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SetClipboardViewer()"_lit);
   return SetClipboardViewer_(hWndNewViewer);
 }
 
 HWND APIUser32::GetClipboardViewer (VOID)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetClipboardViewer()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetClipboardViewer()"_lit);
   return GetClipboardViewer_();
 }
 
 WINBOOL APIUser32::ChangeClipboardChain (HWND hWndRemove, HWND hWndNewNext)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ChangeClipboardChain()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "ChangeClipboardChain()"_lit);
   return ChangeClipboardChain_(hWndRemove, hWndNewNext);
 }
 
 HANDLE APIUser32::SetClipboardData (UINT uFormat, HANDLE hMem)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetClipboardData()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SetClipboardData()"_lit);
   return SetClipboardData_(uFormat, hMem);
 }
 
 HANDLE APIUser32::GetClipboardData (UINT uFormat)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetClipboardData()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetClipboardData()"_lit);
   return GetClipboardData_(uFormat);
 }
 
 UINT APIUser32::RegisterClipboardFormatA (LPCSTR lpszFormat)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "RegisterClipboardFormatA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "RegisterClipboardFormatA()"_lit);
   return RegisterClipboardFormatA_(lpszFormat);
 }
 
 UINT APIUser32::RegisterClipboardFormatW (LPCWSTR lpszFormat)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "RegisterClipboardFormatW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "RegisterClipboardFormatW()"_lit);
   return RegisterClipboardFormatW_(lpszFormat);
 }
 
 int APIUser32::CountClipboardFormats (VOID)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CountClipboardFormats()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "CountClipboardFormats()"_lit);
   return CountClipboardFormats_();
 }
 
 UINT APIUser32::EnumClipboardFormats (UINT format)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "EnumClipboardFormats()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "EnumClipboardFormats()"_lit);
   return EnumClipboardFormats_(format);
 }
 
 int APIUser32::GetClipboardFormatNameA (UINT format, LPSTR lpszFormatName, int cchMaxCount)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetClipboardFormatNameA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetClipboardFormatNameA()"_lit);
   return GetClipboardFormatNameA_(format, lpszFormatName, cchMaxCount);
 }
 
 int APIUser32::GetClipboardFormatNameW (UINT format, LPWSTR lpszFormatName, int cchMaxCount)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetClipboardFormatNameW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetClipboardFormatNameW()"_lit);
   return GetClipboardFormatNameW_(format, lpszFormatName, cchMaxCount);
 }
 
 WINBOOL APIUser32::EmptyClipboard (VOID)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "EmptyClipboard()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "EmptyClipboard()"_lit);
   return EmptyClipboard_();
 }
 
 WINBOOL APIUser32::IsClipboardFormatAvailable (UINT format)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "IsClipboardFormatAvailable()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "IsClipboardFormatAvailable()"_lit);
   return IsClipboardFormatAvailable_(format);
 }
 
 int APIUser32::GetPriorityClipboardFormat (UINT * paFormatPriorityList, int cFormats)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetPriorityClipboardFormat()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetPriorityClipboardFormat()"_lit);
   return GetPriorityClipboardFormat_(paFormatPriorityList, cFormats);
 }
 
 HWND APIUser32::GetOpenClipboardWindow (VOID)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetOpenClipboardWindow()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetOpenClipboardWindow()"_lit);
   return GetOpenClipboardWindow_();
 }
 
 WINBOOL APIUser32::AddClipboardFormatListener (HWND hwnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "AddClipboardFormatListener()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "AddClipboardFormatListener()"_lit);
   return AddClipboardFormatListener_(hwnd);
 }
 
 WINBOOL APIUser32::RemoveClipboardFormatListener (HWND hwnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "RemoveClipboardFormatListener()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "RemoveClipboardFormatListener()"_lit);
   return RemoveClipboardFormatListener_(hwnd);
 }
 
 WINBOOL APIUser32::GetUpdatedClipboardFormats (PUINT lpuiFormats, UINT cFormats, PUINT pcFormatsOut)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetUpdatedClipboardFormats()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetUpdatedClipboardFormats()"_lit);
   return GetUpdatedClipboardFormats_(lpuiFormats, cFormats, pcFormatsOut);
 }
 
 WINBOOL APIUser32::CharToOemA (LPCSTR lpszSrc, LPSTR lpszDst)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CharToOemA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "CharToOemA()"_lit);
   return CharToOemA_(lpszSrc, lpszDst);
 }
 
 WINBOOL APIUser32::CharToOemW (LPCWSTR lpszSrc, LPSTR lpszDst)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CharToOemW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "CharToOemW()"_lit);
   return CharToOemW_(lpszSrc, lpszDst);
 }
 
 WINBOOL APIUser32::OemToCharA (LPCSTR lpszSrc, LPSTR lpszDst)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "OemToCharA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "OemToCharA()"_lit);
   return OemToCharA_(lpszSrc, lpszDst);
 }
 
 WINBOOL APIUser32::OemToCharW (LPCSTR lpszSrc, LPWSTR lpszDst)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "OemToCharW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "OemToCharW()"_lit);
   return OemToCharW_(lpszSrc, lpszDst);
 }
 
 WINBOOL APIUser32::CharToOemBuffA (LPCSTR lpszSrc, LPSTR lpszDst, DWORD cchDstLength)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CharToOemBuffA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "CharToOemBuffA()"_lit);
   return CharToOemBuffA_(lpszSrc, lpszDst, cchDstLength);
 }
 
 WINBOOL APIUser32::CharToOemBuffW (LPCWSTR lpszSrc, LPSTR lpszDst, DWORD cchDstLength)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CharToOemBuffW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "CharToOemBuffW()"_lit);
   return CharToOemBuffW_(lpszSrc, lpszDst, cchDstLength);
 }
 
 WINBOOL APIUser32::OemToCharBuffA (LPCSTR lpszSrc, LPSTR lpszDst, DWORD cchDstLength)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "OemToCharBuffA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "OemToCharBuffA()"_lit);
   return OemToCharBuffA_(lpszSrc, lpszDst, cchDstLength);
 }
 
 WINBOOL APIUser32::OemToCharBuffW (LPCSTR lpszSrc, LPWSTR lpszDst, DWORD cchDstLength)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "OemToCharBuffW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "OemToCharBuffW()"_lit);
   return OemToCharBuffW_(lpszSrc, lpszDst, cchDstLength);
 }
 
 LPSTR APIUser32::CharUpperA (LPSTR lpsz)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CharUpperA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "CharUpperA()"_lit);
   return CharUpperA_(lpsz);
 }
 
 LPWSTR APIUser32::CharUpperW (LPWSTR lpsz)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CharUpperW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "CharUpperW()"_lit);
   return CharUpperW_(lpsz);
 }
 
 DWORD APIUser32::CharUpperBuffA (LPSTR lpsz, DWORD cchLength)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CharUpperBuffA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "CharUpperBuffA()"_lit);
   return CharUpperBuffA_(lpsz, cchLength);
 }
 
 DWORD APIUser32::CharUpperBuffW (LPWSTR lpsz, DWORD cchLength)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CharUpperBuffW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "CharUpperBuffW()"_lit);
   return CharUpperBuffW_(lpsz, cchLength);
 }
 
 LPSTR APIUser32::CharLowerA (LPSTR lpsz)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CharLowerA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "CharLowerA()"_lit);
   return CharLowerA_(lpsz);
 }
 
 LPWSTR APIUser32::CharLowerW (LPWSTR lpsz)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CharLowerW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "CharLowerW()"_lit);
   return CharLowerW_(lpsz);
 }
 
 DWORD APIUser32::CharLowerBuffA (LPSTR lpsz, DWORD cchLength)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CharLowerBuffA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "CharLowerBuffA()"_lit);
   return CharLowerBuffA_(lpsz, cchLength);
 }
 
 DWORD APIUser32::CharLowerBuffW (LPWSTR lpsz, DWORD cchLength)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CharLowerBuffW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "CharLowerBuffW()"_lit);
   return CharLowerBuffW_(lpsz, cchLength);
 }
 
 LPSTR APIUser32::CharNextA (LPCSTR lpsz)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CharNextA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "CharNextA()"_lit);
   return CharNextA_(lpsz);
 }
 
 LPWSTR APIUser32::CharNextW (LPCWSTR lpsz)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CharNextW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "CharNextW()"_lit);
   return CharNextW_(lpsz);
 }
 
 LPSTR APIUser32::CharPrevA (LPCSTR lpszStart, LPCSTR lpszCurrent)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CharPrevA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "CharPrevA()"_lit);
   return CharPrevA_(lpszStart, lpszCurrent);
 }
 
 LPWSTR APIUser32::CharPrevW (LPCWSTR lpszStart, LPCWSTR lpszCurrent)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CharPrevW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "CharPrevW()"_lit);
   return CharPrevW_(lpszStart, lpszCurrent);
 }
 
 LPSTR APIUser32::CharNextExA (WORD CodePage, LPCSTR lpCurrentChar, DWORD dwFlags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CharNextExA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "CharNextExA()"_lit);
   return CharNextExA_(CodePage, lpCurrentChar, dwFlags);
 }
 
 LPSTR APIUser32::CharPrevExA (WORD CodePage, LPCSTR lpStart, LPCSTR lpCurrentChar, DWORD dwFlags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CharPrevExA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "CharPrevExA()"_lit);
   return CharPrevExA_(CodePage, lpStart, lpCurrentChar, dwFlags);
 }
 
 WINBOOL APIUser32::IsCharAlphaA (CHAR ch)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "IsCharAlphaA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "IsCharAlphaA()"_lit);
   return IsCharAlphaA_(ch);
 }
 
 WINBOOL APIUser32::IsCharAlphaW (WCHAR ch)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "IsCharAlphaW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "IsCharAlphaW()"_lit);
   return IsCharAlphaW_(ch);
 }
 
 WINBOOL APIUser32::IsCharAlphaNumericA (CHAR ch)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "IsCharAlphaNumericA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "IsCharAlphaNumericA()"_lit);
   return IsCharAlphaNumericA_(ch);
 }
 
 WINBOOL APIUser32::IsCharAlphaNumericW (WCHAR ch)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "IsCharAlphaNumericW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "IsCharAlphaNumericW()"_lit);
   return IsCharAlphaNumericW_(ch);
 }
 
 WINBOOL APIUser32::IsCharUpperA (CHAR ch)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "IsCharUpperA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "IsCharUpperA()"_lit);
   return IsCharUpperA_(ch);
 }
 
 WINBOOL APIUser32::IsCharUpperW (WCHAR ch)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "IsCharUpperW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "IsCharUpperW()"_lit);
   return IsCharUpperW_(ch);
 }
 
 WINBOOL APIUser32::IsCharLowerA (CHAR ch)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "IsCharLowerA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "IsCharLowerA()"_lit);
   return IsCharLowerA_(ch);
 }
 
 WINBOOL APIUser32::IsCharLowerW (WCHAR ch)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "IsCharLowerW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "IsCharLowerW()"_lit);
   return IsCharLowerW_(ch);
 }
 
 HWND APIUser32::SetFocus (HWND hWnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetFocus()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SetFocus()"_lit);
   return SetFocus_(hWnd);
 }
 
 HWND APIUser32::GetActiveWindow (VOID)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetActiveWindow()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetActiveWindow()"_lit);
   return GetActiveWindow_();
 }
 
 HWND APIUser32::GetFocus (VOID)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetFocus()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetFocus()"_lit);
   return GetFocus_();
 }
 
 UINT APIUser32::GetKBCodePage (VOID)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetKBCodePage()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetKBCodePage()"_lit);
   return GetKBCodePage_();
 }
 
 SHORT APIUser32::GetKeyState (int nVirtKey)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetKeyState()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetKeyState()"_lit);
   return GetKeyState_(nVirtKey);
 }
 
 SHORT APIUser32::GetAsyncKeyState (int vKey)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetAsyncKeyState()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetAsyncKeyState()"_lit);
   return GetAsyncKeyState_(vKey);
 }
 
 WINBOOL APIUser32::GetKeyboardState (PBYTE lpKeyState)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetKeyboardState()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetKeyboardState()"_lit);
   return GetKeyboardState_(lpKeyState);
 }
 
 WINBOOL APIUser32::SetKeyboardState (LPBYTE lpKeyState)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetKeyboardState()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SetKeyboardState()"_lit);
   return SetKeyboardState_(lpKeyState);
 }
 
 int APIUser32::GetKeyNameTextA (LONG lParam, LPSTR lpString, int cchSize)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetKeyNameTextA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetKeyNameTextA()"_lit);
   return GetKeyNameTextA_(lParam, lpString, cchSize);
 }
 
 int APIUser32::GetKeyNameTextW (LONG lParam, LPWSTR lpString, int cchSize)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetKeyNameTextW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetKeyNameTextW()"_lit);
   return GetKeyNameTextW_(lParam, lpString, cchSize);
 }
 
 int APIUser32::GetKeyboardType (int nTypeFlag)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetKeyboardType()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetKeyboardType()"_lit);
   return GetKeyboardType_(nTypeFlag);
 }
 
 int APIUser32::ToAscii (UINT uVirtKey, UINT uScanCode, CONST BYTE * lpKeyState, LPWORD lpChar, UINT uFlags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ToAscii()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "ToAscii()"_lit);
   return ToAscii_(uVirtKey, uScanCode, lpKeyState, lpChar, uFlags);
 }
 
 int APIUser32::ToAsciiEx (UINT uVirtKey, UINT uScanCode, CONST BYTE * lpKeyState, LPWORD lpChar, UINT uFlags, HKL dwhkl)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ToAsciiEx()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "ToAsciiEx()"_lit);
   return ToAsciiEx_(uVirtKey, uScanCode, lpKeyState, lpChar, uFlags, dwhkl);
 }
 
 int APIUser32::ToUnicode (UINT wVirtKey, UINT wScanCode, CONST BYTE * lpKeyState, LPWSTR pwszBuff, int cchBuff, UINT wFlags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ToUnicode()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "ToUnicode()"_lit);
   return ToUnicode_(wVirtKey, wScanCode, lpKeyState, pwszBuff, cchBuff, wFlags);
 }
 
 DWORD APIUser32::OemKeyScan (WORD wOemChar)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "OemKeyScan()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "OemKeyScan()"_lit);
   return OemKeyScan_(wOemChar);
 }
 
 SHORT APIUser32::VkKeyScanA (CHAR ch)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "VkKeyScanA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "VkKeyScanA()"_lit);
   return VkKeyScanA_(ch);
 }
 
 SHORT APIUser32::VkKeyScanW (WCHAR ch)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "VkKeyScanW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "VkKeyScanW()"_lit);
   return VkKeyScanW_(ch);
 }
 
 SHORT APIUser32::VkKeyScanExA (CHAR ch, HKL dwhkl)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "VkKeyScanExA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "VkKeyScanExA()"_lit);
   return VkKeyScanExA_(ch, dwhkl);
 }
 
 SHORT APIUser32::VkKeyScanExW (WCHAR ch, HKL dwhkl)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "VkKeyScanExW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "VkKeyScanExW()"_lit);
   return VkKeyScanExW_(ch, dwhkl);
 }
 
 VOID APIUser32::keybd_event (BYTE bVk, BYTE bScan, DWORD dwFlags, ULONG_PTR dwExtraInfo)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "keybd_event()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "keybd_event()"_lit);
   keybd_event_(bVk, bScan, dwFlags, dwExtraInfo);
 }
 
 VOID APIUser32::mouse_event (DWORD dwFlags, DWORD dx, DWORD dy, DWORD dwData, ULONG_PTR dwExtraInfo)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "mouse_event()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "mouse_event()"_lit);
   mouse_event_(dwFlags, dx, dy, dwData, dwExtraInfo);
 }
 
 UINT APIUser32::SendInput (UINT cInputs, LPINPUT pInputs, int cbSize)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SendInput()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SendInput()"_lit);
   return SendInput_(cInputs, pInputs, cbSize);
 }
 
 WINBOOL APIUser32::GetTouchInputInfo (HTOUCHINPUT hTouchInput, UINT cInputs, PTOUCHINPUT pInputs, int cbSize)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetTouchInputInfo()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetTouchInputInfo()"_lit);
   return GetTouchInputInfo_(hTouchInput, cInputs, pInputs, cbSize);
 }
 
 WINBOOL APIUser32::CloseTouchInputHandle (HTOUCHINPUT hTouchInput)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CloseTouchInputHandle()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "CloseTouchInputHandle()"_lit);
   return CloseTouchInputHandle_(hTouchInput);
 }
 
 WINBOOL APIUser32::RegisterTouchWindow (HWND hwnd, ULONG ulFlags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "RegisterTouchWindow()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "RegisterTouchWindow()"_lit);
   return RegisterTouchWindow_(hwnd, ulFlags);
 }
 
 WINBOOL APIUser32::UnregisterTouchWindow (HWND hwnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "UnregisterTouchWindow()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "UnregisterTouchWindow()"_lit);
   return UnregisterTouchWindow_(hwnd);
 }
 
 WINBOOL APIUser32::IsTouchWindow (HWND hwnd, PULONG pulFlags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "IsTouchWindow()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "IsTouchWindow()"_lit);
   return IsTouchWindow_(hwnd, pulFlags);
 }
 
 WINBOOL APIUser32::InitializeTouchInjection (UINT32 maxCount, DWORD dwMode)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "InitializeTouchInjection()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "InitializeTouchInjection()"_lit);
   return InitializeTouchInjection_(maxCount, dwMode);
 }
 
 WINBOOL APIUser32::InjectTouchInput (UINT32 count, CONST POINTER_TOUCH_INFO * contacts)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "InjectTouchInput()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "InjectTouchInput()"_lit);
   return InjectTouchInput_(count, contacts);
 }
 
 WINBOOL APIUser32::GetPointerType (UINT32 pointerId, POINTER_INPUT_TYPE * pointerType)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetPointerType()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetPointerType()"_lit);
   return GetPointerType_(pointerId, pointerType);
 }
 
 WINBOOL APIUser32::GetPointerCursorId (UINT32 pointerId, UINT32 * cursorId)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetPointerCursorId()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetPointerCursorId()"_lit);
   return GetPointerCursorId_(pointerId, cursorId);
 }
 
 WINBOOL APIUser32::GetPointerInfo (UINT32 pointerId, POINTER_INFO * pointerInfo)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetPointerInfo()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetPointerInfo()"_lit);
   return GetPointerInfo_(pointerId, pointerInfo);
 }
 
 WINBOOL APIUser32::GetPointerInfoHistory (UINT32 pointerId, UINT32 * entriesCount, POINTER_INFO * pointerInfo)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetPointerInfoHistory()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetPointerInfoHistory()"_lit);
   return GetPointerInfoHistory_(pointerId, entriesCount, pointerInfo);
 }
 
 WINBOOL APIUser32::GetPointerFrameInfo (UINT32 pointerId, UINT32 * pointerCount, POINTER_INFO * pointerInfo)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetPointerFrameInfo()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetPointerFrameInfo()"_lit);
   return GetPointerFrameInfo_(pointerId, pointerCount, pointerInfo);
 }
 
 WINBOOL APIUser32::GetPointerFrameInfoHistory (UINT32 pointerId, UINT32 * entriesCount, UINT32 * pointerCount, POINTER_INFO * pointerInfo)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetPointerFrameInfoHistory()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetPointerFrameInfoHistory()"_lit);
   return GetPointerFrameInfoHistory_(pointerId, entriesCount, pointerCount, pointerInfo);
 }
 
 WINBOOL APIUser32::GetPointerTouchInfo (UINT32 pointerId, POINTER_TOUCH_INFO * touchInfo)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetPointerTouchInfo()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetPointerTouchInfo()"_lit);
   return GetPointerTouchInfo_(pointerId, touchInfo);
 }
 
 WINBOOL APIUser32::GetPointerTouchInfoHistory (UINT32 pointerId, UINT32 * entriesCount, POINTER_TOUCH_INFO * touchInfo)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetPointerTouchInfoHistory()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetPointerTouchInfoHistory()"_lit);
   return GetPointerTouchInfoHistory_(pointerId, entriesCount, touchInfo);
 }
 
 WINBOOL APIUser32::GetPointerFrameTouchInfo (UINT32 pointerId, UINT32 * pointerCount, POINTER_TOUCH_INFO * touchInfo)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetPointerFrameTouchInfo()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetPointerFrameTouchInfo()"_lit);
   return GetPointerFrameTouchInfo_(pointerId, pointerCount, touchInfo);
 }
 
 WINBOOL APIUser32::GetPointerFrameTouchInfoHistory (UINT32 pointerId, UINT32 * entriesCount, UINT32 * pointerCount, POINTER_TOUCH_INFO * touchInfo)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetPointerFrameTouchInfoHistory()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetPointerFrameTouchInfoHistory()"_lit);
   return GetPointerFrameTouchInfoHistory_(pointerId, entriesCount, pointerCount, touchInfo);
 }
 
 WINBOOL APIUser32::GetPointerPenInfo (UINT32 pointerId, POINTER_PEN_INFO * penInfo)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetPointerPenInfo()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetPointerPenInfo()"_lit);
   return GetPointerPenInfo_(pointerId, penInfo);
 }
 
 WINBOOL APIUser32::GetPointerPenInfoHistory (UINT32 pointerId, UINT32 * entriesCount, POINTER_PEN_INFO * penInfo)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetPointerPenInfoHistory()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetPointerPenInfoHistory()"_lit);
   return GetPointerPenInfoHistory_(pointerId, entriesCount, penInfo);
 }
 
 WINBOOL APIUser32::GetPointerFramePenInfo (UINT32 pointerId, UINT32 * pointerCount, POINTER_PEN_INFO * penInfo)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetPointerFramePenInfo()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetPointerFramePenInfo()"_lit);
   return GetPointerFramePenInfo_(pointerId, pointerCount, penInfo);
 }
 
 WINBOOL APIUser32::GetPointerFramePenInfoHistory (UINT32 pointerId, UINT32 * entriesCount, UINT32 * pointerCount, POINTER_PEN_INFO * penInfo)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetPointerFramePenInfoHistory()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetPointerFramePenInfoHistory()"_lit);
   return GetPointerFramePenInfoHistory_(pointerId, entriesCount, pointerCount, penInfo);
 }
 
 WINBOOL APIUser32::SkipPointerFrameMessages (UINT32 pointerId)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SkipPointerFrameMessages()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SkipPointerFrameMessages()"_lit);
   return SkipPointerFrameMessages_(pointerId);
 }
 
 WINBOOL APIUser32::RegisterPointerInputTarget (HWND hwnd, POINTER_INPUT_TYPE pointerType)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "RegisterPointerInputTarget()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "RegisterPointerInputTarget()"_lit);
   return RegisterPointerInputTarget_(hwnd, pointerType);
 }
 
 WINBOOL APIUser32::UnregisterPointerInputTarget (HWND hwnd, POINTER_INPUT_TYPE pointerType)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "UnregisterPointerInputTarget()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "UnregisterPointerInputTarget()"_lit);
   return UnregisterPointerInputTarget_(hwnd, pointerType);
 }
 
 WINBOOL APIUser32::EnableMouseInPointer (WINBOOL fEnable)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "EnableMouseInPointer()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "EnableMouseInPointer()"_lit);
   return EnableMouseInPointer_(fEnable);
 }
 
 WINBOOL APIUser32::IsMouseInPointerEnabled (VOID)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "IsMouseInPointerEnabled()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "IsMouseInPointerEnabled()"_lit);
   return IsMouseInPointerEnabled_();
 }
 
 WINBOOL APIUser32::RegisterTouchHitTestingWindow (HWND hwnd, ULONG value)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "RegisterTouchHitTestingWindow()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "RegisterTouchHitTestingWindow()"_lit);
   return RegisterTouchHitTestingWindow_(hwnd, value);
 }
 
 WINBOOL APIUser32::EvaluateProximityToRect (const RECT * controlBoundingBox, const TOUCH_HIT_TESTING_INPUT * pHitTestingInput, TOUCH_HIT_TESTING_PROXIMITY_EVALUATION * pProximityEval)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "EvaluateProximityToRect()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "EvaluateProximityToRect()"_lit);
   return EvaluateProximityToRect_(controlBoundingBox, pHitTestingInput, pProximityEval);
 }
 
 WINBOOL APIUser32::EvaluateProximityToPolygon (UINT32 numVertices, const POINT * controlPolygon, const TOUCH_HIT_TESTING_INPUT * pHitTestingInput, TOUCH_HIT_TESTING_PROXIMITY_EVALUATION * pProximityEval)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "EvaluateProximityToPolygon()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "EvaluateProximityToPolygon()"_lit);
   return EvaluateProximityToPolygon_(numVertices, controlPolygon, pHitTestingInput, pProximityEval);
 }
 
 LRESULT APIUser32::PackTouchHitTestingProximityEvaluation (const TOUCH_HIT_TESTING_INPUT * pHitTestingInput, const TOUCH_HIT_TESTING_PROXIMITY_EVALUATION * pProximityEval)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "PackTouchHitTestingProximityEvaluation()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "PackTouchHitTestingProximityEvaluation()"_lit);
   return PackTouchHitTestingProximityEvaluation_(pHitTestingInput, pProximityEval);
 }
 
 WINBOOL APIUser32::GetWindowFeedbackSetting (HWND hwnd, FEEDBACK_TYPE feedback, DWORD dwFlags, UINT32 * pSize, VOID * config)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetWindowFeedbackSetting()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetWindowFeedbackSetting()"_lit);
   return GetWindowFeedbackSetting_(hwnd, feedback, dwFlags, pSize, config);
 }
 
 WINBOOL APIUser32::SetWindowFeedbackSetting (HWND hwnd, FEEDBACK_TYPE feedback, DWORD dwFlags, UINT32 size, CONST VOID * configuration)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetWindowFeedbackSetting()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SetWindowFeedbackSetting()"_lit);
   return SetWindowFeedbackSetting_(hwnd, feedback, dwFlags, size, configuration);
 }
 
 WINBOOL APIUser32::GetLastInputInfo (PLASTINPUTINFO plii)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetLastInputInfo()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetLastInputInfo()"_lit);
   return GetLastInputInfo_(plii);
 }
 
 UINT APIUser32::MapVirtualKeyA (UINT uCode, UINT uMapType)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "MapVirtualKeyA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "MapVirtualKeyA()"_lit);
   return MapVirtualKeyA_(uCode, uMapType);
 }
 
 UINT APIUser32::MapVirtualKeyW (UINT uCode, UINT uMapType)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "MapVirtualKeyW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "MapVirtualKeyW()"_lit);
   return MapVirtualKeyW_(uCode, uMapType);
 }
 
 UINT APIUser32::MapVirtualKeyExA (UINT uCode, UINT uMapType, HKL dwhkl)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "MapVirtualKeyExA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "MapVirtualKeyExA()"_lit);
   return MapVirtualKeyExA_(uCode, uMapType, dwhkl);
 }
 
 UINT APIUser32::MapVirtualKeyExW (UINT uCode, UINT uMapType, HKL dwhkl)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "MapVirtualKeyExW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "MapVirtualKeyExW()"_lit);
   return MapVirtualKeyExW_(uCode, uMapType, dwhkl);
 }
 
 WINBOOL APIUser32::GetInputState (VOID)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetInputState()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetInputState()"_lit);
   return GetInputState_();
 }
 
 DWORD APIUser32::GetQueueStatus (UINT flags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetQueueStatus()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetQueueStatus()"_lit);
   return GetQueueStatus_(flags);
 }
 
 HWND APIUser32::GetCapture (VOID)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetCapture()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetCapture()"_lit);
   return GetCapture_();
 }
 
 HWND APIUser32::SetCapture (HWND hWnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetCapture()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SetCapture()"_lit);
   return SetCapture_(hWnd);
 }
 
 WINBOOL APIUser32::ReleaseCapture (VOID)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ReleaseCapture()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "ReleaseCapture()"_lit);
   return ReleaseCapture_();
 }
 
 DWORD APIUser32::MsgWaitForMultipleObjects (DWORD nCount, CONST HANDLE * pHandles, WINBOOL fWaitAll, DWORD dwMilliseconds, DWORD dwWakeMask)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "MsgWaitForMultipleObjects()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "MsgWaitForMultipleObjects()"_lit);
   return MsgWaitForMultipleObjects_(nCount, pHandles, fWaitAll, dwMilliseconds, dwWakeMask);
 }
 
 DWORD APIUser32::MsgWaitForMultipleObjectsEx (DWORD nCount, CONST HANDLE * pHandles, DWORD dwMilliseconds, DWORD dwWakeMask, DWORD dwFlags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "MsgWaitForMultipleObjectsEx()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "MsgWaitForMultipleObjectsEx()"_lit);
   return MsgWaitForMultipleObjectsEx_(nCount, pHandles, dwMilliseconds, dwWakeMask, dwFlags);
 }
 
 UINT_PTR APIUser32::SetTimer (HWND hWnd, UINT_PTR nIDEvent, UINT uElapse, TIMERPROC lpTimerFunc)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetTimer()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SetTimer()"_lit);
   return SetTimer_(hWnd, nIDEvent, uElapse, lpTimerFunc);
 }
 
 WINBOOL APIUser32::KillTimer (HWND hWnd, UINT_PTR uIDEvent)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "KillTimer()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "KillTimer()"_lit);
   return KillTimer_(hWnd, uIDEvent);
 }
 
 WINBOOL APIUser32::IsWindowUnicode (HWND hWnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "IsWindowUnicode()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "IsWindowUnicode()"_lit);
   return IsWindowUnicode_(hWnd);
 }
 
 WINBOOL APIUser32::EnableWindow (HWND hWnd, WINBOOL bEnable)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "EnableWindow()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "EnableWindow()"_lit);
   return EnableWindow_(hWnd, bEnable);
 }
 
 WINBOOL APIUser32::IsWindowEnabled (HWND hWnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "IsWindowEnabled()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "IsWindowEnabled()"_lit);
   return IsWindowEnabled_(hWnd);
 }
 
 HACCEL APIUser32::LoadAcceleratorsA (HINSTANCE hInstance, LPCSTR lpTableName)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "LoadAcceleratorsA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "LoadAcceleratorsA()"_lit);
   return LoadAcceleratorsA_(hInstance, lpTableName);
 }
 
 HACCEL APIUser32::LoadAcceleratorsW (HINSTANCE hInstance, LPCWSTR lpTableName)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "LoadAcceleratorsW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "LoadAcceleratorsW()"_lit);
   return LoadAcceleratorsW_(hInstance, lpTableName);
 }
 
 HACCEL APIUser32::CreateAcceleratorTableA (LPACCEL paccel, int cAccel)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CreateAcceleratorTableA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "CreateAcceleratorTableA()"_lit);
   return CreateAcceleratorTableA_(paccel, cAccel);
 }
 
 HACCEL APIUser32::CreateAcceleratorTableW (LPACCEL paccel, int cAccel)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CreateAcceleratorTableW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "CreateAcceleratorTableW()"_lit);
   return CreateAcceleratorTableW_(paccel, cAccel);
 }
 
 WINBOOL APIUser32::DestroyAcceleratorTable (HACCEL hAccel)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DestroyAcceleratorTable()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "DestroyAcceleratorTable()"_lit);
   return DestroyAcceleratorTable_(hAccel);
 }
 
 int APIUser32::CopyAcceleratorTableA (HACCEL hAccelSrc, LPACCEL lpAccelDst, int cAccelEntries)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CopyAcceleratorTableA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "CopyAcceleratorTableA()"_lit);
   return CopyAcceleratorTableA_(hAccelSrc, lpAccelDst, cAccelEntries);
 }
 
 int APIUser32::CopyAcceleratorTableW (HACCEL hAccelSrc, LPACCEL lpAccelDst, int cAccelEntries)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CopyAcceleratorTableW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "CopyAcceleratorTableW()"_lit);
   return CopyAcceleratorTableW_(hAccelSrc, lpAccelDst, cAccelEntries);
 }
 
 int APIUser32::TranslateAcceleratorA (HWND hWnd, HACCEL hAccTable, LPMSG lpMsg)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "TranslateAcceleratorA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "TranslateAcceleratorA()"_lit);
   return TranslateAcceleratorA_(hWnd, hAccTable, lpMsg);
 }
 
 int APIUser32::TranslateAcceleratorW (HWND hWnd, HACCEL hAccTable, LPMSG lpMsg)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "TranslateAcceleratorW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "TranslateAcceleratorW()"_lit);
   return TranslateAcceleratorW_(hWnd, hAccTable, lpMsg);
 }
 
 UINT_PTR APIUser32::SetCoalescableTimer (HWND hWnd, UINT_PTR nIDEvent, UINT uElapse, TIMERPROC lpTimerFunc, ULONG uToleranceDelay)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetCoalescableTimer()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SetCoalescableTimer()"_lit);
   return SetCoalescableTimer_(hWnd, nIDEvent, uElapse, lpTimerFunc, uToleranceDelay);
 }
 
 int APIUser32::GetSystemMetrics (int nIndex)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetSystemMetrics()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetSystemMetrics()"_lit);
   return GetSystemMetrics_(nIndex);
 }
 
 HMENU APIUser32::LoadMenuA (HINSTANCE hInstance, LPCSTR lpMenuName)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "LoadMenuA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "LoadMenuA()"_lit);
   return LoadMenuA_(hInstance, lpMenuName);
 }
 
 HMENU APIUser32::LoadMenuW (HINSTANCE hInstance, LPCWSTR lpMenuName)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "LoadMenuW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "LoadMenuW()"_lit);
   return LoadMenuW_(hInstance, lpMenuName);
 }
 
 HMENU APIUser32::LoadMenuIndirectA (CONST MENUTEMPLATEA * lpMenuTemplate)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "LoadMenuIndirectA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "LoadMenuIndirectA()"_lit);
   return LoadMenuIndirectA_(lpMenuTemplate);
 }
 
 HMENU APIUser32::LoadMenuIndirectW (CONST MENUTEMPLATEW * lpMenuTemplate)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "LoadMenuIndirectW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "LoadMenuIndirectW()"_lit);
   return LoadMenuIndirectW_(lpMenuTemplate);
 }
 
 HMENU APIUser32::GetMenu (HWND hWnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetMenu()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetMenu()"_lit);
   return GetMenu_(hWnd);
 }
 
 WINBOOL APIUser32::SetMenu (HWND hWnd, HMENU hMenu)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetMenu()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SetMenu()"_lit);
   return SetMenu_(hWnd, hMenu);
 }
 
 WINBOOL APIUser32::ChangeMenuA (HMENU hMenu, UINT cmd, LPCSTR lpszNewItem, UINT cmdInsert, UINT flags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ChangeMenuA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "ChangeMenuA()"_lit);
   return ChangeMenuA_(hMenu, cmd, lpszNewItem, cmdInsert, flags);
 }
 
 WINBOOL APIUser32::ChangeMenuW (HMENU hMenu, UINT cmd, LPCWSTR lpszNewItem, UINT cmdInsert, UINT flags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ChangeMenuW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "ChangeMenuW()"_lit);
   return ChangeMenuW_(hMenu, cmd, lpszNewItem, cmdInsert, flags);
 }
 
 WINBOOL APIUser32::HiliteMenuItem (HWND hWnd, HMENU hMenu, UINT uIDHiliteItem, UINT uHilite)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "HiliteMenuItem()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "HiliteMenuItem()"_lit);
   return HiliteMenuItem_(hWnd, hMenu, uIDHiliteItem, uHilite);
 }
 
 int APIUser32::GetMenuStringA (HMENU hMenu, UINT uIDItem, LPSTR lpString, int cchMax, UINT flags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetMenuStringA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetMenuStringA()"_lit);
   return GetMenuStringA_(hMenu, uIDItem, lpString, cchMax, flags);
 }
 
 int APIUser32::GetMenuStringW (HMENU hMenu, UINT uIDItem, LPWSTR lpString, int cchMax, UINT flags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetMenuStringW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetMenuStringW()"_lit);
   return GetMenuStringW_(hMenu, uIDItem, lpString, cchMax, flags);
 }
 
 UINT APIUser32::GetMenuState (HMENU hMenu, UINT uId, UINT uFlags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetMenuState()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetMenuState()"_lit);
   return GetMenuState_(hMenu, uId, uFlags);
 }
 
 WINBOOL APIUser32::DrawMenuBar (HWND hWnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DrawMenuBar()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "DrawMenuBar()"_lit);
   return DrawMenuBar_(hWnd);
 }
 
 HMENU APIUser32::GetSystemMenu (HWND hWnd, WINBOOL bRevert)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetSystemMenu()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetSystemMenu()"_lit);
   return GetSystemMenu_(hWnd, bRevert);
 }
 
 HMENU APIUser32::CreateMenu (VOID)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CreateMenu()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "CreateMenu()"_lit);
   return CreateMenu_();
 }
 
 HMENU APIUser32::CreatePopupMenu (VOID)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CreatePopupMenu()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "CreatePopupMenu()"_lit);
   return CreatePopupMenu_();
 }
 
 WINBOOL APIUser32::DestroyMenu (HMENU hMenu)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DestroyMenu()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "DestroyMenu()"_lit);
   return DestroyMenu_(hMenu);
 }
 
 DWORD APIUser32::CheckMenuItem (HMENU hMenu, UINT uIDCheckItem, UINT uCheck)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CheckMenuItem()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "CheckMenuItem()"_lit);
   return CheckMenuItem_(hMenu, uIDCheckItem, uCheck);
 }
 
 WINBOOL APIUser32::EnableMenuItem (HMENU hMenu, UINT uIDEnableItem, UINT uEnable)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "EnableMenuItem()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "EnableMenuItem()"_lit);
   return EnableMenuItem_(hMenu, uIDEnableItem, uEnable);
 }
 
 HMENU APIUser32::GetSubMenu (HMENU hMenu, int nPos)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetSubMenu()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetSubMenu()"_lit);
   return GetSubMenu_(hMenu, nPos);
 }
 
 UINT APIUser32::GetMenuItemID (HMENU hMenu, int nPos)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetMenuItemID()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetMenuItemID()"_lit);
   return GetMenuItemID_(hMenu, nPos);
 }
 
 int APIUser32::GetMenuItemCount (HMENU hMenu)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetMenuItemCount()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetMenuItemCount()"_lit);
   return GetMenuItemCount_(hMenu);
 }
 
 WINBOOL APIUser32::InsertMenuA (HMENU hMenu, UINT uPosition, UINT uFlags, UINT_PTR uIDNewItem, LPCSTR lpNewItem)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "InsertMenuA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "InsertMenuA()"_lit);
   return InsertMenuA_(hMenu, uPosition, uFlags, uIDNewItem, lpNewItem);
 }
 
 WINBOOL APIUser32::InsertMenuW (HMENU hMenu, UINT uPosition, UINT uFlags, UINT_PTR uIDNewItem, LPCWSTR lpNewItem)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "InsertMenuW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "InsertMenuW()"_lit);
   return InsertMenuW_(hMenu, uPosition, uFlags, uIDNewItem, lpNewItem);
 }
 
 WINBOOL APIUser32::AppendMenuA (HMENU hMenu, UINT uFlags, UINT_PTR uIDNewItem, LPCSTR lpNewItem)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "AppendMenuA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "AppendMenuA()"_lit);
   return AppendMenuA_(hMenu, uFlags, uIDNewItem, lpNewItem);
 }
 
 WINBOOL APIUser32::AppendMenuW (HMENU hMenu, UINT uFlags, UINT_PTR uIDNewItem, LPCWSTR lpNewItem)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "AppendMenuW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "AppendMenuW()"_lit);
   return AppendMenuW_(hMenu, uFlags, uIDNewItem, lpNewItem);
 }
 
 WINBOOL APIUser32::ModifyMenuA (HMENU hMnu, UINT uPosition, UINT uFlags, UINT_PTR uIDNewItem, LPCSTR lpNewItem)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ModifyMenuA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "ModifyMenuA()"_lit);
   return ModifyMenuA_(hMnu, uPosition, uFlags, uIDNewItem, lpNewItem);
 }
 
 WINBOOL APIUser32::ModifyMenuW (HMENU hMnu, UINT uPosition, UINT uFlags, UINT_PTR uIDNewItem, LPCWSTR lpNewItem)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ModifyMenuW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "ModifyMenuW()"_lit);
   return ModifyMenuW_(hMnu, uPosition, uFlags, uIDNewItem, lpNewItem);
 }
 
 WINBOOL APIUser32::RemoveMenu (HMENU hMenu, UINT uPosition, UINT uFlags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "RemoveMenu()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "RemoveMenu()"_lit);
   return RemoveMenu_(hMenu, uPosition, uFlags);
 }
 
 WINBOOL APIUser32::DeleteMenu (HMENU hMenu, UINT uPosition, UINT uFlags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DeleteMenu()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "DeleteMenu()"_lit);
   return DeleteMenu_(hMenu, uPosition, uFlags);
 }
 
 WINBOOL APIUser32::SetMenuItemBitmaps (HMENU hMenu, UINT uPosition, UINT uFlags, HBITMAP hBitmapUnchecked, HBITMAP hBitmapChecked)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetMenuItemBitmaps()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SetMenuItemBitmaps()"_lit);
   return SetMenuItemBitmaps_(hMenu, uPosition, uFlags, hBitmapUnchecked, hBitmapChecked);
 }
 
 LONG APIUser32::GetMenuCheckMarkDimensions (VOID)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetMenuCheckMarkDimensions()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetMenuCheckMarkDimensions()"_lit);
   return GetMenuCheckMarkDimensions_();
 }
 
 WINBOOL APIUser32::TrackPopupMenu (HMENU hMenu, UINT uFlags, int x, int y, int nReserved, HWND hWnd, CONST RECT * prcRect)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "TrackPopupMenu()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "TrackPopupMenu()"_lit);
   return TrackPopupMenu_(hMenu, uFlags, x, y, nReserved, hWnd, prcRect);
 }
 
 WINBOOL APIUser32::TrackPopupMenuEx (HMENU arg0, UINT arg1, int arg2, int arg3, HWND arg4, LPTPMPARAMS arg5)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "TrackPopupMenuEx()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "TrackPopupMenuEx()"_lit);
   return TrackPopupMenuEx_(arg0, arg1, arg2, arg3, arg4, arg5);
 }
 
 WINBOOL APIUser32::GetMenuInfo (HMENU arg0, LPMENUINFO arg1)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetMenuInfo()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetMenuInfo()"_lit);
   return GetMenuInfo_(arg0, arg1);
 }
 
 WINBOOL APIUser32::SetMenuInfo (HMENU arg0, LPCMENUINFO arg1)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetMenuInfo()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SetMenuInfo()"_lit);
   return SetMenuInfo_(arg0, arg1);
 }
 
 WINBOOL APIUser32::EndMenu (VOID)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "EndMenu()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "EndMenu()"_lit);
   return EndMenu_();
 }
 
 WINBOOL APIUser32::CalculatePopupWindowPosition (const POINT * anchorPoint, const SIZE * windowSize, UINT flags, RECT * excludeRect, RECT * popupWindowPosition)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CalculatePopupWindowPosition()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "CalculatePopupWindowPosition()"_lit);
   return CalculatePopupWindowPosition_(anchorPoint, windowSize, flags, excludeRect, popupWindowPosition);
 }
 
 WINBOOL APIUser32::InsertMenuItemA (HMENU hmenu, UINT item, WINBOOL fByPosition, LPCMENUITEMINFOA lpmi)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "InsertMenuItemA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "InsertMenuItemA()"_lit);
   return InsertMenuItemA_(hmenu, item, fByPosition, lpmi);
 }
 
 WINBOOL APIUser32::InsertMenuItemW (HMENU hmenu, UINT item, WINBOOL fByPosition, LPCMENUITEMINFOW lpmi)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "InsertMenuItemW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "InsertMenuItemW()"_lit);
   return InsertMenuItemW_(hmenu, item, fByPosition, lpmi);
 }
 
 WINBOOL APIUser32::GetMenuItemInfoA (HMENU hmenu, UINT item, WINBOOL fByPosition, LPMENUITEMINFOA lpmii)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetMenuItemInfoA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetMenuItemInfoA()"_lit);
   return GetMenuItemInfoA_(hmenu, item, fByPosition, lpmii);
 }
 
 WINBOOL APIUser32::GetMenuItemInfoW (HMENU hmenu, UINT item, WINBOOL fByPosition, LPMENUITEMINFOW lpmii)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetMenuItemInfoW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetMenuItemInfoW()"_lit);
   return GetMenuItemInfoW_(hmenu, item, fByPosition, lpmii);
 }
 
 WINBOOL APIUser32::SetMenuItemInfoA (HMENU hmenu, UINT item, WINBOOL fByPositon, LPCMENUITEMINFOA lpmii)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetMenuItemInfoA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SetMenuItemInfoA()"_lit);
   return SetMenuItemInfoA_(hmenu, item, fByPositon, lpmii);
 }
 
 WINBOOL APIUser32::SetMenuItemInfoW (HMENU hmenu, UINT item, WINBOOL fByPositon, LPCMENUITEMINFOW lpmii)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetMenuItemInfoW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SetMenuItemInfoW()"_lit);
   return SetMenuItemInfoW_(hmenu, item, fByPositon, lpmii);
 }
 
 UINT APIUser32::GetMenuDefaultItem (HMENU hMenu, UINT fByPos, UINT gmdiFlags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetMenuDefaultItem()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetMenuDefaultItem()"_lit);
   return GetMenuDefaultItem_(hMenu, fByPos, gmdiFlags);
 }
 
 WINBOOL APIUser32::SetMenuDefaultItem (HMENU hMenu, UINT uItem, UINT fByPos)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetMenuDefaultItem()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SetMenuDefaultItem()"_lit);
   return SetMenuDefaultItem_(hMenu, uItem, fByPos);
 }
 
 WINBOOL APIUser32::GetMenuItemRect (HWND hWnd, HMENU hMenu, UINT uItem, LPRECT lprcItem)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetMenuItemRect()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetMenuItemRect()"_lit);
   return GetMenuItemRect_(hWnd, hMenu, uItem, lprcItem);
 }
 
 int APIUser32::MenuItemFromPoint (HWND hWnd, HMENU hMenu, POINT ptScreen)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "MenuItemFromPoint()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "MenuItemFromPoint()"_lit);
   return MenuItemFromPoint_(hWnd, hMenu, ptScreen);
 }
 
 DWORD APIUser32::DragObject (HWND hwndParent, HWND hwndFrom, UINT fmt, ULONG_PTR data, HCURSOR hcur)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DragObject()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "DragObject()"_lit);
   return DragObject_(hwndParent, hwndFrom, fmt, data, hcur);
 }
 
 WINBOOL APIUser32::DragDetect (HWND hwnd, POINT pt)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DragDetect()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "DragDetect()"_lit);
   return DragDetect_(hwnd, pt);
 }
 
 WINBOOL APIUser32::DrawIcon (HDC hDC, int X, int Y, HICON hIcon)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DrawIcon()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "DrawIcon()"_lit);
   return DrawIcon_(hDC, X, Y, hIcon);
 }
 
 int APIUser32::DrawTextA (HDC hdc, LPCSTR lpchText, int cchText, LPRECT lprc, UINT format)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DrawTextA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "DrawTextA()"_lit);
   return DrawTextA_(hdc, lpchText, cchText, lprc, format);
 }
 
 int APIUser32::DrawTextW (HDC hdc, LPCWSTR lpchText, int cchText, LPRECT lprc, UINT format)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DrawTextW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "DrawTextW()"_lit);
   return DrawTextW_(hdc, lpchText, cchText, lprc, format);
 }
 
 int APIUser32::DrawTextExA (HDC hdc, LPSTR lpchText, int cchText, LPRECT lprc, UINT format, LPDRAWTEXTPARAMS lpdtp)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DrawTextExA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "DrawTextExA()"_lit);
   return DrawTextExA_(hdc, lpchText, cchText, lprc, format, lpdtp);
 }
 
 int APIUser32::DrawTextExW (HDC hdc, LPWSTR lpchText, int cchText, LPRECT lprc, UINT format, LPDRAWTEXTPARAMS lpdtp)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DrawTextExW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "DrawTextExW()"_lit);
   return DrawTextExW_(hdc, lpchText, cchText, lprc, format, lpdtp);
 }
 
 WINBOOL APIUser32::GrayStringA (HDC hDC, HBRUSH hBrush, GRAYSTRINGPROC lpOutputFunc, LPARAM lpData, int nCount, int X, int Y, int nWidth, int nHeight)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GrayStringA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GrayStringA()"_lit);
   return GrayStringA_(hDC, hBrush, lpOutputFunc, lpData, nCount, X, Y, nWidth, nHeight);
 }
 
 WINBOOL APIUser32::GrayStringW (HDC hDC, HBRUSH hBrush, GRAYSTRINGPROC lpOutputFunc, LPARAM lpData, int nCount, int X, int Y, int nWidth, int nHeight)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GrayStringW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GrayStringW()"_lit);
   return GrayStringW_(hDC, hBrush, lpOutputFunc, lpData, nCount, X, Y, nWidth, nHeight);
 }
 
 WINBOOL APIUser32::DrawStateA (HDC hdc, HBRUSH hbrFore, DRAWSTATEPROC qfnCallBack, LPARAM lData, WPARAM wData, int x, int y, int cx, int cy, UINT uFlags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DrawStateA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "DrawStateA()"_lit);
   return DrawStateA_(hdc, hbrFore, qfnCallBack, lData, wData, x, y, cx, cy, uFlags);
 }
 
 WINBOOL APIUser32::DrawStateW (HDC hdc, HBRUSH hbrFore, DRAWSTATEPROC qfnCallBack, LPARAM lData, WPARAM wData, int x, int y, int cx, int cy, UINT uFlags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DrawStateW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "DrawStateW()"_lit);
   return DrawStateW_(hdc, hbrFore, qfnCallBack, lData, wData, x, y, cx, cy, uFlags);
 }
 
 LONG APIUser32::TabbedTextOutA (HDC hdc, int x, int y, LPCSTR lpString, int chCount, int nTabPositions, CONST INT * lpnTabStopPositions, int nTabOrigin)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "TabbedTextOutA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "TabbedTextOutA()"_lit);
   return TabbedTextOutA_(hdc, x, y, lpString, chCount, nTabPositions, lpnTabStopPositions, nTabOrigin);
 }
 
 LONG APIUser32::TabbedTextOutW (HDC hdc, int x, int y, LPCWSTR lpString, int chCount, int nTabPositions, CONST INT * lpnTabStopPositions, int nTabOrigin)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "TabbedTextOutW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "TabbedTextOutW()"_lit);
   return TabbedTextOutW_(hdc, x, y, lpString, chCount, nTabPositions, lpnTabStopPositions, nTabOrigin);
 }
 
 DWORD APIUser32::GetTabbedTextExtentA (HDC hdc, LPCSTR lpString, int chCount, int nTabPositions, CONST INT * lpnTabStopPositions)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetTabbedTextExtentA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetTabbedTextExtentA()"_lit);
   return GetTabbedTextExtentA_(hdc, lpString, chCount, nTabPositions, lpnTabStopPositions);
 }
 
 DWORD APIUser32::GetTabbedTextExtentW (HDC hdc, LPCWSTR lpString, int chCount, int nTabPositions, CONST INT * lpnTabStopPositions)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetTabbedTextExtentW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetTabbedTextExtentW()"_lit);
   return GetTabbedTextExtentW_(hdc, lpString, chCount, nTabPositions, lpnTabStopPositions);
 }
 
 WINBOOL APIUser32::UpdateWindow (HWND hWnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "UpdateWindow()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "UpdateWindow()"_lit);
   return UpdateWindow_(hWnd);
 }
 
 HWND APIUser32::SetActiveWindow (HWND hWnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetActiveWindow()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SetActiveWindow()"_lit);
   return SetActiveWindow_(hWnd);
 }
 
 HWND APIUser32::GetForegroundWindow (VOID)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetForegroundWindow()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetForegroundWindow()"_lit);
   return GetForegroundWindow_();
 }
 
 WINBOOL APIUser32::PaintDesktop (HDC hdc)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "PaintDesktop()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "PaintDesktop()"_lit);
   return PaintDesktop_(hdc);
 }
 
 VOID APIUser32::SwitchToThisWindow (HWND hwnd, WINBOOL fUnknown)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SwitchToThisWindow()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SwitchToThisWindow()"_lit);
   SwitchToThisWindow_(hwnd, fUnknown);
 }
 
 WINBOOL APIUser32::SetForegroundWindow (HWND hWnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetForegroundWindow()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SetForegroundWindow()"_lit);
   return SetForegroundWindow_(hWnd);
 }
 
 WINBOOL APIUser32::AllowSetForegroundWindow (DWORD dwProcessId)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "AllowSetForegroundWindow()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "AllowSetForegroundWindow()"_lit);
   return AllowSetForegroundWindow_(dwProcessId);
 }
 
 WINBOOL APIUser32::LockSetForegroundWindow (UINT uLockCode)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "LockSetForegroundWindow()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "LockSetForegroundWindow()"_lit);
   return LockSetForegroundWindow_(uLockCode);
 }
 
 HWND APIUser32::WindowFromDC (HDC hDC)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "WindowFromDC()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "WindowFromDC()"_lit);
   return WindowFromDC_(hDC);
 }
 
 HDC APIUser32::GetDC (HWND hWnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetDC()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetDC()"_lit);
   return GetDC_(hWnd);
 }
 
 HDC APIUser32::GetDCEx (HWND hWnd, HRGN hrgnClip, DWORD flags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetDCEx()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetDCEx()"_lit);
   return GetDCEx_(hWnd, hrgnClip, flags);
 }
 
 HDC APIUser32::GetWindowDC (HWND hWnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetWindowDC()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetWindowDC()"_lit);
   return GetWindowDC_(hWnd);
 }
 
 int APIUser32::ReleaseDC (HWND hWnd, HDC hDC)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ReleaseDC()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "ReleaseDC()"_lit);
   return ReleaseDC_(hWnd, hDC);
 }
 
 HDC APIUser32::BeginPaint (HWND hWnd, LPPAINTSTRUCT lpPaint)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "BeginPaint()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "BeginPaint()"_lit);
   return BeginPaint_(hWnd, lpPaint);
 }
 
 WINBOOL APIUser32::EndPaint (HWND hWnd, CONST PAINTSTRUCT * lpPaint)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "EndPaint()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "EndPaint()"_lit);
   return EndPaint_(hWnd, lpPaint);
 }
 
 WINBOOL APIUser32::GetUpdateRect (HWND hWnd, LPRECT lpRect, WINBOOL bErase)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetUpdateRect()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetUpdateRect()"_lit);
   return GetUpdateRect_(hWnd, lpRect, bErase);
 }
 
 int APIUser32::GetUpdateRgn (HWND hWnd, HRGN hRgn, WINBOOL bErase)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetUpdateRgn()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetUpdateRgn()"_lit);
   return GetUpdateRgn_(hWnd, hRgn, bErase);
 }
 
 int APIUser32::SetWindowRgn (HWND hWnd, HRGN hRgn, WINBOOL bRedraw)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetWindowRgn()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SetWindowRgn()"_lit);
   return SetWindowRgn_(hWnd, hRgn, bRedraw);
 }
 
 int APIUser32::GetWindowRgn (HWND hWnd, HRGN hRgn)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetWindowRgn()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetWindowRgn()"_lit);
   return GetWindowRgn_(hWnd, hRgn);
 }
 
 int APIUser32::GetWindowRgnBox (HWND hWnd, LPRECT lprc)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetWindowRgnBox()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetWindowRgnBox()"_lit);
   return GetWindowRgnBox_(hWnd, lprc);
 }
 
 int APIUser32::ExcludeUpdateRgn (HDC hDC, HWND hWnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ExcludeUpdateRgn()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "ExcludeUpdateRgn()"_lit);
   return ExcludeUpdateRgn_(hDC, hWnd);
 }
 
 WINBOOL APIUser32::InvalidateRect (HWND hWnd, CONST RECT * lpRect, WINBOOL bErase)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "InvalidateRect()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "InvalidateRect()"_lit);
   return InvalidateRect_(hWnd, lpRect, bErase);
 }
 
 WINBOOL APIUser32::ValidateRect (HWND hWnd, CONST RECT * lpRect)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ValidateRect()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "ValidateRect()"_lit);
   return ValidateRect_(hWnd, lpRect);
 }
 
 WINBOOL APIUser32::InvalidateRgn (HWND hWnd, HRGN hRgn, WINBOOL bErase)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "InvalidateRgn()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "InvalidateRgn()"_lit);
   return InvalidateRgn_(hWnd, hRgn, bErase);
 }
 
 WINBOOL APIUser32::ValidateRgn (HWND hWnd, HRGN hRgn)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ValidateRgn()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "ValidateRgn()"_lit);
   return ValidateRgn_(hWnd, hRgn);
 }
 
 WINBOOL APIUser32::RedrawWindow (HWND hWnd, CONST RECT * lprcUpdate, HRGN hrgnUpdate, UINT flags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "RedrawWindow()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "RedrawWindow()"_lit);
   return RedrawWindow_(hWnd, lprcUpdate, hrgnUpdate, flags);
 }
 
 WINBOOL APIUser32::LockWindowUpdate (HWND hWndLock)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "LockWindowUpdate()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "LockWindowUpdate()"_lit);
   return LockWindowUpdate_(hWndLock);
 }
 
 WINBOOL APIUser32::ScrollWindow (HWND hWnd, int XAmount, int YAmount, CONST RECT * lpRect, CONST RECT * lpClipRect)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ScrollWindow()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "ScrollWindow()"_lit);
   return ScrollWindow_(hWnd, XAmount, YAmount, lpRect, lpClipRect);
 }
 
 WINBOOL APIUser32::ScrollDC (HDC hDC, int dx, int dy, CONST RECT * lprcScroll, CONST RECT * lprcClip, HRGN hrgnUpdate, LPRECT lprcUpdate)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ScrollDC()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "ScrollDC()"_lit);
   return ScrollDC_(hDC, dx, dy, lprcScroll, lprcClip, hrgnUpdate, lprcUpdate);
 }
 
 int APIUser32::ScrollWindowEx (HWND hWnd, int dx, int dy, CONST RECT * prcScroll, CONST RECT * prcClip, HRGN hrgnUpdate, LPRECT prcUpdate, UINT flags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ScrollWindowEx()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "ScrollWindowEx()"_lit);
   return ScrollWindowEx_(hWnd, dx, dy, prcScroll, prcClip, hrgnUpdate, prcUpdate, flags);
 }
 
 int APIUser32::SetScrollPos (HWND hWnd, int nBar, int nPos, WINBOOL bRedraw)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetScrollPos()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SetScrollPos()"_lit);
   return SetScrollPos_(hWnd, nBar, nPos, bRedraw);
 }
 
 int APIUser32::GetScrollPos (HWND hWnd, int nBar)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetScrollPos()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetScrollPos()"_lit);
   return GetScrollPos_(hWnd, nBar);
 }
 
 WINBOOL APIUser32::SetScrollRange (HWND hWnd, int nBar, int nMinPos, int nMaxPos, WINBOOL bRedraw)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetScrollRange()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SetScrollRange()"_lit);
   return SetScrollRange_(hWnd, nBar, nMinPos, nMaxPos, bRedraw);
 }
 
 WINBOOL APIUser32::GetScrollRange (HWND hWnd, int nBar, LPINT lpMinPos, LPINT lpMaxPos)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetScrollRange()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetScrollRange()"_lit);
   return GetScrollRange_(hWnd, nBar, lpMinPos, lpMaxPos);
 }
 
 WINBOOL APIUser32::ShowScrollBar (HWND hWnd, int wBar, WINBOOL bShow)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ShowScrollBar()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "ShowScrollBar()"_lit);
   return ShowScrollBar_(hWnd, wBar, bShow);
 }
 
 WINBOOL APIUser32::EnableScrollBar (HWND hWnd, UINT wSBflags, UINT wArrows)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "EnableScrollBar()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "EnableScrollBar()"_lit);
   return EnableScrollBar_(hWnd, wSBflags, wArrows);
 }
 
 WINBOOL APIUser32::SetPropA (HWND hWnd, LPCSTR lpString, HANDLE hData)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetPropA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SetPropA()"_lit);
   return SetPropA_(hWnd, lpString, hData);
 }
 
 WINBOOL APIUser32::SetPropW (HWND hWnd, LPCWSTR lpString, HANDLE hData)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetPropW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SetPropW()"_lit);
   return SetPropW_(hWnd, lpString, hData);
 }
 
 HANDLE APIUser32::GetPropA (HWND hWnd, LPCSTR lpString)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetPropA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetPropA()"_lit);
   return GetPropA_(hWnd, lpString);
 }
 
 HANDLE APIUser32::GetPropW (HWND hWnd, LPCWSTR lpString)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetPropW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetPropW()"_lit);
   return GetPropW_(hWnd, lpString);
 }
 
 HANDLE APIUser32::RemovePropA (HWND hWnd, LPCSTR lpString)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "RemovePropA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "RemovePropA()"_lit);
   return RemovePropA_(hWnd, lpString);
 }
 
 HANDLE APIUser32::RemovePropW (HWND hWnd, LPCWSTR lpString)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "RemovePropW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "RemovePropW()"_lit);
   return RemovePropW_(hWnd, lpString);
 }
 
 int APIUser32::EnumPropsExA (HWND hWnd, PROPENUMPROCEXA lpEnumFunc, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "EnumPropsExA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "EnumPropsExA()"_lit);
   return EnumPropsExA_(hWnd, lpEnumFunc, lParam);
 }
 
 int APIUser32::EnumPropsExW (HWND hWnd, PROPENUMPROCEXW lpEnumFunc, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "EnumPropsExW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "EnumPropsExW()"_lit);
   return EnumPropsExW_(hWnd, lpEnumFunc, lParam);
 }
 
 int APIUser32::EnumPropsA (HWND hWnd, PROPENUMPROCA lpEnumFunc)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "EnumPropsA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "EnumPropsA()"_lit);
   return EnumPropsA_(hWnd, lpEnumFunc);
 }
 
 int APIUser32::EnumPropsW (HWND hWnd, PROPENUMPROCW lpEnumFunc)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "EnumPropsW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "EnumPropsW()"_lit);
   return EnumPropsW_(hWnd, lpEnumFunc);
 }
 
 WINBOOL APIUser32::SetWindowTextA (HWND hWnd, LPCSTR lpString)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetWindowTextA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SetWindowTextA()"_lit);
   return SetWindowTextA_(hWnd, lpString);
 }
 
 WINBOOL APIUser32::SetWindowTextW (HWND hWnd, LPCWSTR lpString)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetWindowTextW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SetWindowTextW()"_lit);
   return SetWindowTextW_(hWnd, lpString);
 }
 
 int APIUser32::GetWindowTextA (HWND hWnd, LPSTR lpString, int nMaxCount)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetWindowTextA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetWindowTextA()"_lit);
   return GetWindowTextA_(hWnd, lpString, nMaxCount);
 }
 
 int APIUser32::GetWindowTextW (HWND hWnd, LPWSTR lpString, int nMaxCount)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetWindowTextW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetWindowTextW()"_lit);
   return GetWindowTextW_(hWnd, lpString, nMaxCount);
 }
 
 int APIUser32::GetWindowTextLengthA (HWND hWnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetWindowTextLengthA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetWindowTextLengthA()"_lit);
   return GetWindowTextLengthA_(hWnd);
 }
 
 int APIUser32::GetWindowTextLengthW (HWND hWnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetWindowTextLengthW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetWindowTextLengthW()"_lit);
   return GetWindowTextLengthW_(hWnd);
 }
 
 WINBOOL APIUser32::GetClientRect (HWND hWnd, LPRECT lpRect)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetClientRect()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetClientRect()"_lit);
   return GetClientRect_(hWnd, lpRect);
 }
 
 WINBOOL APIUser32::GetWindowRect (HWND hWnd, LPRECT lpRect)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetWindowRect()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetWindowRect()"_lit);
   return GetWindowRect_(hWnd, lpRect);
 }
 
 WINBOOL APIUser32::AdjustWindowRect (LPRECT lpRect, DWORD dwStyle, WINBOOL bMenu)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "AdjustWindowRect()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "AdjustWindowRect()"_lit);
   return AdjustWindowRect_(lpRect, dwStyle, bMenu);
 }
 
 WINBOOL APIUser32::AdjustWindowRectEx (LPRECT lpRect, DWORD dwStyle, WINBOOL bMenu, DWORD dwExStyle)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "AdjustWindowRectEx()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "AdjustWindowRectEx()"_lit);
   return AdjustWindowRectEx_(lpRect, dwStyle, bMenu, dwExStyle);
 }
 
 WINBOOL APIUser32::SetWindowContextHelpId (HWND arg0, DWORD arg1)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetWindowContextHelpId()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SetWindowContextHelpId()"_lit);
   return SetWindowContextHelpId_(arg0, arg1);
 }
 
 DWORD APIUser32::GetWindowContextHelpId (HWND arg0)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetWindowContextHelpId()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetWindowContextHelpId()"_lit);
   return GetWindowContextHelpId_(arg0);
 }
 
 WINBOOL APIUser32::SetMenuContextHelpId (HMENU arg0, DWORD arg1)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetMenuContextHelpId()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SetMenuContextHelpId()"_lit);
   return SetMenuContextHelpId_(arg0, arg1);
 }
 
 DWORD APIUser32::GetMenuContextHelpId (HMENU arg0)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetMenuContextHelpId()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetMenuContextHelpId()"_lit);
   return GetMenuContextHelpId_(arg0);
 }
 
 int APIUser32::MessageBoxA (HWND hWnd, LPCSTR lpText, LPCSTR lpCaption, UINT uType)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "MessageBoxA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "MessageBoxA()"_lit);
   return MessageBoxA_(hWnd, lpText, lpCaption, uType);
 }
 
 int APIUser32::MessageBoxW (HWND hWnd, LPCWSTR lpText, LPCWSTR lpCaption, UINT uType)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "MessageBoxW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "MessageBoxW()"_lit);
   return MessageBoxW_(hWnd, lpText, lpCaption, uType);
 }
 
 int APIUser32::MessageBoxExA (HWND hWnd, LPCSTR lpText, LPCSTR lpCaption, UINT uType, WORD wLanguageId)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "MessageBoxExA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "MessageBoxExA()"_lit);
   return MessageBoxExA_(hWnd, lpText, lpCaption, uType, wLanguageId);
 }
 
 int APIUser32::MessageBoxExW (HWND hWnd, LPCWSTR lpText, LPCWSTR lpCaption, UINT uType, WORD wLanguageId)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "MessageBoxExW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "MessageBoxExW()"_lit);
   return MessageBoxExW_(hWnd, lpText, lpCaption, uType, wLanguageId);
 }
 
 int APIUser32::MessageBoxIndirectA (CONST MSGBOXPARAMSA * lpmbp)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "MessageBoxIndirectA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "MessageBoxIndirectA()"_lit);
   return MessageBoxIndirectA_(lpmbp);
 }
 
 int APIUser32::MessageBoxIndirectW (CONST MSGBOXPARAMSW * lpmbp)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "MessageBoxIndirectW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "MessageBoxIndirectW()"_lit);
   return MessageBoxIndirectW_(lpmbp);
 }
 
 WINBOOL APIUser32::MessageBeep (UINT uType)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "MessageBeep()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "MessageBeep()"_lit);
   return MessageBeep_(uType);
 }
 
 int APIUser32::ShowCursor (WINBOOL bShow)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ShowCursor()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "ShowCursor()"_lit);
   return ShowCursor_(bShow);
 }
 
 WINBOOL APIUser32::SetCursorPos (int X, int Y)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetCursorPos()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SetCursorPos()"_lit);
   return SetCursorPos_(X, Y);
 }
 
 HCURSOR APIUser32::SetCursor (HCURSOR hCursor)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetCursor()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SetCursor()"_lit);
   return SetCursor_(hCursor);
 }
 
 WINBOOL APIUser32::GetCursorPos (LPPOINT lpPoint)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetCursorPos()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetCursorPos()"_lit);
   return GetCursorPos_(lpPoint);
 }
 
 WINBOOL APIUser32::ClipCursor (CONST RECT * lpRect)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ClipCursor()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "ClipCursor()"_lit);
   return ClipCursor_(lpRect);
 }
 
 WINBOOL APIUser32::GetClipCursor (LPRECT lpRect)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetClipCursor()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetClipCursor()"_lit);
   return GetClipCursor_(lpRect);
 }
 
 HCURSOR APIUser32::GetCursor (VOID)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetCursor()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetCursor()"_lit);
   return GetCursor_();
 }
 
 WINBOOL APIUser32::CreateCaret (HWND hWnd, HBITMAP hBitmap, int nWidth, int nHeight)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CreateCaret()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "CreateCaret()"_lit);
   return CreateCaret_(hWnd, hBitmap, nWidth, nHeight);
 }
 
 UINT APIUser32::GetCaretBlinkTime (VOID)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetCaretBlinkTime()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetCaretBlinkTime()"_lit);
   return GetCaretBlinkTime_();
 }
 
 WINBOOL APIUser32::SetCaretBlinkTime (UINT uMSeconds)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetCaretBlinkTime()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SetCaretBlinkTime()"_lit);
   return SetCaretBlinkTime_(uMSeconds);
 }
 
 WINBOOL APIUser32::DestroyCaret (VOID)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DestroyCaret()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "DestroyCaret()"_lit);
   return DestroyCaret_();
 }
 
 WINBOOL APIUser32::HideCaret (HWND hWnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "HideCaret()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "HideCaret()"_lit);
   return HideCaret_(hWnd);
 }
 
 WINBOOL APIUser32::ShowCaret (HWND hWnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ShowCaret()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "ShowCaret()"_lit);
   return ShowCaret_(hWnd);
 }
 
 WINBOOL APIUser32::SetCaretPos (int X, int Y)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetCaretPos()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SetCaretPos()"_lit);
   return SetCaretPos_(X, Y);
 }
 
 WINBOOL APIUser32::GetCaretPos (LPPOINT lpPoint)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetCaretPos()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetCaretPos()"_lit);
   return GetCaretPos_(lpPoint);
 }
 
 WINBOOL APIUser32::ClientToScreen (HWND hWnd, LPPOINT lpPoint)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ClientToScreen()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "ClientToScreen()"_lit);
   return ClientToScreen_(hWnd, lpPoint);
 }
 
 WINBOOL APIUser32::ScreenToClient (HWND hWnd, LPPOINT lpPoint)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ScreenToClient()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "ScreenToClient()"_lit);
   return ScreenToClient_(hWnd, lpPoint);
 }
 
 int APIUser32::MapWindowPoints (HWND hWndFrom, HWND hWndTo, LPPOINT lpPoints, UINT cPoints)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "MapWindowPoints()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "MapWindowPoints()"_lit);
   return MapWindowPoints_(hWndFrom, hWndTo, lpPoints, cPoints);
 }
 
 HWND APIUser32::WindowFromPoint (POINT Point)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "WindowFromPoint()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "WindowFromPoint()"_lit);
   return WindowFromPoint_(Point);
 }
 
 HWND APIUser32::ChildWindowFromPoint (HWND hWndParent, POINT Point)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ChildWindowFromPoint()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "ChildWindowFromPoint()"_lit);
   return ChildWindowFromPoint_(hWndParent, Point);
 }
 
 HWND APIUser32::ChildWindowFromPointEx (HWND hwnd, POINT pt, UINT flags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ChildWindowFromPointEx()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "ChildWindowFromPointEx()"_lit);
   return ChildWindowFromPointEx_(hwnd, pt, flags);
 }
 
 WINBOOL APIUser32::SetPhysicalCursorPos (int X, int Y)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetPhysicalCursorPos()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SetPhysicalCursorPos()"_lit);
   return SetPhysicalCursorPos_(X, Y);
 }
 
 WINBOOL APIUser32::GetPhysicalCursorPos (LPPOINT lpPoint)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetPhysicalCursorPos()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetPhysicalCursorPos()"_lit);
   return GetPhysicalCursorPos_(lpPoint);
 }
 
 WINBOOL APIUser32::LogicalToPhysicalPoint (HWND hWnd, LPPOINT lpPoint)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "LogicalToPhysicalPoint()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "LogicalToPhysicalPoint()"_lit);
   return LogicalToPhysicalPoint_(hWnd, lpPoint);
 }
 
 WINBOOL APIUser32::PhysicalToLogicalPoint (HWND hWnd, LPPOINT lpPoint)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "PhysicalToLogicalPoint()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "PhysicalToLogicalPoint()"_lit);
   return PhysicalToLogicalPoint_(hWnd, lpPoint);
 }
 
 HWND APIUser32::WindowFromPhysicalPoint (POINT Point)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "WindowFromPhysicalPoint()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "WindowFromPhysicalPoint()"_lit);
   return WindowFromPhysicalPoint_(Point);
 }
 
 DWORD APIUser32::GetSysColor (int nIndex)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetSysColor()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetSysColor()"_lit);
   return GetSysColor_(nIndex);
 }
 
 HBRUSH APIUser32::GetSysColorBrush (int nIndex)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetSysColorBrush()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetSysColorBrush()"_lit);
   return GetSysColorBrush_(nIndex);
 }
 
 WINBOOL APIUser32::SetSysColors (int cElements, CONST INT * lpaElements, CONST COLORREF * lpaRgbValues)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetSysColors()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SetSysColors()"_lit);
   return SetSysColors_(cElements, lpaElements, lpaRgbValues);
 }
 
 WINBOOL APIUser32::DrawFocusRect (HDC hDC, CONST RECT * lprc)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DrawFocusRect()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "DrawFocusRect()"_lit);
   return DrawFocusRect_(hDC, lprc);
 }
 
 int APIUser32::FillRect (HDC hDC, CONST RECT * lprc, HBRUSH hbr)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "FillRect()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "FillRect()"_lit);
   return FillRect_(hDC, lprc, hbr);
 }
 
 int APIUser32::FrameRect (HDC hDC, CONST RECT * lprc, HBRUSH hbr)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "FrameRect()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "FrameRect()"_lit);
   return FrameRect_(hDC, lprc, hbr);
 }
 
 WINBOOL APIUser32::InvertRect (HDC hDC, CONST RECT * lprc)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "InvertRect()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "InvertRect()"_lit);
   return InvertRect_(hDC, lprc);
 }
 
 WINBOOL APIUser32::SetRect (LPRECT lprc, int xLeft, int yTop, int xRight, int yBottom)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetRect()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SetRect()"_lit);
   return SetRect_(lprc, xLeft, yTop, xRight, yBottom);
 }
 
 WINBOOL APIUser32::SetRectEmpty (LPRECT lprc)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetRectEmpty()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SetRectEmpty()"_lit);
   return SetRectEmpty_(lprc);
 }
 
 WINBOOL APIUser32::CopyRect (LPRECT lprcDst, CONST RECT * lprcSrc)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CopyRect()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "CopyRect()"_lit);
   return CopyRect_(lprcDst, lprcSrc);
 }
 
 WINBOOL APIUser32::InflateRect (LPRECT lprc, int dx, int dy)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "InflateRect()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "InflateRect()"_lit);
   return InflateRect_(lprc, dx, dy);
 }
 
 WINBOOL APIUser32::IntersectRect (LPRECT lprcDst, CONST RECT * lprcSrc1, CONST RECT * lprcSrc2)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "IntersectRect()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "IntersectRect()"_lit);
   return IntersectRect_(lprcDst, lprcSrc1, lprcSrc2);
 }
 
 WINBOOL APIUser32::UnionRect (LPRECT lprcDst, CONST RECT * lprcSrc1, CONST RECT * lprcSrc2)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "UnionRect()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "UnionRect()"_lit);
   return UnionRect_(lprcDst, lprcSrc1, lprcSrc2);
 }
 
 WINBOOL APIUser32::SubtractRect (LPRECT lprcDst, CONST RECT * lprcSrc1, CONST RECT * lprcSrc2)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SubtractRect()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SubtractRect()"_lit);
   return SubtractRect_(lprcDst, lprcSrc1, lprcSrc2);
 }
 
 WINBOOL APIUser32::OffsetRect (LPRECT lprc, int dx, int dy)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "OffsetRect()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "OffsetRect()"_lit);
   return OffsetRect_(lprc, dx, dy);
 }
 
 WINBOOL APIUser32::IsRectEmpty (CONST RECT * lprc)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "IsRectEmpty()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "IsRectEmpty()"_lit);
   return IsRectEmpty_(lprc);
 }
 
 WINBOOL APIUser32::EqualRect (CONST RECT * lprc1, CONST RECT * lprc2)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "EqualRect()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "EqualRect()"_lit);
   return EqualRect_(lprc1, lprc2);
 }
 
 WINBOOL APIUser32::PtInRect (CONST RECT * lprc, POINT pt)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "PtInRect()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "PtInRect()"_lit);
   return PtInRect_(lprc, pt);
 }
 
 WORD APIUser32::GetWindowWord (HWND hWnd, int nIndex)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetWindowWord()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetWindowWord()"_lit);
   return GetWindowWord_(hWnd, nIndex);
 }
 
 WORD APIUser32::SetWindowWord (HWND hWnd, int nIndex, WORD wNewWord)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetWindowWord()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SetWindowWord()"_lit);
   return SetWindowWord_(hWnd, nIndex, wNewWord);
 }
 
 LONG APIUser32::GetWindowLongA (HWND hWnd, int nIndex)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetWindowLongA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetWindowLongA()"_lit);
   return GetWindowLongA_(hWnd, nIndex);
 }
 
 LONG APIUser32::GetWindowLongW (HWND hWnd, int nIndex)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetWindowLongW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetWindowLongW()"_lit);
   return GetWindowLongW_(hWnd, nIndex);
 }
 
 LONG APIUser32::SetWindowLongA (HWND hWnd, int nIndex, LONG dwNewLong)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetWindowLongA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SetWindowLongA()"_lit);
   return SetWindowLongA_(hWnd, nIndex, dwNewLong);
 }
 
 LONG APIUser32::SetWindowLongW (HWND hWnd, int nIndex, LONG dwNewLong)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetWindowLongW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SetWindowLongW()"_lit);
   return SetWindowLongW_(hWnd, nIndex, dwNewLong);
 }
 
 LONG_PTR APIUser32::GetWindowLongPtrA (HWND hWnd, int nIndex)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetWindowLongPtrA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetWindowLongPtrA()"_lit);
   return GetWindowLongPtrA_(hWnd, nIndex);
 }
 
 LONG_PTR APIUser32::GetWindowLongPtrW (HWND hWnd, int nIndex)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetWindowLongPtrW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetWindowLongPtrW()"_lit);
   return GetWindowLongPtrW_(hWnd, nIndex);
 }
 
 LONG_PTR APIUser32::SetWindowLongPtrA (HWND hWnd, int nIndex, LONG_PTR dwNewLong)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetWindowLongPtrA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SetWindowLongPtrA()"_lit);
   return SetWindowLongPtrA_(hWnd, nIndex, dwNewLong);
 }
 
 LONG_PTR APIUser32::SetWindowLongPtrW (HWND hWnd, int nIndex, LONG_PTR dwNewLong)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetWindowLongPtrW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SetWindowLongPtrW()"_lit);
   return SetWindowLongPtrW_(hWnd, nIndex, dwNewLong);
 }
 
 WORD APIUser32::GetClassWord (HWND hWnd, int nIndex)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetClassWord()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetClassWord()"_lit);
   return GetClassWord_(hWnd, nIndex);
 }
 
 WORD APIUser32::SetClassWord (HWND hWnd, int nIndex, WORD wNewWord)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetClassWord()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SetClassWord()"_lit);
   return SetClassWord_(hWnd, nIndex, wNewWord);
 }
 
 DWORD APIUser32::GetClassLongA (HWND hWnd, int nIndex)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetClassLongA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetClassLongA()"_lit);
   return GetClassLongA_(hWnd, nIndex);
 }
 
 DWORD APIUser32::GetClassLongW (HWND hWnd, int nIndex)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetClassLongW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetClassLongW()"_lit);
   return GetClassLongW_(hWnd, nIndex);
 }
 
 DWORD APIUser32::SetClassLongA (HWND hWnd, int nIndex, LONG dwNewLong)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetClassLongA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SetClassLongA()"_lit);
   return SetClassLongA_(hWnd, nIndex, dwNewLong);
 }
 
 DWORD APIUser32::SetClassLongW (HWND hWnd, int nIndex, LONG dwNewLong)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetClassLongW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SetClassLongW()"_lit);
   return SetClassLongW_(hWnd, nIndex, dwNewLong);
 }
 
 ULONG_PTR APIUser32::GetClassLongPtrA (HWND hWnd, int nIndex)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetClassLongPtrA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetClassLongPtrA()"_lit);
   return GetClassLongPtrA_(hWnd, nIndex);
 }
 
 ULONG_PTR APIUser32::GetClassLongPtrW (HWND hWnd, int nIndex)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetClassLongPtrW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetClassLongPtrW()"_lit);
   return GetClassLongPtrW_(hWnd, nIndex);
 }
 
 ULONG_PTR APIUser32::SetClassLongPtrA (HWND hWnd, int nIndex, LONG_PTR dwNewLong)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetClassLongPtrA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SetClassLongPtrA()"_lit);
   return SetClassLongPtrA_(hWnd, nIndex, dwNewLong);
 }
 
 ULONG_PTR APIUser32::SetClassLongPtrW (HWND hWnd, int nIndex, LONG_PTR dwNewLong)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetClassLongPtrW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SetClassLongPtrW()"_lit);
   return SetClassLongPtrW_(hWnd, nIndex, dwNewLong);
 }
 
 WINBOOL APIUser32::GetProcessDefaultLayout (DWORD * pdwDefaultLayout)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetProcessDefaultLayout()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetProcessDefaultLayout()"_lit);
   return GetProcessDefaultLayout_(pdwDefaultLayout);
 }
 
 WINBOOL APIUser32::SetProcessDefaultLayout (DWORD dwDefaultLayout)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetProcessDefaultLayout()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SetProcessDefaultLayout()"_lit);
   return SetProcessDefaultLayout_(dwDefaultLayout);
 }
 
 HWND APIUser32::GetDesktopWindow (VOID)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetDesktopWindow()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetDesktopWindow()"_lit);
   return GetDesktopWindow_();
 }
 
 HWND APIUser32::GetParent (HWND hWnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetParent()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetParent()"_lit);
   return GetParent_(hWnd);
 }
 
 HWND APIUser32::SetParent (HWND hWndChild, HWND hWndNewParent)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetParent()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SetParent()"_lit);
   return SetParent_(hWndChild, hWndNewParent);
 }
 
 WINBOOL APIUser32::EnumChildWindows (HWND hWndParent, WNDENUMPROC lpEnumFunc, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "EnumChildWindows()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "EnumChildWindows()"_lit);
   return EnumChildWindows_(hWndParent, lpEnumFunc, lParam);
 }
 
 HWND APIUser32::FindWindowA (LPCSTR lpClassName, LPCSTR lpWindowName)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "FindWindowA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "FindWindowA()"_lit);
   return FindWindowA_(lpClassName, lpWindowName);
 }
 
 HWND APIUser32::FindWindowW (LPCWSTR lpClassName, LPCWSTR lpWindowName)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "FindWindowW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "FindWindowW()"_lit);
   return FindWindowW_(lpClassName, lpWindowName);
 }
 
 HWND APIUser32::FindWindowExA (HWND hWndParent, HWND hWndChildAfter, LPCSTR lpszClass, LPCSTR lpszWindow)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "FindWindowExA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "FindWindowExA()"_lit);
   return FindWindowExA_(hWndParent, hWndChildAfter, lpszClass, lpszWindow);
 }
 
 HWND APIUser32::FindWindowExW (HWND hWndParent, HWND hWndChildAfter, LPCWSTR lpszClass, LPCWSTR lpszWindow)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "FindWindowExW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "FindWindowExW()"_lit);
   return FindWindowExW_(hWndParent, hWndChildAfter, lpszClass, lpszWindow);
 }
 
 HWND APIUser32::GetShellWindow (VOID)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetShellWindow()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetShellWindow()"_lit);
   return GetShellWindow_();
 }
 
 WINBOOL APIUser32::RegisterShellHookWindow (HWND hwnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "RegisterShellHookWindow()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "RegisterShellHookWindow()"_lit);
   return RegisterShellHookWindow_(hwnd);
 }
 
 WINBOOL APIUser32::DeregisterShellHookWindow (HWND hwnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DeregisterShellHookWindow()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "DeregisterShellHookWindow()"_lit);
   return DeregisterShellHookWindow_(hwnd);
 }
 
 WINBOOL APIUser32::EnumWindows (WNDENUMPROC lpEnumFunc, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "EnumWindows()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "EnumWindows()"_lit);
   return EnumWindows_(lpEnumFunc, lParam);
 }
 
 WINBOOL APIUser32::EnumThreadWindows (DWORD dwThreadId, WNDENUMPROC lpfn, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "EnumThreadWindows()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "EnumThreadWindows()"_lit);
   return EnumThreadWindows_(dwThreadId, lpfn, lParam);
 }
 
 int APIUser32::GetClassNameA (HWND hWnd, LPSTR lpClassName, int nMaxCount)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetClassNameA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetClassNameA()"_lit);
   return GetClassNameA_(hWnd, lpClassName, nMaxCount);
 }
 
 int APIUser32::GetClassNameW (HWND hWnd, LPWSTR lpClassName, int nMaxCount)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetClassNameW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetClassNameW()"_lit);
   return GetClassNameW_(hWnd, lpClassName, nMaxCount);
 }
 
 HWND APIUser32::GetTopWindow (HWND hWnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetTopWindow()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetTopWindow()"_lit);
   return GetTopWindow_(hWnd);
 }
 
 DWORD APIUser32::GetWindowThreadProcessId (HWND hWnd, LPDWORD lpdwProcessId)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetWindowThreadProcessId()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetWindowThreadProcessId()"_lit);
   return GetWindowThreadProcessId_(hWnd, lpdwProcessId);
 }
 
 WINBOOL APIUser32::IsGUIThread (WINBOOL bConvert)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "IsGUIThread()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "IsGUIThread()"_lit);
   return IsGUIThread_(bConvert);
 }
 
 HWND APIUser32::GetLastActivePopup (HWND hWnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetLastActivePopup()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetLastActivePopup()"_lit);
   return GetLastActivePopup_(hWnd);
 }
 
 HWND APIUser32::GetWindow (HWND hWnd, UINT uCmd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetWindow()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetWindow()"_lit);
   return GetWindow_(hWnd, uCmd);
 }
 
@@ -8112,13 +8123,13 @@ HWND APIUser32::GetWindow (HWND hWnd, UINT uCmd)
 
 HHOOK APIUser32::SetWindowsHookA (int nFilterType, HOOKPROC pfnFilterProc)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetWindowsHookA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SetWindowsHookA()"_lit);
   return SetWindowsHookA_(nFilterType, pfnFilterProc);
 }
 
 HHOOK APIUser32::SetWindowsHookW (int nFilterType, HOOKPROC pfnFilterProc)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetWindowsHookW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SetWindowsHookW()"_lit);
   return SetWindowsHookW_(nFilterType, pfnFilterProc);
 }
 
@@ -8126,13 +8137,13 @@ HHOOK APIUser32::SetWindowsHookW (int nFilterType, HOOKPROC pfnFilterProc)
 
 HOOKPROC APIUser32::SetWindowsHookA (int nFilterType, HOOKPROC pfnFilterProc)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetWindowsHookA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SetWindowsHookA()"_lit);
   return SetWindowsHookA_(nFilterType, pfnFilterProc);
 }
 
 HOOKPROC APIUser32::SetWindowsHookW (int nFilterType, HOOKPROC pfnFilterProc)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetWindowsHookW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SetWindowsHookW()"_lit);
   return SetWindowsHookW_(nFilterType, pfnFilterProc);
 }
 
@@ -8140,1609 +8151,1609 @@ HOOKPROC APIUser32::SetWindowsHookW (int nFilterType, HOOKPROC pfnFilterProc)
 
 WINBOOL APIUser32::UnhookWindowsHook (int nCode, HOOKPROC pfnFilterProc)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "UnhookWindowsHook()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "UnhookWindowsHook()"_lit);
   return UnhookWindowsHook_(nCode, pfnFilterProc);
 }
 
 HHOOK APIUser32::SetWindowsHookExA (int idHook, HOOKPROC lpfn, HINSTANCE hmod, DWORD dwThreadId)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetWindowsHookExA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SetWindowsHookExA()"_lit);
   return SetWindowsHookExA_(idHook, lpfn, hmod, dwThreadId);
 }
 
 HHOOK APIUser32::SetWindowsHookExW (int idHook, HOOKPROC lpfn, HINSTANCE hmod, DWORD dwThreadId)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetWindowsHookExW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SetWindowsHookExW()"_lit);
   return SetWindowsHookExW_(idHook, lpfn, hmod, dwThreadId);
 }
 
 WINBOOL APIUser32::UnhookWindowsHookEx (HHOOK hhk)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "UnhookWindowsHookEx()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "UnhookWindowsHookEx()"_lit);
   return UnhookWindowsHookEx_(hhk);
 }
 
 LRESULT APIUser32::CallNextHookEx (HHOOK hhk, int nCode, WPARAM wParam, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CallNextHookEx()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "CallNextHookEx()"_lit);
   return CallNextHookEx_(hhk, nCode, wParam, lParam);
 }
 
 WINBOOL APIUser32::CheckMenuRadioItem (HMENU hmenu, UINT first, UINT last, UINT check, UINT flags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CheckMenuRadioItem()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "CheckMenuRadioItem()"_lit);
   return CheckMenuRadioItem_(hmenu, first, last, check, flags);
 }
 
 HBITMAP APIUser32::LoadBitmapA (HINSTANCE hInstance, LPCSTR lpBitmapName)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "LoadBitmapA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "LoadBitmapA()"_lit);
   return LoadBitmapA_(hInstance, lpBitmapName);
 }
 
 HBITMAP APIUser32::LoadBitmapW (HINSTANCE hInstance, LPCWSTR lpBitmapName)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "LoadBitmapW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "LoadBitmapW()"_lit);
   return LoadBitmapW_(hInstance, lpBitmapName);
 }
 
 HCURSOR APIUser32::LoadCursorA (HINSTANCE hInstance, LPCSTR lpCursorName)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "LoadCursorA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "LoadCursorA()"_lit);
   return LoadCursorA_(hInstance, lpCursorName);
 }
 
 HCURSOR APIUser32::LoadCursorW (HINSTANCE hInstance, LPCWSTR lpCursorName)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "LoadCursorW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "LoadCursorW()"_lit);
   return LoadCursorW_(hInstance, lpCursorName);
 }
 
 HCURSOR APIUser32::LoadCursorFromFileA (LPCSTR lpFileName)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "LoadCursorFromFileA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "LoadCursorFromFileA()"_lit);
   return LoadCursorFromFileA_(lpFileName);
 }
 
 HCURSOR APIUser32::LoadCursorFromFileW (LPCWSTR lpFileName)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "LoadCursorFromFileW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "LoadCursorFromFileW()"_lit);
   return LoadCursorFromFileW_(lpFileName);
 }
 
 HCURSOR APIUser32::CreateCursor (HINSTANCE hInst, int xHotSpot, int yHotSpot, int nWidth, int nHeight, CONST VOID * pvANDPlane, CONST VOID * pvXORPlane)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CreateCursor()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "CreateCursor()"_lit);
   return CreateCursor_(hInst, xHotSpot, yHotSpot, nWidth, nHeight, pvANDPlane, pvXORPlane);
 }
 
 WINBOOL APIUser32::DestroyCursor (HCURSOR hCursor)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DestroyCursor()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "DestroyCursor()"_lit);
   return DestroyCursor_(hCursor);
 }
 
 WINBOOL APIUser32::SetSystemCursor (HCURSOR hcur, DWORD id)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetSystemCursor()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SetSystemCursor()"_lit);
   return SetSystemCursor_(hcur, id);
 }
 
 HICON APIUser32::LoadIconA (HINSTANCE hInstance, LPCSTR lpIconName)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "LoadIconA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "LoadIconA()"_lit);
   return LoadIconA_(hInstance, lpIconName);
 }
 
 HICON APIUser32::LoadIconW (HINSTANCE hInstance, LPCWSTR lpIconName)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "LoadIconW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "LoadIconW()"_lit);
   return LoadIconW_(hInstance, lpIconName);
 }
 
 UINT APIUser32::PrivateExtractIconsA (LPCSTR szFileName, int nIconIndex, int cxIcon, int cyIcon, HICON * phicon, UINT * piconid, UINT nIcons, UINT flags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "PrivateExtractIconsA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "PrivateExtractIconsA()"_lit);
   return PrivateExtractIconsA_(szFileName, nIconIndex, cxIcon, cyIcon, phicon, piconid, nIcons, flags);
 }
 
 UINT APIUser32::PrivateExtractIconsW (LPCWSTR szFileName, int nIconIndex, int cxIcon, int cyIcon, HICON * phicon, UINT * piconid, UINT nIcons, UINT flags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "PrivateExtractIconsW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "PrivateExtractIconsW()"_lit);
   return PrivateExtractIconsW_(szFileName, nIconIndex, cxIcon, cyIcon, phicon, piconid, nIcons, flags);
 }
 
 HICON APIUser32::CreateIcon (HINSTANCE hInstance, int nWidth, int nHeight, BYTE cPlanes, BYTE cBitsPixel, CONST BYTE * lpbANDbits, CONST BYTE * lpbXORbits)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CreateIcon()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "CreateIcon()"_lit);
   return CreateIcon_(hInstance, nWidth, nHeight, cPlanes, cBitsPixel, lpbANDbits, lpbXORbits);
 }
 
 WINBOOL APIUser32::DestroyIcon (HICON hIcon)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DestroyIcon()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "DestroyIcon()"_lit);
   return DestroyIcon_(hIcon);
 }
 
 int APIUser32::LookupIconIdFromDirectory (PBYTE presbits, WINBOOL fIcon)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "LookupIconIdFromDirectory()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "LookupIconIdFromDirectory()"_lit);
   return LookupIconIdFromDirectory_(presbits, fIcon);
 }
 
 int APIUser32::LookupIconIdFromDirectoryEx (PBYTE presbits, WINBOOL fIcon, int cxDesired, int cyDesired, UINT Flags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "LookupIconIdFromDirectoryEx()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "LookupIconIdFromDirectoryEx()"_lit);
   return LookupIconIdFromDirectoryEx_(presbits, fIcon, cxDesired, cyDesired, Flags);
 }
 
 HICON APIUser32::CreateIconFromResource (PBYTE presbits, DWORD dwResSize, WINBOOL fIcon, DWORD dwVer)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CreateIconFromResource()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "CreateIconFromResource()"_lit);
   return CreateIconFromResource_(presbits, dwResSize, fIcon, dwVer);
 }
 
 HICON APIUser32::CreateIconFromResourceEx (PBYTE presbits, DWORD dwResSize, WINBOOL fIcon, DWORD dwVer, int cxDesired, int cyDesired, UINT Flags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CreateIconFromResourceEx()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "CreateIconFromResourceEx()"_lit);
   return CreateIconFromResourceEx_(presbits, dwResSize, fIcon, dwVer, cxDesired, cyDesired, Flags);
 }
 
 HANDLE APIUser32::LoadImageA (HINSTANCE hInst, LPCSTR name, UINT type, int cx, int cy, UINT fuLoad)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "LoadImageA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "LoadImageA()"_lit);
   return LoadImageA_(hInst, name, type, cx, cy, fuLoad);
 }
 
 HANDLE APIUser32::LoadImageW (HINSTANCE hInst, LPCWSTR name, UINT type, int cx, int cy, UINT fuLoad)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "LoadImageW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "LoadImageW()"_lit);
   return LoadImageW_(hInst, name, type, cx, cy, fuLoad);
 }
 
 HANDLE APIUser32::CopyImage (HANDLE h, UINT type, int cx, int cy, UINT flags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CopyImage()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "CopyImage()"_lit);
   return CopyImage_(h, type, cx, cy, flags);
 }
 
 WINBOOL APIUser32::DrawIconEx (HDC hdc, int xLeft, int yTop, HICON hIcon, int cxWidth, int cyWidth, UINT istepIfAniCur, HBRUSH hbrFlickerFreeDraw, UINT diFlags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DrawIconEx()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "DrawIconEx()"_lit);
   return DrawIconEx_(hdc, xLeft, yTop, hIcon, cxWidth, cyWidth, istepIfAniCur, hbrFlickerFreeDraw, diFlags);
 }
 
 HICON APIUser32::CreateIconIndirect (PICONINFO piconinfo)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CreateIconIndirect()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "CreateIconIndirect()"_lit);
   return CreateIconIndirect_(piconinfo);
 }
 
 HICON APIUser32::CopyIcon (HICON hIcon)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CopyIcon()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "CopyIcon()"_lit);
   return CopyIcon_(hIcon);
 }
 
 WINBOOL APIUser32::GetIconInfo (HICON hIcon, PICONINFO piconinfo)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetIconInfo()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetIconInfo()"_lit);
   return GetIconInfo_(hIcon, piconinfo);
 }
 
 WINBOOL APIUser32::GetIconInfoExA (HICON hicon, PICONINFOEXA piconinfo)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetIconInfoExA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetIconInfoExA()"_lit);
   return GetIconInfoExA_(hicon, piconinfo);
 }
 
 WINBOOL APIUser32::GetIconInfoExW (HICON hicon, PICONINFOEXW piconinfo)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetIconInfoExW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetIconInfoExW()"_lit);
   return GetIconInfoExW_(hicon, piconinfo);
 }
 
 int APIUser32::LoadStringA (HINSTANCE hInstance, UINT uID, LPSTR lpBuffer, int cchBufferMax)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "LoadStringA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "LoadStringA()"_lit);
   return LoadStringA_(hInstance, uID, lpBuffer, cchBufferMax);
 }
 
 int APIUser32::LoadStringW (HINSTANCE hInstance, UINT uID, LPWSTR lpBuffer, int cchBufferMax)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "LoadStringW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "LoadStringW()"_lit);
   return LoadStringW_(hInstance, uID, lpBuffer, cchBufferMax);
 }
 
 WINBOOL APIUser32::IsDialogMessageA (HWND hDlg, LPMSG lpMsg)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "IsDialogMessageA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "IsDialogMessageA()"_lit);
   return IsDialogMessageA_(hDlg, lpMsg);
 }
 
 WINBOOL APIUser32::IsDialogMessageW (HWND hDlg, LPMSG lpMsg)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "IsDialogMessageW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "IsDialogMessageW()"_lit);
   return IsDialogMessageW_(hDlg, lpMsg);
 }
 
 WINBOOL APIUser32::MapDialogRect (HWND hDlg, LPRECT lpRect)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "MapDialogRect()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "MapDialogRect()"_lit);
   return MapDialogRect_(hDlg, lpRect);
 }
 
 int APIUser32::DlgDirListA (HWND hDlg, LPSTR lpPathSpec, int nIDListBox, int nIDStaticPath, UINT uFileType)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DlgDirListA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "DlgDirListA()"_lit);
   return DlgDirListA_(hDlg, lpPathSpec, nIDListBox, nIDStaticPath, uFileType);
 }
 
 int APIUser32::DlgDirListW (HWND hDlg, LPWSTR lpPathSpec, int nIDListBox, int nIDStaticPath, UINT uFileType)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DlgDirListW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "DlgDirListW()"_lit);
   return DlgDirListW_(hDlg, lpPathSpec, nIDListBox, nIDStaticPath, uFileType);
 }
 
 WINBOOL APIUser32::DlgDirSelectExA (HWND hwndDlg, LPSTR lpString, int chCount, int idListBox)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DlgDirSelectExA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "DlgDirSelectExA()"_lit);
   return DlgDirSelectExA_(hwndDlg, lpString, chCount, idListBox);
 }
 
 WINBOOL APIUser32::DlgDirSelectExW (HWND hwndDlg, LPWSTR lpString, int chCount, int idListBox)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DlgDirSelectExW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "DlgDirSelectExW()"_lit);
   return DlgDirSelectExW_(hwndDlg, lpString, chCount, idListBox);
 }
 
 int APIUser32::DlgDirListComboBoxA (HWND hDlg, LPSTR lpPathSpec, int nIDComboBox, int nIDStaticPath, UINT uFiletype)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DlgDirListComboBoxA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "DlgDirListComboBoxA()"_lit);
   return DlgDirListComboBoxA_(hDlg, lpPathSpec, nIDComboBox, nIDStaticPath, uFiletype);
 }
 
 int APIUser32::DlgDirListComboBoxW (HWND hDlg, LPWSTR lpPathSpec, int nIDComboBox, int nIDStaticPath, UINT uFiletype)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DlgDirListComboBoxW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "DlgDirListComboBoxW()"_lit);
   return DlgDirListComboBoxW_(hDlg, lpPathSpec, nIDComboBox, nIDStaticPath, uFiletype);
 }
 
 WINBOOL APIUser32::DlgDirSelectComboBoxExA (HWND hwndDlg, LPSTR lpString, int cchOut, int idComboBox)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DlgDirSelectComboBoxExA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "DlgDirSelectComboBoxExA()"_lit);
   return DlgDirSelectComboBoxExA_(hwndDlg, lpString, cchOut, idComboBox);
 }
 
 WINBOOL APIUser32::DlgDirSelectComboBoxExW (HWND hwndDlg, LPWSTR lpString, int cchOut, int idComboBox)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DlgDirSelectComboBoxExW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "DlgDirSelectComboBoxExW()"_lit);
   return DlgDirSelectComboBoxExW_(hwndDlg, lpString, cchOut, idComboBox);
 }
 
 int APIUser32::SetScrollInfo (HWND hwnd, int nBar, LPCSCROLLINFO lpsi, WINBOOL redraw)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetScrollInfo()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SetScrollInfo()"_lit);
   return SetScrollInfo_(hwnd, nBar, lpsi, redraw);
 }
 
 WINBOOL APIUser32::GetScrollInfo (HWND hwnd, int nBar, LPSCROLLINFO lpsi)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetScrollInfo()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetScrollInfo()"_lit);
   return GetScrollInfo_(hwnd, nBar, lpsi);
 }
 
 LRESULT APIUser32::DefFrameProcA (HWND hWnd, HWND hWndMDIClient, UINT uMsg, WPARAM wParam, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DefFrameProcA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "DefFrameProcA()"_lit);
   return DefFrameProcA_(hWnd, hWndMDIClient, uMsg, wParam, lParam);
 }
 
 LRESULT APIUser32::DefFrameProcW (HWND hWnd, HWND hWndMDIClient, UINT uMsg, WPARAM wParam, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DefFrameProcW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "DefFrameProcW()"_lit);
   return DefFrameProcW_(hWnd, hWndMDIClient, uMsg, wParam, lParam);
 }
 
 LRESULT APIUser32::DefMDIChildProcA (HWND hWnd, UINT uMsg, WPARAM wParam, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DefMDIChildProcA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "DefMDIChildProcA()"_lit);
   return DefMDIChildProcA_(hWnd, uMsg, wParam, lParam);
 }
 
 LRESULT APIUser32::DefMDIChildProcW (HWND hWnd, UINT uMsg, WPARAM wParam, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DefMDIChildProcW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "DefMDIChildProcW()"_lit);
   return DefMDIChildProcW_(hWnd, uMsg, wParam, lParam);
 }
 
 WINBOOL APIUser32::TranslateMDISysAccel (HWND hWndClient, LPMSG lpMsg)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "TranslateMDISysAccel()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "TranslateMDISysAccel()"_lit);
   return TranslateMDISysAccel_(hWndClient, lpMsg);
 }
 
 UINT APIUser32::ArrangeIconicWindows (HWND hWnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ArrangeIconicWindows()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "ArrangeIconicWindows()"_lit);
   return ArrangeIconicWindows_(hWnd);
 }
 
 HWND APIUser32::CreateMDIWindowA (LPCSTR lpClassName, LPCSTR lpWindowName, DWORD dwStyle, int X, int Y, int nWidth, int nHeight, HWND hWndParent, HINSTANCE hInstance, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CreateMDIWindowA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "CreateMDIWindowA()"_lit);
   return CreateMDIWindowA_(lpClassName, lpWindowName, dwStyle, X, Y, nWidth, nHeight, hWndParent, hInstance, lParam);
 }
 
 HWND APIUser32::CreateMDIWindowW (LPCWSTR lpClassName, LPCWSTR lpWindowName, DWORD dwStyle, int X, int Y, int nWidth, int nHeight, HWND hWndParent, HINSTANCE hInstance, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CreateMDIWindowW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "CreateMDIWindowW()"_lit);
   return CreateMDIWindowW_(lpClassName, lpWindowName, dwStyle, X, Y, nWidth, nHeight, hWndParent, hInstance, lParam);
 }
 
 WORD APIUser32::TileWindows (HWND hwndParent, UINT wHow, CONST RECT * lpRect, UINT cKids, const HWND * lpKids)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "TileWindows()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "TileWindows()"_lit);
   return TileWindows_(hwndParent, wHow, lpRect, cKids, lpKids);
 }
 
 WORD APIUser32::CascadeWindows (HWND hwndParent, UINT wHow, CONST RECT * lpRect, UINT cKids, const HWND * lpKids)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CascadeWindows()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "CascadeWindows()"_lit);
   return CascadeWindows_(hwndParent, wHow, lpRect, cKids, lpKids);
 }
 
 WINBOOL APIUser32::WinHelpA (HWND hWndMain, LPCSTR lpszHelp, UINT uCommand, ULONG_PTR dwData)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "WinHelpA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "WinHelpA()"_lit);
   return WinHelpA_(hWndMain, lpszHelp, uCommand, dwData);
 }
 
 WINBOOL APIUser32::WinHelpW (HWND hWndMain, LPCWSTR lpszHelp, UINT uCommand, ULONG_PTR dwData)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "WinHelpW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "WinHelpW()"_lit);
   return WinHelpW_(hWndMain, lpszHelp, uCommand, dwData);
 }
 
 DWORD APIUser32::GetGuiResources (HANDLE hProcess, DWORD uiFlags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetGuiResources()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetGuiResources()"_lit);
   return GetGuiResources_(hProcess, uiFlags);
 }
 
 LONG APIUser32::ChangeDisplaySettingsA (LPDEVMODEA lpDevMode, DWORD dwFlags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ChangeDisplaySettingsA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "ChangeDisplaySettingsA()"_lit);
   return ChangeDisplaySettingsA_(lpDevMode, dwFlags);
 }
 
 LONG APIUser32::ChangeDisplaySettingsW (LPDEVMODEW lpDevMode, DWORD dwFlags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ChangeDisplaySettingsW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "ChangeDisplaySettingsW()"_lit);
   return ChangeDisplaySettingsW_(lpDevMode, dwFlags);
 }
 
 LONG APIUser32::ChangeDisplaySettingsExA (LPCSTR lpszDeviceName, LPDEVMODEA lpDevMode, HWND hwnd, DWORD dwflags, LPVOID lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ChangeDisplaySettingsExA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "ChangeDisplaySettingsExA()"_lit);
   return ChangeDisplaySettingsExA_(lpszDeviceName, lpDevMode, hwnd, dwflags, lParam);
 }
 
 LONG APIUser32::ChangeDisplaySettingsExW (LPCWSTR lpszDeviceName, LPDEVMODEW lpDevMode, HWND hwnd, DWORD dwflags, LPVOID lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ChangeDisplaySettingsExW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "ChangeDisplaySettingsExW()"_lit);
   return ChangeDisplaySettingsExW_(lpszDeviceName, lpDevMode, hwnd, dwflags, lParam);
 }
 
 WINBOOL APIUser32::EnumDisplaySettingsA (LPCSTR lpszDeviceName, DWORD iModeNum, LPDEVMODEA lpDevMode)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "EnumDisplaySettingsA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "EnumDisplaySettingsA()"_lit);
   return EnumDisplaySettingsA_(lpszDeviceName, iModeNum, lpDevMode);
 }
 
 WINBOOL APIUser32::EnumDisplaySettingsW (LPCWSTR lpszDeviceName, DWORD iModeNum, LPDEVMODEW lpDevMode)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "EnumDisplaySettingsW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "EnumDisplaySettingsW()"_lit);
   return EnumDisplaySettingsW_(lpszDeviceName, iModeNum, lpDevMode);
 }
 
 WINBOOL APIUser32::EnumDisplaySettingsExA (LPCSTR lpszDeviceName, DWORD iModeNum, LPDEVMODEA lpDevMode, DWORD dwFlags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "EnumDisplaySettingsExA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "EnumDisplaySettingsExA()"_lit);
   return EnumDisplaySettingsExA_(lpszDeviceName, iModeNum, lpDevMode, dwFlags);
 }
 
 WINBOOL APIUser32::EnumDisplaySettingsExW (LPCWSTR lpszDeviceName, DWORD iModeNum, LPDEVMODEW lpDevMode, DWORD dwFlags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "EnumDisplaySettingsExW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "EnumDisplaySettingsExW()"_lit);
   return EnumDisplaySettingsExW_(lpszDeviceName, iModeNum, lpDevMode, dwFlags);
 }
 
 WINBOOL APIUser32::EnumDisplayDevicesA (LPCSTR lpDevice, DWORD iDevNum, PDISPLAY_DEVICEA lpDisplayDevice, DWORD dwFlags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "EnumDisplayDevicesA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "EnumDisplayDevicesA()"_lit);
   return EnumDisplayDevicesA_(lpDevice, iDevNum, lpDisplayDevice, dwFlags);
 }
 
 WINBOOL APIUser32::EnumDisplayDevicesW (LPCWSTR lpDevice, DWORD iDevNum, PDISPLAY_DEVICEW lpDisplayDevice, DWORD dwFlags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "EnumDisplayDevicesW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "EnumDisplayDevicesW()"_lit);
   return EnumDisplayDevicesW_(lpDevice, iDevNum, lpDisplayDevice, dwFlags);
 }
 
 LONG APIUser32::GetDisplayConfigBufferSizes (UINT32 flags, UINT32 * numPathArrayElements, UINT32 * numModeInfoArrayElements)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetDisplayConfigBufferSizes()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetDisplayConfigBufferSizes()"_lit);
   return GetDisplayConfigBufferSizes_(flags, numPathArrayElements, numModeInfoArrayElements);
 }
 
 LONG APIUser32::SetDisplayConfig (UINT32 numPathArrayElements, DISPLAYCONFIG_PATH_INFO * pathArray, UINT32 numModeInfoArrayElements, DISPLAYCONFIG_MODE_INFO * modeInfoArray, UINT32 flags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetDisplayConfig()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SetDisplayConfig()"_lit);
   return SetDisplayConfig_(numPathArrayElements, pathArray, numModeInfoArrayElements, modeInfoArray, flags);
 }
 
 LONG APIUser32::QueryDisplayConfig (UINT32 flags, UINT32 * numPathArrayElements, DISPLAYCONFIG_PATH_INFO * pathArray, UINT32 * numModeInfoArrayElements, DISPLAYCONFIG_MODE_INFO * modeInfoArray, DISPLAYCONFIG_TOPOLOGY_ID * currentTopologyId)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "QueryDisplayConfig()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "QueryDisplayConfig()"_lit);
   return QueryDisplayConfig_(flags, numPathArrayElements, pathArray, numModeInfoArrayElements, modeInfoArray, currentTopologyId);
 }
 
 LONG APIUser32::DisplayConfigGetDeviceInfo (DISPLAYCONFIG_DEVICE_INFO_HEADER * requestPacket)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DisplayConfigGetDeviceInfo()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "DisplayConfigGetDeviceInfo()"_lit);
   return DisplayConfigGetDeviceInfo_(requestPacket);
 }
 
 LONG APIUser32::DisplayConfigSetDeviceInfo (DISPLAYCONFIG_DEVICE_INFO_HEADER * setPacket)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DisplayConfigSetDeviceInfo()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "DisplayConfigSetDeviceInfo()"_lit);
   return DisplayConfigSetDeviceInfo_(setPacket);
 }
 
 WINBOOL APIUser32::SystemParametersInfoA (UINT uiAction, UINT uiParam, PVOID pvParam, UINT fWinIni)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SystemParametersInfoA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SystemParametersInfoA()"_lit);
   return SystemParametersInfoA_(uiAction, uiParam, pvParam, fWinIni);
 }
 
 WINBOOL APIUser32::SystemParametersInfoW (UINT uiAction, UINT uiParam, PVOID pvParam, UINT fWinIni)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SystemParametersInfoW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SystemParametersInfoW()"_lit);
   return SystemParametersInfoW_(uiAction, uiParam, pvParam, fWinIni);
 }
 
 VOID APIUser32::SetDebugErrorLevel (DWORD dwLevel)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetDebugErrorLevel()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SetDebugErrorLevel()"_lit);
   SetDebugErrorLevel_(dwLevel);
 }
 
 VOID APIUser32::SetLastErrorEx (DWORD dwErrCode, DWORD dwType)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetLastErrorEx()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SetLastErrorEx()"_lit);
   SetLastErrorEx_(dwErrCode, dwType);
 }
 
 int APIUser32::InternalGetWindowText (HWND hWnd, LPWSTR pString, int cchMaxCount)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "InternalGetWindowText()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "InternalGetWindowText()"_lit);
   return InternalGetWindowText_(hWnd, pString, cchMaxCount);
 }
 
 WINBOOL APIUser32::CancelShutdown (VOID)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CancelShutdown()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "CancelShutdown()"_lit);
   return CancelShutdown_();
 }
 
 HMONITOR APIUser32::MonitorFromPoint (POINT pt, DWORD dwFlags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "MonitorFromPoint()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "MonitorFromPoint()"_lit);
   return MonitorFromPoint_(pt, dwFlags);
 }
 
 HMONITOR APIUser32::MonitorFromRect (LPCRECT lprc, DWORD dwFlags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "MonitorFromRect()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "MonitorFromRect()"_lit);
   return MonitorFromRect_(lprc, dwFlags);
 }
 
 HMONITOR APIUser32::MonitorFromWindow (HWND hwnd, DWORD dwFlags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "MonitorFromWindow()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "MonitorFromWindow()"_lit);
   return MonitorFromWindow_(hwnd, dwFlags);
 }
 
 WINBOOL APIUser32::EndTask (HWND hWnd, WINBOOL fShutDown, WINBOOL fForce)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "EndTask()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "EndTask()"_lit);
   return EndTask_(hWnd, fShutDown, fForce);
 }
 
 WINBOOL APIUser32::SoundSentry (VOID)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SoundSentry()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SoundSentry()"_lit);
   return SoundSentry_();
 }
 
 WINBOOL APIUser32::GetMonitorInfoA (HMONITOR hMonitor, LPMONITORINFO lpmi)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetMonitorInfoA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetMonitorInfoA()"_lit);
   return GetMonitorInfoA_(hMonitor, lpmi);
 }
 
 WINBOOL APIUser32::GetMonitorInfoW (HMONITOR hMonitor, LPMONITORINFO lpmi)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetMonitorInfoW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetMonitorInfoW()"_lit);
   return GetMonitorInfoW_(hMonitor, lpmi);
 }
 
 WINBOOL APIUser32::EnumDisplayMonitors (HDC hdc, LPCRECT lprcClip, MONITORENUMPROC lpfnEnum, LPARAM dwData)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "EnumDisplayMonitors()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "EnumDisplayMonitors()"_lit);
   return EnumDisplayMonitors_(hdc, lprcClip, lpfnEnum, dwData);
 }
 
 VOID APIUser32::NotifyWinEvent (DWORD event, HWND hwnd, LONG idObject, LONG idChild)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "NotifyWinEvent()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "NotifyWinEvent()"_lit);
   NotifyWinEvent_(event, hwnd, idObject, idChild);
 }
 
 HWINEVENTHOOK APIUser32::SetWinEventHook (DWORD eventMin, DWORD eventMax, HMODULE hmodWinEventProc, WINEVENTPROC pfnWinEventProc, DWORD idProcess, DWORD idThread, DWORD dwFlags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetWinEventHook()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SetWinEventHook()"_lit);
   return SetWinEventHook_(eventMin, eventMax, hmodWinEventProc, pfnWinEventProc, idProcess, idThread, dwFlags);
 }
 
 WINBOOL APIUser32::IsWinEventHookInstalled (DWORD event)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "IsWinEventHookInstalled()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "IsWinEventHookInstalled()"_lit);
   return IsWinEventHookInstalled_(event);
 }
 
 WINBOOL APIUser32::UnhookWinEvent (HWINEVENTHOOK hWinEventHook)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "UnhookWinEvent()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "UnhookWinEvent()"_lit);
   return UnhookWinEvent_(hWinEventHook);
 }
 
 WINBOOL APIUser32::GetGUIThreadInfo (DWORD idThread, PGUITHREADINFO pgui)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetGUIThreadInfo()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetGUIThreadInfo()"_lit);
   return GetGUIThreadInfo_(idThread, pgui);
 }
 
 WINBOOL APIUser32::BlockInput (WINBOOL fBlockIt)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "BlockInput()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "BlockInput()"_lit);
   return BlockInput_(fBlockIt);
 }
 
 UINT APIUser32::GetWindowModuleFileNameA (HWND hwnd, LPSTR pszFileName, UINT cchFileNameMax)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetWindowModuleFileNameA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetWindowModuleFileNameA()"_lit);
   return GetWindowModuleFileNameA_(hwnd, pszFileName, cchFileNameMax);
 }
 
 UINT APIUser32::GetWindowModuleFileNameW (HWND hwnd, LPWSTR pszFileName, UINT cchFileNameMax)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetWindowModuleFileNameW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetWindowModuleFileNameW()"_lit);
   return GetWindowModuleFileNameW_(hwnd, pszFileName, cchFileNameMax);
 }
 
 WINBOOL APIUser32::SetProcessDPIAware (VOID)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetProcessDPIAware()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SetProcessDPIAware()"_lit);
   return SetProcessDPIAware_();
 }
 
 WINBOOL APIUser32::IsProcessDPIAware (VOID)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "IsProcessDPIAware()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "IsProcessDPIAware()"_lit);
   return IsProcessDPIAware_();
 }
 
 WINBOOL APIUser32::GetCursorInfo (PCURSORINFO pci)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetCursorInfo()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetCursorInfo()"_lit);
   return GetCursorInfo_(pci);
 }
 
 WINBOOL APIUser32::GetWindowInfo (HWND hwnd, PWINDOWINFO pwi)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetWindowInfo()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetWindowInfo()"_lit);
   return GetWindowInfo_(hwnd, pwi);
 }
 
 WINBOOL APIUser32::GetTitleBarInfo (HWND hwnd, PTITLEBARINFO pti)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetTitleBarInfo()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetTitleBarInfo()"_lit);
   return GetTitleBarInfo_(hwnd, pti);
 }
 
 WINBOOL APIUser32::GetMenuBarInfo (HWND hwnd, LONG idObject, LONG idItem, PMENUBARINFO pmbi)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetMenuBarInfo()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetMenuBarInfo()"_lit);
   return GetMenuBarInfo_(hwnd, idObject, idItem, pmbi);
 }
 
 WINBOOL APIUser32::GetScrollBarInfo (HWND hwnd, LONG idObject, PSCROLLBARINFO psbi)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetScrollBarInfo()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetScrollBarInfo()"_lit);
   return GetScrollBarInfo_(hwnd, idObject, psbi);
 }
 
 WINBOOL APIUser32::GetComboBoxInfo (HWND hwndCombo, PCOMBOBOXINFO pcbi)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetComboBoxInfo()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetComboBoxInfo()"_lit);
   return GetComboBoxInfo_(hwndCombo, pcbi);
 }
 
 HWND APIUser32::GetAncestor (HWND hwnd, UINT gaFlags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetAncestor()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetAncestor()"_lit);
   return GetAncestor_(hwnd, gaFlags);
 }
 
 HWND APIUser32::RealChildWindowFromPoint (HWND hwndParent, POINT ptParentClientCoords)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "RealChildWindowFromPoint()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "RealChildWindowFromPoint()"_lit);
   return RealChildWindowFromPoint_(hwndParent, ptParentClientCoords);
 }
 
 UINT APIUser32::RealGetWindowClassA (HWND hwnd, LPSTR ptszClassName, UINT cchClassNameMax)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "RealGetWindowClassA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "RealGetWindowClassA()"_lit);
   return RealGetWindowClassA_(hwnd, ptszClassName, cchClassNameMax);
 }
 
 UINT APIUser32::RealGetWindowClassW (HWND hwnd, LPWSTR ptszClassName, UINT cchClassNameMax)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "RealGetWindowClassW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "RealGetWindowClassW()"_lit);
   return RealGetWindowClassW_(hwnd, ptszClassName, cchClassNameMax);
 }
 
 WINBOOL APIUser32::GetAltTabInfoA (HWND hwnd, int iItem, PALTTABINFO pati, LPSTR pszItemText, UINT cchItemText)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetAltTabInfoA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetAltTabInfoA()"_lit);
   return GetAltTabInfoA_(hwnd, iItem, pati, pszItemText, cchItemText);
 }
 
 WINBOOL APIUser32::GetAltTabInfoW (HWND hwnd, int iItem, PALTTABINFO pati, LPWSTR pszItemText, UINT cchItemText)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetAltTabInfoW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetAltTabInfoW()"_lit);
   return GetAltTabInfoW_(hwnd, iItem, pati, pszItemText, cchItemText);
 }
 
 DWORD APIUser32::GetListBoxInfo (HWND hwnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetListBoxInfo()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetListBoxInfo()"_lit);
   return GetListBoxInfo_(hwnd);
 }
 
 WINBOOL APIUser32::LockWorkStation (VOID)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "LockWorkStation()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "LockWorkStation()"_lit);
   return LockWorkStation_();
 }
 
 WINBOOL APIUser32::UserHandleGrantAccess (HANDLE hUserHandle, HANDLE hJob, WINBOOL bGrant)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "UserHandleGrantAccess()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "UserHandleGrantAccess()"_lit);
   return UserHandleGrantAccess_(hUserHandle, hJob, bGrant);
 }
 
 UINT APIUser32::GetRawInputData (HRAWINPUT hRawInput, UINT uiCommand, LPVOID pData, PUINT pcbSize, UINT cbSizeHeader)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetRawInputData");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetRawInputData"_lit);
   return GetRawInputData_(hRawInput, uiCommand, pData, pcbSize, cbSizeHeader);
 }
 
 UINT APIUser32::GetRawInputDeviceInfoA (HANDLE hDevice, UINT uiCommand, LPVOID pData, PUINT pcbSize)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetRawInputDeviceInfoA");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetRawInputDeviceInfoA"_lit);
   return GetRawInputDeviceInfoA_(hDevice, uiCommand, pData, pcbSize);
 }
 
 UINT APIUser32::GetRawInputDeviceInfoW (HANDLE hDevice, UINT uiCommand, LPVOID pData, PUINT pcbSize)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetRawInputDeviceInfoW");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetRawInputDeviceInfoW"_lit);
   return GetRawInputDeviceInfoW_(hDevice, uiCommand, pData, pcbSize);
 }
 
 UINT APIUser32::GetRawInputBuffer (PRAWINPUT pData, PUINT pcbSize, UINT cbSizeHeader)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetRawInputBuffer");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetRawInputBuffer"_lit);
   return GetRawInputBuffer_(pData, pcbSize, cbSizeHeader);
 }
 
 WINBOOL APIUser32::RegisterRawInputDevices (PCRAWINPUTDEVICE pRawInputDevices, UINT uiNumDevices, UINT cbSize)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "RegisterRawInputDevices");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "RegisterRawInputDevices"_lit);
   return RegisterRawInputDevices_(pRawInputDevices, uiNumDevices, cbSize);
 }
 
 UINT APIUser32::GetRegisteredRawInputDevices (PRAWINPUTDEVICE pRawInputDevices, PUINT puiNumDevices, UINT cbSize)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetRegisteredRawInputDevices");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetRegisteredRawInputDevices"_lit);
   return GetRegisteredRawInputDevices_(pRawInputDevices, puiNumDevices, cbSize);
 }
 
 UINT APIUser32::GetRawInputDeviceList (PRAWINPUTDEVICELIST pRawInputDeviceList, PUINT puiNumDevices, UINT cbSize)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "APIUser32::GetRawInputDeviceList()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "APIUser32::GetRawInputDeviceList()"_lit);
   return GetRawInputDeviceList_(pRawInputDeviceList, puiNumDevices, cbSize);
 }
 
 LRESULT APIUser32::DefRawInputProc (PRAWINPUT * paRawInput, INT nInput, UINT cbSizeHeader)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DefRawInputProc");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "DefRawInputProc"_lit);
   return DefRawInputProc_(paRawInput, nInput, cbSizeHeader);
 }
 
 WINBOOL APIUser32::GetPointerDevices (UINT32 * deviceCount, POINTER_DEVICE_INFO * pointerDevices)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetPointerDevices()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetPointerDevices()"_lit);
   return GetPointerDevices_(deviceCount, pointerDevices);
 }
 
 WINBOOL APIUser32::GetPointerDevice (HANDLE device, POINTER_DEVICE_INFO * pointerDevice)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetPointerDevice()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetPointerDevice()"_lit);
   return GetPointerDevice_(device, pointerDevice);
 }
 
 WINBOOL APIUser32::GetPointerDeviceProperties (HANDLE device, UINT32 * propertyCount, POINTER_DEVICE_PROPERTY * pointerProperties)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetPointerDeviceProperties()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetPointerDeviceProperties()"_lit);
   return GetPointerDeviceProperties_(device, propertyCount, pointerProperties);
 }
 
 WINBOOL APIUser32::RegisterPointerDeviceNotifications (HWND window, WINBOOL notifyRange)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "RegisterPointerDeviceNotifications()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "RegisterPointerDeviceNotifications()"_lit);
   return RegisterPointerDeviceNotifications_(window, notifyRange);
 }
 
 WINBOOL APIUser32::GetPointerDeviceRects (HANDLE device, RECT * pointerDeviceRect, RECT * displayRect)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetPointerDeviceRects()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetPointerDeviceRects()"_lit);
   return GetPointerDeviceRects_(device, pointerDeviceRect, displayRect);
 }
 
 WINBOOL APIUser32::GetPointerDeviceCursors (HANDLE device, UINT32 * cursorCount, POINTER_DEVICE_CURSOR_INFO * deviceCursors)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetPointerDeviceCursors()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetPointerDeviceCursors()"_lit);
   return GetPointerDeviceCursors_(device, cursorCount, deviceCursors);
 }
 
 WINBOOL APIUser32::GetRawPointerDeviceData (UINT32 pointerId, UINT32 historyCount, UINT32 propertiesCount, POINTER_DEVICE_PROPERTY * pProperties, LONG * pValues)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetRawPointerDeviceData()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetRawPointerDeviceData()"_lit);
   return GetRawPointerDeviceData_(pointerId, historyCount, propertiesCount, pProperties, pValues);
 }
 
 WINBOOL APIUser32::ChangeWindowMessageFilter (UINT message, DWORD dwFlag)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ChangeWindowMessageFilter()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "ChangeWindowMessageFilter()"_lit);
   return ChangeWindowMessageFilter_(message, dwFlag);
 }
 
 WINBOOL APIUser32::ChangeWindowMessageFilterEx (HWND hwnd, UINT message, DWORD action, PCHANGEFILTERSTRUCT pChangeFilterStruct)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ChangeWindowMessageFilterEx()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "ChangeWindowMessageFilterEx()"_lit);
   return ChangeWindowMessageFilterEx_(hwnd, message, action, pChangeFilterStruct);
 }
 
 WINBOOL APIUser32::GetGestureInfo (HGESTUREINFO hGestureInfo, PGESTUREINFO pGestureInfo)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetGestureInfo()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetGestureInfo()"_lit);
   return GetGestureInfo_(hGestureInfo, pGestureInfo);
 }
 
 WINBOOL APIUser32::GetGestureExtraArgs (HGESTUREINFO hGestureInfo, UINT cbExtraArgs, PBYTE pExtraArgs)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetGestureExtraArgs()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetGestureExtraArgs()"_lit);
   return GetGestureExtraArgs_(hGestureInfo, cbExtraArgs, pExtraArgs);
 }
 
 WINBOOL APIUser32::CloseGestureInfoHandle (HGESTUREINFO hGestureInfo)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CloseGestureInfoHandle()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "CloseGestureInfoHandle()"_lit);
   return CloseGestureInfoHandle_(hGestureInfo);
 }
 
 WINBOOL APIUser32::SetGestureConfig (HWND hwnd, DWORD dwReserved, UINT cIDs, PGESTURECONFIG pGestureConfig, UINT cbSize)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetGestureConfig()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SetGestureConfig()"_lit);
   return SetGestureConfig_(hwnd, dwReserved, cIDs, pGestureConfig, cbSize);
 }
 
 WINBOOL APIUser32::GetGestureConfig (HWND hwnd, DWORD dwReserved, DWORD dwFlags, PUINT pcIDs, PGESTURECONFIG pGestureConfig, UINT cbSize)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetGestureConfig()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetGestureConfig()"_lit);
   return GetGestureConfig_(hwnd, dwReserved, dwFlags, pcIDs, pGestureConfig, cbSize);
 }
 
 WINBOOL APIUser32::ShutdownBlockReasonCreate (HWND hWnd, LPCWSTR pwszReason)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ShutdownBlockReasonCreate()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "ShutdownBlockReasonCreate()"_lit);
   return ShutdownBlockReasonCreate_(hWnd, pwszReason);
 }
 
 WINBOOL APIUser32::ShutdownBlockReasonQuery (HWND hWnd, LPWSTR pwszBuff, DWORD * pcchBuff)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ShutdownBlockReasonQuery()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "ShutdownBlockReasonQuery()"_lit);
   return ShutdownBlockReasonQuery_(hWnd, pwszBuff, pcchBuff);
 }
 
 WINBOOL APIUser32::ShutdownBlockReasonDestroy (HWND hWnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ShutdownBlockReasonDestroy()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "ShutdownBlockReasonDestroy()"_lit);
   return ShutdownBlockReasonDestroy_(hWnd);
 }
 
 WINBOOL APIUser32::GetCurrentInputMessageSource (INPUT_MESSAGE_SOURCE * inputMessageSource)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetCurrentInputMessageSource()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetCurrentInputMessageSource()"_lit);
   return GetCurrentInputMessageSource_(inputMessageSource);
 }
 
 WINBOOL APIUser32::GetCIMSSM (INPUT_MESSAGE_SOURCE * inputMessageSource)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetCIMSSM()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetCIMSSM()"_lit);
   return GetCIMSSM_(inputMessageSource);
 }
 
 WINBOOL APIUser32::GetAutoRotationState (PAR_STATE pState)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetAutoRotationState()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetAutoRotationState()"_lit);
   return GetAutoRotationState_(pState);
 }
 
 WINBOOL APIUser32::GetDisplayAutoRotationPreferences (ORIENTATION_PREFERENCE * pOrientation)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetDisplayAutoRotationPreferences()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetDisplayAutoRotationPreferences()"_lit);
   return GetDisplayAutoRotationPreferences_(pOrientation);
 }
 
 WINBOOL APIUser32::GetDisplayAutoRotationPreferencesByProcessId (DWORD dwProcessId, ORIENTATION_PREFERENCE * pOrientation, WINBOOL * fRotateScreen)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetDisplayAutoRotationPreferencesByProcessId()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetDisplayAutoRotationPreferencesByProcessId()"_lit);
   return GetDisplayAutoRotationPreferencesByProcessId_(dwProcessId, pOrientation, fRotateScreen);
 }
 
 WINBOOL APIUser32::SetDisplayAutoRotationPreferences (ORIENTATION_PREFERENCE orientation)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetDisplayAutoRotationPreferences()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SetDisplayAutoRotationPreferences()"_lit);
   return SetDisplayAutoRotationPreferences_(orientation);
 }
 
 WINBOOL APIUser32::IsImmersiveProcess (HANDLE hProcess)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "IsImmersiveProcess()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "IsImmersiveProcess()"_lit);
   return IsImmersiveProcess_(hProcess);
 }
 
 WINBOOL APIUser32::SetProcessRestrictionExemption (WINBOOL fEnableExemption)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetProcessRestrictionExemption()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SetProcessRestrictionExemption()"_lit);
   return SetProcessRestrictionExemption_(fEnableExemption);
 }
 
 WINBOOL APIUser32::GetPointerInputTransform (UINT32 pointerId, UINT32 historyCount, UINT32 * inputTransform)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetPointerInputTransform()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetPointerInputTransform()"_lit);
   return GetPointerInputTransform_(pointerId, historyCount, inputTransform);
 }
 
 WINBOOL APIUser32::IsMousePointerEnabled (void)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "IsMousePointerEnabled()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "IsMousePointerEnabled()"_lit);
   return IsMousePointerEnabled_();
 }
 
 UINT_PTR APIUser32::SetSystemTimer (HWND hwnd, UINT_PTR id, UINT timeout, void * unknown)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetSystemTimer()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SetSystemTimer()"_lit);
   return SetSystemTimer_(hwnd, id, timeout, unknown);
 }
 
 DWORD APIUser32::CalcMenuBar (HWND hwnd, DWORD left, DWORD right, DWORD top, RECT * rect)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CalcMenuBar()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "CalcMenuBar()"_lit);
   return CalcMenuBar_(hwnd, left, right, top, rect);
 }
 
 UINT APIUser32::WINNLSGetIMEHotkey (HWND hwnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "WINNLSGetIMEHotkey()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "WINNLSGetIMEHotkey()"_lit);
   return WINNLSGetIMEHotkey_(hwnd);
 }
 
 HWND APIUser32::GetTaskmanWindow (void)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetTaskmanWindow()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetTaskmanWindow()"_lit);
   return GetTaskmanWindow_();
 }
 
 BOOL APIUser32::DdeDisconnect (HCONV hConv)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DdeDisconnect()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "DdeDisconnect()"_lit);
   return DdeDisconnect_(hConv);
 }
 
 HSZ APIUser32::DdeCreateStringHandleA (DWORD idInst, LPCSTR psz, INT codepage)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DdeCreateStringHandleA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "DdeCreateStringHandleA()"_lit);
   return DdeCreateStringHandleA_(idInst, psz, codepage);
 }
 
 BOOL APIUser32::SetProcessDpiAwarenessInternal (DPI_AWARENESS awareness)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetProcessDpiAwarenessInternal()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SetProcessDpiAwarenessInternal()"_lit);
   return SetProcessDpiAwarenessInternal_(awareness);
 }
 
 BOOL APIUser32::SetDeskWallpaper (const char * filename)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetDeskWallpaper()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SetDeskWallpaper()"_lit);
   return SetDeskWallpaper_(filename);
 }
 
 NTSTATUS APIUser32::User32ImmTranslateMessage (void * args, ULONG size)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "User32ImmTranslateMessage()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "User32ImmTranslateMessage()"_lit);
   return User32ImmTranslateMessage_(args, size);
 }
 
 DWORD APIUser32::DdeGetData (HDDEDATA hData, LPBYTE pDst, DWORD cbMax, DWORD cbOff)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DdeGetData()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "DdeGetData()"_lit);
   return DdeGetData_(hData, pDst, cbMax, cbOff);
 }
 
 DWORD_PTR APIUser32::SetSysColorsTemp (const COLORREF * pPens, const HBRUSH * pBrushes, DWORD_PTR n)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetSysColorsTemp()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SetSysColorsTemp()"_lit);
   return SetSysColorsTemp_(pPens, pBrushes, n);
 }
 
 LRESULT APIUser32::StaticWndProcW (HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "StaticWndProcW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "StaticWndProcW()"_lit);
   return StaticWndProcW_(hwnd, msg, wParam, lParam);
 }
 
 LPBYTE APIUser32::DdeAccessData (HDDEDATA hData, LPDWORD pcbDataSize)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DdeAccessData()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "DdeAccessData()"_lit);
   return DdeAccessData_(hData, pcbDataSize);
 }
 
 BOOL APIUser32::DdeUnaccessData (HDDEDATA hData)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DdeUnaccessData()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "DdeUnaccessData()"_lit);
   return DdeUnaccessData_(hData);
 }
 
 UINT APIUser32::DdeInitializeA (LPDWORD pidInst, PFNCALLBACK pfnCallback, DWORD afCmd, DWORD ulRes)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DdeInitializeA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "DdeInitializeA()"_lit);
   return DdeInitializeA_(pidInst, pfnCallback, afCmd, ulRes);
 }
 
 UINT APIUser32::DdeInitializeW (LPDWORD pidInst, PFNCALLBACK pfnCallback, DWORD afCmd, DWORD ulRes)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DdeInitializeW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "DdeInitializeW()"_lit);
   return DdeInitializeW_(pidInst, pfnCallback, afCmd, ulRes);
 }
 
 BOOL APIUser32::DdeUninitialize (DWORD idInst)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DdeUninitialize()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "DdeUninitialize()"_lit);
   return DdeUninitialize_(idInst);
 }
 
 VOID APIUser32::LoadLocalFonts (VOID)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "LoadLocalFonts()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "LoadLocalFonts()"_lit);
   LoadLocalFonts_();
 }
 
 LPSTR APIUser32::CharPrevExW (WORD codepage, LPCWSTR start, LPCWSTR ptr, DWORD flags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CharPrevExW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "CharPrevExW()"_lit);
   return CharPrevExW_(codepage, start, ptr, flags);
 }
 
 HWND APIUser32::GetProgmanWindow (void)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetProgmanWindow()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetProgmanWindow()"_lit);
   return GetProgmanWindow_();
 }
 
 DPI_AWARENESS_CONTEXT APIUser32::SetThreadDpiAwarenessContext (DPI_AWARENESS_CONTEXT context)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetThreadDpiAwarenessContext()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SetThreadDpiAwarenessContext()"_lit);
   return SetThreadDpiAwarenessContext_(context);
 }
 
 LPARAM APIUser32::PackDDElParam (UINT msg, UINT_PTR uiLo, UINT_PTR uiHi)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "PackDDElParam()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "PackDDElParam()"_lit);
   return PackDDElParam_(msg, uiLo, uiHi);
 }
 
 BOOL APIUser32::DdeFreeDataHandle (HDDEDATA hData)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DdeFreeDataHandle()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "DdeFreeDataHandle()"_lit);
   return DdeFreeDataHandle_(hData);
 }
 
 BOOL APIUser32::AlignRects (LPRECT rect, DWORD b, DWORD c, DWORD d)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "AlignRects()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "AlignRects()"_lit);
   return AlignRects_(rect, b, c, d);
 }
 
 DWORD APIUser32::DdeQueryStringW (DWORD idInst, HSZ hsz, LPWSTR psz, DWORD cchMax, INT iCodePage)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DdeQueryStringW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "DdeQueryStringW()"_lit);
   return DdeQueryStringW_(idInst, hsz, psz, cchMax, iCodePage);
 }
 
 DWORD APIUser32::SetLogonNotifyWindow (HWINSTA hwinsta, HWND hwnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetLogonNotifyWindow()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SetLogonNotifyWindow()"_lit);
   return SetLogonNotifyWindow_(hwinsta, hwnd);
 }
 
 HCURSOR APIUser32::GetCursorFrameInfo (HCURSOR handle, DWORD reserved, DWORD istep, DWORD * rate, DWORD * steps)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetCursorFrameInfo()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetCursorFrameInfo()"_lit);
   return GetCursorFrameInfo_(handle, reserved, istep, rate, steps);
 }
 
 DWORD APIUser32::DdeQueryStringA (DWORD idInst, HSZ hsz, LPSTR psz, DWORD cchMax, INT iCodePage)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DdeQueryStringA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "DdeQueryStringA()"_lit);
   return DdeQueryStringA_(idInst, hsz, psz, cchMax, iCodePage);
 }
 
 BOOL APIUser32::DdeSetQualityOfService (HWND hwndClient, const SECURITY_QUALITY_OF_SERVICE * pqosNew, PSECURITY_QUALITY_OF_SERVICE pqosPrev)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DdeSetQualityOfService()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "DdeSetQualityOfService()"_lit);
   return DdeSetQualityOfService_(hwndClient, pqosNew, pqosPrev);
 }
 
 UINT APIUser32::DdeGetLastError (DWORD idInst)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DdeGetLastError()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "DdeGetLastError()"_lit);
   return DdeGetLastError_(idInst);
 }
 
 LRESULT APIUser32::ComboWndProcA (HWND hwnd, UINT message, WPARAM wParam, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ComboWndProcA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "ComboWndProcA()"_lit);
   return ComboWndProcA_(hwnd, message, wParam, lParam);
 }
 
 BOOL APIUser32::DdeDisconnectList (HCONVLIST hConvList)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DdeDisconnectList()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "DdeDisconnectList()"_lit);
   return DdeDisconnectList_(hConvList);
 }
 
 LRESULT APIUser32::SendIMEMessageExA (HWND hwnd, LPARAM lparam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SendIMEMessageExA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SendIMEMessageExA()"_lit);
   return SendIMEMessageExA_(hwnd, lparam);
 }
 
 INT APIUser32::DdeCmpStringHandles (HSZ hsz1, HSZ hsz2)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DdeCmpStringHandles()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "DdeCmpStringHandles()"_lit);
   return DdeCmpStringHandles_(hsz1, hsz2);
 }
 
 DWORD APIUser32::RegisterTasklist (DWORD x)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "RegisterTasklist()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "RegisterTasklist()"_lit);
   return RegisterTasklist_(x);
 }
 
 LRESULT APIUser32::IconTitleWndProc (HWND hWnd, UINT msg, WPARAM wParam, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "IconTitleWndProc()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "IconTitleWndProc()"_lit);
   return IconTitleWndProc_(hWnd, msg, wParam, lParam);
 }
 
 LRESULT APIUser32::SendIMEMessageExW (HWND hwnd, LPARAM lparam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SendIMEMessageExW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SendIMEMessageExW()"_lit);
   return SendIMEMessageExW_(hwnd, lparam);
 }
 
 LRESULT APIUser32::ComboWndProcW (HWND hwnd, UINT message, WPARAM wParam, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ComboWndProcW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "ComboWndProcW()"_lit);
   return ComboWndProcW_(hwnd, message, wParam, lParam);
 }
 
 HCONVLIST APIUser32::DdeConnectList (DWORD idInst, HSZ hszService, HSZ hszTopic, HCONVLIST hConvList, PCONVCONTEXT pCC)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DdeConnectList()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "DdeConnectList()"_lit);
   return DdeConnectList_(idInst, hszService, hszTopic, hConvList, pCC);
 }
 
 HCONV APIUser32::DdeQueryNextServer (HCONVLIST hConvList, HCONV hConvPrev)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DdeQueryNextServer()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "DdeQueryNextServer()"_lit);
   return DdeQueryNextServer_(hConvList, hConvPrev);
 }
 
 BOOL APIUser32::RegisterUserApiHook (const struct user_api_hook * new_hook, struct user_api_hook * old_hook)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "RegisterUserApiHook()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "RegisterUserApiHook()"_lit);
   return RegisterUserApiHook_(new_hook, old_hook);
 }
 
 void APIUser32::UnregisterUserApiHook (void)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "UnregisterUserApiHook()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "UnregisterUserApiHook()"_lit);
   UnregisterUserApiHook_();
 }
 
 LRESULT APIUser32::StaticWndProcA (HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "StaticWndProcA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "StaticWndProcA()"_lit);
   return StaticWndProcA_(hwnd, msg, wParam, lParam);
 }
 
 LRESULT APIUser32::MDIClientWndProcW (HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "MDIClientWndProcW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "MDIClientWndProcW()"_lit);
   return MDIClientWndProcW_(hwnd, msg, wParam, lParam);
 }
 
 BOOL APIUser32::DdeKeepStringHandle (DWORD idInst, HSZ hsz)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DdeKeepStringHandle()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "DdeKeepStringHandle()"_lit);
   return DdeKeepStringHandle_(idInst, hsz);
 }
 
 DWORD APIUser32::GetAppCompatFlags (HTASK hTask)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetAppCompatFlags()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetAppCompatFlags()"_lit);
   return GetAppCompatFlags_(hTask);
 }
 
 HWND APIUser32::SetProgmanWindow (HWND hwnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetProgmanWindow()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SetProgmanWindow()"_lit);
   return SetProgmanWindow_(hwnd);
 }
 
 BOOL APIUser32::DdeEnableCallback (DWORD idInst, HCONV hConv, UINT wCmd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DdeEnableCallback()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "DdeEnableCallback()"_lit);
   return DdeEnableCallback_(idInst, hConv, wCmd);
 }
 
 DPI_HOSTING_BEHAVIOR APIUser32::GetThreadDpiHostingBehavior (void)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetThreadDpiHostingBehavior()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetThreadDpiHostingBehavior()"_lit);
   return GetThreadDpiHostingBehavior_();
 }
 
 LRESULT APIUser32::MDIClientWndProcA (HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "MDIClientWndProcA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "MDIClientWndProcA()"_lit);
   return MDIClientWndProcA_(hwnd, msg, wParam, lParam);
 }
 
 LRESULT APIUser32::EditWndProcW (HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "EditWndProcW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "EditWndProcW()"_lit);
   return EditWndProcW_(hwnd, msg, wParam, lParam);
 }
 
 LRESULT APIUser32::ButtonWndProcW (HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ButtonWndProcW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "ButtonWndProcW()"_lit);
   return ButtonWndProcW_(hwnd, msg, wParam, lParam);
 }
 
 HWND APIUser32::SetTaskmanWindow (HWND hwnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetTaskmanWindow()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SetTaskmanWindow()"_lit);
   return SetTaskmanWindow_(hwnd);
 }
 
 BOOL APIUser32::DdeImpersonateClient (HCONV hConv)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DdeImpersonateClient()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "DdeImpersonateClient()"_lit);
   return DdeImpersonateClient_(hConv);
 }
 
 UINT APIUser32::DdeQueryConvInfo (HCONV hConv, DWORD id, PCONVINFO lpConvInfo)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DdeQueryConvInfo()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "DdeQueryConvInfo()"_lit);
   return DdeQueryConvInfo_(hConv, id, lpConvInfo);
 }
 
 void APIUser32::CalcChildScroll (HWND hwnd, INT scroll)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CalcChildScroll()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "CalcChildScroll()"_lit);
   CalcChildScroll_(hwnd, scroll);
 }
 
 HCONV APIUser32::DdeConnect (DWORD idInst, HSZ hszService, HSZ hszTopic, PCONVCONTEXT pCC)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DdeConnect()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "DdeConnect()"_lit);
   return DdeConnect_(idInst, hszService, hszTopic, pCC);
 }
 
 HCONV APIUser32::DdeReconnect (HCONV hConv)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DdeReconnect()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "DdeReconnect()"_lit);
   return DdeReconnect_(hConv);
 }
 
 LPWSTR APIUser32::CharNextExW (WORD codepage, LPCWSTR ptr, DWORD flags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CharNextExW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "CharNextExW()"_lit);
   return CharNextExW_(codepage, ptr, flags);
 }
 
 LRESULT APIUser32::EditWndProcA (HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "EditWndProcA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "EditWndProcA()"_lit);
   return EditWndProcA_(hwnd, msg, wParam, lParam);
 }
 
 BOOL APIUser32::GetProcessDpiAwarenessInternal (HANDLE process, DPI_AWARENESS * awareness)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetProcessDpiAwarenessInternal()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetProcessDpiAwarenessInternal()"_lit);
   return GetProcessDpiAwarenessInternal_(process, awareness);
 }
 
 void APIUser32::RegisterSystemThread (DWORD flags, DWORD reserved)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "RegisterSystemThread()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "RegisterSystemThread()"_lit);
   RegisterSystemThread_(flags, reserved);
 }
 
 BOOL APIUser32::SetWindowCompositionAttribute (HWND hwnd, WINDOWCOMPOSITIONATTRIBDATA const * pwcad)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetWindowCompositionAttribute()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SetWindowCompositionAttribute()"_lit);
   return SetWindowCompositionAttribute_(hwnd, pwcad);
 }
 
 HDDEDATA APIUser32::DdeClientTransaction (LPBYTE pData, DWORD cbData, HCONV hConv, HSZ hszItem, UINT wFmt, UINT wType, DWORD dwTimeout, LPDWORD pdwResult)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DdeClientTransaction()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "DdeClientTransaction()"_lit);
   return DdeClientTransaction_(pData, cbData, hConv, hszItem, wFmt, wType, dwTimeout, pdwResult);
 }
 
 BOOL APIUser32::DdeAbandonTransaction (DWORD idInst, HCONV hConv, DWORD idTransaction)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DdeAbandonTransaction()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "DdeAbandonTransaction()"_lit);
   return DdeAbandonTransaction_(idInst, hConv, idTransaction);
 }
 
 LRESULT APIUser32::ScrollBarWndProcA (HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ScrollBarWndProcA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "ScrollBarWndProcA()"_lit);
   return ScrollBarWndProcA_(hwnd, msg, wParam, lParam);
 }
 
 HKL APIUser32::LoadKeyboardLayoutEx (HKL layout, const WCHAR * name, UINT flags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "LoadKeyboardLayoutEx()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "LoadKeyboardLayoutEx()"_lit);
   return LoadKeyboardLayoutEx_(layout, name, flags);
 }
 
 int APIUser32::RegisterServicesProcess (DWORD ServicesProcessId)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "RegisterServicesProcess()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "RegisterServicesProcess()"_lit);
   return RegisterServicesProcess_(ServicesProcessId);
 }
 
 HDDEDATA APIUser32::DdeCreateDataHandle (DWORD idInst, LPBYTE pSrc, DWORD cb, DWORD cbOff, HSZ hszItem, UINT wFmt, UINT afCmd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DdeCreateDataHandle()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "DdeCreateDataHandle()"_lit);
   return DdeCreateDataHandle_(idInst, pSrc, cb, cbOff, hszItem, wFmt, afCmd);
 }
 
 HDDEDATA APIUser32::DdeAddData (HDDEDATA hData, LPBYTE pSrc, DWORD cb, DWORD cbOff)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DdeAddData()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "DdeAddData()"_lit);
   return DdeAddData_(hData, pSrc, cb, cbOff);
 }
 
 LRESULT APIUser32::ScrollBarWndProcW (HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ScrollBarWndProcW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "ScrollBarWndProcW()"_lit);
   return ScrollBarWndProcW_(hwnd, msg, wParam, lParam);
 }
 
 HDDEDATA APIUser32::DdeNameService (DWORD idInst, HSZ hsz1, HSZ hsz2, UINT afCmd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DdeNameService()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "DdeNameService()"_lit);
   return DdeNameService_(idInst, hsz1, hsz2, afCmd);
 }
 
 LRESULT APIUser32::ButtonWndProcA (HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ButtonWndProcA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "ButtonWndProcA()"_lit);
   return ButtonWndProcA_(hwnd, msg, wParam, lParam);
 }
 
 INT APIUser32::GetSystemMetricsForDpi (INT index, UINT dpi)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetSystemMetricsForDpi()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetSystemMetricsForDpi()"_lit);
   return GetSystemMetricsForDpi_(index, dpi);
 }
 
 DPI_HOSTING_BEHAVIOR APIUser32::GetWindowDpiHostingBehavior (HWND hwnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetWindowDpiHostingBehavior()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetWindowDpiHostingBehavior()"_lit);
   return GetWindowDpiHostingBehavior_(hwnd);
 }
 
 DWORD APIUser32::SetWindowStationUser (DWORD x1, DWORD x2)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetWindowStationUser()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SetWindowStationUser()"_lit);
   return SetWindowStationUser_(x1, x2);
 }
 
 BOOL APIUser32::SystemParametersInfoForDpi (UINT action, UINT val, PVOID ptr, UINT winini, UINT dpi)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SystemParametersInfoForDpi()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SystemParametersInfoForDpi()"_lit);
   return SystemParametersInfoForDpi_(action, val, ptr, winini, dpi);
 }
 
 LRESULT APIUser32::MessageWndProc (HWND hwnd, UINT message, WPARAM wParam, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "MessageWndProc()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "MessageWndProc()"_lit);
   return MessageWndProc_(hwnd, message, wParam, lParam);
 }
 
 BOOL APIUser32::IsWindowRedirectedForPrint (HWND hwnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "IsWindowRedirectedForPrint()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "IsWindowRedirectedForPrint()"_lit);
   return IsWindowRedirectedForPrint_(hwnd);
 }
 
 BOOL APIUser32::WINNLSGetEnableStatus (HWND hwnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "WINNLSGetEnableStatus()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "WINNLSGetEnableStatus()"_lit);
   return WINNLSGetEnableStatus_(hwnd);
 }
 
 BOOL APIUser32::KillSystemTimer (HWND hwnd, UINT_PTR id)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "KillSystemTimer()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "KillSystemTimer()"_lit);
   return KillSystemTimer_(hwnd, id);
 }
 
 HSZ APIUser32::DdeCreateStringHandleW (DWORD idInst, LPCWSTR psz, INT codepage)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DdeCreateStringHandleW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "DdeCreateStringHandleW()"_lit);
   return DdeCreateStringHandleW_(idInst, psz, codepage);
 }
 
 INT_PTR APIUser32::MDI_MoreWindowsDlgProc (HWND hDlg, UINT iMsg, WPARAM wParam, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "MDI_MoreWindowsDlgProc()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "MDI_MoreWindowsDlgProc()"_lit);
   return MDI_MoreWindowsDlgProc_(hDlg, iMsg, wParam, lParam);
 }
 
 BOOL APIUser32::WINNLSEnableIME (HWND hwnd, BOOL enable)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "WINNLSEnableIME()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "WINNLSEnableIME()"_lit);
   return WINNLSEnableIME_(hwnd, enable);
 }
 
 BOOL APIUser32::AdjustWindowRectExForDpi (LPRECT rect, DWORD style, BOOL menu, DWORD dwExStyle, UINT dpi)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "AdjustWindowRectExForDpi()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "AdjustWindowRectExForDpi()"_lit);
   return AdjustWindowRectExForDpi_(rect, style, menu, dwExStyle, dpi);
 }
 
 DPI_AWARENESS_CONTEXT APIUser32::GetThreadDpiAwarenessContext (void)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetThreadDpiAwarenessContext()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetThreadDpiAwarenessContext()"_lit);
   return GetThreadDpiAwarenessContext_();
 }
 
 BOOL APIUser32::DdeFreeStringHandle (DWORD idInst, HSZ hsz)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DdeFreeStringHandle()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "DdeFreeStringHandle()"_lit);
   return DdeFreeStringHandle_(idInst, hsz);
 }
 
 BOOL APIUser32::DrawCaptionTempA (HWND hwnd, HDC hdc, const RECT * rect, HFONT hFont, HICON hIcon, LPCSTR str, UINT uFlags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DrawCaptionTempA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "DrawCaptionTempA()"_lit);
   return DrawCaptionTempA_(hwnd, hdc, rect, hFont, hIcon, str, uFlags);
 }
 
 WORD APIUser32::TileChildWindows (HWND parent, UINT flags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "TileChildWindows()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "TileChildWindows()"_lit);
   return TileChildWindows_(parent, flags);
 }
 
 LPARAM APIUser32::ReuseDDElParam (LPARAM lParam, UINT msgIn, UINT msgOut, UINT_PTR uiLo, UINT_PTR uiHi)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ReuseDDElParam()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "ReuseDDElParam()"_lit);
   return ReuseDDElParam_(lParam, msgIn, msgOut, uiLo, uiHi);
 }
 
 BOOL APIUser32::ImpersonateDdeClientWindow (HWND hWndClient, HWND hWndServer)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ImpersonateDdeClientWindow()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "ImpersonateDdeClientWindow()"_lit);
   return ImpersonateDdeClientWindow_(hWndClient, hWndServer);
 }
 
 UINT APIUser32::GetDpiForSystem (void)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetDpiForSystem()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetDpiForSystem()"_lit);
   return GetDpiForSystem_();
 }
 
 BOOL APIUser32::User32InitializeImmEntryTable (DWORD magic)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "User32InitializeImmEntryTable()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "User32InitializeImmEntryTable()"_lit);
   return User32InitializeImmEntryTable_(magic);
 }
 
 BOOL APIUser32::EnableNonClientDpiScaling (HWND hwnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "EnableNonClientDpiScaling()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "EnableNonClientDpiScaling()"_lit);
   return EnableNonClientDpiScaling_(hwnd);
 }
 
 BOOL APIUser32::ImmSetActiveContext (HWND arg0, HIMC arg1, BOOL arg2)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ImmSetActiveContext()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "ImmSetActiveContext()"_lit);
   return ImmSetActiveContext_(arg0, arg1, arg2);
 }
 
 BOOL APIUser32::IsValidDpiAwarenessContext (DPI_AWARENESS_CONTEXT context)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "IsValidDpiAwarenessContext()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "IsValidDpiAwarenessContext()"_lit);
   return IsValidDpiAwarenessContext_(context);
 }
 
 void APIUser32::ScrollChildren (HWND hWnd, UINT uMsg, WPARAM wParam, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ScrollChildren()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "ScrollChildren()"_lit);
   ScrollChildren_(hWnd, uMsg, wParam, lParam);
 }
 
 WORD APIUser32::CascadeChildWindows (HWND parent, UINT flags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "CascadeChildWindows()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "CascadeChildWindows()"_lit);
   return CascadeChildWindows_(parent, flags);
 }
 
 DPI_AWARENESS_CONTEXT APIUser32::GetWindowDpiAwarenessContext (HWND hwnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetWindowDpiAwarenessContext()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetWindowDpiAwarenessContext()"_lit);
   return GetWindowDpiAwarenessContext_(hwnd);
 }
 
 HDEVNOTIFY APIUser32::I_ScRegisterDeviceNotification (DEVICE_NOTIFICATION_DETAILS * details, LPVOID filter, DWORD flags)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "I_ScRegisterDeviceNotification()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "I_ScRegisterDeviceNotification()"_lit);
   return I_ScRegisterDeviceNotification_(details, filter, flags);
 }
 
 BOOL APIUser32::I_ScUnregisterDeviceNotification (HDEVNOTIFY handle)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "I_ScUnregisterDeviceNotification()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "I_ScUnregisterDeviceNotification()"_lit);
   return I_ScUnregisterDeviceNotification_(handle);
 }
 
 BOOL APIUser32::DdeSetUserHandle (HCONV hConv, DWORD id, DWORD_PTR hUser)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DdeSetUserHandle()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "DdeSetUserHandle()"_lit);
   return DdeSetUserHandle_(hConv, id, hUser);
 }
 
 BOOL APIUser32::DdePostAdvise (DWORD idInst, HSZ hszTopic, HSZ hszItem)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "DdePostAdvise()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "DdePostAdvise()"_lit);
   return DdePostAdvise_(idInst, hszTopic, hszItem);
 }
 
 DWORD APIUser32::GetAppCompatFlags2 (HTASK hTask)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetAppCompatFlags2()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetAppCompatFlags2()"_lit);
   return GetAppCompatFlags2_(hTask);
 }
 
 BOOL APIUser32::AreDpiAwarenessContextsEqual (DPI_AWARENESS_CONTEXT ctx1, DPI_AWARENESS_CONTEXT ctx2)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "AreDpiAwarenessContextsEqual()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "AreDpiAwarenessContextsEqual()"_lit);
   return AreDpiAwarenessContextsEqual_(ctx1, ctx2);
 }
 
 DPI_AWARENESS APIUser32::GetAwarenessFromDpiAwarenessContext (DPI_AWARENESS_CONTEXT context)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetAwarenessFromDpiAwarenessContext()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetAwarenessFromDpiAwarenessContext()"_lit);
   return GetAwarenessFromDpiAwarenessContext_(context);
 }
 
 BOOL APIUser32::SetShellWindow (HWND hwnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetShellWindow()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SetShellWindow()"_lit);
   return SetShellWindow_(hwnd);
 }
 
 LRESULT APIUser32::ImeWndProcW (HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ImeWndProcW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "ImeWndProcW()"_lit);
   return ImeWndProcW_(hwnd, msg, wParam, lParam);
 }
 
 UINT APIUser32::GetDpiForWindow (HWND hwnd)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GetDpiForWindow()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "GetDpiForWindow()"_lit);
   return GetDpiForWindow_(hwnd);
 }
 
 BOOL APIUser32::UnpackDDElParam (UINT msg, LPARAM lParam, PUINT_PTR puiLo, PUINT_PTR puiHi)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "UnpackDDElParam()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "UnpackDDElParam()"_lit);
   return UnpackDDElParam_(msg, lParam, puiLo, puiHi);
 }
 
 BOOL APIUser32::FreeDDElParam (UINT msg, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "FreeDDElParam()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "FreeDDElParam()"_lit);
   return FreeDDElParam_(msg, lParam);
 }
 
 void APIUser32::UserRegisterWowHandlers (const struct wow_handlers16 * new_, struct wow_handlers32 * orig)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "UserRegisterWowHandlers()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "UserRegisterWowHandlers()"_lit);
   UserRegisterWowHandlers_(new_, orig);
 }
 
 LRESULT APIUser32::ImeWndProcA (HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ImeWndProcA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "ImeWndProcA()"_lit);
   return ImeWndProcA_(hwnd, msg, wParam, lParam);
 }
 
 LRESULT APIUser32::ListBoxWndProcW (HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ListBoxWndProcW()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "ListBoxWndProcW()"_lit);
   return ListBoxWndProcW_(hwnd, msg, wParam, lParam);
 }
 
 LRESULT APIUser32::ListBoxWndProcA (HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "ListBoxWndProcA()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "ListBoxWndProcA()"_lit);
   return ListBoxWndProcA_(hwnd, msg, wParam, lParam);
 }
 
 DPI_HOSTING_BEHAVIOR APIUser32::SetThreadDpiHostingBehavior (DPI_HOSTING_BEHAVIOR value)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "SetThreadDpiHostingBehavior()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "SetThreadDpiHostingBehavior()"_lit);
   return SetThreadDpiHostingBehavior_(value);
 }
 
 DWORD APIUser32::RegisterLogonProcess (HANDLE hprocess, BOOL x)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "RegisterLogonProcess()");
+  logging::log(logging::LogSource::api, logging::LogLevel::debug, "RegisterLogonProcess()"_lit);
   return RegisterLogonProcess_(hprocess, x);
 }
 
@@ -9752,14 +9763,14 @@ FARPROC APIUser32::GetProcAddress_(HMODULE hModule, LPCSTR lpProcName)
   auto r = GetProcAddress(hModule, lpProcName);
   char buf[100];
   std::snprintf(buf, sizeof(buf), "0x%X", r);
-  logging::log("init", logging::LogLevel::debug, lpProcName, " ", buf);
+  logging::log(logging::LogSource::init, logging::LogLevel::debug, lpProcName, " "_lit, buf);
   return r;
 }
 
 
 APIUser32::APIUser32(std::string const & dllPath)
 {
-  logging::log("init", logging::LogLevel::debug, "APIUser32::APIUser32()");
+  logging::log(logging::LogSource::init, logging::LogLevel::debug, "APIUser32::APIUser32()"_lit);
 
   std::string dllPath2;
   if (dllPath.empty())
@@ -9773,7 +9784,7 @@ APIUser32::APIUser32(std::string const & dllPath)
   else
     dllPath2 = dllPath;
   
-  logging::log("init", logging::LogLevel::debug, "APIUser32::APIUser32(): dllPath: ", dllPath, "; dllPath2: ", dllPath2);
+  logging::log(logging::LogSource::init, logging::LogLevel::debug, "APIUser32::APIUser32(): dllPath: "_lit, dllPath, "; dllPath2: "_lit, dllPath2);
 
   HMODULE hModule = LoadLibrary(dllPath2.c_str());
   if (!hModule)
@@ -9782,7 +9793,7 @@ APIUser32::APIUser32(std::string const & dllPath)
     ss << "Failed to load dll from: " << dllPath2;
     throw std::runtime_error(ss.str());
   }
-  logging::log("init", logging::LogLevel::debug, "APIUser32::APIUser32(): hModule: ", hModule);
+  logging::log(logging::LogSource::init, logging::LogLevel::debug, "APIUser32::APIUser32(): hModule: "_lit, hModule);
 
   wvsprintfA_ = reinterpret_cast<decltype(wvsprintfA_)>(GetProcAddress_(hModule,"wvsprintfA"));
   wvsprintfW_ = reinterpret_cast<decltype(wvsprintfW_)>(GetProcAddress_(hModule,"wvsprintfW"));
@@ -10582,5 +10593,5 @@ APIUser32::APIUser32(std::string const & dllPath)
   SetThreadDpiHostingBehavior_ = reinterpret_cast<decltype(SetThreadDpiHostingBehavior_)>(GetProcAddress_(hModule,"SetThreadDpiHostingBehavior"));
   RegisterLogonProcess_ = reinterpret_cast<decltype(RegisterLogonProcess_)>(GetProcAddress_(hModule,"RegisterLogonProcess"));
 
-  logging::log("init", logging::LogLevel::debug, "APIUser32::APIUser32() exit");
+  logging::log(logging::LogSource::init, logging::LogLevel::debug, "APIUser32::APIUser32() exit"_lit);
 } 
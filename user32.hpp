@@ -893,18 +893,24 @@ public:
   virtual ~IUser32() =default;
 
   typedef std::unique_ptr<IUser32> instance_ptr_t;
+  /* May return null if instance can not be created yet; then fallback instance is used. */
   typedef std::function<instance_ptr_t ()> instance_factory_t;
   typedef std::function<void()> postinit_callback_t;
+  typedef std::function<IUser32 * ()> fallback_getter_t;
 
   static bool has_instance();
-  static IUser32 * get_instance();
+  /* If fallback getter is set and wait is false, caller does not wait while other thread creates instance (it may
+     need loader lock held by caller): fallback instance is returned instead. */
+  static IUser32 * get_instance(bool wait=false);
   static void set_instance(instance_ptr_t && upInstance);
-  static void set_instance_factory(instance_factory_t const & instaceFactory, postinit_callback_t const & postinitCallback);
+  static void set_instance_factory(instance_factory_t const & instaceFactory, postinit_callback_t const & postinitCallback,
+    fallback_getter_t const & getFallback=nullptr);
 
 private:
   static instance_ptr_t upInstance_;
   static instance_factory_t instaceFactory_;
   static postinit_callback_t postinitCallback_;
+  static fallback_getter_t getFallback_;
 }; //IUser32
 
 
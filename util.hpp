@@ -3,6 +3,10 @@
 
 #include <string>
 #include <sstream>
+#include <cstring>
+#include <cstdio>
+#include <cstdint>
+#include <type_traits>
 
 /* String helpers */
 template <typename S, typename T>
@@ -26,4 +30,144 @@ std::string stream_to_str(const T&... t)
   return ss.str();
 }
 
+/* Non-owning string reference. */
+struct StrRef
+{
+  char const * data;
+  std::size_t size;
+
+  StrRef() : data(""), size(0) {}
+  StrRef(char const * data, std::size_t size) : data(data), size(size) {}
+  StrRef(char const * s) : data(s), size(std::strlen(s)) {}
+  StrRef(std::string const & s) : data(s.data()), size(s.size()) {}
+};
+
+inline std::ostream & operator<<(std::ostream & os, StrRef const & s)
+{
+  return os.write(s.data, s.size);
+}
+
+/* Formats into caller-provided storage and never allocates. Output that does not fit is truncated.
+   Produces the same text as std::ostream with default flags does for supported types. */
+class StrWriter
+{
+public:
+  StrWriter & write(char const * s, std::size_t n)
+  {
+    std::size_t const left = end_ - cur_;
+    if (n > left)
+      n = left;
+    std::memcpy(cur_, s, n);
+    cur_ += n;
+    return *this;
+  }
+
+  StrWriter & put(char c)
+  {
+    if (cur_ != end_)
+      *cur_++ = c;
+    return *this;
+  }
+
+  char const * data() const { return begin_; }
+  std::size_t size() const { return cur_ - begin_; }
+  StrRef str() const { return StrRef(begin_, size()); }
+  void clear() { cur_ = begin_; }
+
+  StrWriter(char * begin, std::size_t n) : begin_(begin), cur_(begin), end_(begin + n) {}
+
+private:
+  char * begin_, * cur_, * end_;
+};
+
+/* StrWriter with embedded storage. */
+template <std::size_t N>
+class StrBuffer : public StrWriter
+{
+public:
+  StrBuffer() : StrWriter(buf_, N) {}
+
+private:
+  char buf_[N];
+};
+
+inline StrWriter & operator<<(StrWriter & w, char const * s)
+{
+  return w.write(s, std::strlen(s));
+}
+
+inline StrWriter & operator<<(StrWriter & w, std::string const & s)
+{
+  return w.write(s.data(), s.size());
+}
+
+inline StrWriter & operator<<(StrWriter & w, StrRef const & s)
+{
+  return w.write(s.data, s.size);
+}
+
+inline StrWriter & operator<<(StrWriter & w, char c)
+{
+  return w.put(c);
+}
+
+/* Like ostream, signed and unsigned char are written as characters, not as numbers. */
+inline StrWriter & operator<<(StrWriter & w, signed char c)
+{
+  return w.put(static_cast<char>(c));
+}
+
+inline StrWriter & operator<<(StrWriter & w, unsigned char c)
+{
+  return w.put(static_cast<char>(c));
+}
+
+inline StrWriter & operator<<(StrWriter & w, bool b)
+{
+  return w.put(b ? '1' : '0');
+}
+
+inline StrWriter & write_uint(StrWriter & w, uint64_t v, unsigned int base=10)
+{
+  static char const digits[] = "0123456789abcdef";
+  char buf[24];
+  char * p = buf + sizeof(buf);
+  do
+  {
+    *--p = digits[v % base];
+    v /= base;
+  } while (v != 0);
+  return w.write(p, buf + sizeof(buf) - p);
+}
+
+template <class T>
+typename std::enable_if<std::is_integral<T>::value && std::is_unsigned<T>::value, StrWriter &>::type
+operator<<(StrWriter & w, T v)
+{
+  return write_uint(w, v);
+}
+
+template <class T>
+typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value, StrWriter &>::type
+operator<<(StrWriter & w, T v)
+{
+  if (v < 0)
+    return write_uint(w.put('-'), 0 - static_cast<uint64_t>(v));
+  return write_uint(w, static_cast<uint64_t>(v));
+}
+
+inline StrWriter & operator<<(StrWriter & w, double v)
+{
+  char buf[32];
+  int const n = std::snprintf(buf, sizeof(buf), "%g", v);
+  return w.write(buf, n > 0 ? n : 0);
+}
+
+inline StrWriter & operator<<(StrWriter & w, void const * p)
+{
+  if (p == nullptr)
+    return w.put('0');
+  return write_uint(w.write("0x", 2), reinterpret_cast<uintptr_t>(p), 16);
+}
+
 #endif
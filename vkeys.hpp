@@ -26,10 +26,246 @@
 #define VKEYS_HPP_
 
 #include <string>
+#include <cstddef>
+#ifdef _WIN32
 #include <dimm.h>
+#else
+#include "vkcodes.hpp"
+#endif
+
+
+/* Key names are names of VK_* constants without prefix, plus a few common aliases (CTRL, ALT, ESC, ENTER, ...).
+   Scan codes are set 1 make codes as reported in RAWKEYBOARD::MakeCode; extended codes are encoded
+   with prefix in high byte: 0xE0xx for E0 and 0xE11D for Pause (E1). Character keys use US layout. */
+
+namespace vkeys_detail
+{
+
+struct KeyName { char const * name; UINT key; };
+
+/* Sorted by name (strcmp() order) for binary search. */
+constexpr KeyName keyNames[] = {
+  { "0", 0x30 }, { "1", 0x31 }, { "2", 0x32 }, { "3", 0x33 },
+  { "4", 0x34 }, { "5", 0x35 }, { "6", 0x36 }, { "7", 0x37 },
+  { "8", 0x38 }, { "9", 0x39 }, { "A", 0x41 }, { "ACCEPT", VK_ACCEPT },
+  { "ADD", VK_ADD }, { "ALT", VK_MENU }, { "APPS", VK_APPS }, { "ATTN", VK_ATTN },
+  { "B", 0x42 }, { "BACK", VK_BACK }, { "BACKSPACE", VK_BACK }, { "BROWSER_BACK", VK_BROWSER_BACK },
+  { "BROWSER_FAVORITES", VK_BROWSER_FAVORITES }, { "BROWSER_FORWARD", VK_BROWSER_FORWARD }, { "BROWSER_HOME", VK_BROWSER_HOME }, { "BROWSER_REFRESH", VK_BROWSER_REFRESH },
+  { "BROWSER_SEARCH", VK_BROWSER_SEARCH }, { "BROWSER_STOP", VK_BROWSER_STOP }, { "C", 0x43 }, { "CANCEL", VK_CANCEL },
+  { "CAPITAL", VK_CAPITAL }, { "CAPSLOCK", VK_CAPITAL }, { "CLEAR", VK_CLEAR }, { "CONTROL", VK_CONTROL },
+  { "CONVERT", VK_CONVERT }, { "CRSEL", VK_CRSEL }, { "CTRL", VK_CONTROL }, { "D", 0x44 },
+  { "DECIMAL", VK_DECIMAL }, { "DEL", VK_DELETE }, { "DELETE", VK_DELETE }, { "DIVIDE", VK_DIVIDE },
+  { "DOWN", VK_DOWN }, { "E", 0x45 }, { "END", VK_END }, { "ENTER", VK_RETURN },
+  { "EREOF", VK_EREOF }, { "ESC", VK_ESCAPE }, { "ESCAPE", VK_ESCAPE }, { "EXECUTE", VK_EXECUTE },
+  { "EXSEL", VK_EXSEL }, { "F", 0x46 }, { "F1", VK_F1 }, { "F10", VK_F10 },
+  { "F11", VK_F11 }, { "F12", VK_F12 }, { "F13", VK_F13 }, { "F14", VK_F14 },
+  { "F15", VK_F15 }, { "F16", VK_F16 }, { "F17", VK_F17 }, { "F18", VK_F18 },
+  { "F19", VK_F19 }, { "F2", VK_F2 }, { "F20", VK_F20 }, { "F21", VK_F21 },
+  { "F22", VK_F22 }, { "F23", VK_F23 }, { "F24", VK_F24 }, { "F3", VK_F3 },
+  { "F4", VK_F4 }, { "F5", VK_F5 }, { "F6", VK_F6 }, { "F7", VK_F7 },
+  { "F8", VK_F8 }, { "F9", VK_F9 }, { "FINAL", VK_FINAL }, { "G", 0x47 },
+  { "H", 0x48 }, { "HANGEUL", VK_HANGEUL }, { "HANGUL", VK_HANGUL }, { "HANJA", VK_HANJA },
+  { "HELP", VK_HELP }, { "HOME", VK_HOME }, { "I", 0x49 }, { "ICO_00", VK_ICO_00 },
+  { "ICO_CLEAR", VK_ICO_CLEAR }, { "ICO_HELP", VK_ICO_HELP }, { "INS", VK_INSERT }, { "INSERT", VK_INSERT },
+  { "J", 0x4a }, { "JUNJA", VK_JUNJA }, { "K", 0x4b }, { "KANA", VK_KANA },
+  { "KANJI", VK_KANJI }, { "L", 0x4c }, { "LALT", VK_LMENU }, { "LAUNCH_APP1", VK_LAUNCH_APP1 },
+  { "LAUNCH_APP2", VK_LAUNCH_APP2 }, { "LAUNCH_MAIL", VK_LAUNCH_MAIL }, { "LAUNCH_MEDIA_SELECT", VK_LAUNCH_MEDIA_SELECT }, { "LBUTTON", VK_LBUTTON },
+  { "LCONTROL", VK_LCONTROL }, { "LCTRL", VK_LCONTROL }, { "LEFT", VK_LEFT }, { "LMENU", VK_LMENU },
+  { "LSHIFT", VK_LSHIFT }, { "LWIN", VK_LWIN }, { "M", 0x4d }, { "MBUTTON", VK_MBUTTON },
+  { "MEDIA_NEXT_TRACK", VK_MEDIA_NEXT_TRACK }, { "MEDIA_PLAY_PAUSE", VK_MEDIA_PLAY_PAUSE }, { "MEDIA_PREV_TRACK", VK_MEDIA_PREV_TRACK }, { "MEDIA_STOP", VK_MEDIA_STOP },
+  { "MENU", VK_MENU }, { "MENUKEY", VK_APPS }, { "MODECHANGE", VK_MODECHANGE }, { "MULTIPLY", VK_MULTIPLY },
+  { "N", 0x4e }, { "NEXT", VK_NEXT }, { "NONAME", VK_NONAME }, { "NONCONVERT", VK_NONCONVERT },
+  { "NUMLOCK", VK_NUMLOCK }, { "NUMPAD0", VK_NUMPAD0 }, { "NUMPAD1", VK_NUMPAD1 }, { "NUMPAD2", VK_NUMPAD2 },
+  { "NUMPAD3", VK_NUMPAD3 }, { "NUMPAD4", VK_NUMPAD4 }, { "NUMPAD5", VK_NUMPAD5 }, { "NUMPAD6", VK_NUMPAD6 },
+  { "NUMPAD7", VK_NUMPAD7 }, { "NUMPAD8", VK_NUMPAD8 }, { "NUMPAD9", VK_NUMPAD9 }, { "O", 0x4f },
+  { "OEM_1", VK_OEM_1 }, { "OEM_102", VK_OEM_102 }, { "OEM_2", VK_OEM_2 }, { "OEM_3", VK_OEM_3 },
+  { "OEM_4", VK_OEM_4 }, { "OEM_5", VK_OEM_5 }, { "OEM_6", VK_OEM_6 }, { "OEM_7", VK_OEM_7 },
+  { "OEM_8", VK_OEM_8 }, { "OEM_ATTN", VK_OEM_ATTN }, { "OEM_AUTO", VK_OEM_AUTO }, { "OEM_AX", VK_OEM_AX },
+  { "OEM_BACKTAB", VK_OEM_BACKTAB }, { "OEM_CLEAR", VK_OEM_CLEAR }, { "OEM_COMMA", VK_OEM_COMMA }, { "OEM_COPY", VK_OEM_COPY },
+  { "OEM_CUSEL", VK_OEM_CUSEL }, { "OEM_ENLW", VK_OEM_ENLW }, { "OEM_FINISH", VK_OEM_FINISH }, { "OEM_FJ_JISHO", VK_OEM_FJ_JISHO },
+  { "OEM_FJ_LOYA", VK_OEM_FJ_LOYA }, { "OEM_FJ_MASSHOU", VK_OEM_FJ_MASSHOU }, { "OEM_FJ_ROYA", VK_OEM_FJ_ROYA }, { "OEM_FJ_TOUROKU", VK_OEM_FJ_TOUROKU },
+  { "OEM_JUMP", VK_OEM_JUMP }, { "OEM_MINUS", VK_OEM_MINUS }, { "OEM_NEC_EQUAL", VK_OEM_NEC_EQUAL }, { "OEM_PA1", VK_OEM_PA1 },
+  { "OEM_PA2", VK_OEM_PA2 }, { "OEM_PA3", VK_OEM_PA3 }, { "OEM_PERIOD", VK_OEM_PERIOD }, { "OEM_PLUS", VK_OEM_PLUS },
+  { "OEM_RESET", VK_OEM_RESET }, { "OEM_WSCTRL", VK_OEM_WSCTRL }, { "P", 0x50 }, { "PA1", VK_PA1 },
+  { "PACKET", VK_PACKET }, { "PAGEDOWN", VK_NEXT }, { "PAGEUP", VK_PRIOR }, { "PAUSE", VK_PAUSE },
+  { "PLAY", VK_PLAY }, { "PRINT", VK_PRINT }, { "PRINTSCREEN", VK_SNAPSHOT }, { "PRIOR", VK_PRIOR },
+  { "PROCESSKEY", VK_PROCESSKEY }, { "Q", 0x51 }, { "R", 0x52 }, { "RALT", VK_RMENU },
+  { "RBUTTON", VK_RBUTTON }, { "RCONTROL", VK_RCONTROL }, { "RCTRL", VK_RCONTROL }, { "RETURN", VK_RETURN },
+  { "RIGHT", VK_RIGHT }, { "RMENU", VK_RMENU }, { "RSHIFT", VK_RSHIFT }, { "RWIN", VK_RWIN },
+  { "S", 0x53 }, { "SCROLL", VK_SCROLL }, { "SCROLLLOCK", VK_SCROLL }, { "SELECT", VK_SELECT },
+  { "SEPARATOR", VK_SEPARATOR }, { "SHIFT", VK_SHIFT }, { "SLEEP", VK_SLEEP }, { "SNAPSHOT", VK_SNAPSHOT },
+  { "SPACE", VK_SPACE }, { "SUBTRACT", VK_SUBTRACT }, { "T", 0x54 }, { "TAB", VK_TAB },
+  { "U", 0x55 }, { "UP", VK_UP }, { "V", 0x56 }, { "VOLUME_DOWN", VK_VOLUME_DOWN },
+  { "VOLUME_MUTE", VK_VOLUME_MUTE }, { "VOLUME_UP", VK_VOLUME_UP }, { "W", 0x57 }, { "X", 0x58 },
+  { "XBUTTON1", VK_XBUTTON1 }, { "XBUTTON2", VK_XBUTTON2 }, { "Y", 0x59 }, { "Z", 0x5a },
+  { "ZOOM", VK_ZOOM },
+};
+
+/* Indexed by virtual key code. */
+constexpr char const * keyNamesByKey[256] = {
+  "", "LBUTTON", "RBUTTON", "CANCEL", "MBUTTON", "XBUTTON1", "XBUTTON2", "",
+  "BACK", "TAB", "", "", "CLEAR", "RETURN", "", "",
+  "SHIFT", "CONTROL", "MENU", "PAUSE", "CAPITAL", "KANA", "", "JUNJA",
+  "FINAL", "HANJA", "", "ESCAPE", "CONVERT", "NONCONVERT", "ACCEPT", "MODECHANGE",
+  "SPACE", "PRIOR", "NEXT", "END", "HOME", "LEFT", "UP", "RIGHT",
+  "DOWN", "SELECT", "PRINT", "EXECUTE", "SNAPSHOT", "INSERT", "DELETE", "HELP",
+  "0", "1", "2", "3", "4", "5", "6", "7",
+  "8", "9", "", "", "", "", "", "",
+  "", "A", "B", "C", "D", "E", "F", "G",
+  "H", "I", "J", "K", "L", "M", "N", "O",
+  "P", "Q", "R", "S", "T", "U", "V", "W",
+  "X", "Y", "Z", "LWIN", "RWIN", "APPS", "", "SLEEP",
+  "NUMPAD0", "NUMPAD1", "NUMPAD2", "NUMPAD3", "NUMPAD4", "NUMPAD5", "NUMPAD6", "NUMPAD7",
+  "NUMPAD8", "NUMPAD9", "MULTIPLY", "ADD", "SEPARATOR", "SUBTRACT", "DECIMAL", "DIVIDE",
+  "F1", "F2", "F3", "F4", "F5", "F6", "F7", "F8",
+  "F9", "F10", "F11", "F12", "F13", "F14", "F15", "F16",
+  "F17", "F18", "F19", "F20", "F21", "F22", "F23", "F24",
+  "", "", "", "", "", "", "", "",
+  "NUMLOCK", "SCROLL", "OEM_NEC_EQUAL", "OEM_FJ_MASSHOU", "OEM_FJ_TOUROKU", "OEM_FJ_LOYA", "OEM_FJ_ROYA", "",
+  "", "", "", "", "", "", "", "",
+  "LSHIFT", "RSHIFT", "LCONTROL", "RCONTROL", "LMENU", "RMENU", "BROWSER_BACK", "BROWSER_FORWARD",
+  "BROWSER_REFRESH", "BROWSER_STOP", "BROWSER_SEARCH", "BROWSER_FAVORITES", "BROWSER_HOME", "VOLUME_MUTE", "VOLUME_DOWN", "VOLUME_UP",
+  "MEDIA_NEXT_TRACK", "MEDIA_PREV_TRACK", "MEDIA_STOP", "MEDIA_PLAY_PAUSE", "LAUNCH_MAIL", "LAUNCH_MEDIA_SELECT", "LAUNCH_APP1", "LAUNCH_APP2",
+  "", "", "OEM_1", "OEM_PLUS", "OEM_COMMA", "OEM_MINUS", "OEM_PERIOD", "OEM_2",
+  "OEM_3", "", "", "", "", "", "", "",
+  "", "", "", "", "", "", "", "",
+  "", "", "", "", "", "", "", "",
+  "", "", "", "OEM_4", "OEM_5", "OEM_6", "OEM_7", "OEM_8",
+  "", "OEM_AX", "OEM_102", "ICO_HELP", "ICO_00", "PROCESSKEY", "ICO_CLEAR", "PACKET",
+  "", "OEM_RESET", "OEM_JUMP", "OEM_PA1", "OEM_PA2", "OEM_PA3", "OEM_WSCTRL", "OEM_CUSEL",
+  "OEM_ATTN", "OEM_FINISH", "OEM_COPY", "OEM_AUTO", "OEM_ENLW", "OEM_BACKTAB", "ATTN", "CRSEL",
+  "EXSEL", "EREOF", "PLAY", "ZOOM", "NONAME", "PA1", "OEM_CLEAR", "",
+};
+
+/* Indexed by make code, with 0x80 added for E0-prefixed codes. */
+constexpr UINT keysByScan[256] = {
+  0, VK_ESCAPE, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36,
+  0x37, 0x38, 0x39, 0x30, VK_OEM_MINUS, VK_OEM_PLUS, VK_BACK, VK_TAB,
+  0x51, 0x57, 0x45, 0x52, 0x54, 0x59, 0x55, 0x49,
+  0x4f, 0x50, VK_OEM_4, VK_OEM_6, VK_RETURN, VK_LCONTROL, 0x41, 0x53,
+  0x44, 0x46, 0x47, 0x48, 0x4a, 0x4b, 0x4c, VK_OEM_1,
+  VK_OEM_7, VK_OEM_3, VK_LSHIFT, VK_OEM_5, 0x5a, 0x58, 0x43, 0x56,
+  0x42, 0x4e, 0x4d, VK_OEM_COMMA, VK_OEM_PERIOD, VK_OEM_2, VK_RSHIFT, VK_MULTIPLY,
+  VK_LMENU, VK_SPACE, VK_CAPITAL, VK_F1, VK_F2, VK_F3, VK_F4, VK_F5,
+  VK_F6, VK_F7, VK_F8, VK_F9, VK_F10, VK_NUMLOCK, VK_SCROLL, VK_NUMPAD7,
+  VK_NUMPAD8, VK_NUMPAD9, VK_SUBTRACT, VK_NUMPAD4, VK_NUMPAD5, VK_NUMPAD6, VK_ADD, VK_NUMPAD1,
+  VK_NUMPAD2, VK_NUMPAD3, VK_NUMPAD0, VK_DECIMAL, VK_SNAPSHOT, 0, VK_OEM_102, VK_F11,
+  VK_F12, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, VK_F13, VK_F14, VK_F15, VK_F16,
+  VK_F17, VK_F18, VK_F19, VK_F20, VK_F21, VK_F22, VK_F23, 0,
+  0, 0, 0, 0, 0, 0, VK_F24, 0,
+  0, VK_CONVERT, 0, VK_NONCONVERT, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  VK_MEDIA_PREV_TRACK, 0, 0, 0, 0, 0, 0, 0,
+  0, VK_MEDIA_NEXT_TRACK, 0, 0, VK_RETURN, VK_RCONTROL, 0, 0,
+  VK_VOLUME_MUTE, VK_LAUNCH_APP2, VK_MEDIA_PLAY_PAUSE, 0, VK_MEDIA_STOP, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, VK_VOLUME_DOWN, 0,
+  VK_VOLUME_UP, 0, VK_BROWSER_HOME, 0, 0, VK_DIVIDE, 0, VK_SNAPSHOT,
+  VK_RMENU, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, VK_NUMLOCK, VK_CANCEL, VK_HOME,
+  VK_UP, VK_PRIOR, 0, VK_LEFT, 0, VK_RIGHT, 0, VK_END,
+  VK_DOWN, VK_NEXT, VK_INSERT, VK_DELETE, 0, 0, 0, 0,
+  0, 0, 0, VK_LWIN, VK_RWIN, VK_APPS, 0, VK_SLEEP,
+  0, 0, 0, 0, 0, VK_BROWSER_SEARCH, VK_BROWSER_FAVORITES, VK_BROWSER_REFRESH,
+  VK_BROWSER_STOP, VK_BROWSER_FORWARD, VK_BROWSER_BACK, VK_LAUNCH_APP1, VK_LAUNCH_MAIL, VK_LAUNCH_MEDIA_SELECT, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+/* Indexed by virtual key code. */
+constexpr UINT scansByKey[256] = {
+  0, 0, 0, 0xe046, 0, 0, 0, 0,
+  0x000e, 0x000f, 0, 0, 0, 0x001c, 0, 0,
+  0, 0, 0, 0xe11d, 0x003a, 0, 0, 0,
+  0, 0, 0, 0x0001, 0x0079, 0x007b, 0, 0,
+  0x0039, 0xe049, 0xe051, 0xe04f, 0xe047, 0xe04b, 0xe048, 0xe04d,
+  0xe050, 0, 0, 0, 0x0054, 0xe052, 0xe053, 0,
+  0x000b, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008,
+  0x0009, 0x000a, 0, 0, 0, 0, 0, 0,
+  0, 0x001e, 0x0030, 0x002e, 0x0020, 0x0012, 0x0021, 0x0022,
+  0x0023, 0x0017, 0x0024, 0x0025, 0x0026, 0x0032, 0x0031, 0x0018,
+  0x0019, 0x0010, 0x0013, 0x001f, 0x0014, 0x0016, 0x002f, 0x0011,
+  0x002d, 0x0015, 0x002c, 0xe05b, 0xe05c, 0xe05d, 0, 0xe05f,
+  0x0052, 0x004f, 0x0050, 0x0051, 0x004b, 0x004c, 0x004d, 0x0047,
+  0x0048, 0x0049, 0x0037, 0x004e, 0, 0x004a, 0x0053, 0xe035,
+  0x003b, 0x003c, 0x003d, 0x003e, 0x003f, 0x0040, 0x0041, 0x0042,
+  0x0043, 0x0044, 0x0057, 0x0058, 0x0064, 0x0065, 0x0066, 0x0067,
+  0x0068, 0x0069, 0x006a, 0x006b, 0x006c, 0x006d, 0x006e, 0x0076,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0x0045, 0x0046, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0x002a, 0x0036, 0x001d, 0xe01d, 0x0038, 0xe038, 0xe06a, 0xe069,
+  0xe067, 0xe068, 0xe065, 0xe066, 0xe032, 0xe020, 0xe02e, 0xe030,
+  0xe019, 0xe010, 0xe024, 0xe022, 0xe06c, 0xe06d, 0xe06b, 0xe021,
+  0, 0, 0x0027, 0x000d, 0x0033, 0x000c, 0x0034, 0x0035,
+  0x0029, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0x001a, 0x002b, 0x001b, 0x0028, 0,
+  0, 0, 0x0056, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+
+constexpr std::size_t keyNamesSize = sizeof(keyNames) / sizeof(keyNames[0]);
+
+
+constexpr int compare(char const * a, char const * b)
+{
+  return *a != *b ? (static_cast<unsigned char>(*a) < static_cast<unsigned char>(*b) ? -1 : 1) : *a == '\0' ? 0 : compare(a + 1, b + 1);
+}
+
+
+constexpr UINT find_key(char const * name, std::size_t lo, std::size_t hi);
+
+constexpr UINT find_key_(char const * name, std::size_t lo, std::size_t hi, std::size_t mid, int cmp)
+{
+  return cmp == 0 ? keyNames[mid].key : cmp < 0 ? find_key(name, lo, mid) : find_key(name, mid + 1, hi);
+}
+
+constexpr UINT find_key(char const * name, std::size_t lo, std::size_t hi)
+{
+  return lo >= hi ? 0 : find_key_(name, lo, hi, lo + (hi - lo) / 2, compare(name, keyNames[lo + (hi - lo) / 2].name));
+}
+
+} //vkeys_detail
+
+
+/* Returns 0 if name is unknown. */
+constexpr UINT name2key(char const * name)
+{
+  return vkeys_detail::find_key(name, 0, vkeys_detail::keyNamesSize);
+}
 
-UINT name2key(char const * name);
 UINT name2key(std::string const & name);
-char const * key2name(UINT key);
+
+/* Returns "" if key has no name. */
+constexpr char const * key2name(UINT key)
+{
+  return key < 256 ? vkeys_detail::keyNamesByKey[key] : "";
+}
+
+/* Combines RAWKEYBOARD::MakeCode and RAWKEYBOARD::Flags into prefixed scan code. */
+constexpr UINT make_scan(UINT makeCode, UINT flags)
+{
+  return (flags & RI_KEY_E1) ? (0xE100 | (makeCode & 0xFF)) : (flags & RI_KEY_E0) ? (0xE000 | (makeCode & 0xFF)) : (makeCode & 0xFF);
+}
+
+/* Returns 0 if scan code is unknown. */
+constexpr UINT scan2key(UINT scan)
+{
+  return scan == 0xE11D ? VK_PAUSE
+    : (scan & 0xFF00) == 0xE000 ? vkeys_detail::keysByScan[0x80 | (scan & 0x7F)]
+    : scan < 0x80 ? vkeys_detail::keysByScan[scan] : 0;
+}
+
+/* Returns 0 if key has no scan code. */
+constexpr UINT key2scan(UINT key)
+{
+  return key < 256 ? vkeys_detail::scansByKey[key] : 0;
+}
 
 #endif
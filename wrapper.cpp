@@ -24,10 +24,15 @@
 
 #include <string>
 #include <sstream>
+#include <iomanip>
 #include <fstream>
 #include <chrono>
 #include <stdexcept>
 #include <cassert>
+#include <atomic>
+#include <algorithm>
+#include <array>
+#include <limits>
 
 #include "logging.hpp"
 #include "config.hpp"
@@ -40,18 +45,14 @@
 /* Headers that depend on Windows-related stuff must be included after above #defines and #undef */
 #include "user32.hpp"
 #include "vkeys.hpp"
+#include "keymap.hpp"
+#include "rawinput.hpp"
+#include "timerwheel.hpp"
 #include "mingw.thread.h"
 #include "mingw.mutex.h"
+#include "mingw.condition_variable.h"
 
 /* raw input filter */
-class RawInputTest
-{
-public:
-  virtual bool test(PRAWINPUT) =0;
-  virtual ~RawInputTest() {}
-};
-
-
 class RawInputFilter : public APIUser32
 {
 public:
@@ -59,16 +60,43 @@ public:
   virtual UINT GetRawInputBuffer (PRAWINPUT pData, PUINT pcbSize, UINT cbSizeHeader);
 
   void set_test(std::shared_ptr<RawInputTest> const & spRawInputTest);
+  /* Null transform is not called. Shall be set before test it goes with. */
+  void set_transform(std::shared_ptr<RawInputTransform> const & spRawInputTransform);
+  /* Releases replaced tests and transforms if no input thread is inside filter. Also done by set_*(). */
+  void collect();
 
   RawInputFilter(std::string const & dllPath, std::shared_ptr<RawInputTest> const & spRawInputTest=nullptr);
 
 private:
   UINT fill_filtered_(UINT cbSizeHeader);
 
+  /* Counts input thread as reader of test and transform while in scope. */
+  class ReaderGuard
+  {
+  public:
+    explicit ReaderGuard(std::atomic<unsigned int> & readers) : readers_(readers) { readers_.fetch_add(1, std::memory_order_seq_cst); }
+    ~ReaderGuard() { readers_.fetch_sub(1, std::memory_order_release); }
+
+  private:
+    std::atomic<unsigned int> & readers_;
+  };
+
+  void collect_();
+
+  /* Test and transform are read by input threads without locking. Replaced ones are retired and released
+     only after count of readers was seen to be zero: reader increments it before loading pointers,
+     so it is either counted or loads new pointers. */
+  std::atomic<RawInputTest *> pRawInputTest_;
   std::shared_ptr<RawInputTest> spRawInputTest_;
+  std::atomic<RawInputTransform *> pRawInputTransform_;
+  std::shared_ptr<RawInputTransform> spRawInputTransform_;
+  std::vector<std::shared_ptr<void> > retired_;
+  std::atomic<unsigned int> readers_;
+  std::mutex testsMutex_;
   typedef std::vector<uint8_t> buffer_t;
   buffer_t buffer_, filtered_;
   buffer_t::value_type * pCurrentFiltered_, * pEndFiltered_;
+  std::vector<PRAWINPUT> accepted_;
 };
 
 
@@ -81,9 +109,19 @@ UINT RawInputFilter::GetRawInputData(HRAWINPUT hRawInput, UINT uiCommand, LPVOID
     //  lpHeader = reinterpret_cast<LPRAWINPUTHEADER>(pData);
     if (uiCommand == RID_INPUT)
     {
+      ReaderGuard const g (readers_);
       auto pRawInput = reinterpret_cast<LPRAWINPUT>(pData);
-      if (spRawInputTest_ && !spRawInputTest_->test(pRawInput))
-        return 0;
+      auto const pRawInputTest = pRawInputTest_.load(std::memory_order_acquire);
+      auto const pRawInputTransform = pRawInputTransform_.load(std::memory_order_acquire);
+      auto const now = pRawInputTest || pRawInputTransform ? RawInputTest::clock_t::now() : RawInputTest::clock_t::time_point();
+      if (pRawInputTest)
+      {
+        pRawInputTest->begin_batch(now);
+        if (!pRawInputTest->test(pRawInput))
+          return 0;
+      }
+      if (pRawInputTransform)
+        pRawInputTransform->transform(&pRawInput, 1, now);
     }
   }
   return r;
@@ -94,6 +132,10 @@ UINT RawInputFilter::GetRawInputBuffer (PRAWINPUT pData, PUINT pcbSize, UINT cbS
 {
   static const UINT er = static_cast<UINT const>(-1);
 
+  /* Filter is not armed yet (see init_worker()): pass through. */
+  if (pCurrentFiltered_ == pEndFiltered_ && pRawInputTest_.load(std::memory_order_acquire) == nullptr)
+    return APIUser32::GetRawInputBuffer(pData, pcbSize, cbSizeHeader);
+
   if (pCurrentFiltered_ == pEndFiltered_ && fill_filtered_(cbSizeHeader) == er)
   {
     *pcbSize = 0;
@@ -133,21 +175,57 @@ UINT RawInputFilter::GetRawInputBuffer (PRAWINPUT pData, PUINT pcbSize, UINT cbS
     nMessages += 1;
   }
 
-  logging::log("wrapper", logging::LogLevel::debug, "nMessages: ", nMessages);
+  logging::log(logging::LogSource::wrapper, logging::LogLevel::debug, "nMessages: "_lit, nMessages);
   return nMessages;
 }
 
 
 void RawInputFilter::set_test(std::shared_ptr<RawInputTest> const & spRawInputTest)
 {
+  std::unique_lock<std::mutex> l (testsMutex_);
+  if (spRawInputTest == spRawInputTest_)
+    return;
+  pRawInputTest_.store(spRawInputTest.get(), std::memory_order_seq_cst);
+  if (spRawInputTest_)
+    retired_.push_back(spRawInputTest_);
   spRawInputTest_ = spRawInputTest;
+  collect_();
+}
+
+
+void RawInputFilter::set_transform(std::shared_ptr<RawInputTransform> const & spRawInputTransform)
+{
+  std::unique_lock<std::mutex> l (testsMutex_);
+  if (spRawInputTransform == spRawInputTransform_)
+    return;
+  pRawInputTransform_.store(spRawInputTransform.get(), std::memory_order_seq_cst);
+  if (spRawInputTransform_)
+    retired_.push_back(spRawInputTransform_);
+  spRawInputTransform_ = spRawInputTransform;
+  collect_();
+}
+
+
+void RawInputFilter::collect()
+{
+  std::unique_lock<std::mutex> l (testsMutex_);
+  collect_();
+}
+
+
+void RawInputFilter::collect_()
+{
+  if (!retired_.empty() && readers_.load(std::memory_order_seq_cst) == 0)
+    retired_.clear();
 }
 
 
 RawInputFilter::RawInputFilter(std::string const & dllPath, std::shared_ptr<RawInputTest> const & spRawInputTest)
-  : APIUser32(dllPath), spRawInputTest_(spRawInputTest),
-    buffer_(), filtered_(), pCurrentFiltered_(nullptr), pEndFiltered_(nullptr)
-{}
+  : APIUser32(dllPath), pRawInputTest_(nullptr), spRawInputTest_(), pRawInputTransform_(nullptr), spRawInputTransform_(),
+    retired_(), readers_(0), testsMutex_(), buffer_(), filtered_(), pCurrentFiltered_(nullptr), pEndFiltered_(nullptr), accepted_()
+{
+  set_test(spRawInputTest);
+}
 
 
 UINT RawInputFilter::fill_filtered_(UINT cbSizeHeader)
@@ -158,7 +236,7 @@ UINT RawInputFilter::fill_filtered_(UINT cbSizeHeader)
   //TODO Check if GetRawInputBuffer() returns (UINT)-1 when checking for buffer size.
   if (r == er && GetLastError() != ERROR_INSUFFICIENT_BUFFER)
     return er;
-  logging::log("wrapper", logging::LogLevel::debug, "requested buffer size: ", cbSize);
+  logging::log(logging::LogSource::wrapper, logging::LogLevel::debug, "requested buffer size: "_lit, cbSize);
   /* When running under Wine 8.0, GetRawInputBuffer() writes incorrect requested buffer size in cbSize
      if first argument is NULL. When actually trying to read data in user-supplied buffer (ptr to which
      is supplied in first argument, GetRawInputBuffer() returns (UINT)-1 and sets last error to
@@ -177,292 +255,771 @@ UINT RawInputFilter::fill_filtered_(UINT cbSizeHeader)
   }
   uint8_t * ptr = buffer_.data();
   uint8_t const * end = ptr + cbSize;
-  logging::log("wrapper", logging::LogLevel::debug, "buffer size: ", buffer_.size(), "; r: ", r, "; cbSize: ", cbSize);
+  logging::log(logging::LogSource::wrapper, logging::LogLevel::debug, "buffer size: "_lit, buffer_.size(), "; r: "_lit, r, "; cbSize: "_lit, cbSize);
   filtered_.clear();
+  /* Accepted messages are not moved by later inserts, so transform can get pointers to them. */
+  filtered_.reserve(cbSize);
+  accepted_.clear();
+  ReaderGuard const g (readers_);
+  auto const pRawInputTransform = pRawInputTransform_.load(std::memory_order_acquire);
+  auto const pRawInputTest = pRawInputTest_.load(std::memory_order_acquire);
+  auto const now = pRawInputTest || pRawInputTransform ? RawInputTest::clock_t::now() : RawInputTest::clock_t::time_point();
+  if (pRawInputTest)
+    pRawInputTest->begin_batch(now);
   for (UINT i = 0; i < r; ++i)
   {
     PRAWINPUT current = reinterpret_cast<PRAWINPUT>(ptr);
     if (ptr > end)
     {
-      logging::log("wrapper", logging::LogLevel::error, "message ", i, " pointer out of bounds");
+      logging::log(logging::LogSource::wrapper, logging::LogLevel::error, "message "_lit, i, " pointer out of bounds"_lit);
       return er;
     }
     UINT const size = current->header.dwSize;
     if (size < cbSizeHeader)
     {
-      logging::log("wrapper", logging::LogLevel::error, "message ", i, " size does not match");
+      logging::log(logging::LogSource::wrapper, logging::LogLevel::error, "message "_lit, i, " size does not match"_lit);
       return er;
     }
 
-    if (spRawInputTest_ && spRawInputTest_->test(current))
+    if (!pRawInputTest || pRawInputTest->test(current))
     {
-      logging::log("wrapper", logging::LogLevel::debug, "accepting message ", i);
+      logging::log(logging::LogSource::wrapper, logging::LogLevel::debug, "accepting message "_lit, i);
+      if (pRawInputTransform)
+        accepted_.push_back(reinterpret_cast<PRAWINPUT>(filtered_.data() + filtered_.size()));
       filtered_.insert(filtered_.end(), ptr, ptr + size);
     }
     else
-      logging::log("wrapper", logging::LogLevel::debug, "skipping message ", i);
+      logging::log(logging::LogSource::wrapper, logging::LogLevel::debug, "skipping message "_lit, i);
 
     ptr += size;
   }
-  logging::log("wrapper", logging::LogLevel::debug, "filtered size: ", filtered_.size());
+  if (pRawInputTransform && !accepted_.empty())
+    pRawInputTransform->transform(accepted_.data(), accepted_.size(), now);
+  logging::log(logging::LogSource::wrapper, logging::LogLevel::debug, "filtered size: "_lit, filtered_.size());
   pCurrentFiltered_ = filtered_.data();
   pEndFiltered_ = pCurrentFiltered_ + filtered_.size();
+  return r;
 }
 
 
 RawInputFilter * g_pRawInputFilter = nullptr;
 
 
-class CompositeRawInputTest : public RawInputTest
+/* Durations in microseconds for percentile reporting. Keeps at most maxSamples per period and does not
+   allocate after construction. */
+class LatencySamples
 {
 public:
-  typedef std::function<bool(bool,bool)> combine_t;
+  typedef std::chrono::steady_clock clock_t;
 
-  virtual bool test(PRAWINPUT pRawInput);
+  void add(clock_t::duration d)
+  {
+    if (samples_.size() < maxSamples)
+      samples_.push_back(std::chrono::duration_cast<std::chrono::microseconds>(d).count());
+  }
+  bool empty() const { return samples_.empty(); }
+  std::size_t size() const { return samples_.size(); }
+  void clear() { samples_.clear(); }
 
-  void add(std::shared_ptr<RawInputTest> const & spChild);
+  /* p is in [0, 100]; reorders samples. */
+  uint32_t percentile(std::size_t p)
+  {
+    auto const it = samples_.begin() + (samples_.size() - 1) * p / 100;
+    std::nth_element(samples_.begin(), it, samples_.end());
+    return *it;
+  }
 
-  CompositeRawInputTest(combine_t const & combine, bool initial=true);
+  LatencySamples() : samples_() { samples_.reserve(maxSamples); }
 
 private:
-  combine_t combine_;
-  bool initial_;
-  std::vector<std::shared_ptr<RawInputTest> > children_;
+  static std::size_t const maxSamples = 4096;
+
+  std::vector<uint32_t> samples_;
 };
 
 
-bool CompositeRawInputTest::test(PRAWINPUT pRawInput)
+uint64_t get_thread_cpu_time()
 {
-  auto r = initial_;
-  for (auto & spChild : children_)
-    r = combine_(r, spChild->test(pRawInput));
-  return r;
+  FILETIME creationTime, exitTime, kernelTime, userTime;
+  if (!GetThreadTimes(GetCurrentThread(), &creationTime, &exitTime, &kernelTime, &userTime))
+    return 0;
+  auto const ft2u = [](FILETIME const & ft) { return (static_cast<uint64_t>(ft.dwHighDateTime) << 32) | ft.dwLowDateTime; };
+  return ft2u(kernelTime) + ft2u(userTime);
 }
 
 
-void CompositeRawInputTest::add(std::shared_ptr<RawInputTest> const & spChild)
+/* Thread times are in 100 ns units. */
+double get_cpu_percent(uint64_t cpuTime, std::chrono::steady_clock::duration wallTime)
 {
-  children_.push_back(spChild);
+  auto const wall = std::chrono::duration_cast<std::chrono::microseconds>(wallTime).count();
+  return wall > 0 ? cpuTime / 10.0 / wall * 100.0 : 0.0;
 }
 
 
-CompositeRawInputTest::CompositeRawInputTest(combine_t const & combine, bool initial)
-  : combine_(combine), initial_(initial), children_()
-{}
+/* Background threads are stopped on FreeLibrary() from DllMain(). Thread can not exit there, since exiting
+   thread waits for loader lock held by caller, and must not run any code of this DLL after it is unmapped.
+   So stopped thread signals event and parks in the same call, and stopping thread waits for event, then
+   terminates parked thread (it holds no locks) and waits for its handle. Locals of thread function must be
+   destroyed before park_thread(). */
+void park_thread(HANDLE hStopped)
+{
+  /* Handle of current thread is only signaled when it exits, so wait lasts until thread is terminated. */
+  SignalObjectAndWait(hStopped, GetCurrentThread(), INFINITE, FALSE);
+}
+
+
+/* Returns false if thread has not parked in time; it is left running then. */
+bool stop_parked_thread(HANDLE hThread, HANDLE hStopped, DWORD timeout)
+{
+  if (WaitForSingleObject(hStopped, timeout) != WAIT_OBJECT_0)
+    return false;
+  TerminateThread(hThread, 0);
+  return WaitForSingleObject(hThread, timeout) == WAIT_OBJECT_0;
+}
+
+
+/* Lock-free ring buffer for single producer and single consumer thread. */
+template <class T, std::size_t N>
+class SPSCQueue
+{
+  static_assert(N != 0 && (N & (N - 1)) == 0, "Queue size must be power of 2");
+
+public:
+  /* Returns false if queue is full. */
+  bool push(T const & item)
+  {
+    auto const tail = tail_.load(std::memory_order_relaxed);
+    if (tail - head_.load(std::memory_order_acquire) == N)
+      return false;
+    items_[tail % N] = item;
+    tail_.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  /* Returns false if queue is empty. */
+  bool pop(T & item)
+  {
+    auto const head = head_.load(std::memory_order_relaxed);
+    if (head == tail_.load(std::memory_order_acquire))
+      return false;
+    item = items_[head % N];
+    head_.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+  std::size_t size() const
+  {
+    return tail_.load(std::memory_order_acquire) - head_.load(std::memory_order_acquire);
+  }
+
+  SPSCQueue() : items_(), pad0_(), head_(0), pad1_(), tail_(0) {}
+
+private:
+  static std::size_t const cacheLineSize = 64;
+
+  std::array<T, N> items_;
+  /* Padded to separate cache lines, so that producer and consumer do not contend on them (alignas is not
+     honored by operator new before C++17). */
+  char pad0_[cacheLineSize];
+  std::atomic<std::size_t> head_;
+  char pad1_[cacheLineSize - sizeof(std::atomic<std::size_t>)];
+  std::atomic<std::size_t> tail_;
+};
 
 
-class DeviceHandleRawInputTest : public RawInputTest
+/* Runs binding actions on its own thread, so that key map thread never waits for them. Actions are run in
+   the order they were posted, so order of actions on any device is preserved. Actions are referenced by
+   pointer and must stay alive until idle() returns true. */
+class ActionExecutor : public ActionSink
 {
 public:
-  virtual bool test(PRAWINPUT pRawInput);
+  typedef std::chrono::steady_clock clock_t;
 
-  void set_state(bool state);
-  bool get_state() const;
-  void push_state(bool state);
-  void pop_state();
+  /* Never blocks; action is dropped if queue is full. */
+  virtual void post(action_t const * pAction);
+  virtual bool idle() const { return done_.load(std::memory_order_acquire) == posted_; }
+  /* Stops after current action and waits (for a limited time) until executor thread is gone. Called once. */
+  void stop();
 
-  DeviceHandleRawInputTest(HANDLE handle, bool state=true);
+  ActionExecutor(std::chrono::microseconds statsPeriod);
 
 private:
-  typedef std::recursive_mutex mutex_t;
-  typedef std::unique_lock<mutex_t> lock_t;
+  ActionExecutor(ActionExecutor const &) =delete;
+  ActionExecutor & operator=(ActionExecutor const &) =delete;
+
+  struct Item
+  {
+    action_t const * pAction;
+    clock_t::time_point posted;
+  };
 
-  HANDLE const handle_;
-  bool state_;
-  std::vector<bool> states_;
-  mutable mutex_t mutex_;
+  static std::size_t const queueSize = 256;
+
+  void run_();
+  void report_(clock_t::time_point now);
+
+  SPSCQueue<Item, queueSize> queue_;
+  HANDLE hEvent_;
+  unsigned long posted_;
+  std::atomic<unsigned long> done_;
+  std::atomic<std::size_t> maxDepth_;
+  std::atomic<unsigned long> dropped_;
+  std::chrono::microseconds statsPeriod_;
+  std::atomic<bool> stopping_;
+  HANDLE hStopped_;
+  std::thread thread_;
+  /* Accessed by executor thread only. */
+  LatencySamples waits_;
+  LatencySamples runs_;
+  clock_t::time_point statsStart_;
+  uint64_t cpuStart_;
 };
 
 
-bool DeviceHandleRawInputTest::test(PRAWINPUT pRawInput)
+void ActionExecutor::post(action_t const * pAction)
+{
+  if (!queue_.push(Item{pAction, clock_t::now()}))
+  {
+    dropped_.fetch_add(1, std::memory_order_relaxed);
+    logging::log(logging::LogSource::wrapper, logging::LogLevel::error, "Action queue is full, action dropped"_lit);
+    return;
+  }
+  ++posted_;
+  auto const depth = queue_.size();
+  if (depth > maxDepth_.load(std::memory_order_relaxed))
+    maxDepth_.store(depth, std::memory_order_relaxed);
+  SetEvent(hEvent_);
+}
+
+
+void ActionExecutor::run_()
 {
-  lock_t l (mutex_);
+  cpuStart_ = get_thread_cpu_time();
+  auto nextReport = clock_t::now() + statsPeriod_;
+  while (!stopping_.load())
+  {
+    WaitForSingleObject(hEvent_, INFINITE);
+    Item item;
+    while (!stopping_.load() && queue_.pop(item))
+    {
+      auto const start = clock_t::now();
+      try {
+        (*item.pAction)();
+      } catch (std::exception const & e)
+      {
+        logging::log(logging::LogSource::wrapper, logging::LogLevel::error, "Exception in action: "_lit, e.what());
+      }
+      auto const end = clock_t::now();
+      waits_.add(start - item.posted);
+      runs_.add(end - start);
+      done_.fetch_add(1, std::memory_order_release);
+    }
 
-  if (pRawInput->header.hDevice == handle_ && state_ == false)
-    return false;
-  else
-    return true;
+    auto const now = clock_t::now();
+    if (statsPeriod_ != std::chrono::microseconds::zero() && now >= nextReport)
+    {
+      nextReport = now + statsPeriod_;
+      report_(now);
+    }
+  }
+  park_thread(hStopped_);
 }
 
-void DeviceHandleRawInputTest::set_state(bool state)
+
+void ActionExecutor::stop()
 {
-  lock_t l (mutex_);
-  state_ = state;
-  logging::log("wrapper", logging::LogLevel::debug, "state: ", state_);
+  stopping_.store(true);
+  SetEvent(hEvent_);
+  if (!stop_parked_thread(thread_.native_handle(), hStopped_, 1000))
+  {
+    logging::log(logging::LogSource::wrapper, logging::LogLevel::error, "Action executor did not stop in time"_lit);
+    thread_.detach();
+    return;
+  }
+  thread_.detach();
+  CloseHandle(hStopped_);
+  CloseHandle(hEvent_);
 }
 
 
-bool DeviceHandleRawInputTest::get_state() const
+void ActionExecutor::report_(clock_t::time_point now)
 {
-  lock_t l (mutex_);
-  return state_;
+  auto const cpu = get_thread_cpu_time();
+  logging::log(logging::LogSource::wrapper, logging::LogLevel::info, "Action executor: actions: "_lit, waits_.size(),
+    "; max queue depth: "_lit, maxDepth_.exchange(0, std::memory_order_relaxed), "; dropped: "_lit, dropped_.exchange(0, std::memory_order_relaxed),
+    "; cpu: "_lit, get_cpu_percent(cpu - cpuStart_, now - statsStart_), "%"_lit);
+  if (!waits_.empty())
+  {
+    logging::log(logging::LogSource::wrapper, logging::LogLevel::info, "Action executor: queue wait p50/p99/max: "_lit, waits_.percentile(50),
+      "/"_lit, waits_.percentile(99), "/"_lit, waits_.percentile(100), " us; run time p50/p99/max: "_lit, runs_.percentile(50), "/"_lit, runs_.percentile(99),
+      "/"_lit, runs_.percentile(100), " us"_lit);
+  }
+  waits_.clear();
+  runs_.clear();
+  statsStart_ = now;
+  cpuStart_ = cpu;
 }
 
 
-void DeviceHandleRawInputTest::push_state(bool state)
+/* Executor thread runs until stop(). */
+ActionExecutor::ActionExecutor(std::chrono::microseconds statsPeriod)
+  : queue_(), hEvent_(CreateEventA(NULL, FALSE, FALSE, NULL)), posted_(0), done_(0), maxDepth_(0), dropped_(0),
+    statsPeriod_(statsPeriod), stopping_(false), hStopped_(CreateEventA(NULL, TRUE, FALSE, NULL)), thread_(), waits_(), runs_(),
+    statsStart_(clock_t::now()), cpuStart_(0)
 {
-  lock_t l (mutex_);
-  states_.push_back(state_);
-  state_ = state;
-  logging::log("wrapper", logging::LogLevel::debug, "state: ", state_);
+  if (!hEvent_ || !hStopped_)
+    throw std::runtime_error("Failed to create action executor events");
+  thread_ = std::thread(&ActionExecutor::run_, this);
 }
 
 
-void DeviceHandleRawInputTest::pop_state()
+/* Sleeps until deadline or until wake event is signaled. Uses high resolution waitable timer if available
+   (Windows 10 1803+), since Sleep() and std::this_thread::sleep_until() have millisecond (or worse)
+   resolution. Otherwise sleeps whole milliseconds, rounded up. */
+class DeadlineSleeper
 {
-  lock_t l (mutex_);
-  state_ = states_.back();
-  logging::log("wrapper", logging::LogLevel::debug, "state: ", state_);
-  states_.pop_back();
+public:
+  typedef std::chrono::steady_clock clock_t;
+
+  /* Returns false if woken up by hWake. Deadline may be clock_t::time_point::max(). */
+  bool sleep_until(clock_t::time_point deadline, HANDLE hWake);
+
+  DeadlineSleeper();
+  ~DeadlineSleeper();
+
+private:
+  DeadlineSleeper(DeadlineSleeper const &) =delete;
+  DeadlineSleeper & operator=(DeadlineSleeper const &) =delete;
+
+  HANDLE hTimer_;
+};
+
+
+bool DeadlineSleeper::sleep_until(clock_t::time_point deadline, HANDLE hWake)
+{
+  auto const now = clock_t::now();
+  if (deadline <= now)
+    return true;
+  if (deadline == clock_t::time_point::max())
+    return WaitForSingleObject(hWake, INFINITE) != WAIT_OBJECT_0;
+
+  if (hTimer_)
+  {
+    LARGE_INTEGER dueTime;
+    /* Negative value is relative time in 100 ns units. */
+    dueTime.QuadPart = -static_cast<LONGLONG>(std::chrono::duration_cast<std::chrono::microseconds>(deadline - now).count() * 10);
+    HANDLE const handles[] = { hTimer_, hWake };
+    if (SetWaitableTimer(hTimer_, &dueTime, 0, NULL, NULL, FALSE))
+    {
+      auto const r = WaitForMultipleObjects(2, handles, FALSE, INFINITE);
+      if (r == WAIT_OBJECT_0)
+        return true;
+      if (r == WAIT_OBJECT_0 + 1)
+      {
+        CancelWaitableTimer(hTimer_);
+        return false;
+      }
+    }
+  }
+
+  /* Without high resolution timer wait is rounded up to whole ms rather than spun out: deadline is met late
+     by less than timer period, and caller checks time itself. */
+  auto const ms = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - now + std::chrono::milliseconds(1) - clock_t::duration(1)).count();
+  return WaitForSingleObject(hWake, static_cast<DWORD>(std::min<long long>(ms, INFINITE - 1))) != WAIT_OBJECT_0;
 }
 
 
-DeviceHandleRawInputTest::DeviceHandleRawInputTest(HANDLE handle, bool state)
-  : handle_(handle), state_(state), states_(), mutex_()
-{}
+DeadlineSleeper::DeadlineSleeper() : hTimer_(NULL)
+{
+  typedef HANDLE (WINAPI * create_timer_t)(LPVOID, LPCWSTR, DWORD, DWORD);
+  static DWORD const createWaitableTimerHighResolution = 0x00000002;
+  static DWORD const timerAllAccess = 0x1F0003;
+
+  if (auto hKernel32 = GetModuleHandleA("kernel32.dll"))
+    if (auto const create = reinterpret_cast<create_timer_t>(GetProcAddress(hKernel32, "CreateWaitableTimerExW")))
+      hTimer_ = create(NULL, NULL, createWaitableTimerHighResolution, timerAllAccess);
+  if (hTimer_)
+    logging::log(logging::LogSource::wrapper, logging::LogLevel::debug, "High resolution timer is used"_lit);
+  else
+    logging::log(logging::LogSource::wrapper, logging::LogLevel::info, "High resolution timer is not available, deadlines are rounded up to whole ms"_lit);
+}
+
+
+DeadlineSleeper::~DeadlineSleeper()
+{
+  if (hTimer_)
+    CloseHandle(hTimer_);
+}
+
+
+/* Ticks are scheduled on fixed deadlines, so time spent in tick does not add to period. After idleTicks
+   ticks without activity period is doubled on each tick until it reaches idlePeriod; activity brings it
+   back to fast period at once. If tick overruns its deadline, next one is scheduled from now. */
+class TickScheduler
+{
+public:
+  typedef std::chrono::steady_clock clock_t;
+  typedef std::chrono::microseconds duration_t;
 
+  /* Returns deadline of next tick. */
+  clock_t::time_point next(clock_t::time_point now);
+  void set_activity(bool active);
+  void configure(duration_t fastPeriod, duration_t idlePeriod, unsigned int idleTicks);
+  duration_t get_period() const { return period_; }
 
-/* Key map */
-enum class KeyEventType : int { press=0, release=1 };
+  TickScheduler(duration_t fastPeriod, duration_t idlePeriod, unsigned int idleTicks);
 
+private:
+  duration_t fastPeriod_;
+  duration_t idlePeriod_;
+  unsigned int idleTicks_;
+  duration_t period_;
+  unsigned int idleCount_;
+  clock_t::time_point deadline_;
+};
 
-KeyEventType name2ket(char const * name)
+
+TickScheduler::clock_t::time_point TickScheduler::next(clock_t::time_point now)
 {
-  static struct { char const * name; KeyEventType ket; } const n2k[] = { { "press", KeyEventType::press }, { "release", KeyEventType::release } };
-  for (auto const & p : n2k)
-    if (std::strcmp(p.name, name) == 0)
-      return p.ket;
-  throw std::runtime_error("Invalid key event type");
+  deadline_ += period_;
+  if (deadline_ < now)
+    deadline_ = now;
+  return deadline_;
 }
 
 
-char const * ket2name(KeyEventType ket)
+void TickScheduler::set_activity(bool active)
 {
-  switch(ket)
+  if (active)
   {
-    case KeyEventType::press:
-      return "pressed";
-    case KeyEventType::release:
-      return "released";
-    default:
-      return "invalid";
+    idleCount_ = 0;
+    period_ = fastPeriod_;
   }
+  else if (idleCount_ < idleTicks_)
+    ++idleCount_;
+  else if (period_ < idlePeriod_)
+    period_ = std::min(period_ * 2, idlePeriod_);
 }
 
 
-class GKSKeyMap
+void TickScheduler::configure(duration_t fastPeriod, duration_t idlePeriod, unsigned int idleTicks)
 {
-public:
-  typedef UINT key_t;
-  typedef std::function<void()> callback_t;
+  fastPeriod_ = fastPeriod;
+  idlePeriod_ = std::max(fastPeriod, idlePeriod);
+  idleTicks_ = idleTicks;
+  period_ = fastPeriod_;
+  idleCount_ = 0;
+}
 
-  void update();
 
-  unsigned int add(key_t key, KeyEventType ket, callback_t const & cb);
-  void remove(unsigned int id);
+TickScheduler::TickScheduler(duration_t fastPeriod, duration_t idlePeriod, unsigned int idleTicks)
+  : fastPeriod_(), idlePeriod_(), idleTicks_(), period_(), idleCount_(), deadline_(clock_t::now())
+{
+  configure(fastPeriod, idlePeriod, idleTicks);
+}
 
-  GKSKeyMap();
-  ~GKSKeyMap() =default;
 
-private:
-  struct Data
-  {
-    typedef std::map<int, std::map<unsigned int, callback_t> > callbacks_t;
+/* Key map thread statistics: CPU time, how late ticks wake up, and upper bound of press-to-action latency
+   (time since previous sample, when key could have been pressed, until actions are queued). */
+class TickStats
+{
+public:
+  typedef std::chrono::steady_clock clock_t;
 
-    callbacks_t callbacks;
-    bool state;
+  void add_tick(clock_t::duration lateness);
+  void add_latency(clock_t::duration latency) { latencies_.add(latency); }
+  /* Logs statistics and starts new period. */
+  void report(TickScheduler::duration_t period);
 
-    Data();
-  };
+  TickStats();
 
-  std::map<key_t, Data> data_;
-  unsigned int id_ = 0;
-  std::map<unsigned int, std::pair<key_t, KeyEventType> > ids_;
+private:
+  clock_t::time_point start_;
+  uint64_t cpuStart_;
+  unsigned long ticks_;
+  clock_t::duration maxLateness_;
+  clock_t::duration totalLateness_;
+  LatencySamples latencies_;
 };
 
 
-void GKSKeyMap::update()
+void TickStats::add_tick(clock_t::duration lateness)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "GKSKeyMap::update()");
-  for (auto & p : data_)
+  ++ticks_;
+  totalLateness_ += lateness;
+  maxLateness_ = std::max(maxLateness_, lateness);
+}
+
+
+void TickStats::report(TickScheduler::duration_t period)
+{
+  typedef std::chrono::microseconds us;
+  auto const now = clock_t::now();
+  auto const cpu = get_thread_cpu_time();
+  auto const avgLateness = ticks_ > 0 ? std::chrono::duration_cast<us>(totalLateness_).count() / static_cast<long long>(ticks_) : 0;
+  logging::log(logging::LogSource::wrapper, logging::LogLevel::info, "Key map thread: ticks: "_lit, ticks_, "; period: "_lit, period.count(),
+    " us; cpu: "_lit, get_cpu_percent(cpu - cpuStart_, now - start_), "%; lateness avg/max: "_lit, avgLateness, "/"_lit,
+    std::chrono::duration_cast<us>(maxLateness_).count(), " us"_lit);
+
+  if (!latencies_.empty())
   {
-    auto const & key = p.first;
-    bool currentState = GetKeyState(key) & 0x8000;
-    logging::log("wrapper", logging::LogLevel::debug, "key ", key2name(key), ": state: ", currentState);
-    auto & prevState = p.second.state;
-    if (currentState != prevState)
-    {
-      auto const ket = (currentState && !prevState) ? KeyEventType::press : KeyEventType::release;
-      for (auto & cb : p.second.callbacks[static_cast<int>(ket)])
-        cb.second();
-      logging::log("wrapper", logging::LogLevel::debug, "key ", key2name(key), " ", ket2name(ket));
-      prevState = currentState;
-    }
+    auto const p50 = latencies_.percentile(50), p90 = latencies_.percentile(90), p99 = latencies_.percentile(99), p100 = latencies_.percentile(100);
+    logging::log(logging::LogSource::wrapper, logging::LogLevel::info, "Key map thread: key events: "_lit, latencies_.size(),
+      "; press-to-action latency p50/p90/p99/max: "_lit, p50, "/"_lit, p90, "/"_lit, p99, "/"_lit, p100, " us"_lit);
   }
+
+  start_ = now;
+  cpuStart_ = cpu;
+  ticks_ = 0;
+  maxLateness_ = totalLateness_ = clock_t::duration::zero();
+  latencies_.clear();
 }
 
 
-unsigned int GKSKeyMap::add(GKSKeyMap::key_t key, KeyEventType ket, GKSKeyMap::callback_t const & cb)
+TickStats::TickStats()
+  : start_(clock_t::now()), cpuStart_(get_thread_cpu_time()), ticks_(0), maxLateness_(clock_t::duration::zero()),
+    totalLateness_(clock_t::duration::zero()), latencies_()
+{}
+
+
+/* Runs periodic and one-shot tasks on single thread; tasks are kept in TimerWheel. Thread sleeps until earliest
+   deadline or until task set is changed. Periodic task that throws is run again on next period; one-shot task
+   that throws is cancelled. */
+class Worker
 {
-  auto id = ++id_;
-  auto it = data_.find(key);
-  if (it == data_.end())
-    data_[key] = Data();
-  data_[key].callbacks[static_cast<int>(ket)][id] = cb;
-  ids_[id] = decltype(ids_)::mapped_type(key, ket);
+public:
+  typedef TimerWheel::clock_t clock_t;
+  typedef TimerWheel::task_t task_t;
+  typedef TimerWheel::task_id_t task_id_t;
+
+  /* Task that throws is run again after retry; zero retry cancels it. */
+  task_id_t add(char const * name, clock_t::time_point first, task_t const & task, clock_t::duration retry = clock_t::duration::zero());
+  /* Runs are due on multiples of period from now; if run overruns, missed ones are skipped. */
+  task_id_t add_periodic(char const * name, clock_t::duration period, std::function<void()> const & f);
+  /* Task does not run after cancel() returns. If called from task itself, current run completes. */
+  void cancel(task_id_t id);
+  /* Logs run time of each task and CPU time of worker thread, then starts new period. Called from task. */
+  void report();
+
+  void start();
+  /* Stops after current task and waits (for a limited time) until worker thread is gone (see park_thread()). */
+  void stop();
+
+  Worker();
+
+private:
+  Worker(Worker const &) =delete;
+  Worker & operator=(Worker const &) =delete;
+
+  typedef TimerWheel::Task Task;
+
+  void run_();
+  void loop_();
+
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  TimerWheel wheel_;
+  task_id_t runningId_;
+  bool stopping_;
+  HANDLE hWake_;
+  HANDLE hStopped_;
+  std::thread thread_;
+  /* Accessed by worker thread only. */
+  DeadlineSleeper sleeper_;
+  clock_t::time_point statsStart_;
+  uint64_t cpuStart_;
+};
+
+
+Worker::task_id_t Worker::add(char const * name, clock_t::time_point first, task_t const & task, clock_t::duration retry)
+{
+  std::unique_lock<std::mutex> lock (mutex_);
+  auto const id = wheel_.add(name, first, task, retry);
+  SetEvent(hWake_);
+  logging::log(logging::LogSource::wrapper, logging::LogLevel::debug, "Added task "_lit, id, " ("_lit, name, ")"_lit);
   return id;
 }
 
 
-void GKSKeyMap::remove(unsigned int id)
+Worker::task_id_t Worker::add_periodic(char const * name, clock_t::duration period, std::function<void()> const & f)
 {
-  auto const & p = ids_[id];
-  data_[p.first].callbacks[static_cast<int>(p.second)].erase(id);
+  return add(name, clock_t::now() + period,
+    [period, f](clock_t::time_point due) -> clock_t::time_point
+    {
+      f();
+      auto const next = due + period;
+      auto const now = clock_t::now();
+      return next > now ? next : now + period;
+    },
+    period
+  );
 }
 
 
-GKSKeyMap::GKSKeyMap() : data_()
-{}
+void Worker::cancel(task_id_t id)
+{
+  std::unique_lock<std::mutex> lock (mutex_);
+  if (wheel_.cancel(id) || runningId_ != id)
+    return;
+  SetEvent(hWake_);
+  if (std::this_thread::get_id() != thread_.get_id())
+    cv_.wait(lock, [this, id]() { return runningId_ != id; });
+}
+
+
+void Worker::report()
+{
+  typedef std::chrono::microseconds us;
+  auto const now = clock_t::now();
+  auto const cpu = get_thread_cpu_time();
+  std::unique_lock<std::mutex> lock (mutex_);
+  logging::log(logging::LogSource::wrapper, logging::LogLevel::info, "Worker: tasks: "_lit, wheel_.size(), "; cpu: "_lit,
+    get_cpu_percent(cpu - cpuStart_, now - statsStart_), "%"_lit);
+  wheel_.for_each([](Task & task)
+  {
+    logging::log(logging::LogSource::wrapper, logging::LogLevel::info, "Worker: task "_lit, task.id, " ("_lit, task.name, "): runs: "_lit, task.runs,
+      "; run time total/max: "_lit, std::chrono::duration_cast<us>(task.runTime).count(), "/"_lit, std::chrono::duration_cast<us>(task.maxRunTime).count(), " us"_lit);
+    task.runs = 0;
+    task.runTime = task.maxRunTime = clock_t::duration::zero();
+  });
+  statsStart_ = now;
+  cpuStart_ = cpu;
+}
+
+
+void Worker::start()
+{
+  std::unique_lock<std::mutex> lock (mutex_);
+  if (!thread_.joinable())
+    thread_ = std::thread(&Worker::run_, this);
+}
+
+
+void Worker::stop()
+{
+  std::unique_lock<std::mutex> lock (mutex_);
+  if (!thread_.joinable())
+    return;
+  stopping_ = true;
+  SetEvent(hWake_);
+  lock.unlock();
+  auto const stopped = stop_parked_thread(thread_.native_handle(), hStopped_, 1000);
+  lock.lock();
+  thread_.detach();
+  if (!stopped)
+  {
+    logging::log(logging::LogSource::wrapper, logging::LogLevel::error, "Worker did not stop in time"_lit);
+    return;
+  }
+  CloseHandle(hStopped_);
+  CloseHandle(hWake_);
+}
+
+
+void Worker::run_()
+{
+  logging::log(logging::LogSource::wrapper, logging::LogLevel::debug, "Worker started"_lit);
+  statsStart_ = clock_t::now();
+  cpuStart_ = get_thread_cpu_time();
+  loop_();
+  logging::log(logging::LogSource::wrapper, logging::LogLevel::debug, "Worker stopped"_lit);
+  park_thread(hStopped_);
+}
+
+
+void Worker::loop_()
+{
+  std::vector<Task *> due;
+  std::unique_lock<std::mutex> lock (mutex_);
+  while (!stopping_)
+  {
+    due.clear();
+    wheel_.collect_due(clock_t::now(), due);
+    for (auto const pTask : due)
+    {
+      if (pTask->cancelled || stopping_)
+      {
+        wheel_.erase(pTask);
+        continue;
+      }
+      runningId_ = pTask->id;
+      lock.unlock();
+      auto const start = clock_t::now();
+      auto const next = TimerWheel::run(*pTask);
+      auto const runTime = clock_t::now() - start;
+      lock.lock();
+      runningId_ = 0;
+      wheel_.complete(pTask, next, runTime);
+      cv_.notify_all();
+    }
+    if (stopping_)
+      break;
+    auto const deadline = wheel_.next_deadline();
+    lock.unlock();
+    sleeper_.sleep_until(deadline, hWake_);
+    lock.lock();
+  }
+}
 
 
-GKSKeyMap::Data::Data() : callbacks(), state(false)
+Worker::Worker()
+  : mutex_(), cv_(), wheel_(clock_t::now()), runningId_(0), stopping_(false), hWake_(CreateEventA(NULL, FALSE, FALSE, NULL)),
+    hStopped_(CreateEventA(NULL, TRUE, FALSE, NULL)), thread_(), sleeper_(), statsStart_(), cpuStart_(0)
 {
-  KeyEventType kets[] = { KeyEventType::press, KeyEventType::release };
-  for (auto ket : kets)
-    callbacks[static_cast<int>(ket)] = callbacks_t::mapped_type();
+  if (!hWake_ || !hStopped_)
+    throw std::runtime_error("Failed to create worker events");
 }
 
-config::config_t g_config;
 
+config::Settings g_settings;
+
+/* Parsed json is only used to fill settings and released right after. */
 void init_config()
 {
-  auto configPath = "user32.cfg";
-  std::ifstream configStream (configPath);
-  if (!configStream.is_open())
-    throw std::runtime_error(stream_to_str("Failed to load config from: ", configPath));
-  g_config = nlohmann::json::parse(configStream);
+  g_settings = config::parse_settings(config::load("user32.cfg"));
+}
+
+
+void apply_log_levels(config::LogSettings const & ls)
+{
+  logging::root_logger().set_repeat_window(ls.repeatWindow);
+  logging::root_logger().set_level(ls.level);
+  for (auto const & p : ls.levels)
+    logging::root_logger().set_level(p.first, p.second);
 }
 
 
 void init_log()
 {
-  auto formatter = [](logging::LogMessage const & lm)
+  auto const & ls = g_settings.log;
+  auto const & logFormat = ls.format;
+  if (logFormat == "text" && ls.maxSize != 0)
   {
-    static char const fmt[] = "%H:%M:%S";
-    size_t const n = 128;
-    char timeCstr[n] = {0};
-    auto time = std::localtime(&lm.time);
-    std::strftime(timeCstr, n, fmt, time);
-    return stream_to_str("(", lm.source, ") <", timeCstr, "> [", lm.level, "] ", lm.msg);
-  };
-  auto const logPath = "user32.log";
-  auto spLogFileSteam = std::make_shared<std::fstream>(logPath, std::ios::out|std::ios::trunc);
-  auto streamHolder = [spLogFileSteam]() -> std::fstream& { return *spLogFileSteam; };
-  auto spLogPrinter = std::make_shared<logging::StreamLogPrinter>(formatter, streamHolder);
-  logging::root_logger().add_printer(spLogPrinter);
-  auto logLevel = logging::n2ll(config::get_d<std::string>(g_config, "logLevel", "DEBUG"));
-  logging::root_logger().set_level(logLevel);
-  logging::log("init", logging::LogLevel::info, "Logging initialized");
+    /* Size-capped memory-mapped log, rotated to user32.log.1 .. user32.log.N */
+    auto spLogPrinter = std::make_shared<logging::MappedFileLogPrinter>(logging::format_default, "user32.log", ls.maxSize, ls.maxFiles);
+    logging::root_logger().add_printer(spLogPrinter);
+  }
+  else if (logFormat == "text")
+  {
+    auto const logPath = "user32.log";
+    auto spLogFileSteam = std::make_shared<std::fstream>(logPath, std::ios::out|std::ios::trunc);
+    auto streamHolder = [spLogFileSteam]() -> std::fstream& { return *spLogFileSteam; };
+    auto spLogPrinter = std::make_shared<logging::StreamLogPrinter>(logging::format_default, streamHolder);
+    logging::root_logger().add_printer(spLogPrinter);
+  }
+  else if (logFormat == "binary")
+  {
+    /* Messages are not formatted at runtime; use blogdec to convert user32.blog to text. */
+    auto const logPath = "user32.blog";
+    auto spLogFileSteam = std::make_shared<std::fstream>(logPath, std::ios::out|std::ios::trunc|std::ios::binary);
+    auto streamHolder = [spLogFileSteam]() -> std::fstream& { return *spLogFileSteam; };
+    auto spLogPrinter = std::make_shared<logging::BinaryLogPrinter>(streamHolder);
+    logging::root_logger().add_printer(spLogPrinter);
+  }
+  else
+    throw std::runtime_error(stream_to_str("Invalid log format: ", logFormat));
+  apply_log_levels(ls);
+  logging::log(logging::LogSource::init, logging::LogLevel::info, "Logging initialized"_lit);
 }
 
 
@@ -550,7 +1107,7 @@ char const * devtype2name(DWORD devType)
 
 void print_raw_input_devices()
 {
-  logging::log("wrapper", logging::LogLevel::info, "===Raw input devices===");
+  logging::log(logging::LogSource::wrapper, logging::LogLevel::info, "===Raw input devices==="_lit);
   auto deviceProps = get_raw_input_device_props();
   std::stringstream ss;
   for (auto const & dp : deviceProps)
@@ -581,192 +1138,868 @@ void print_raw_input_devices()
          << "; usage page: " << hid.usUsagePage << "; usage: " << hid.usUsage;
     }
 
-    logging::log("wrapper", logging::LogLevel::info, ss.str());
+    logging::log(logging::LogSource::wrapper, logging::LogLevel::info, ss.str());
   }
-  logging::log("wrapper", logging::LogLevel::info, "=======================");
+  logging::log(logging::LogSource::wrapper, logging::LogLevel::info, "======================="_lit);
 }
 
 
-GKSKeyMap g_keyMap;
+/* Raw input filter state built from settings: device tests, device name (or alias) to handle map and device
+   sets (devices and groups) that actions apply to. */
+struct FilterState
+{
+  std::shared_ptr<CompositeRawInputTest> spTest;
+  std::map<std::string, HANDLE> nameToHandle;
+  std::shared_ptr<DeviceMaskRawInputTest> spMaskTest;
+  /* Device states given in settings, by bit of mask test. */
+  DeviceMaskRawInputTest::mask_t initial;
+  std::map<std::string, std::shared_ptr<DeviceSet> > nameToSet;
+  std::map<std::string, DeviceMaskRawInputTest::mask_t> profiles;
+  std::shared_ptr<ActivityWindowRawInputTest> spActivityTest;
+  std::shared_ptr<ArbitrationRawInputTest> spArbitrationTest;
+  std::shared_ptr<CompositeRawInputTransform> spTransform;
+  std::shared_ptr<DebounceRawInputTransform> spDebounce;
+  std::shared_ptr<RemapRawInputTransform> spRemap;
+  std::shared_ptr<MotionRawInputTransform> spMotion;
+
+  /* Returns NULL if there is no device with given name or alias. Null handle must not be used in tests,
+     since it matches injected input. */
+  HANDLE find_handle(std::string const & name) const;
+  /* Adds set of given devices for name, unless there is one already. */
+  void make_set(std::string const & name, std::vector<HANDLE> const & handles);
+  /* Adds set of single device for name, unless there is set already. Logs error if there is no such device. */
+  void make_device_set(std::string const & name);
+  std::shared_ptr<DeviceSet> get_set(std::string const & name) const;
+
+  FilterState();
+};
+
 
-void init_raw_input_filter()
+void FilterState::make_set(std::string const & name, std::vector<HANDLE> const & handles)
 {
-  logging::log("wrapper", logging::LogLevel::debug, "init_raw_input_filter()");
+  if (nameToSet.count(name))
+    return;
+  DeviceSet::mask_t mask {};
+  for (auto const hDevice : handles)
+  {
+    auto const i = spMaskTest->add(hDevice, true);
+    mask[i / 64] |= uint64_t(1) << (i % 64);
+  }
+  nameToSet[name] = std::make_shared<DeviceSet>(spMaskTest, mask);
+}
 
-  std::map<std::string, HANDLE> nameToHandle;
-  auto deviceProps = get_raw_input_device_props();
+
+HANDLE FilterState::find_handle(std::string const & name) const
+{
+  auto const it = nameToHandle.find(name);
+  return it == nameToHandle.end() ? NULL : it->second;
+}
+
+
+void FilterState::make_device_set(std::string const & name)
+{
+  if (nameToSet.count(name))
+    return;
+  auto const hDevice = find_handle(name);
+  if (hDevice == NULL)
+  {
+    logging::log(logging::LogSource::init, logging::LogLevel::error, "Device not found: \""_lit, name, "\""_lit);
+    return;
+  }
+  make_set(name, std::vector<HANDLE>(1, hDevice));
+}
+
+
+std::shared_ptr<DeviceSet> FilterState::get_set(std::string const & name) const
+{
+  auto it = nameToSet.find(name);
+  if (it == nameToSet.end())
+    throw std::runtime_error(stream_to_str("No device or group: ", name));
+  return it->second;
+}
+
+
+FilterState::FilterState()
+  : spTest(std::make_shared<CompositeRawInputTest>(std::logical_and<bool>(), true)), nameToHandle(), spMaskTest(), initial(),
+    nameToSet(), profiles(), spActivityTest(), spArbitrationTest(), spTransform(std::make_shared<CompositeRawInputTransform>()),
+    spDebounce(), spRemap(), spMotion()
+{}
+
+
+std::vector<std::string> get_bound_device_names(config::Settings const & settings)
+{
+  std::vector<std::string> names;
+  for (auto const & binding : settings.bindings)
+    if (!binding.do_.name.empty())
+      names.push_back(binding.do_.name);
+  std::sort(names.begin(), names.end());
+  names.erase(std::unique(names.begin(), names.end()), names.end());
+  return names;
+}
+
+
+/* Device mask test, sets of devices that actions apply to and profile tables. */
+void build_device_mask(FilterState & state, config::Settings const & settings)
+{
+  state.spMaskTest = std::make_shared<DeviceMaskRawInputTest>();
+
+  if (!settings.devices.empty())
+  {
+    logging::log(logging::LogSource::init, logging::LogLevel::debug, "Processing \"devices\""_lit);
+    for (auto const & ds : settings.devices)
+    {
+      auto const & alias = ds.alias;
+      auto const & devName = ds.name;
+      auto const devHandle = state.find_handle(devName);
+      if (devHandle == NULL)
+      {
+        logging::log(logging::LogSource::init, logging::LogLevel::error, "Device not found, skipping \""_lit, alias, "\": "_lit, devName);
+        continue;
+      }
+      auto const bit = state.spMaskTest->add(devHandle, ds.state);
+      logging::log(logging::LogSource::init, logging::LogLevel::debug, "devName: "_lit, devName, "; alias: "_lit, alias, "; devHandle: "_lit, devHandle, "; bit: "_lit, bit);
+    }
+  }
+
+  if (!settings.groups.empty())
+  {
+    logging::log(logging::LogSource::init, logging::LogLevel::debug, "Processing \"groups\""_lit);
+    for (auto const & gs : settings.groups)
+    {
+      std::vector<HANDLE> handles;
+      for (auto const & name : gs.devices)
+      {
+        auto const hDevice = state.find_handle(name);
+        if (hDevice == NULL)
+          logging::log(logging::LogSource::init, logging::LogLevel::error, "Device not found, not adding \""_lit, name, "\" to group "_lit, gs.name);
+        else
+          handles.push_back(hDevice);
+      }
+      state.make_set(gs.name, handles);
+      logging::log(logging::LogSource::init, logging::LogLevel::debug, "group: "_lit, gs.name, "; devices: "_lit, handles.size());
+    }
+  }
+
+  for (auto const & binding : settings.bindings)
+  {
+    auto const & name = binding.do_.name;
+    if (!name.empty())
+      state.make_device_set(name);
+  }
+
+  /* Profiles are compiled last, so that their tables cover all devices. */
+  if (!settings.profiles.empty())
+  {
+    logging::log(logging::LogSource::init, logging::LogLevel::debug, "Processing \"profiles\""_lit);
+    for (auto const & ps : settings.profiles)
+      for (auto const & names : { &ps.enable, &ps.disable })
+        for (auto const & name : *names)
+          state.make_device_set(name);
+  }
+  DeviceMaskRawInputTest::mask_t all;
+  all.fill(~uint64_t(0));
+  state.initial = state.spMaskTest->get(all);
+  for (auto const & ps : settings.profiles)
+  {
+    auto table = state.initial;
+    for (auto const & name : ps.enable)
+      if (state.nameToSet.count(name))
+        for (std::size_t w = 0; w < table.size(); ++w)
+          table[w] |= state.get_set(name)->mask()[w];
+    for (auto const & name : ps.disable)
+      if (state.nameToSet.count(name))
+        for (std::size_t w = 0; w < table.size(); ++w)
+          table[w] &= ~state.get_set(name)->mask()[w];
+    state.profiles[ps.name] = table;
+    /* Whole table as one hex number, highest device bit first. */
+    std::stringstream mask;
+    mask << std::hex << std::setfill('0');
+    for (std::size_t w = table.size(); w-- > 0;)
+      mask << std::setw(16) << table[w];
+    logging::log(logging::LogSource::init, logging::LogLevel::debug, "profile: "_lit, ps.name, "; mask: "_lit, mask.str());
+  }
+}
+
+
+/* Copies current state of devices of previous mask test to new one, unless device is gone or its state in settings
+   was changed. Changes made by actions between this and publishing of new state are lost. */
+void carry_device_states(FilterState & state, FilterState const & prev)
+{
+  DeviceMaskRawInputTest::mask_t all;
+  all.fill(~uint64_t(0));
+  auto const current = prev.spMaskTest->get(all);
+  auto bits = state.initial;
+  std::size_t carried = 0;
+  for (std::size_t i = 0; i < state.spMaskTest->size(); ++i)
+  {
+    auto const j = prev.spMaskTest->find(state.spMaskTest->handle(i));
+    if (j == DeviceIndex::npos || ((prev.initial[j / 64] >> (j % 64)) & 1) != ((state.initial[i / 64] >> (i % 64)) & 1))
+      continue;
+    auto const bit = uint64_t(1) << (i % 64);
+    bits[i / 64] = ((current[j / 64] >> (j % 64)) & 1) ? bits[i / 64] | bit : bits[i / 64] & ~bit;
+    ++carried;
+  }
+  state.spMaskTest->assign(all, bits);
+  logging::log(logging::LogSource::init, logging::LogLevel::debug, "carried state of "_lit, carried, " of "_lit, state.spMaskTest->size(), " devices"_lit);
+}
+
+
+/* Tests for all devices mentioned in settings are created here, so that state is complete before it is published.
+   On reload previous state and settings are given: parts whose settings and device handles are unchanged are reused
+   with their runtime state, and device mask test keeps states of devices that are still present. */
+std::shared_ptr<FilterState> build_filter_state(config::Settings const & settings, std::vector<RawInputDeviceProps> const & deviceProps,
+  FilterState const * pPrev=nullptr, config::Settings const * pPrevSettings=nullptr)
+{
+  auto spState = std::make_shared<FilterState>();
+  auto & nameToHandle = spState->nameToHandle;
   for (auto const & dp : deviceProps)
     nameToHandle[dp.name] = dp.hDevice;
+  for (auto const & ds : settings.devices)
+  {
+    auto const it = nameToHandle.find(ds.name);
+    if (it != nameToHandle.end())
+      nameToHandle[ds.alias] = it->second;
+  }
+
+  auto const handlesChanged = pPrev == nullptr || pPrevSettings == nullptr || nameToHandle != pPrev->nameToHandle;
+  /* Everything is rebuilt if there is no previous state or device handles changed; prev is then a placeholder. */
+  auto const & prev = handlesChanged ? settings : *pPrevSettings;
+  auto const maskChanged = handlesChanged || settings.devices != prev.devices || settings.groups != prev.groups
+    || settings.profiles != prev.profiles || get_bound_device_names(settings) != get_bound_device_names(prev);
+
+  if (!maskChanged)
+  {
+    spState->spMaskTest = pPrev->spMaskTest;
+    spState->initial = pPrev->initial;
+    spState->nameToSet = pPrev->nameToSet;
+    spState->profiles = pPrev->profiles;
+  }
+  else
+  {
+    build_device_mask(*spState, settings);
+    if (pPrev)
+      carry_device_states(*spState, *pPrev);
+  }
+  spState->spTest->add(spState->spMaskTest);
+
+  if (!handlesChanged && settings.blocks == prev.blocks)
+    spState->spActivityTest = pPrev->spActivityTest;
+  else if (!settings.blocks.empty())
+  {
+    logging::log(logging::LogSource::init, logging::LogLevel::debug, "Processing \"blocks\""_lit);
+    auto const spActivityTest = std::make_shared<ActivityWindowRawInputTest>();
+    for (auto const & bs : settings.blocks)
+    {
+      /* Null handle would match injected input. */
+      auto const hSource = spState->find_handle(bs.source);
+      auto const hTarget = spState->find_handle(bs.target);
+      if (hSource == NULL || hTarget == NULL)
+      {
+        logging::log(logging::LogSource::init, logging::LogLevel::error, "Device not found, skipping block of \""_lit, bs.target, "\" by \""_lit, bs.source, "\""_lit);
+        continue;
+      }
+      spActivityTest->add_rule(hSource, hTarget, bs.window);
+      logging::log(logging::LogSource::init, logging::LogLevel::debug, "source: "_lit, bs.source, "; target: "_lit, bs.target, "; window: "_lit, bs.window.count(), " us"_lit);
+    }
+    spState->spActivityTest = spActivityTest;
+  }
+  if (spState->spActivityTest)
+    spState->spTest->add(spState->spActivityTest);
+
+  if (!handlesChanged && settings.arbitration == prev.arbitration)
+    spState->spArbitrationTest = pPrev->spArbitrationTest;
+  else if (!settings.arbitration.empty())
+  {
+    logging::log(logging::LogSource::init, logging::LogLevel::debug, "Processing \"arbitration\""_lit);
+    auto const spArbitrationTest = std::make_shared<ArbitrationRawInputTest>();
+    for (auto const & as : settings.arbitration)
+    {
+      std::vector<HANDLE> handles;
+      for (auto const & name : as.devices)
+      {
+        auto const hDevice = spState->find_handle(name);
+        if (hDevice == NULL)
+          logging::log(logging::LogSource::init, logging::LogLevel::error, "Device not found, not arbitrating \""_lit, name, "\""_lit);
+        else
+          handles.push_back(hDevice);
+      }
+      spArbitrationTest->add_group(handles, as.takeover, as.gap);
+      logging::log(logging::LogSource::init, logging::LogLevel::debug, "arbitrated devices: "_lit, handles.size(), "; takeover: "_lit, as.takeover.count(),
+        " us; gap: "_lit, as.gap.count(), " us"_lit);
+    }
+    spState->spArbitrationTest = spArbitrationTest;
+  }
+  if (spState->spArbitrationTest)
+    spState->spTest->add(spState->spArbitrationTest);
+
+  /* Debounce goes first, so that it sees physical buttons. */
+  if (!handlesChanged && settings.debounce == prev.debounce)
+    spState->spDebounce = pPrev->spDebounce;
+  else if (!settings.debounce.empty())
+  {
+    logging::log(logging::LogSource::init, logging::LogLevel::debug, "Processing \"debounce\""_lit);
+    auto const spDebounce = std::make_shared<DebounceRawInputTransform>();
+    for (auto const & ds : settings.debounce)
+    {
+      auto const hDevice = spState->find_handle(ds.device);
+      if (hDevice == NULL)
+      {
+        logging::log(logging::LogSource::init, logging::LogLevel::error, "Device not found, not debouncing \""_lit, ds.device, "\""_lit);
+        continue;
+      }
+      spDebounce->set_window(hDevice, ds.window);
+      logging::log(logging::LogSource::init, logging::LogLevel::debug, "debounce: "_lit, ds.device, "; window: "_lit, ds.window.count(), " us"_lit);
+    }
+    spState->spDebounce = spDebounce;
+  }
+  if (spState->spDebounce)
+    spState->spTransform->add(spState->spDebounce);
 
-  auto spCompositeRawInputTest = std::make_shared<CompositeRawInputTest>(std::logical_and<bool>(), true);
-  std::map<HANDLE, std::shared_ptr<DeviceHandleRawInputTest> > handleToRawInputTest;
-  auto make_test =
-    [&spCompositeRawInputTest, &handleToRawInputTest](HANDLE hDevice, bool state=true)
+  if (!handlesChanged && settings.remap == prev.remap)
+    spState->spRemap = pPrev->spRemap;
+  else if (!settings.remap.empty())
+  {
+    logging::log(logging::LogSource::init, logging::LogLevel::debug, "Processing \"remap\""_lit);
+    auto const spRemap = std::make_shared<RemapRawInputTransform>();
+    for (auto const & rs : settings.remap)
     {
-      std::shared_ptr<DeviceHandleRawInputTest> spRawInputTest;
-      auto it = handleToRawInputTest.find(hDevice);
-      if (it == handleToRawInputTest.end())
+      auto const hDevice = spState->find_handle(rs.device);
+      if (hDevice == NULL)
       {
-        spRawInputTest = std::make_shared<DeviceHandleRawInputTest>(hDevice, state);
-        handleToRawInputTest[hDevice] = spRawInputTest;
-        spCompositeRawInputTest->add(spRawInputTest);
+        logging::log(logging::LogSource::init, logging::LogLevel::error, "Device not found, not remapping \""_lit, rs.device, "\""_lit);
+        continue;
       }
-      else
-        spRawInputTest = it->second;
-      return spRawInputTest;
-    };
-
-  if (g_config.contains("devices"))
-  {
-    logging::log("init", logging::LogLevel::debug, "Processing \"devices\"");
-    for (auto const el : config::get(g_config, "devices").items())
-    {
-      auto const & alias = el.key();
-      auto const & di = el.value();
-      auto const devName = config::get_escaped_string(di, "name");
-      auto const & devHandle = nameToHandle[devName];
-      nameToHandle[alias] = devHandle;
-      auto const state = config::get_d<bool>(di, "state", true);
-      auto const spRawInputTest = make_test(devHandle, state);
-      logging::log("init", logging::LogLevel::debug, "devName: ", devName, "; alias: ", alias, "; devHandle: ", devHandle, "; spRawInputTest: ", spRawInputTest);
-    }
-  }
-
-  if (g_config.contains("bindings"))
-  {
-    logging::log("init", logging::LogLevel::debug, "Processing \"bindings\"");
-    auto const & bindings = config::get(g_config, "bindings"); 
-    for (auto const & binding : bindings)
-    {
-      auto const & on = config::get(binding, "on");
-      auto const key = name2key(config::get<std::string>(on, "key").c_str());
-      auto const ket = name2ket(config::get<std::string>(on, "event").c_str());
-
-      auto const & do_ = config::get(binding, "do");
-      auto const & devName = config::get_escaped_string(do_, "name");
-      HANDLE const & devHandle = nameToHandle[devName];
-      std::shared_ptr<DeviceHandleRawInputTest> spRawInputTest = make_test(devHandle);
-      logging::log("init", logging::LogLevel::debug, "name: ", devName, "; devHandle: ", devHandle, "; spRawInputTest:", spRawInputTest);
-
-      std::function<void()> action;
-      auto const & actionName = config::get<std::string>(do_, "action");
-      if (actionName == "enable")
-        action = [spRawInputTest]() { spRawInputTest->set_state(true); };
-      else if (actionName == "disable")
-        action = [spRawInputTest]() { spRawInputTest->set_state(false); };
-      else if (actionName == "toggle")
-        action = [spRawInputTest]() { spRawInputTest->set_state(!spRawInputTest->get_state()); };
-      else if (actionName == "set_state")
+      if (!rs.keys.empty())
       {
-        auto const state = config::get<bool>(do_, "state");
-        action = [spRawInputTest, state]() { spRawInputTest->set_state(state); };
+        auto keys = RemapRawInputTransform::make_key_table();
+        for (auto const & p : rs.keys)
+          RemapRawInputTransform::map_key(keys, p.first, p.second);
+        spRemap->set_keys(hDevice, keys);
       }
-      else if (actionName == "push_state")
+      if (!rs.buttons.empty())
       {
-        auto const state = config::get<bool>(do_, "state");
-        action = [spRawInputTest, state]() { spRawInputTest->push_state(state); };
+        auto buttons = RemapRawInputTransform::make_button_table();
+        for (auto const & p : rs.buttons)
+          buttons[p.first - 1] = p.second;
+        spRemap->set_buttons(hDevice, buttons);
       }
-      else if (actionName == "pop_state")
-        action = [spRawInputTest]() { spRawInputTest->pop_state(); };
-      else
-        throw std::runtime_error("Invalid action");
+      logging::log(logging::LogSource::init, logging::LogLevel::debug, "remap: "_lit, rs.device, "; keys: "_lit, rs.keys.size(), "; buttons: "_lit, rs.buttons.size());
+    }
+    spState->spRemap = spRemap;
+  }
+  if (spState->spRemap)
+    spState->spTransform->add(spState->spRemap);
 
-      g_keyMap.add(key, ket, action);
+  if (!handlesChanged && settings.motion == prev.motion)
+    spState->spMotion = pPrev->spMotion;
+  else if (!settings.motion.empty())
+  {
+    logging::log(logging::LogSource::init, logging::LogLevel::debug, "Processing \"motion\""_lit);
+    auto const spMotion = std::make_shared<MotionRawInputTransform>();
+    for (auto const & ms : settings.motion)
+    {
+      auto const hDevice = spState->find_handle(ms.device);
+      if (hDevice == NULL)
+      {
+        logging::log(logging::LogSource::init, logging::LogLevel::error, "Device not found, not transforming motion of \""_lit, ms.device, "\""_lit);
+        continue;
+      }
+      auto params = MotionRawInputTransform::make_params(ms.scale, ms.curve);
+      params.swapAxes = ms.swapAxes;
+      params.invertX = ms.invertX;
+      params.invertY = ms.invertY;
+      spMotion->set_params(hDevice, params);
+      logging::log(logging::LogSource::init, logging::LogLevel::debug, "motion: "_lit, ms.device, "; scale: "_lit, ms.scale, "; curve points: "_lit, ms.curve.size(),
+        "; swapAxes: "_lit, ms.swapAxes, "; invertX: "_lit, ms.invertX, "; invertY: "_lit, ms.invertY);
     }
+    spState->spMotion = spMotion;
+  }
+  if (spState->spMotion)
+    spState->spTransform->add(spState->spMotion);
+
+  return spState;
+}
+
+
+/* Created with key map thread; lives for process lifetime. */
+ActionExecutor * g_pActionExecutor = nullptr;
+/* Created on attach and never deleted: on process exit its thread is already gone. */
+Worker * g_pWorker = nullptr;
+
+/* Sets device state for a duration, then restores state it had before. Triggering again while active extends
+   duration instead of stacking. Expiry is a worker task, so raw input filter does not check time. */
+class TimedStateAction : public std::enable_shared_from_this<TimedStateAction>
+{
+public:
+  typedef Worker::clock_t clock_t;
+
+  /* Called from executor thread. */
+  void trigger();
+
+  /* If toggle is true, state is inverted instead of set to given one. */
+  TimedStateAction(Worker & worker, std::shared_ptr<DeviceSet> const & spSet, bool state, bool toggle,
+    clock_t::duration duration);
+
+private:
+  /* Called from worker thread. */
+  clock_t::time_point expire_();
+
+  Worker & worker_;
+  std::shared_ptr<DeviceSet> const spSet_;
+  bool const state_;
+  bool const toggle_;
+  clock_t::duration const duration_;
+  std::mutex mutex_;
+  bool active_;
+  DeviceSet::mask_t prevState_;
+  clock_t::time_point until_;
+};
+
+
+void TimedStateAction::trigger()
+{
+  std::unique_lock<std::mutex> lock (mutex_);
+  until_ = clock_t::now() + duration_;
+  if (active_)
+    return;
+  active_ = true;
+  prevState_ = spSet_->save();
+  if (toggle_)
+    spSet_->toggle();
+  else
+    spSet_->set_state(state_);
+  auto const spThis = shared_from_this();
+  worker_.add("timed action", until_, [spThis](clock_t::time_point) { return spThis->expire_(); });
+}
+
+
+/* Task is not rescheduled on every trigger: on expiry it is rescheduled to extended deadline if any. */
+TimedStateAction::clock_t::time_point TimedStateAction::expire_()
+{
+  std::unique_lock<std::mutex> lock (mutex_);
+  if (clock_t::now() < until_)
+    return until_;
+  spSet_->restore(prevState_);
+  active_ = false;
+  return clock_t::time_point();
+}
+
+
+TimedStateAction::TimedStateAction(Worker & worker, std::shared_ptr<DeviceSet> const & spSet, bool state, bool toggle,
+  clock_t::duration duration)
+  : worker_(worker), spSet_(spSet), state_(state), toggle_(toggle), duration_(duration), mutex_(), active_(false), prevState_(),
+    until_()
+{}
+
+
+std::vector<GKSKeyMap::binding_t> build_bindings(config::Settings const & settings, FilterState const & state)
+{
+  std::vector<GKSKeyMap::binding_t> bindings;
+  if (settings.bindings.empty())
+    return bindings;
 
-    auto const updatePeriod = config::get_d<unsigned int>(g_config, "updatePeriod", 0.1);
-    std::thread t (
-      [&g_keyMap, updatePeriod]() {
-        while (true)
+  logging::log(logging::LogSource::init, logging::LogLevel::debug, "Processing \"bindings\""_lit);
+  for (auto const & binding : settings.bindings)
+  {
+    GKSKeyMap::Trigger trigger;
+    for (auto const & name : binding.keys)
+      trigger.keys.push_back(name2key(name));
+    for (auto const & name : binding.modifiers)
+      trigger.modifiers.push_back(name2key(name));
+    trigger.event = name2ket(binding.event.c_str());
+    trigger.hold = binding.hold;
+    trigger.interval = binding.interval;
+
+    auto const & do_ = binding.do_;
+    if (do_.action == "switch_profile")
+    {
+      auto const spMaskTest = state.spMaskTest;
+      auto const it = state.profiles.find(do_.profile);
+      if (it == state.profiles.end())
+        throw std::runtime_error(stream_to_str("No profile: ", do_.profile));
+      auto const table = it->second;
+      auto const name = do_.profile;
+      bindings.push_back(GKSKeyMap::binding_t(trigger,
+        [spMaskTest, table, name]()
         {
-          g_keyMap.update();
-          std::this_thread::sleep_for(std::chrono::seconds(updatePeriod));
+          auto const start = std::chrono::steady_clock::now();
+          spMaskTest->switch_to(table);
+          auto const elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+          logging::log(logging::LogSource::wrapper, logging::LogLevel::info, "Switched to profile "_lit, name, " in "_lit, elapsed, " us"_lit);
         }
-      }
-    );
-    t.detach();
+      ));
+      continue;
+    }
+
+    auto const & devName = do_.name;
+    /* Device that is not present has no set; error was logged when sets were built. */
+    auto const itSet = state.nameToSet.find(devName);
+    if (itSet == state.nameToSet.end())
+    {
+      logging::log(logging::LogSource::init, logging::LogLevel::error, "Skipping binding of \""_lit, devName, "\""_lit);
+      continue;
+    }
+    auto const spSet = itSet->second;
+    logging::log(logging::LogSource::init, logging::LogLevel::debug, "name: "_lit, devName, "; spSet:"_lit, spSet);
+
+    std::function<void()> action;
+    auto const & actionName = do_.action;
+    if (do_.duration != std::chrono::microseconds::zero())
+    {
+      auto const toggle = actionName == "toggle";
+      auto const state = actionName == "enable" || (actionName == "set_state" && do_.state);
+      auto const spAction = std::make_shared<TimedStateAction>(*g_pWorker, spSet, state, toggle, do_.duration);
+      action = [spAction]() { spAction->trigger(); };
+    }
+    else if (actionName == "enable")
+      action = [spSet]() { spSet->set_state(true); };
+    else if (actionName == "disable")
+      action = [spSet]() { spSet->set_state(false); };
+    else if (actionName == "toggle")
+      action = [spSet]() { spSet->toggle(); };
+    else if (actionName == "set_state")
+    {
+      auto const state = do_.state;
+      action = [spSet, state]() { spSet->set_state(state); };
+    }
+    else if (actionName == "push_state")
+    {
+      auto const state = do_.state;
+      action = [spSet, state]() { spSet->push_state(state); };
+    }
+    else if (actionName == "pop_state")
+      action = [spSet]() { spSet->pop_state(); };
+    else
+      throw std::runtime_error("Invalid action");
+
+    bindings.push_back(GKSKeyMap::binding_t(trigger, action));
   }
+  return bindings;
+}
 
-  auto r = static_cast<RawInputFilter *>(IUser32::get_instance());
-  r->set_test(spCompositeRawInputTest);
 
-  logging::log("wrapper", logging::LogLevel::debug, "init_raw_input_filter() exit");
+/* Key state is sampled with GetAsyncKeyState(), since GetKeyState() and GetKeyboardState() return state of
+   calling thread's message queue, which is never updated on key map thread. */
+bool is_key_down(GKSKeyMap::key_t key)
+{
+  return (GetAsyncKeyState(key) & 0x8000) != 0;
 }
 
-void init_user32()
+
+/* g_spFilterState is only accessed from key map thread after init; g_keyMap may be changed from any thread. */
+GKSKeyMap g_keyMap (is_key_down);
+std::shared_ptr<FilterState> g_spFilterState;
+
+/* Rebuilds only parts of filter that were changed in config; device states are kept. New device tests are published to
+   filter by a single atomic store, so input thread never sees partially built state. */
+void reload_config()
 {
-  logging::log("init", logging::LogLevel::debug, "init_user32()");
+  logging::log(logging::LogSource::init, logging::LogLevel::info, "Reloading config"_lit);
+  config::Settings settings;
+  try {
+    settings = config::parse_settings(config::load("user32.cfg"));
+  } catch (std::exception const & e)
+  {
+    logging::log(logging::LogSource::init, logging::LogLevel::error, "Failed to reload config, keeping current one: "_lit, e.what());
+    return;
+  }
+
+  if (settings.dllPath != g_settings.dllPath || settings.enabled != g_settings.enabled || settings.printDevices != g_settings.printDevices
+    || settings.log.format != g_settings.log.format || settings.log.maxSize != g_settings.log.maxSize || settings.log.maxFiles != g_settings.log.maxFiles)
+    logging::log(logging::LogSource::init, logging::LogLevel::info, "Changes to dll path, enabled, printDevices or log output settings require restart"_lit);
 
-  /* json does not like backslashes in strings, so can use forward slashes in dll path specified in config. */
-  auto dllPath = config::get_escaped_string_d(g_config, "dllPath", "");
-  auto const printDevs = config::get_d<bool>(g_config, "printDevices", true);
+  apply_log_levels(settings.log);
 
-  IUser32::instance_factory_t instanceFactory;
-  auto const isEnabled = config::get_d<bool>(g_config, "enabled", true);
-  if (isEnabled)
+  auto const devicesChanged = settings.devices != g_settings.devices || get_bound_device_names(settings) != get_bound_device_names(g_settings)
+    || settings.groups != g_settings.groups || settings.profiles != g_settings.profiles || settings.blocks != g_settings.blocks || settings.arbitration != g_settings.arbitration
+    || settings.remap != g_settings.remap || settings.motion != g_settings.motion || settings.debounce != g_settings.debounce;
+  auto const bindingsChanged = settings.bindings != g_settings.bindings;
+  try {
+    auto spState = g_spFilterState;
+    if (devicesChanged)
+    {
+      logging::log(logging::LogSource::init, logging::LogLevel::info, "Rebuilding device tests"_lit);
+      spState = build_filter_state(settings, get_raw_input_device_props(), g_spFilterState.get(), &g_settings);
+    }
+    /* Bindings refer to device sets of mask test, so they are rebuilt with it. */
+    auto const setsChanged = spState->spMaskTest != g_spFilterState->spMaskTest;
+    std::vector<GKSKeyMap::binding_t> bindings;
+    if (setsChanged || bindingsChanged)
+    {
+      logging::log(logging::LogSource::init, logging::LogLevel::info, "Rebuilding bindings"_lit);
+      bindings = build_bindings(settings, *spState);
+    }
+    if (devicesChanged)
+    {
+      if (auto pFilter = dynamic_cast<RawInputFilter *>(IUser32::get_instance(true)))
+      {
+        pFilter->set_transform(spState->spTransform->empty() ? nullptr : spState->spTransform);
+        pFilter->set_test(spState->spTest);
+      }
+      g_spFilterState = spState;
+    }
+    if (setsChanged || bindingsChanged)
+      g_keyMap.assign(bindings);
+  } catch (std::exception const & e)
   {
-    logging::log("init", logging::LogLevel::info, "Input filter is enabled");
-    instanceFactory = [dllPath]() -> IUser32::instance_ptr_t { return IUser32::instance_ptr_t(new RawInputFilter(dllPath)); };
+    logging::log(logging::LogSource::init, logging::LogLevel::error, "Failed to apply reloaded config, keeping current one: "_lit, e.what());
+    return;
   }
-  else
+
+  g_settings = settings;
+  logging::log(logging::LogSource::init, logging::LogLevel::info, "Config reloaded"_lit);
+}
+
+
+/* Samples key map on scheduler ticks. Runs on worker thread, which is the only one touching key map
+   runtime state, scheduler and stats. */
+struct KeyMapTask
+{
+  typedef std::chrono::steady_clock clock_t;
+
+  TickScheduler scheduler;
+  TickStats stats;
+  clock_t::time_point prevSampleTime;
+
+  clock_t::time_point run(clock_t::time_point due)
   {
-    logging::log("init", logging::LogLevel::info, "Input filter is disabled");
-    instanceFactory = [dllPath]() -> IUser32::instance_ptr_t { return IUser32::instance_ptr_t(new APIUser32(dllPath)); };
+    auto const sampleTime = clock_t::now();
+    stats.add_tick(sampleTime - due);
+    auto const events = g_keyMap.update();
+    if (events != 0)
+      stats.add_latency(clock_t::now() - prevSampleTime);
+    prevSampleTime = sampleTime;
+    scheduler.set_activity(events != 0 || g_keyMap.has_pending_timers());
+    g_keyMap.collect();
+    return scheduler.next(clock_t::now());
   }
 
-  auto postinitCallback = [printDevs]()
+  KeyMapTask()
+    : scheduler(g_settings.updatePeriod, g_settings.idleUpdatePeriod, g_settings.idleTicks), stats(), prevSampleTime(clock_t::now())
+  {}
+};
+
+std::unique_ptr<KeyMapTask> g_upKeyMapTask;
+
+
+void init_raw_input_filter()
+{
+  logging::log(logging::LogSource::wrapper, logging::LogLevel::debug, "init_raw_input_filter()"_lit);
+
+  g_spFilterState = build_filter_state(g_settings, get_raw_input_device_props());
+
+  /* Key map, config watcher and stats run as tasks of the worker, so that key map is only ever updated by one thread. */
+  auto const runKeyMap = !g_settings.bindings.empty() || g_settings.configReloadPeriod != std::chrono::microseconds::zero();
+  if (runKeyMap)
+    g_pActionExecutor = new ActionExecutor(g_settings.statsPeriod);
+  g_keyMap.set_executor(g_pActionExecutor);
+  g_keyMap.assign(build_bindings(g_settings, *g_spFilterState));
+
+  if (runKeyMap)
   {
-    init_raw_input_filter();
-    if (printDevs)
-      print_raw_input_devices();
-  };
+    typedef Worker::clock_t clock_t;
+    g_upKeyMapTask.reset(new KeyMapTask());
+    g_pWorker->add("keymap", clock_t::now(), [](clock_t::time_point due) { return g_upKeyMapTask->run(due); }, g_settings.updatePeriod);
 
-  /* LoadLibrary() shall not be called from DllMain(): https://learn.microsoft.com/en-us/windows/win32/dlls/dllmain#remarks
-     So main initialization by default is deferred until fist call to the wrapped funcion. */
-  if (config::get_d<bool>(g_config, "deferInit", true))
-    IUser32::set_instance_factory(instanceFactory, postinitCallback);
-  else
+    if (g_settings.configReloadPeriod != std::chrono::microseconds::zero())
+    {
+      auto const spWatcher = std::make_shared<config::FileWatcher>("user32.cfg");
+      g_pWorker->add("config", clock_t::now() + g_settings.configReloadPeriod,
+        [spWatcher](clock_t::time_point) -> clock_t::time_point
+        {
+          if (spWatcher->poll())
+          {
+            reload_config();
+            g_upKeyMapTask->scheduler.configure(g_settings.updatePeriod, g_settings.idleUpdatePeriod, g_settings.idleTicks);
+          }
+          /* Replaced tests could not be released on reload if input thread was inside filter. */
+          if (auto pFilter = dynamic_cast<RawInputFilter *>(IUser32::get_instance(true)))
+            pFilter->collect();
+          auto const reloadPeriod = g_settings.configReloadPeriod;
+          return reloadPeriod == std::chrono::microseconds::zero() ? clock_t::time_point() : clock_t::now() + reloadPeriod;
+        },
+        g_settings.configReloadPeriod
+      );
+    }
+  }
+
+  if (g_settings.statsPeriod != std::chrono::microseconds::zero())
+    g_pWorker->add_periodic("stats", g_settings.statsPeriod,
+      []()
+      {
+        if (g_upKeyMapTask)
+          g_upKeyMapTask->stats.report(g_upKeyMapTask->scheduler.get_period());
+        if (g_spFilterState && g_spFilterState->spDebounce)
+          g_spFilterState->spDebounce->report();
+        g_pWorker->report();
+      }
+    );
+
+  if (auto pFilter = dynamic_cast<RawInputFilter *>(IUser32::get_instance(true)))
   {
-    IUser32::set_instance(instanceFactory());
-    postinitCallback();
+    pFilter->set_transform(g_spFilterState->spTransform->empty() ? nullptr : g_spFilterState->spTransform);
+    pFilter->set_test(g_spFilterState->spTest);
   }
 
-  logging::log("init", logging::LogLevel::debug, "init_user32() exit");
+  logging::log(logging::LogSource::wrapper, logging::LogLevel::debug, "init_raw_input_filter() exit"_lit);
 }
 
+typedef std::chrono::steady_clock init_clock_t;
+init_clock_t::time_point g_initStart;
 
-BOOL WINAPI DllMain(HINSTANCE hInst, DWORD reason,LPVOID v)
-try {
-  if (reason == DLL_PROCESS_ATTACH)
+long long get_init_elapsed_ms()
+{
+  return std::chrono::duration_cast<std::chrono::milliseconds>(init_clock_t::now() - g_initStart).count();
+}
+
+
+/* Config and log are initialized once, by whichever comes first: init worker or exported function that
+   needs user32 instance. The latter may run under loader lock (e.g. from DllMain() of other dll), which
+   worker may need while initializing (e.g. to load dll), so it does not wait: if worker is initializing,
+   false is returned and the call is passed through. Worker waits. If config can not be loaded, filter is
+   disabled and calls are passed through. Returns true if config and log are initialized. */
+bool ensure_config_and_log(bool wait)
+{
+  static std::atomic<bool> done (false);
+  if (done.load(std::memory_order_acquire))
+    return true;
+
+  static std::recursive_mutex mutex;
+  std::unique_lock<std::recursive_mutex> lock (mutex, std::defer_lock);
+  if (wait)
+    lock.lock();
+  else if (!lock.try_lock())
+    return false;
+  if (done.load(std::memory_order_relaxed))
+    return true;
+
+  /* Printing error message to file while log is not initialized. */
+  try {
+    init_config();
+    init_log();
+  } catch (std::exception & e)
   {
-    /* Printing error message to file while log is not initialized. */
-    try {
-      init_config();
-      init_log();
-    } catch (std::exception & e)
+    std::fstream fs("user32.error", std::ios::out|std::ios::trunc);
+    fs << e.what() << std::endl;
+    g_settings = config::Settings();
+    g_settings.enabled = false;
+  }
+  logging::log(logging::LogSource::init, logging::LogLevel::info, "Config and log initialized in "_lit, get_init_elapsed_ms(), " ms since attach"_lit);
+  done.store(true, std::memory_order_release);
+  return true;
+}
+
+
+/* Used by exported functions while worker initializes config or creates instance. Configured dllPath is not
+   known yet, so dll from system directory is used. Callers do not wait for each other: if two create
+   instance at once, one of them is discarded. Never deleted, since it may be in use after main instance is
+   created. */
+IUser32 * get_passthrough_instance()
+{
+  static std::atomic<IUser32 *> pInstance (nullptr);
+  auto p = pInstance.load(std::memory_order_acquire);
+  if (p)
+    return p;
+  std::unique_ptr<IUser32> upInstance (new APIUser32(std::string()));
+  if (!pInstance.compare_exchange_strong(p, upInstance.get(), std::memory_order_acq_rel))
+    return p;
+  logging::log(logging::LogSource::init, logging::LogLevel::info, "Passing calls through until initialization is complete"_lit);
+  return upInstance.release();
+}
+
+
+/* Instance is created by first caller of IUser32::get_instance(): either init worker or exported function. Exported
+   function that comes while worker is at it gets pass-through instance. */
+void init_user32()
+{
+  IUser32::instance_factory_t instanceFactory = []() -> IUser32::instance_ptr_t
+  {
+    if (!ensure_config_and_log(false))
+      return nullptr;
+    logging::log(logging::LogSource::init, logging::LogLevel::debug, "Creating user32 instance"_lit);
+    IUser32::instance_ptr_t upInstance;
+    if (g_settings.enabled)
     {
-      std::fstream fs("user32.error", std::ios::out|std::ios::trunc);
-      fs << e.what() << std::endl;
-      throw;
-    } catch (...)
+      logging::log(logging::LogSource::init, logging::LogLevel::info, "Input filter is enabled"_lit);
+      upInstance.reset(new RawInputFilter(g_settings.dllPath));
+    }
+    else
     {
-      std::fstream fs("user32.error", std::ios::out|std::ios::trunc);
-      fs << "unknown exception";
-      throw;
+      logging::log(logging::LogSource::init, logging::LogLevel::info, "Input filter is disabled"_lit);
+      upInstance.reset(new APIUser32(g_settings.dllPath));
     }
-    logging::log("init", logging::LogLevel::debug, "DllMain()");
+    logging::log(logging::LogSource::init, logging::LogLevel::info, "User32 instance created in "_lit, get_init_elapsed_ms(), " ms since attach"_lit);
+    return upInstance;
+  };
+  IUser32::set_instance_factory(instanceFactory, nullptr, get_passthrough_instance);
+}
+
+
+/* Heavy initialization: runs as first task of the worker, whose thread only starts after DllMain() returns and
+   loader lock is released. Until filter is armed by init_raw_input_filter(), RawInputFilter passes input through. */
+void init_worker()
+try {
+  ensure_config_and_log(true);
+  logging::log(logging::LogSource::init, logging::LogLevel::debug, "init_worker()"_lit);
+  /* Otherwise summary of suppressed repeats of last message is only printed when next message comes. */
+  g_pWorker->add("log", Worker::clock_t::now() + std::chrono::seconds(1),
+    [](Worker::clock_t::time_point) -> Worker::clock_t::time_point
+    {
+      logging::root_logger().flush_repeats();
+      auto const window = g_settings.log.repeatWindow;
+      return Worker::clock_t::now() + (window == std::chrono::milliseconds::zero() ? std::chrono::seconds(1) : window);
+    },
+    std::chrono::seconds(1)
+  );
+  IUser32::get_instance(true);
+  if (g_settings.enabled)
+  {
+    init_raw_input_filter();
+    logging::log(logging::LogSource::init, logging::LogLevel::info, "Input filter armed in "_lit, get_init_elapsed_ms(), " ms since attach"_lit);
+  }
+  if (g_settings.printDevices)
+    print_raw_input_devices();
+  logging::log(logging::LogSource::init, logging::LogLevel::debug, "init_worker() exit"_lit);
+} catch (std::exception const & e)
+{
+  logging::log(logging::LogSource::init, logging::LogLevel::error, "Exception in init_worker(): "_lit, e.what());
+}
+
+
+BOOL WINAPI DllMain(HINSTANCE hInst, DWORD reason,LPVOID v)
+try {
+  /* LoadLibrary() and other heavy stuff shall not be called from DllMain(): https://learn.microsoft.com/en-us/windows/win32/dlls/dllmain#remarks
+     So only trivial work is done here, the rest is done by init_worker() or on first call to the wrapped function. */
+  if (reason == DLL_PROCESS_ATTACH)
+  {
+    g_initStart = init_clock_t::now();
     init_user32();
-    logging::log("init", logging::LogLevel::info, "Dll attached");
+    g_pWorker = new Worker();
+    g_pWorker->add("init", Worker::clock_t::now(),
+      [](Worker::clock_t::time_point) { init_worker(); return Worker::clock_t::time_point(); });
+    g_pWorker->start();
   }
 
   if (reason == DLL_PROCESS_DETACH)
   {
-    logging::log("init", logging::LogLevel::info, "Dll detached");
+    logging::log(logging::LogSource::init, logging::LogLevel::info, "Dll detached"_lit);
+    /* On FreeLibrary() (v is NULL) threads keep running and must be stopped before code is unmapped. On process
+       termination other threads are already terminated. */
+    if (v == NULL)
+    {
+      if (g_pWorker)
+        g_pWorker->stop();
+      if (g_pActionExecutor)
+        g_pActionExecutor->stop();
+      logging::log(logging::LogSource::init, logging::LogLevel::info, "Background threads stopped"_lit);
+    }
+    /* Log printers are still alive here, unlike in static destruction that follows. */
+    logging::root_logger().flush_repeats(true);
   }
 
   return TRUE;
 } catch (std::exception const & e)
 {
-  logging::log("init", logging::LogLevel::error, "Exception in DllMain(): ", e.what());
+  logging::log(logging::LogSource::init, logging::LogLevel::error, "Exception in DllMain(): "_lit, e.what());
   return FALSE;
 }